@@ -179,6 +179,11 @@
     #define DQN_MEMCOPY(dest, src, count) memcpy(dest, src, count)
 #endif
 
+#if !defined(DQN_MEMMOVE)
+    #include <string.h>
+    #define DQN_MEMMOVE(dest, src, count) memmove(dest, src, count)
+#endif
+
 #if !defined(DQN_MEMSET)
     #include <string.h>
     #define DQN_MEMSET(dest, value, count) memset(dest, value, count)
@@ -248,6 +253,13 @@
 #endif
 #define DQN_LOCAL_PERSIST static
 #define DQN_FILE_SCOPE static
+#define DQN_THREAD_LOCAL thread_local
+
+#if defined(DQN_COMPILER_W32_MSVC) || defined(DQN_COMPILER_W32_CLANG)
+    #define DQN_FORCE_INLINE __forceinline
+#else
+    #define DQN_FORCE_INLINE inline __attribute__((always_inline))
+#endif
 
 // -------------------------------------------------------------------------------------------------
 //
@@ -466,7 +478,8 @@ DQN_API void Dqn__ZeroMemBytes(void *ptr, Dqn_usize count, Dqn_ZeroMem zero_mem)
 // NOTE: Intrinsics
 //
 // -------------------------------------------------------------------------------------------------
-// NOTE: Dqn_AtomicAdd/Exchange return the previous value store in the target
+// NOTE: Dqn_AtomicAdd/Exchange return the previous value store in the target. The relaxed load and
+// store are untorn but give no ordering, i.e. for a counter with 1 writer read by other threads.
 #if defined(DQN_COMPILER_W32_MSVC) || defined(DQN_COMPILER_W32_CLANG)
     #include <intrin.h>
     #define Dqn_AtomicAddU32(target, value) _InterlockedExchangeAdd(DQN_CAST(long volatile *)target, value)
@@ -476,6 +489,8 @@ DQN_API void Dqn__ZeroMemBytes(void *ptr, Dqn_usize count, Dqn_ZeroMem zero_mem)
     #define Dqn_AtomicSetPointer(target, value) InterlockedExchangePointer(DQN_CAST(void *volatile *)target, value)
     #define Dqn_AtomicSetValue64(target, value) InterlockedExchange64(DQN_CAST(__int64 volatile *)target, value)
     #define Dqn_AtomicSetValue32(target, value) InterlockedExchange(DQN_CAST(unsigned long volatile *)target, value)
+    #define Dqn_AtomicLoadISizeRelaxed(target) (*DQN_CAST(Dqn_isize volatile *)(target))
+    #define Dqn_AtomicStoreISizeRelaxed(target, value) (*DQN_CAST(Dqn_isize volatile *)(target) = (value))
     #define Dqn_CPUClockCycle() __rdtsc()
     #define Dqn_CompilerReadBarrierAndCPUReadFence _ReadBarrier(); _mm_lfence()
     #define Dqn_CompilerWriteBarrierAndCPUWriteFence _WriteBarrier(); _mm_sfence()
@@ -487,6 +502,8 @@ DQN_API void Dqn__ZeroMemBytes(void *ptr, Dqn_usize count, Dqn_ZeroMem zero_mem)
     #define Dqn_AtomicSubU64(target, value) __atomic_fetch_sub(target, value, __ATOMIC_ACQ_REL)
     #define Dqn_AtomicSetValue64(target, value) __sync_lock_test_and_set(target, value)
     #define Dqn_AtomicSetValue32(target, value) __sync_lock_test_and_set(target, value)
+    #define Dqn_AtomicLoadISizeRelaxed(target) __atomic_load_n(target, __ATOMIC_RELAXED)
+    #define Dqn_AtomicStoreISizeRelaxed(target, value) __atomic_store_n(target, value, __ATOMIC_RELAXED)
     #if defined(DQN_COMPILER_GCC)
         #define Dqn_CPUClockCycle() __rdtsc()
     #else
@@ -498,11 +515,113 @@ DQN_API void Dqn__ZeroMemBytes(void *ptr, Dqn_usize count, Dqn_ZeroMem zero_mem)
     #error "Compiler not supported"
 #endif
 
+#if defined(__ppc64__) || defined(__aarch64__) || defined(_M_X64) || defined(__x86_64__) || defined(__x86_64)
+    #define Dqn_AtomicAddISize(target, value) Dqn_AtomicAddU64(target, value)
+#else
+    #define Dqn_AtomicAddISize(target, value) Dqn_AtomicAddU32(target, value)
+#endif
+
+// NOTE: Define DQN_NO_SSE2 to force the scalar fallback of functions that use SSE2 when available
+#if !defined(DQN_NO_SSE2) && (defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2))
+    #define DQN_SSE2
+    #include <emmintrin.h>
+#endif
+
+// NOTE: Functions marked DQN_AVX2_FUNCTION/DQN_SSE42_FUNCTION are compiled with the instruction set
+// enabled without requiring the rest of the program to be, only call them after checking
+// Dqn_CPU_Features(). Define DQN_NO_AVX2/DQN_NO_SSE42 to compile them out.
+#if !defined(DQN_NO_AVX2) && defined(DQN_SSE2)
+    #define DQN_AVX2
+    #include <immintrin.h>
+    #if defined(DQN_COMPILER_GCC) || defined(DQN_COMPILER_CLANG)
+        #define DQN_AVX2_FUNCTION __attribute__((target("avx2")))
+    #else
+        #define DQN_AVX2_FUNCTION
+    #endif
+#endif
+
+// NOTE: Only for 64 bit targets, the functions using it need the 64 bit CRC32 instruction
+#if !defined(DQN_NO_SSE42) && defined(DQN_SSE2) && (defined(_M_X64) || defined(__x86_64__))
+    #define DQN_SSE42
+    #include <nmmintrin.h>
+    #if defined(DQN_COMPILER_GCC) || defined(DQN_COMPILER_CLANG)
+        #define DQN_SSE42_FUNCTION __attribute__((target("sse4.2")))
+    #else
+        #define DQN_SSE42_FUNCTION
+    #endif
+#endif
+
+// NOTE: Start loading the cache line holding 'address' into every cache level without waiting for it
+#if defined(DQN_SSE2)
+    #define DQN_PREFETCH(address) _mm_prefetch(DQN_CAST(char const *)(address), _MM_HINT_T0)
+#elif defined(DQN_COMPILER_GCC) || defined(DQN_COMPILER_CLANG)
+    #define DQN_PREFETCH(address) __builtin_prefetch(address)
+#else
+    #define DQN_PREFETCH(address)
+#endif
+
+// NOTE: Index of the lowest set bit in value, value must not be 0
+DQN_FORCE_INLINE Dqn_u32 Dqn_CountTrailingZerosU32(Dqn_u32 value)
+{
+#if defined(DQN_COMPILER_W32_MSVC) || defined(DQN_COMPILER_W32_CLANG)
+    unsigned long result = 0;
+    _BitScanForward(&result, value);
+#else
+    unsigned int result = __builtin_ctz(value);
+#endif
+    return DQN_CAST(Dqn_u32)result;
+}
+
+DQN_FORCE_INLINE Dqn_u32 Dqn_CountTrailingZerosU64(Dqn_u64 value)
+{
+#if defined(DQN_COMPILER_W32_MSVC) || defined(DQN_COMPILER_W32_CLANG)
+    #if defined(_M_X64) || defined(_M_ARM64)
+    unsigned long result = 0;
+    _BitScanForward64(&result, value);
+    #else
+    Dqn_u32 low    = DQN_CAST(Dqn_u32)value;
+    Dqn_u32 result = low ? Dqn_CountTrailingZerosU32(low) : 32 + Dqn_CountTrailingZerosU32(DQN_CAST(Dqn_u32)(value >> 32));
+    #endif
+#else
+    unsigned int result = __builtin_ctzll(value);
+#endif
+    return DQN_CAST(Dqn_u32)result;
+}
+
+// NOTE: Number of zero bits above the highest set bit in value, value must not be 0
+DQN_FORCE_INLINE Dqn_u32 Dqn_CountLeadingZerosU64(Dqn_u64 value)
+{
+#if defined(DQN_COMPILER_W32_MSVC) || defined(DQN_COMPILER_W32_CLANG)
+    #if defined(_M_X64) || defined(_M_ARM64)
+    unsigned long index = 0;
+    _BitScanReverse64(&index, value);
+    #else
+    unsigned long index = 0;
+    Dqn_u32       high  = DQN_CAST(Dqn_u32)(value >> 32);
+    if (high) { _BitScanReverse(&index, high); index += 32; }
+    else      { _BitScanReverse(&index, DQN_CAST(Dqn_u32)value); }
+    #endif
+    Dqn_u32 result = 63 - DQN_CAST(Dqn_u32)index;
+#else
+    Dqn_u32 result = DQN_CAST(Dqn_u32)__builtin_clzll(value);
+#endif
+    return result;
+}
+
 struct Dqn_CPUIDRegisters
 {
     unsigned int array[4]; // eax, ebx, ecx, edx
 };
 
+// NOTE: Instruction sets usable on this machine, i.e. supported by the CPU and, for AVX, the OS saves
+// the wider registers on a context switch.
+struct Dqn_CPUFeatures
+{
+    Dqn_b32 sse2;
+    Dqn_b32 sse42;
+    Dqn_b32 avx2;
+};
+
 struct Dqn_TicketMutex
 {
     unsigned int volatile ticket;  // The next ticket ID to give out to the thread taking the mutex
@@ -510,7 +629,8 @@ struct Dqn_TicketMutex
 };
 
 // Query the CPU's CPUID function and return the data in the registers
-Dqn_CPUIDRegisters Dqn_CPUID                 (int function_id);
+Dqn_CPUIDRegisters Dqn_CPUID                 (int function_id, int sub_function_id = 0);
+DQN_API Dqn_CPUFeatures Dqn_CPU_Features     (); // Queried once and cached in dqn__lib
 void               Dqn_TicketMutex_Begin     (Dqn_TicketMutex *mutex);
 void               Dqn_TicketMutex_End       (Dqn_TicketMutex *mutex);
 
@@ -788,6 +908,9 @@ struct Dqn_Lib
 {
     Dqn_LogProc *LogCallback = Dqn_Log;
     void *       log_user_data;
+    Dqn_isize    os_page_size; // Lazily queried by Dqn_VirtualMem_PageSize()
+    Dqn_b32         cpu_features_queried;
+    Dqn_CPUFeatures cpu_features; // Lazily queried by Dqn_CPU_Features()
 #if defined(DQN_OS_WIN32)
     LARGE_INTEGER win32_qpc_frequency;
 #endif
@@ -836,34 +959,103 @@ DQN_API char               *Dqn_PointerMetadata_GetRawPointer(void *ptr);
 // NOTE: Dqn_Map
 //
 // -------------------------------------------------------------------------------------------------
+// An open addressing hash table over a fixed block of memory. Keys are stored alongside their values
+// and collisions are resolved by linear probing from the slot the hashed key maps to. Erasing shifts
+// the following entries of the probe sequence back so no tombstones are left behind and lookups
+// never degrade after many add/erase cycles. The map never grows, FindOrMake/Add return nullptr
+// and false respectively once every slot is occupied.
 using Dqn_MapUsageBitset = Dqn_usize;
+Dqn_isize constexpr DQN_MAP_GET_BATCH_SIZE = 16;
 
 template <typename T>
 struct Dqn_Map
 {
     Dqn_isize           count;              // Count of actual 'values' stored in the map so far.
     Dqn_isize           size;               // Total 'values' the map can store
+    Dqn_u64            *keys;               // The key stored in each occupied slot of 'values'
     T                  *values;             // Storage of the 'values' a key maps to
     Dqn_MapUsageBitset *usage_bitsets;      // Array of numbers where each bit represents if the map slot in 'data' is occupied or not.
     Dqn_isize           usage_bitsets_size; // The number of usage bitsets
 };
 
-// Internal structure for finding a key in the Map
-struct Dqn__MapKeyLookup
+struct Dqn_MapStats
 {
-    Dqn_isize index;        // Index into the 'values' array containing the value for the 'key'
-    Dqn_isize bitset_index; // Index into the 'usage_bitset' array for the usage of the
-    Dqn_usize bit_index;    // The N'th bit in the 'usage_bitset'
-    Dqn_usize bitset_bit;   // The N'th bit, bit-shifted into bitset position
+    Dqn_f64   load_factor;          // count / size
+    Dqn_f64   average_probe_length; // Average number of slots inspected to find a stored key
+    Dqn_isize max_probe_length;     // Worst case number of slots inspected to find a stored key
+    Dqn_isize resize_count;         // Number of times the map grew, always 0 for fixed memory maps
 };
 
+// mem: Must be aligned to at least 8 bytes and alignof(T).
 template <typename T> Dqn_isize          Dqn_Map_MemoryRequired(Dqn_isize num_values);
 template <typename T> Dqn_Map<T>         Dqn_Map_InitWithMemory(void *mem, Dqn_isize mem_size);
-template <typename T> Dqn__MapKeyLookup  Dqn_Map__GetKeyLookup (Dqn_Map<T> const *map, Dqn_u64 key);
 template <typename T> T                 *Dqn_Map_FindOrMake    (Dqn_Map<T> *map, Dqn_u64 key, Dqn_b32 *found = nullptr);
 template <typename T> Dqn_b32            Dqn_Map_Add           (Dqn_Map<T> *map, Dqn_u64 key, T const &value);
 template <typename T> T                 *Dqn_Map_Get           (Dqn_Map<T> *map, Dqn_u64 key);
+
+// Look up 'count' keys at once, writing the value of each key (or nullptr) to 'results'. Keys are
+// hashed and their slots prefetched DQN_MAP_GET_BATCH_SIZE at a time before any are probed, so the
+// cache misses of a batch overlap instead of stalling one after another on tables that do not fit in
+// cache. Returns the number of keys found.
+template <typename T> Dqn_isize          Dqn_Map_GetBatch      (Dqn_Map<T> *map, Dqn_u64 const *keys, Dqn_isize count, T **results);
 template <typename T> Dqn_b32            Dqn_Map_Erase         (Dqn_Map<T> *map, Dqn_u64 key);
+template <typename T> Dqn_MapStats       Dqn_Map_GetStats      (Dqn_Map<T> const *map);
+
+// -------------------------------------------------------------------------------------------------
+//
+// NOTE: Dqn_FlatMap
+//
+// -------------------------------------------------------------------------------------------------
+// A fixed memory hash map for large tables that keeps a 1 byte control word per slot in its own array.
+// The control word holds 7 bits of the key's hash, lookups compare a group of 16 control words at
+// once (with SSE2 when DQN_SSE2 is defined) and only visit the key/value slots whose hash bits match,
+// so most probes stay inside one cache line of the control array. Slots are probed in groups with
+// triangular probing and erased slots become tombstones that later inserts reuse. Tombstones don't
+// end a probe so when too many build up Dqn_Map_FindOrMake rehashes the map in place to drop them.
+//
+// Keys must be integers or pointers (they are cast to a Dqn_u64 for hashing) and are compared with
+// '=='. The Dqn_Map_FindOrMake/Add/Get/Erase/GetStats functions are overloaded for Dqn_FlatMap.
+Dqn_isize constexpr DQN_FLAT_MAP_GROUP_SIZE    = 16;
+Dqn_u8    constexpr DQN_FLAT_MAP_CTRL_EMPTY    = 0x80;
+Dqn_u8    constexpr DQN_FLAT_MAP_CTRL_DELETED  = 0xFE;
+
+template <typename K, typename V>
+struct Dqn_FlatMapSlot
+{
+    K key;
+    V value;
+};
+
+template <typename K, typename V>
+struct Dqn_FlatMap
+{
+    using Key   = K;
+    using Value = V;
+
+    Dqn_isize               count;      // Count of actual 'values' stored in the map so far.
+    Dqn_isize               size;       // Total slots in the map, a power of 2 multiple of DQN_FLAT_MAP_GROUP_SIZE
+    Dqn_isize               tombstones; // Slots erased that are still part of a probe sequence
+    Dqn_u8                 *ctrl;       // Control word per slot, EMPTY, DELETED or the low 7 bits of the key's hash
+    Dqn_FlatMapSlot<K, V>  *slots;      // The key and value stored in each slot
+};
+
+// num_values: Rounded up to a power of 2 multiple of DQN_FLAT_MAP_GROUP_SIZE
+// mem: Must be aligned to alignof(Dqn_FlatMapSlot<K, V>), the map uses the largest power of 2 slot
+// count that fits in mem_size.
+template <typename K, typename V> Dqn_isize          Dqn_FlatMap_MemoryRequired(Dqn_isize num_values);
+template <typename K, typename V> Dqn_FlatMap<K, V>  Dqn_FlatMap_InitWithMemory(void *mem, Dqn_isize mem_size);
+template <typename K, typename V> V                 *Dqn_Map_FindOrMake        (Dqn_FlatMap<K, V> *map, typename Dqn_FlatMap<K, V>::Key key, Dqn_b32 *found = nullptr);
+template <typename K, typename V> Dqn_b32            Dqn_Map_Add               (Dqn_FlatMap<K, V> *map, typename Dqn_FlatMap<K, V>::Key key, typename Dqn_FlatMap<K, V>::Value const &value);
+template <typename K, typename V> V                 *Dqn_Map_Get               (Dqn_FlatMap<K, V> *map, typename Dqn_FlatMap<K, V>::Key key);
+template <typename K, typename V> Dqn_b32            Dqn_Map_Erase             (Dqn_FlatMap<K, V> *map, typename Dqn_FlatMap<K, V>::Key key);
+
+// Move every value to the first free slot of its probe sequence and turn all tombstones back into
+// empty slots. Called by Dqn_Map_FindOrMake before an insert when the tombstones exceed 1/8 of the
+// slots, or outnumber the empty slots once there are at least 1/32 of the slots.
+template <typename K, typename V> void               Dqn_FlatMap_Rehash        (Dqn_FlatMap<K, V> *map);
+
+// Probe lengths are measured in groups of DQN_FLAT_MAP_GROUP_SIZE slots
+template <typename K, typename V> Dqn_MapStats       Dqn_Map_GetStats          (Dqn_FlatMap<K, V> const *map);
 
 // -------------------------------------------------------------------------------------------------
 //
@@ -973,6 +1165,9 @@ enum struct Dqn_AllocatorType
 
     XHeap,  // Malloc free, crash on failure
     Arena,
+    Pool,   // Fixed size slots, allocations must fit in the pool's slot size and alignment
+    Slab,   // Power of 2 size classes carved from virtual memory, see Dqn_SlabAllocator
+    ThreadCache, // Thread safe, per-thread caches in front of another allocator, see Dqn_ThreadCacheAllocator
     Custom,
 };
 
@@ -1009,8 +1204,13 @@ struct Dqn_Allocator
     {
         void                       *user;
         struct Dqn_ArenaAllocator  *arena;
+        struct Dqn_PoolAllocator   *pool;
+        struct Dqn_SlabAllocator   *slab;
+        struct Dqn_ThreadCacheAllocator *thread_cache;
     } context;
 
+    // NOTE: Not updated for Dqn_AllocatorType::ThreadCache as the allocator is shared between
+    // threads, use Dqn_ThreadCacheAllocator_GetStats instead.
     Dqn_AllocationTracer *tracer;
     Dqn_isize             bytes_allocated;
     Dqn_isize             allocations;
@@ -1029,6 +1229,9 @@ DQN_API Dqn_Allocator Dqn_Allocator_InitWithNull  ();
 DQN_API Dqn_Allocator Dqn_Allocator_InitWithHeap  ();
 DQN_API Dqn_Allocator Dqn_Allocator_InitWithXHeap ();
 DQN_API Dqn_Allocator Dqn_Allocator_InitWithArena (Dqn_ArenaAllocator *arena);
+DQN_API Dqn_Allocator Dqn_Allocator_InitWithPool  (Dqn_PoolAllocator *pool);
+DQN_API Dqn_Allocator Dqn_Allocator_InitWithSlab  (Dqn_SlabAllocator *slab);
+DQN_API Dqn_Allocator Dqn_Allocator_InitWithThreadCache(Dqn_ThreadCacheAllocator *thread_cache);
 DQN_API Dqn_Allocator Dqn_Allocator_InitWithProcs (Dqn_Allocator_CustomAllocateProc *allocate_proc, Dqn_Allocator_CustomFreeProc *free_proc);
 DQN_API void          Dqn_Allocator_Free          (Dqn_Allocator *allocator, void *ptr);
 
@@ -1051,6 +1254,94 @@ DQN_API void          Dqn_Allocator_Free          (Dqn_Allocator *allocator, voi
 // Internal API. Avoid using, and prefer the macros above.
 DQN_API void         *Dqn_Allocator__Allocate     (Dqn_Allocator *allocator, Dqn_isize size, Dqn_u8 alignment, Dqn_ZeroMem zero_mem DQN_CALL_SITE_ARGS);
 
+// -------------------------------------------------------------------------------------------------
+//
+// NOTE: Dqn_GrowableMap
+//
+// -------------------------------------------------------------------------------------------------
+// A Dqn_Map that allocates its table from an allocator and doubles in size once it is 3/4 full.
+// Growing does not rehash the whole table at once, the old table is kept alongside the new one and
+// every insert migrates the next 'rehash_step' slots of the old table. Lookups and erases check both
+// tables until the migration finishes and the old table is freed, so no single insert pays for
+// rehashing every entry. Pointers returned by the map are invalidated by the next insert.
+//
+// The Dqn_Map_FindOrMake/Add/Get/Erase/GetStats functions are overloaded for Dqn_GrowableMap. A zero
+// initialised map with an 'allocator' assigned is valid and allocates on the first insert.
+Dqn_isize constexpr DQN_GROWABLE_MAP_MIN_SIZE    = 16;
+Dqn_isize constexpr DQN_GROWABLE_MAP_REHASH_STEP = 16;
+
+template <typename T>
+struct Dqn_GrowableMap
+{
+    Dqn_Allocator allocator;
+    Dqn_Map<T>    map;           // The table new keys are added to
+    Dqn_Map<T>    old_map;       // The table being migrated into 'map', its size is 0 when no migration is in progress
+    Dqn_isize     rehash_cursor; // The next slot of 'old_map' to migrate
+    Dqn_isize     rehash_step;   // Slots of 'old_map' migrated per insert, DQN_GROWABLE_MAP_REHASH_STEP if 0
+    Dqn_isize     resize_count;  // Number of times the map has grown
+};
+
+template <typename T> Dqn_GrowableMap<T>  Dqn_GrowableMap_InitWithAllocator(Dqn_Allocator allocator, Dqn_isize initial_size = 0);
+template <typename T> void                Dqn_GrowableMap_Free             (Dqn_GrowableMap<T> *map);
+template <typename T> T                  *Dqn_Map_FindOrMake               (Dqn_GrowableMap<T> *map, Dqn_u64 key, Dqn_b32 *found = nullptr);
+template <typename T> Dqn_b32             Dqn_Map_Add                      (Dqn_GrowableMap<T> *map, Dqn_u64 key, T const &value);
+template <typename T> T                  *Dqn_Map_Get                      (Dqn_GrowableMap<T> *map, Dqn_u64 key);
+template <typename T> Dqn_b32             Dqn_Map_Erase                    (Dqn_GrowableMap<T> *map, Dqn_u64 key);
+template <typename T> Dqn_MapStats        Dqn_Map_GetStats                 (Dqn_GrowableMap<T> const *map);
+
+// -------------------------------------------------------------------------------------------------
+//
+// NOTE: Dqn_ConcurrentMap
+//
+// -------------------------------------------------------------------------------------------------
+// A map that many threads can add to and look up at once. Keys are spread across 'shard_count'
+// Dqn_GrowableMap shards by the high bits of their hash and each shard has its own mutex, so threads
+// only wait on each other when they touch the same shard instead of serialising on one mutex around
+// the whole map. Shards are padded to whole cache lines so locking one shard does not contend with
+// its neighbours.
+//
+// Values are copied in and out under the shard's mutex as a pointer into a shard is invalidated by
+// another thread's insert. Each shard grows with its own copy of 'allocator' which must be safe to
+// allocate from on multiple threads, e.g. the heap or a Dqn_ThreadCacheAllocator.
+Dqn_isize constexpr DQN_CONCURRENT_MAP_DEFAULT_SHARD_COUNT = 64;
+Dqn_isize constexpr DQN_CONCURRENT_MAP_CACHE_LINE_SIZE     = 64;
+
+template <typename T>
+struct Dqn_ConcurrentMapShard
+{
+    Dqn_TicketMutex    mutex;
+    Dqn_GrowableMap<T> map;
+    char               padding[DQN_CONCURRENT_MAP_CACHE_LINE_SIZE - ((sizeof(Dqn_TicketMutex) + sizeof(Dqn_GrowableMap<T>)) % DQN_CONCURRENT_MAP_CACHE_LINE_SIZE)];
+};
+
+template <typename T>
+struct Dqn_ConcurrentMap
+{
+    Dqn_Allocator              allocator;
+    Dqn_ConcurrentMapShard<T> *shards;
+    Dqn_isize                  shard_count; // Power of 2
+    Dqn_u32                    shard_shift; // Shift applied to a key's hash to get its shard
+};
+
+// shard_count: Rounded up to a power of 2, more shards than threads that use the map keeps contention low
+// return: False if the shards could not be allocated, the map is left empty and every operation on
+// it fails until it is initialised again.
+template <typename T> Dqn_b32              Dqn_ConcurrentMap_InitWithAllocator(Dqn_ConcurrentMap<T> *map, Dqn_Allocator allocator, Dqn_isize shard_count = DQN_CONCURRENT_MAP_DEFAULT_SHARD_COUNT);
+template <typename T> void                 Dqn_ConcurrentMap_Free             (Dqn_ConcurrentMap<T> *map);
+
+// Return true if 'key' was not in the map and 'value' was added, false if the key exists or memory ran out
+template <typename T> Dqn_b32              Dqn_ConcurrentMap_Add              (Dqn_ConcurrentMap<T> *map, Dqn_u64 key, T const &value);
+
+// Add 'key' or overwrite its value if it exists, return false if memory ran out
+template <typename T> Dqn_b32              Dqn_ConcurrentMap_Set              (Dqn_ConcurrentMap<T> *map, Dqn_u64 key, T const &value);
+
+// Copy the value of 'key' to 'value' (if not null) and return true if the key is in the map
+template <typename T> Dqn_b32              Dqn_ConcurrentMap_Get              (Dqn_ConcurrentMap<T> *map, Dqn_u64 key, T *value);
+template <typename T> Dqn_b32              Dqn_ConcurrentMap_Erase            (Dqn_ConcurrentMap<T> *map, Dqn_u64 key);
+
+// Shards are counted one at a time so the result is only exact when no other thread is modifying the map
+template <typename T> Dqn_isize            Dqn_ConcurrentMap_Count            (Dqn_ConcurrentMap<T> *map);
+
 // -------------------------------------------------------------------------------------------------
 //
 // NOTE: Dqn_Slices
@@ -1154,8 +1445,68 @@ DQN_API Dqn_b32    Dqn_String_AppendFmt             (Dqn_String *str, char const
 // allocator: The same allocator specified when `Dqn_String_Copy` was called.
 DQN_API void                  Dqn_String_Free      (Dqn_String *string, Dqn_Allocator *allocator);
 DQN_API Dqn_b32               Dqn_String_StartsWith(Dqn_String string, Dqn_String prefix);
+// Split 'src' into lines on '\r' and '\n', empty lines are skipped.
+// return: The lines, pointing into 'src', in a slice allocated from 'allocator'
 DQN_API Dqn_Slice<Dqn_String> Dqn_String_Split     (Dqn_String src, Dqn_Allocator *allocator);
 
+// Split 'src' on any of the bytes in 'delimiters' in a single pass, appending the non-empty pieces
+// to 'splits' as they're found. Pieces point into 'src' which is read up to 'src.size' and does not
+// have to be null-terminated.
+// return: The number of pieces appended, less than the number of pieces if the list failed to allocate
+template <typename T> struct Dqn_List;
+DQN_API Dqn_isize Dqn_String_SplitToList(Dqn_String src, Dqn_String delimiters, Dqn_List<Dqn_String> *splits);
+
+// -------------------------------------------------------------------------------------------------
+//
+// NOTE: Dqn_StringTokenizer
+//
+// -------------------------------------------------------------------------------------------------
+// Yields the pieces of a string between delimiters one at a time, pointing into the string. Nothing
+// is allocated and the string is only read up to the last token asked for so callers can stop early.
+// Empty pieces are skipped, i.e. runs of delimiters separate 2 tokens like a single one.
+/*
+   for (Dqn_StringTokenizer it = Dqn_StringTokenizer_InitLines(file); Dqn_StringTokenizer_Next(&it);)
+   {
+       Dqn_String line = it.token;
+       if (Dqn_String_StartsWith(line, DQN_STRING("#")))
+           break;
+   }
+*/
+
+// (Internal): The delimiters as a byte lookup, the first 4 bytes for SSE2 compares and as nibble
+// tables for AVX2. Bit (high nibble & 7) of 'low_nibble_bits[high nibble >= 8][low nibble]' is set
+// for each delimiter so any set of bytes is tested with 2 shuffles per register.
+struct Dqn_String__SplitSet
+{
+    Dqn_u8    is_delimiter[256];
+    char      first_four[4]; // Padded with repeats of the first delimiter
+    Dqn_isize count;         // Number of distinct delimiters
+    Dqn_u8    low_nibble_bits[2][16];
+};
+
+struct Dqn_StringTokenizer
+{
+    Dqn_String           src;
+    Dqn_isize            pos;   // Where the search for the next token starts
+    Dqn_String           token; // The token found by the last call to Dqn_StringTokenizer_Next
+    Dqn_String__SplitSet set;   // (Internal)
+};
+
+// Tokenize on '\r' and '\n', i.e. the lines of 'src' as Dqn_String_Split would produce them
+DQN_API Dqn_StringTokenizer Dqn_StringTokenizer_InitLines         (Dqn_String src);
+
+// Tokenize on the characters Dqn_Char_IsWhitespace is true for
+DQN_API Dqn_StringTokenizer Dqn_StringTokenizer_InitWords         (Dqn_String src);
+DQN_API Dqn_StringTokenizer Dqn_StringTokenizer_InitWithDelimiters(Dqn_String src, Dqn_String delimiters);
+
+// Find the next token and store it in 'tokenizer->token'
+// return: False when there are no tokens left
+DQN_API Dqn_b32             Dqn_StringTokenizer_Next              (Dqn_StringTokenizer *tokenizer);
+
+// return: The part of 'src' that has not been tokenized yet, starting with the delimiter after the
+// last token
+DQN_API Dqn_String          Dqn_StringTokenizer_Rest              (Dqn_StringTokenizer const *tokenizer);
+
 
 // -------------------------------------------------------------------------------------------------
 //
@@ -1417,36 +1768,76 @@ DQN_API Dqn_f32 Dqn_LerpF32(Dqn_f32 a, Dqn_f32 t, Dqn_f32 b);
 // NOTE: Dqn_StringMap
 //
 // -------------------------------------------------------------------------------------------------
+// An open addressing hash map from strings to pointers. Entries live in a single flat array with
+// the key's hash stored beside the key so probing compares hashes and only compares the strings of
+// entries whose hash matches. The table is a power of 2 size and doubles once it is 3/4 full, entry
+// pointers returned by the map are invalidated by the next Add. Keys are not copied, their memory
+// must outlive the map. Growing frees the old table through the allocator which is a no-op for
+// arenas, the old tables stay in the arena until it is freed.
 template <typename T>
 struct Dqn_StringMapEntry
 {
-    Dqn_String          key;
-    T                  *value;
-    Dqn_StringMapEntry *next;
+    Dqn_u64    hash; // 0 if the slot is empty
+    Dqn_String key;
+    T         *value;
 };
 
 template <typename T>
 struct Dqn_StringMap
 {
-    Dqn_Allocator           backup_allocator;
-    Dqn_u32                 hashing_seed;
-    Dqn_Allocator          *allocator;
-    Dqn_StringMapEntry<T> **values;
-    Dqn_isize               size;
+    Dqn_Allocator          backup_allocator;
+    Dqn_u32                hashing_seed;
+    Dqn_Allocator         *allocator;
+    Dqn_StringMapEntry<T> *values;
+    Dqn_isize              size;  // Number of slots in 'values', a power of 2
+    Dqn_isize              count; // Number of slots in 'values' in use
 };
 
 enum struct Dqn_StringMapCollisionRule
 {
-    Stop,
-    Chain,
+    Stop,              // Keep the existing value if the key is already in the map
+    Overwrite,         // Replace the value if the key is already in the map
+    Chain = Overwrite, // DEPRECATED: Use Overwrite, the name from when colliding entries were chained
 };
 
+// size: The number of entries to reserve space for, rounded up to a power of 2. Defaults to 4096.
 template <typename T> void                   Dqn_StringMap__InitializeSize(Dqn_StringMap<T> *map, Dqn_isize size = 0);
 template <typename T> Dqn_StringMap<T>       Dqn_StringMap_InitWithArena  (Dqn_ArenaAllocator *arena, Dqn_isize size = 0, Dqn_u32 hashing_seed = 0);
+template <typename T> void                   Dqn_StringMap_Free           (Dqn_StringMap<T> *map);
 template <typename T> Dqn_u64                Dqn_StringMap_Hash           (Dqn_StringMap<T> *map, Dqn_String key);
 template <typename T> Dqn_StringMapEntry<T> *Dqn_StringMap_Add            (Dqn_StringMap<T> *map, Dqn_String key, T *value, Dqn_StringMapCollisionRule rule);
 template <typename T> Dqn_StringMapEntry<T> *Dqn_StringMap_Get            (Dqn_StringMap<T> *map, Dqn_String key);
 
+// Look up 'count' keys at once, writing the entry of each key (or nullptr) to 'results'. Like
+// Dqn_Map_GetBatch, DQN_MAP_GET_BATCH_SIZE keys are hashed and their slots prefetched before any are
+// probed, then the characters of each stored key whose hash matches are prefetched before the
+// string compares. Returns the number of keys found.
+template <typename T> Dqn_isize              Dqn_StringMap_GetBatch       (Dqn_StringMap<T> *map, Dqn_String const *keys, Dqn_isize count, Dqn_StringMapEntry<T> **results);
+
+// -------------------------------------------------------------------------------------------------
+//
+// NOTE: Dqn_VirtualMem
+//
+// -------------------------------------------------------------------------------------------------
+// Thin wrapper over the OS virtual memory API, VirtualAlloc/VirtualFree on Win32 and
+// mmap/mprotect/madvise/munmap otherwise. Reserved memory is inaccessible until it is committed.
+// Pointers and sizes passed to Commit/Decommit should be page aligned.
+
+// return: The size of a page on this machine, queried once and cached in 'dqn__lib'.
+DQN_API Dqn_isize Dqn_VirtualMem_PageSize();
+
+// return: nullptr if the address space could not be reserved.
+DQN_API void     *Dqn_VirtualMem_Reserve (Dqn_isize size);
+DQN_API Dqn_b32   Dqn_VirtualMem_Commit  (void *ptr, Dqn_isize size);
+
+// Return the physical pages backing the range to the OS. The address space stays reserved and can be
+// committed again, in which case the memory reads back as zero.
+DQN_API void      Dqn_VirtualMem_Decommit(void *ptr, Dqn_isize size);
+
+// ptr: The pointer returned from 'Dqn_VirtualMem_Reserve'
+// size: The size that was passed into 'Dqn_VirtualMem_Reserve'
+DQN_API void      Dqn_VirtualMem_Release (void *ptr, Dqn_isize size);
+
 // -------------------------------------------------------------------------------------------------
 //
 // NOTE: Dqn_ArenaAllocator
@@ -1462,7 +1853,8 @@ struct Dqn_ArenaAllocatorBlock
     Dqn_ArenaAllocatorBlock *next;
 };
 
-Dqn_usize const DQN_MEM_ARENA_DEFAULT_MIN_BLOCK_SIZE = DQN_KILOBYTES(4);
+Dqn_usize const DQN_MEM_ARENA_DEFAULT_MIN_BLOCK_SIZE     = DQN_KILOBYTES(4);
+Dqn_usize const DQN_MEM_ARENA_DEFAULT_COMMIT_GRANULARITY = DQN_KILOBYTES(64);
 struct Dqn_ArenaAllocator
 {
     // NOTE: Manual Configuration
@@ -1479,6 +1871,14 @@ struct Dqn_ArenaAllocator
     int                      total_allocated_mem_blocks;
     Dqn_isize                usage_before_last_reset;
     Dqn_isize                wastage_before_last_reset;
+
+    // NOTE: Virtual Memory (Read Only)
+    // Only set for arenas created with Dqn_ArenaAllocator_InitWithVirtualMemory. The arena owns a
+    // single block at the start of the reserved range whose 'size' is the committed range. The
+    // block is grown in place in 'commit_granularity' steps up to 'reserve_size' instead of
+    // chaining new blocks, so allocations stay contiguous.
+    Dqn_isize                reserve_size;
+    Dqn_isize                commit_granularity;
 };
 
 struct Dqn_ArenaAllocatorRegion
@@ -1507,6 +1907,14 @@ struct Dqn_ArenaAllocatorStats
 DQN_API Dqn_ArenaAllocator             Dqn_ArenaAllocator_InitWithNewAllocator(Dqn_Allocator allocator, Dqn_isize size, Dqn_AllocationTracer *tracer DQN_CALL_SITE_ARGS);
 DQN_API Dqn_ArenaAllocator             Dqn_ArenaAllocator_InitWithAllocator   (Dqn_Allocator *allocator, Dqn_isize size, Dqn_AllocationTracer *tracer DQN_CALL_SITE_ARGS);
 DQN_API Dqn_ArenaAllocator             Dqn_ArenaAllocator_InitWithMemory      (void *memory, Dqn_isize size, Dqn_AllocationTracer *tracer = nullptr);
+
+// Reserve a contiguous range of address space and commit it on demand as the arena grows.
+// Resetting the arena decommits everything but the first 'commit_granularity' bytes and freeing the
+// arena releases the reservation. Allocations that exceed the reservation fail and return nullptr.
+// reserve_size: The maximum size the arena can grow to, rounded up to the page size.
+// commit_granularity: (Optional) The minimum amount of memory to commit each time the arena grows,
+//                     rounded up to the page size. When 0, DQN_MEM_ARENA_DEFAULT_COMMIT_GRANULARITY is used.
+DQN_API Dqn_ArenaAllocator             Dqn_ArenaAllocator_InitWithVirtualMemory(Dqn_isize reserve_size, Dqn_isize commit_granularity = 0, Dqn_AllocationTracer *tracer = nullptr);
 DQN_API void                           Dqn_ArenaAllocator_Free                (Dqn_ArenaAllocator *arena);
 DQN_API Dqn_b32                        Dqn_ArenaAllocator_Reserve             (Dqn_ArenaAllocator *arena, Dqn_isize size DQN_CALL_SITE_ARGS);
 DQN_API void                           Dqn_ArenaAllocator_ResetUsage          (Dqn_ArenaAllocator *arena, Dqn_ZeroMem zero_mem);
@@ -1523,11 +1931,343 @@ DQN_API Dqn_ArenaAllocatorScopedRegion Dqn_ArenaAllocator_MakeScopedRegion    (D
 #define                                Dqn_ArenaAllocator_TaggedNewArray(      arena, Type, count, zero_mem, tag)     (Type *)Dqn_ArenaAllocator__Allocate(arena, sizeof(Type) * count, alignof(Type), zero_mem DQN_CALL_SITE(tag))
 #define                                Dqn_ArenaAllocator_NewArray(            arena, Type, count, zero_mem)          (Type *)Dqn_ArenaAllocator__Allocate(arena, sizeof(Type) * count, alignof(Type), zero_mem DQN_CALL_SITE(""))
 
-DQN_API void                          *Dqn_ArenaAllocator__Allocate           (Dqn_ArenaAllocator *arena, Dqn_isize size, Dqn_u8 alignment, Dqn_ZeroMem zero_mem DQN_CALL_SITE_ARGS);
+// Internal API. Avoid using, and prefer the macros above. The allocate function is inlined and only
+// bumps the pointer of the current block, the out-of-line slow path is taken when the current block
+// is exhausted to move onto the next retained block or grow the arena.
+DQN_FORCE_INLINE void                 *Dqn_ArenaAllocator__Allocate           (Dqn_ArenaAllocator *arena, Dqn_isize size, Dqn_u8 alignment, Dqn_ZeroMem zero_mem DQN_CALL_SITE_ARGS);
+DQN_FORCE_INLINE void                 *Dqn_ArenaAllocator__BumpBlock          (Dqn_ArenaAllocatorBlock *block, Dqn_isize size, Dqn_u8 alignment);
+DQN_API void                          *Dqn_ArenaAllocator__AllocateSlowPath   (Dqn_ArenaAllocator *arena, Dqn_isize size, Dqn_u8 alignment DQN_CALL_SITE_ARGS);
 DQN_API Dqn_ArenaAllocatorStats        Dqn_ArenaAllocator_GetStats            (Dqn_ArenaAllocator const *arena);
 DQN_API void                           Dqn_ArenaAllocator_DumpStatsToLog      (Dqn_ArenaAllocator const *arena, char const *label);
 DQN_API Dqn_FixedString<512>           Dqn_ArenaAllocator_StatsString         (Dqn_ArenaAllocator const *arena, char const *label);
 
+// -------------------------------------------------------------------------------------------------
+//
+// NOTE: Dqn_ConcurrentArenaAllocator
+//
+// -------------------------------------------------------------------------------------------------
+// An arena that can be allocated from by multiple threads at once. Threads reserve their allocation
+// by atomically advancing the 'used' offset of the current block, so the common case takes no
+// lock. When the current block is exhausted, one thread chains a new block under the mutex and
+// publishes it to the other threads.
+//
+// The blocks are owned by the wrapped 'arena' which uses the same block layout as
+// Dqn_ArenaAllocator. Allocations reserve the worst case alignment padding as the aligned address
+// is not known until the offset has been claimed.
+struct Dqn_ConcurrentArenaAllocator
+{
+    // NOTE: Read Only
+    Dqn_TicketMutex                   mutex;          // Serialises chaining new blocks into 'arena'
+    Dqn_ArenaAllocator                arena;          // Owns the blocks, only modified whilst holding 'mutex'
+    Dqn_ArenaAllocatorBlock *volatile curr_mem_block; // The block threads bump allocate from
+};
+
+DQN_API Dqn_ConcurrentArenaAllocator Dqn_ConcurrentArenaAllocator_InitWithNewAllocator(Dqn_Allocator allocator, Dqn_isize size, Dqn_AllocationTracer *tracer DQN_CALL_SITE_ARGS);
+DQN_API void                         Dqn_ConcurrentArenaAllocator_Free                (Dqn_ConcurrentArenaAllocator *arena);
+
+// Not thread safe, the caller must ensure no other thread is allocating from the arena.
+DQN_API void                         Dqn_ConcurrentArenaAllocator_ResetUsage          (Dqn_ConcurrentArenaAllocator *arena, Dqn_ZeroMem zero_mem);
+DQN_API Dqn_ArenaAllocatorStats      Dqn_ConcurrentArenaAllocator_GetStats            (Dqn_ConcurrentArenaAllocator const *arena);
+
+#define                              Dqn_ConcurrentArenaAllocator_TaggedAllocate(arena, size, alignment, zero_mem, tag)     Dqn_ConcurrentArenaAllocator__Allocate(arena, size, alignment, zero_mem DQN_CALL_SITE(tag))
+#define                              Dqn_ConcurrentArenaAllocator_Allocate(      arena, size, alignment, zero_mem)          Dqn_ConcurrentArenaAllocator__Allocate(arena, size, alignment, zero_mem DQN_CALL_SITE(""))
+
+#define                              Dqn_ConcurrentArenaAllocator_TaggedNew(     arena, Type, zero_mem, tag)        (Type *)Dqn_ConcurrentArenaAllocator__Allocate(arena, sizeof(Type), alignof(Type), zero_mem DQN_CALL_SITE(tag))
+#define                              Dqn_ConcurrentArenaAllocator_New(           arena, Type, zero_mem)             (Type *)Dqn_ConcurrentArenaAllocator__Allocate(arena, sizeof(Type), alignof(Type), zero_mem DQN_CALL_SITE(""))
+
+#define                              Dqn_ConcurrentArenaAllocator_TaggedNewArray(arena, Type, count, zero_mem, tag) (Type *)Dqn_ConcurrentArenaAllocator__Allocate(arena, sizeof(Type) * count, alignof(Type), zero_mem DQN_CALL_SITE(tag))
+#define                              Dqn_ConcurrentArenaAllocator_NewArray(      arena, Type, count, zero_mem)      (Type *)Dqn_ConcurrentArenaAllocator__Allocate(arena, sizeof(Type) * count, alignof(Type), zero_mem DQN_CALL_SITE(""))
+
+// Internal API. Avoid using, and prefer the macros above.
+DQN_API void                        *Dqn_ConcurrentArenaAllocator__Allocate           (Dqn_ConcurrentArenaAllocator *arena, Dqn_isize size, Dqn_u8 alignment, Dqn_ZeroMem zero_mem DQN_CALL_SITE_ARGS);
+
+// -------------------------------------------------------------------------------------------------
+//
+// NOTE: Dqn_PoolAllocator
+//
+// -------------------------------------------------------------------------------------------------
+// Allocates fixed size slots carved out of chunks from an arena. Freed slots are pushed onto an
+// intrusive free list and handed out again, so allocating and freeing are O(1) and carry no
+// per-allocation header. The memory for the chunks is only returned when the arena is freed.
+/*
+  Dqn_PoolAllocator pool      = Dqn_PoolAllocator_InitWithArena(&arena, Dqn_List_ChunkAllocationSize<Dqn_u64>(128), alignof(Dqn_ListChunk<Dqn_u64>));
+  Dqn_Allocator     allocator = Dqn_Allocator_InitWithPool(&pool);
+  Dqn_List<Dqn_u64> list      = Dqn_List_InitWithAllocator<Dqn_u64>(&allocator, 128);
+*/
+Dqn_isize constexpr DQN_POOL_ALLOCATOR_DEFAULT_SLOTS_PER_CHUNK = 64;
+struct Dqn_PoolAllocatorSlot
+{
+    Dqn_PoolAllocatorSlot *next;
+};
+
+struct Dqn_PoolAllocator
+{
+    // NOTE: Read Only
+    Dqn_ArenaAllocator    *arena;           // Arena that chunks of slots are allocated from
+    Dqn_isize              slot_size;       // Bytes per slot, atleast large enough to hold the free list link
+    Dqn_u8                 slot_alignment;
+    Dqn_isize              slots_per_chunk; // Slots to allocate from the arena when the free list is empty
+    Dqn_PoolAllocatorSlot *free_list;
+
+    // NOTE: Stats
+    Dqn_isize              slots_in_use;
+    Dqn_isize              total_slots;     // Slots allocated from the arena, in use or free
+};
+
+DQN_API Dqn_PoolAllocator Dqn_PoolAllocator_InitWithArena(Dqn_ArenaAllocator *arena, Dqn_isize slot_size, Dqn_u8 slot_alignment, Dqn_isize slots_per_chunk = DQN_POOL_ALLOCATOR_DEFAULT_SLOTS_PER_CHUNK);
+DQN_API void              Dqn_PoolAllocator_Free         (Dqn_PoolAllocator *pool, void *ptr);
+
+#define                   Dqn_PoolAllocator_TaggedAllocate(pool, zero_mem, tag)       Dqn_PoolAllocator__Allocate(pool, zero_mem DQN_CALL_SITE(tag))
+#define                   Dqn_PoolAllocator_Allocate(      pool, zero_mem)            Dqn_PoolAllocator__Allocate(pool, zero_mem DQN_CALL_SITE(""))
+
+#define                   Dqn_PoolAllocator_TaggedNew(     pool, Type, zero_mem, tag) (Type *)Dqn_PoolAllocator__AllocateType(pool, sizeof(Type), alignof(Type), zero_mem DQN_CALL_SITE(tag))
+#define                   Dqn_PoolAllocator_New(           pool, Type, zero_mem)      (Type *)Dqn_PoolAllocator__AllocateType(pool, sizeof(Type), alignof(Type), zero_mem DQN_CALL_SITE(""))
+
+// Internal API. Avoid using, and prefer the macros above.
+DQN_API void             *Dqn_PoolAllocator__Allocate    (Dqn_PoolAllocator *pool, Dqn_ZeroMem zero_mem DQN_CALL_SITE_ARGS);
+DQN_API void             *Dqn_PoolAllocator__AllocateType(Dqn_PoolAllocator *pool, Dqn_isize size, Dqn_u8 alignment, Dqn_ZeroMem zero_mem DQN_CALL_SITE_ARGS);
+
+// -------------------------------------------------------------------------------------------------
+//
+// NOTE: Dqn_SlabAllocator
+//
+// -------------------------------------------------------------------------------------------------
+// A general purpose allocator for small objects. Allocations are rounded up to a power of 2 size
+// class between DQN_SLAB_ALLOCATOR_MIN_SLOT_SIZE and DQN_SLAB_ALLOCATOR_MAX_SLOT_SIZE and served
+// from that class's free list. Free lists are refilled by carving a slab out of a large span of
+// virtual memory, so once the allocator has warmed up, allocating and freeing does not call into
+// the OS or the CRT.
+//
+// Slabs are aligned to DQN_SLAB_ALLOCATOR_SLAB_SIZE and start with a Dqn_SlabAllocatorSlab header,
+// so the size class of a pointer is found by masking its address, there is no per-allocation
+// header. Allocations larger than the biggest size class get their own virtual memory reservation
+// with a header in the same position.
+//
+// Not thread safe.
+Dqn_isize constexpr DQN_SLAB_ALLOCATOR_SLAB_SIZE       = DQN_KILOBYTES(64);
+Dqn_isize constexpr DQN_SLAB_ALLOCATOR_SPAN_SIZE       = DQN_MEGABYTES(4);
+Dqn_isize constexpr DQN_SLAB_ALLOCATOR_MIN_SLOT_SIZE   = 16;
+Dqn_isize constexpr DQN_SLAB_ALLOCATOR_MAX_SLOT_SIZE   = DQN_KILOBYTES(4);
+Dqn_isize constexpr DQN_SLAB_ALLOCATOR_SIZE_CLASS_COUNT = 9; // 16, 32, 64 ... 4096
+Dqn_isize constexpr DQN_SLAB_ALLOCATOR_LARGE_SIZE_CLASS = -1;
+
+struct Dqn_SlabAllocatorSlot
+{
+    Dqn_SlabAllocatorSlot *next;
+};
+
+struct Dqn_SlabAllocatorSlab
+{
+    Dqn_isize              size_class;   // Index into the allocator's size classes or DQN_SLAB_ALLOCATOR_LARGE_SIZE_CLASS
+
+    // NOTE: Only set on slabs that start a reservation, i.e. the first slab of a span or a large allocation
+    void                  *reserve_base; // The pointer returned from Dqn_VirtualMem_Reserve
+    Dqn_isize              reserve_size;
+    Dqn_isize              large_size;   // The requested size of a large allocation
+    Dqn_SlabAllocatorSlab *prev;
+    Dqn_SlabAllocatorSlab *next;
+};
+
+struct Dqn_SlabAllocatorSizeClass
+{
+    Dqn_SlabAllocatorSlot *free_list;
+
+    // NOTE: Stats
+    Dqn_isize              slot_size;
+    Dqn_isize              slots_in_use;
+    Dqn_isize              total_slots;       // Slots carved out of slabs, in use or free
+    Dqn_isize              total_slabs;
+    Dqn_isize              total_allocations; // Cumulative count of allocations served from this class
+};
+
+struct Dqn_SlabAllocator
+{
+    Dqn_AllocationTracer      *tracer;
+    Dqn_SlabAllocatorSizeClass size_classes[DQN_SLAB_ALLOCATOR_SIZE_CLASS_COUNT];
+    Dqn_SlabAllocatorSlab     *reservations; // Spans and large allocations to release when the allocator is freed
+    char                      *span_cursor;  // The next slab to commit in the current span
+    char                      *span_end;
+
+    // NOTE: Stats
+    Dqn_isize                  large_allocations;
+    Dqn_isize                  large_bytes;
+    Dqn_isize                  total_spans;
+};
+
+DQN_API void      Dqn_SlabAllocator_Release       (Dqn_SlabAllocator *slab);
+DQN_API void      Dqn_SlabAllocator_Free          (Dqn_SlabAllocator *slab, void *ptr);
+
+// return: The number of bytes reserved for the pointer, i.e. the slot size of its size class.
+DQN_API Dqn_isize Dqn_SlabAllocator_AllocationSize(void const *ptr);
+DQN_API void      Dqn_SlabAllocator_DumpStatsToLog(Dqn_SlabAllocator const *slab, char const *label);
+
+#define           Dqn_SlabAllocator_TaggedAllocate(slab, size, alignment, zero_mem, tag)     Dqn_SlabAllocator__Allocate(slab, size, alignment, zero_mem DQN_CALL_SITE(tag))
+#define           Dqn_SlabAllocator_Allocate(      slab, size, alignment, zero_mem)          Dqn_SlabAllocator__Allocate(slab, size, alignment, zero_mem DQN_CALL_SITE(""))
+
+#define           Dqn_SlabAllocator_TaggedNew(     slab, Type, zero_mem, tag)        (Type *)Dqn_SlabAllocator__Allocate(slab, sizeof(Type), alignof(Type), zero_mem DQN_CALL_SITE(tag))
+#define           Dqn_SlabAllocator_New(           slab, Type, zero_mem)             (Type *)Dqn_SlabAllocator__Allocate(slab, sizeof(Type), alignof(Type), zero_mem DQN_CALL_SITE(""))
+
+#define           Dqn_SlabAllocator_TaggedNewArray(slab, Type, count, zero_mem, tag) (Type *)Dqn_SlabAllocator__Allocate(slab, sizeof(Type) * count, alignof(Type), zero_mem DQN_CALL_SITE(tag))
+#define           Dqn_SlabAllocator_NewArray(      slab, Type, count, zero_mem)      (Type *)Dqn_SlabAllocator__Allocate(slab, sizeof(Type) * count, alignof(Type), zero_mem DQN_CALL_SITE(""))
+
+// Internal API. Avoid using, and prefer the macros above.
+DQN_API void     *Dqn_SlabAllocator__Allocate     (Dqn_SlabAllocator *slab, Dqn_isize size, Dqn_u8 alignment, Dqn_ZeroMem zero_mem DQN_CALL_SITE_ARGS);
+
+// -------------------------------------------------------------------------------------------------
+//
+// NOTE: Dqn_ThreadCacheAllocator
+//
+// -------------------------------------------------------------------------------------------------
+// A thread safe allocator in front of any Dqn_Allocator. Each thread keeps a magazine of free slots
+// per size class and only takes the allocator's mutex to refill or drain a magazine in batches of
+// 'batch_size' slots, so threads allocating and freeing concurrently do not serialise on the
+// backing allocator. A pointer may be freed on a different thread than the one that allocated it,
+// a thread that has never allocated from the allocator frees into the shared free lists.
+//
+// Slots are prefixed with a DQN_THREAD_CACHE_HEADER_SIZE header holding their size class, user
+// pointers are 16 byte aligned. Allocations larger than DQN_THREAD_CACHE_MAX_SLOT_SIZE or with a
+// larger alignment go straight to the backing allocator under the mutex.
+//
+// Allocation counters are kept per thread and summed on demand by Dqn_ThreadCacheAllocator_GetStats.
+// A thread's cached slots and counters are handed back to the allocator when the thread exits or
+// calls Dqn_ThreadCacheAllocator_FlushThread. No thread may use the allocator while it is released.
+//
+// Dqn_ThreadCacheAllocator_Release must be called before the allocator's storage goes away (i.e. it
+// goes out of scope or the memory holding it is freed). Each thread that used the allocator keeps a
+// pointer to it and flushes into it on exit until Release detaches them. When asserts are enabled
+// an allocator destroyed with threads or memory still attached asserts.
+Dqn_isize constexpr DQN_THREAD_CACHE_HEADER_SIZE            = 16;
+Dqn_isize constexpr DQN_THREAD_CACHE_MIN_SLOT_SIZE          = 16;
+Dqn_isize constexpr DQN_THREAD_CACHE_MAX_SLOT_SIZE          = DQN_KILOBYTES(4);
+Dqn_isize constexpr DQN_THREAD_CACHE_SIZE_CLASS_COUNT       = 9; // 16, 32, 64 ... 4096
+Dqn_isize constexpr DQN_THREAD_CACHE_DEFAULT_BATCH_SIZE     = 32;
+Dqn_isize constexpr DQN_THREAD_CACHE_MAX_ALLOCATORS_PER_THREAD = 4;
+
+struct Dqn_ThreadCacheAllocatorSlot
+{
+    Dqn_ThreadCacheAllocatorSlot *next;
+};
+
+struct Dqn_ThreadCacheAllocatorMagazine
+{
+    Dqn_ThreadCacheAllocatorSlot *slots;
+    Dqn_isize                     count; // Written by the owning thread with Dqn_AtomicStoreISizeRelaxed, read by Dqn_ThreadCacheAllocator_GetStats
+};
+
+struct Dqn_ThreadCacheAllocatorCounters
+{
+    Dqn_isize bytes_allocated;
+    Dqn_isize allocations;
+    Dqn_isize total_bytes_allocated;
+    Dqn_isize total_allocations;
+};
+
+// A thread's cache for one allocator, it lives in thread local storage.
+struct Dqn_ThreadCacheAllocatorThread
+{
+    struct Dqn_ThreadCacheAllocator  *allocator; // Null when unused or detached by Dqn_ThreadCacheAllocator_Release
+    Dqn_ThreadCacheAllocatorMagazine  magazines[DQN_THREAD_CACHE_SIZE_CLASS_COUNT];
+    Dqn_ThreadCacheAllocatorCounters  counters;  // Only written by the owning thread, with relaxed atomics as Dqn_ThreadCacheAllocator_GetStats reads them
+    Dqn_ThreadCacheAllocatorThread   *prev;      // Registered threads of 'allocator', guarded by its mutex
+    Dqn_ThreadCacheAllocatorThread   *next;
+};
+
+struct Dqn_ThreadCacheAllocator
+{
+#if !defined(DQN_NO_ASSERT)
+    ~Dqn_ThreadCacheAllocator(); // Asserts that Dqn_ThreadCacheAllocator_Release was called
+#endif
+
+    // NOTE: Read Only
+    Dqn_TicketMutex                   mutex;      // Guards everything below
+    Dqn_Allocator                    *backing;
+    Dqn_isize                         batch_size; // Slots moved between a thread's magazine and the shared free lists at a time
+    Dqn_ThreadCacheAllocatorSlot     *free_lists[DQN_THREAD_CACHE_SIZE_CLASS_COUNT];
+    Dqn_isize                         free_list_counts[DQN_THREAD_CACHE_SIZE_CLASS_COUNT];
+    Dqn_ThreadCacheAllocatorSlot     *chunks;     // Batches of slots allocated from 'backing'
+    Dqn_ThreadCacheAllocatorThread   *threads;
+    Dqn_ThreadCacheAllocatorCounters  retired;    // Counters of threads that have flushed, and of allocations made without a thread cache
+};
+
+struct Dqn_ThreadCacheAllocatorStats
+{
+    Dqn_isize bytes_allocated;
+    Dqn_isize allocations;
+    Dqn_isize total_bytes_allocated;
+    Dqn_isize total_allocations;
+    Dqn_isize cached_slots; // Free slots held in thread caches
+    Dqn_isize shared_slots; // Free slots in the allocator's shared free lists
+    Dqn_isize threads;      // Threads with a cache registered with the allocator
+};
+
+DQN_API Dqn_ThreadCacheAllocator      Dqn_ThreadCacheAllocator_Init       (Dqn_Allocator *backing, Dqn_isize batch_size = DQN_THREAD_CACHE_DEFAULT_BATCH_SIZE);
+DQN_API void                          Dqn_ThreadCacheAllocator_Release    (Dqn_ThreadCacheAllocator *allocator);
+DQN_API void                          Dqn_ThreadCacheAllocator_Free       (Dqn_ThreadCacheAllocator *allocator, void *ptr);
+
+// Return the calling thread's cached slots to the allocator and fold its counters into the allocator.
+DQN_API void                          Dqn_ThreadCacheAllocator_FlushThread(Dqn_ThreadCacheAllocator *allocator);
+
+// Threads still allocating update their counters with relaxed atomics, so each value is read
+// whole but they may be slightly out of date relative to each other.
+DQN_API Dqn_ThreadCacheAllocatorStats Dqn_ThreadCacheAllocator_GetStats   (Dqn_ThreadCacheAllocator *allocator);
+
+// return: The number of bytes reserved for the pointer, i.e. the slot size of its size class.
+DQN_API Dqn_isize                     Dqn_ThreadCacheAllocator_AllocationSize(void const *ptr);
+
+#define                               Dqn_ThreadCacheAllocator_TaggedAllocate(allocator, size, alignment, zero_mem, tag) Dqn_ThreadCacheAllocator__Allocate(allocator, size, alignment, zero_mem DQN_CALL_SITE(tag))
+#define                               Dqn_ThreadCacheAllocator_Allocate(      allocator, size, alignment, zero_mem)      Dqn_ThreadCacheAllocator__Allocate(allocator, size, alignment, zero_mem DQN_CALL_SITE(""))
+
+#define                               Dqn_ThreadCacheAllocator_TaggedNew(     allocator, Type, zero_mem, tag)    (Type *)Dqn_ThreadCacheAllocator__Allocate(allocator, sizeof(Type), alignof(Type), zero_mem DQN_CALL_SITE(tag))
+#define                               Dqn_ThreadCacheAllocator_New(           allocator, Type, zero_mem)         (Type *)Dqn_ThreadCacheAllocator__Allocate(allocator, sizeof(Type), alignof(Type), zero_mem DQN_CALL_SITE(""))
+
+// Internal API. Avoid using, and prefer the macros above.
+DQN_API void                         *Dqn_ThreadCacheAllocator__Allocate  (Dqn_ThreadCacheAllocator *allocator, Dqn_isize size, Dqn_u8 alignment, Dqn_ZeroMem zero_mem DQN_CALL_SITE_ARGS);
+
+// -------------------------------------------------------------------------------------------------
+//
+// NOTE: Dqn_ScratchArena
+//
+// -------------------------------------------------------------------------------------------------
+// Each thread owns a small pool of virtual memory arenas for short-lived allocations. Getting a
+// scratch arena begins a region on it that is ended when the returned struct goes out of scope.
+// Pass in any arena the caller is still allocating into (i.e. the arena the result of a function
+// is returned in) so that the scratch arena handed out does not alias it.
+/*
+    Dqn_String FormatNames(Dqn_ArenaAllocator *arena, ...)
+    {
+        Dqn_ScratchArena scratch = Dqn_Scratch_Get(arena);
+        Dqn_String       names   = Dqn_String_InitFmt(&scratch.allocator, ...); // Freed at the end of the scope
+        Dqn_String       result  = Dqn_String_InitArenaFmt(arena, "%.*s", DQN_STRING_FMT(names));
+        return result;
+    }
+*/
+#if !defined(DQN_SCRATCH_ARENA_COUNT)
+    #define DQN_SCRATCH_ARENA_COUNT 2
+#endif
+
+#if !defined(DQN_SCRATCH_ARENA_RESERVE_SIZE)
+    #define DQN_SCRATCH_ARENA_RESERVE_SIZE (sizeof(void *) == 8 ? DQN_GIGABYTES(1) : DQN_MEGABYTES(64))
+#endif
+
+// Not copyable as each copy would end the region. Moving leaves the source without a region.
+struct Dqn_ScratchArena
+{
+    Dqn_ScratchArena(Dqn_ArenaAllocator *arena);
+    Dqn_ScratchArena(Dqn_ScratchArena &&other);
+    Dqn_ScratchArena(Dqn_ScratchArena const &)            = delete;
+    Dqn_ScratchArena &operator=(Dqn_ScratchArena const &) = delete;
+    Dqn_ArenaAllocator            *arena;     // The thread's scratch arena, usage is reset when this goes out of scope
+    Dqn_Allocator                  allocator; // Wraps 'arena' for APIs that take a Dqn_Allocator
+    Dqn_ArenaAllocatorScopedRegion region;
+};
+
+// conflict_arena: (Optional) An arena the returned scratch arena must not alias
+DQN_API Dqn_ScratchArena Dqn_Scratch_Get         (Dqn_ArenaAllocator const *conflict_arena = nullptr);
+
+// conflict_arenas: The arenas the returned scratch arena must not alias. The pool must have more
+//                  arenas than conflicts, see DQN_SCRATCH_ARENA_COUNT.
+DQN_API Dqn_ScratchArena Dqn_Scratch_GetExcluding(Dqn_ArenaAllocator const *const *conflict_arenas, Dqn_isize conflict_arenas_size);
+
 // -------------------------------------------------------------------------------------------------
 //
 // NOTE: Dqn_Bit
@@ -1578,8 +2318,15 @@ DQN_API char    Dqn_Char_ToLower       (char ch);
 //
 // -------------------------------------------------------------------------------------------------
 DQN_API Dqn_b32     Dqn_Str_Equals                     (char const *a, char const *b, Dqn_isize a_len = -1, Dqn_isize b_len = -1);
+// Compares every string in 'find_list' at every offset, use Dqn_AhoCorasick to match many strings or
+// to match the same strings against many buffers.
 DQN_API char const *Dqn_Str_FindMulti                  (char const *buf, char const *find_list[], Dqn_isize const *find_string_lens, Dqn_isize find_len, Dqn_isize *match_index, Dqn_isize buf_len = -1);
+
+// Return a pointer to the first occurrence of 'find' in 'buf' or nullptr. Candidates are found 16/32
+// positions at a time with SSE2/AVX2 (AVX2 is picked at runtime) by matching the first and last byte
+// of 'find', both for case sensitive and insensitive searches.
 DQN_API char const *Dqn_Str_Find                       (char const *buf, char const *find, Dqn_isize buf_len = -1, Dqn_isize find_len = -1, Dqn_b32 case_insensitive = false);
+
 DQN_API char const *Dqn_Str_FileNameFromPath           (char const *path, int len = -1, int *file_name_len = nullptr);
 DQN_API Dqn_b32     Dqn_Str_Len                        (char const *a);
 DQN_API Dqn_b32     Dqn_Str_Match                      (char const *src, char const *find, int find_len);
@@ -1600,9 +2347,36 @@ DQN_API char const *Dqn_Str_TrimWhitespaceAround       (char const *src, Dqn_isi
 DQN_API char const *Dqn_Str_TrimPrefix                 (char const *src, Dqn_isize size, char const *prefix, Dqn_isize prefix_size, Dqn_isize *trimmed_size);
 
 // separator: The separator between the thousand-th digits, i.e. separator = ',' converts '1,234' to '1234'.
+// return: The number, saturated to the min/max of the type if it does not fit
 DQN_API Dqn_u64     Dqn_Str_ToU64                      (char const *buf, int len = -1, char separator = ',');
 DQN_API Dqn_i64     Dqn_Str_ToI64                      (char const *buf, int len = -1, char separator = ',');
 
+// Parse the number at the start of 'buf', 8 digits at a time. There is no whitespace skipping or
+// thousands separators, the number ends at the first character that is not a digit. The I64 variant
+// accepts a leading '+' or '-'.
+// return: The number of characters parsed or 0 if 'buf' does not start with a number. If the number
+//         does not fit, 0 is returned and 'value' is saturated to the min/max of the type.
+DQN_API Dqn_isize   Dqn_Str_ParseU64                   (char const *buf, Dqn_isize size, Dqn_u64 *value);
+DQN_API Dqn_isize   Dqn_Str_ParseI64                   (char const *buf, Dqn_isize size, Dqn_i64 *value);
+
+// Parse a column of numbers separated by 'delimiter', i.e. '\n' for a number per line or ',' for a
+// row of values. Spaces and tabs around a number and a '\r' before the delimiter are skipped.
+// return: The number of values written. Parsing stops at the end of 'buf', when 'values' is full or
+//         at the first entry that's not a number or does not fit.
+// consumed: (Optional) Set to the bytes parsed up to and including the delimiter of the last value
+//           written, i.e. where to resume from when 'values' was full.
+DQN_API Dqn_isize   Dqn_Str_ParseU64Column             (char const *buf, Dqn_isize size, char delimiter, Dqn_u64 *values, Dqn_isize values_size, Dqn_isize *consumed = nullptr);
+DQN_API Dqn_isize   Dqn_Str_ParseI64Column             (char const *buf, Dqn_isize size, char delimiter, Dqn_i64 *values, Dqn_isize values_size, Dqn_isize *consumed = nullptr);
+
+// Parse a decimal floating point number, i.e. "-12.5", ".5", "1e-7" or "6.02E+23", rounded to the
+// nearest double. "inf", "infinity" and "nan" are accepted in any case. There is no hex float or
+// thousands separator support.
+// return: Dqn_Str_ToF64 returns the number or 0 if there's no number. Dqn_Str_ParseF64 returns the
+//         number of characters parsed or 0 if 'buf' does not start with a number. Values too large
+//         for a double are parsed as inf.
+DQN_API Dqn_f64     Dqn_Str_ToF64                      (char const *buf, int len = -1);
+DQN_API Dqn_isize   Dqn_Str_ParseF64                   (char const *buf, Dqn_isize size, Dqn_f64 *value);
+
 // -------------------------------------------------------------------------------------------------
 //
 // NOTE: Dqn_File
@@ -1674,9 +2448,31 @@ DQN_API Dqn_f64   Dqn_Timer_Ms    (Dqn_Timer timer);
 DQN_API Dqn_f64   Dqn_Timer_MicroS(Dqn_Timer timer);
 DQN_API Dqn_f64   Dqn_Timer_Ns    (Dqn_Timer timer);
 
+// Convert 'val' to decimal 2 digits at a time, with a ',' between every 3 digits if 'comma_sep'
 DQN_API char *Dqn_U64ToStr            (Dqn_u64 val, Dqn_U64Str *result, Dqn_b32 comma_sep);
+
+// return: A string in a thread local buffer that's overwritten by the next call on the same thread
 DQN_API char *Dqn_U64ToTempStr        (Dqn_u64 val, Dqn_b32 comma_sep = true);
 
+// Thread-safe and can be held onto, i.e. convert into the arena from Dqn_Scratch_Get for a temporary
+DQN_API Dqn_String Dqn_U64ToArenaStr  (Dqn_ArenaAllocator *arena, Dqn_u64 val, Dqn_b32 comma_sep = true);
+
+// buf: Must have at least Dqn_U64ToStrSize bytes, at most 26, the result is not null-terminated
+// return: The number of characters written
+DQN_API Dqn_isize Dqn_U64ToStrSize    (Dqn_u64 val, Dqn_b32 comma_sep);
+DQN_API Dqn_isize Dqn_U64ToStrBuffer  (Dqn_u64 val, char *buf, Dqn_b32 comma_sep);
+
+// Format 'value' with the fewest digits that Dqn_Str_ToF64 parses back to the same value, i.e.
+// 0.1 is "0.1" and not "0.100000000000000006". Exponent notation is used when the number needs more
+// than 21 digits left of the decimal point or 6 zeros right of it, i.e. "1e+21" and "1.5e-7".
+// Infinity and NaN produce "inf", "-inf" and "nan".
+// buf: Must have at least DQN_F64_STR_MAX_SIZE bytes, the result is not null-terminated
+// return: The number of characters written.
+#define DQN_F64_STR_MAX_SIZE 25
+DQN_API Dqn_isize             Dqn_F64ToStrBuffer      (Dqn_f64 value, char *buf);
+DQN_API Dqn_FixedString<32>   Dqn_F64ToStr            (Dqn_f64 value);
+DQN_API Dqn_String            Dqn_F64ToArenaStr       (Dqn_ArenaAllocator *arena, Dqn_f64 value);
+
 // -------------------------------------------------------------------------------------------------
 //
 // NOTE: Dqn_Win32
@@ -1763,6 +2559,10 @@ struct Dqn_StringBuilderBlock
 };
 
 Dqn_isize constexpr DQN_STRING_BUILDER_MIN_BLOCK_SIZE = DQN_KILOBYTES(4);
+
+// The block header and its memory are a single allocation of atleast this size, i.e. the slot size
+// for a Dqn_PoolAllocator that backs a string builder's appends of up to the minimum block size.
+Dqn_isize constexpr DQN_STRING_BUILDER_BLOCK_ALLOCATION_SIZE = DQN_ISIZEOF(Dqn_StringBuilderBlock) + DQN_STRING_BUILDER_MIN_BLOCK_SIZE;
 template <Dqn_isize N = DQN_KILOBYTES(16)>
 struct Dqn_StringBuilder
 {
@@ -1789,6 +2589,10 @@ template <Dqn_isize N> DQN_API void        Dqn_StringBuilder_AppendFmt
 template <Dqn_isize N> DQN_API void        Dqn_StringBuilder_Append                  (Dqn_StringBuilder<N> *builder, char const *str, Dqn_isize len = -1);
 template <Dqn_isize N> DQN_API void        Dqn_StringBuilder_AppendString            (Dqn_StringBuilder<N> *builder, Dqn_String const string);
 template <Dqn_isize N> DQN_API void        Dqn_StringBuilder_AppendChar              (Dqn_StringBuilder<N> *builder, char ch);
+
+// Append each number in 'values' as decimal with 'separator' between them. The strings are sized up
+// front and converted straight into the builder, a batch of values per allocation.
+template <Dqn_isize N> DQN_API void        Dqn_StringBuilder_AppendU64Array          (Dqn_StringBuilder<N> *builder, Dqn_u64 const *values, Dqn_isize values_size, Dqn_String separator, Dqn_b32 comma_sep = false);
 template <Dqn_isize N> DQN_API void        Dqn_StringBuilder_Free                    (Dqn_StringBuilder<N> *builder);
 
 // -------------------------------------------------------------------------------------------------
@@ -1928,6 +2732,10 @@ struct Dqn_List
 template <typename T> DQN_API Dqn_List<T>  Dqn_List_InitWithArena    (Dqn_ArenaAllocator *arena, Dqn_isize chunk_size = 128);
 template <typename T> DQN_API Dqn_List<T>  Dqn_List_InitWithAllocator(Dqn_Allocator *allocator, Dqn_isize chunk_size = 128);
 
+// A chunk's header and its items are a single allocation. Return the bytes allocated for a chunk
+// of 'chunk_size' items, i.e. the slot size for a Dqn_PoolAllocator that backs the list.
+template <typename T> DQN_API Dqn_isize    Dqn_List_ChunkAllocationSize(Dqn_isize chunk_size);
+
 // Produce an iterator for the data in the list
 /*
    Dqn_List<int> list = {};
@@ -1941,6 +2749,152 @@ template <typename T> DQN_API Dqn_b32      Dqn_List_Iterate          (Dqn_List<T
 #define                                    Dqn_List_TaggedMake(       list, count, tag) Dqn_List__Make(list, count DQN_CALL_SITE(tag))
 #define                                    Dqn_List_Make(             list, count)      Dqn_List__Make(list, count DQN_CALL_SITE(""))
 template <typename T> DQN_API T           *Dqn_List__Make(            Dqn_List<T> *list, Dqn_isize count DQN_CALL_SITE_ARGS);
+
+// -------------------------------------------------------------------------------------------------
+//
+// NOTE: Dqn_StringInterner
+//
+// -------------------------------------------------------------------------------------------------
+// Maps each distinct string to a dense id and a single canonical copy stored in the interner's arena.
+// Interned strings compare by id instead of comparing their characters. Ids start at 1, 0 is never
+// handed out and marks a zero initialised or not found Dqn_InternedString.
+//
+// thread_safe: Every call takes the interner's mutex so threads can intern and look up strings
+// concurrently. The arena must not be used outside the interner while other threads are using it.
+/*
+   Dqn_StringInterner interner = Dqn_StringInterner_InitWithArena(&arena);
+   Dqn_InternedString a        = Dqn_StringInterner_Intern(&interner, DQN_STRING("position"));
+   Dqn_InternedString b        = Dqn_StringInterner_Intern(&interner, field_name);
+   if (a == b) // Integer compare, a.string.str == b.string.str as well
+*/
+struct Dqn_InternedString
+{
+    Dqn_String string; // The canonical copy, null terminated and shared by every equal string interned
+    Dqn_u32    id;
+
+    bool operator==(Dqn_InternedString const &other) const { return id == other.id; }
+    bool operator!=(Dqn_InternedString const &other) const { return id != other.id; }
+};
+
+struct Dqn_StringInterner
+{
+    Dqn_ArenaAllocator                *arena;
+    Dqn_b32                            thread_safe;
+    Dqn_TicketMutex                    mutex;
+    Dqn_StringMap<Dqn_InternedString>  map;     // Canonical string to its entry in 'arena'
+    Dqn_Array<Dqn_InternedString>      entries; // Entry for each id, indexed by 'id - 1'
+};
+
+DQN_API Dqn_StringInterner Dqn_StringInterner_InitWithArena(Dqn_ArenaAllocator *arena, Dqn_b32 thread_safe = false);
+DQN_API Dqn_InternedString Dqn_StringInterner_Intern       (Dqn_StringInterner *interner, Dqn_String string);
+
+// Return the interned string or an id of 0 if 'string' has not been interned
+DQN_API Dqn_InternedString Dqn_StringInterner_Find         (Dqn_StringInterner *interner, Dqn_String string);
+
+// Return the canonical string for 'id' or an empty string if the id was not handed out by the interner
+DQN_API Dqn_String         Dqn_StringInterner_StringFromID (Dqn_StringInterner *interner, Dqn_u32 id);
+
+// -------------------------------------------------------------------------------------------------
+//
+// NOTE: Dqn_PerfectHash
+//
+// -------------------------------------------------------------------------------------------------
+// Collision free lookup table for a fixed set of strings (keywords, header names, command names)
+// built at compile time. Find hashes the string once, mixes the hash with its bucket's seed to get a
+// slot and does one compare, returning the index of the string in the list the table was made from
+// or -1.
+//
+// Strings are grouped into buckets by their hash, then starting with the largest bucket each one is
+// given a seed that sends all of its strings to free slots (hash and displace). The table has at
+// least twice as many slots as strings so a seed is usually found within a few attempts. Duplicate
+// strings, or a bucket no seed can be found for, leave 'valid' false: check it with a static_assert.
+// Very large sets may need the compiler's constant evaluation limit raised (MSVC /constexpr:steps).
+/*
+   static constexpr char const *KEYWORDS[]    = {"if", "else", "for", "while", "return"};
+   static constexpr auto        KEYWORD_TABLE = Dqn_PerfectHash_Init(KEYWORDS);
+   static_assert(KEYWORD_TABLE.valid, "Keywords must be unique");
+
+   Dqn_isize index = Dqn_PerfectHash_Find(&KEYWORD_TABLE, token); // Index into KEYWORDS, -1 if not a keyword
+*/
+Dqn_isize constexpr DQN_PERFECT_HASH_MAX_SEED_ATTEMPTS = 4096;
+
+constexpr Dqn_isize Dqn_PerfectHash__SlotCount(Dqn_isize key_count)
+{
+    Dqn_isize result = 1;
+    while (result < key_count * 2)
+        result *= 2;
+    return result;
+}
+
+template <Dqn_isize N>
+struct Dqn_PerfectHash
+{
+    Dqn_b32     valid;
+    char const *keys     [N];                              // The strings the table was made from, in order
+    Dqn_isize   key_sizes[N];
+    Dqn_u32     seeds    [N];                              // Seed of each bucket, a string's bucket is picked from its hash
+    Dqn_i32     slots    [Dqn_PerfectHash__SlotCount(N)]; // Index into 'keys' or -1 if the slot is empty
+};
+
+template <Dqn_isize N> constexpr Dqn_PerfectHash<N> Dqn_PerfectHash_Init(char const *const (&keys)[N]);
+
+// Return the index of 'key' in the list the table was made from or -1 if it's not in the table
+template <Dqn_isize N> constexpr Dqn_isize          Dqn_PerfectHash_Find(Dqn_PerfectHash<N> const *table, char const *key, Dqn_isize size);
+template <Dqn_isize N> DQN_API   Dqn_isize          Dqn_PerfectHash_Find(Dqn_PerfectHash<N> const *table, Dqn_String key);
+
+// -------------------------------------------------------------------------------------------------
+//
+// NOTE: Dqn_AhoCorasick
+//
+// -------------------------------------------------------------------------------------------------
+// Finds any of a set of patterns (keywords, markers) in a buffer in a single pass, built once and
+// reused for every buffer. The patterns form a trie that is completed into a DFA, each input byte
+// is one table lookup no matter how many patterns there are, unlike Dqn_Str_FindMulti which
+// compares every pattern at every offset.
+//
+// Bytes that don't appear in any pattern share a column of the table so the table is
+// (states * distinct pattern bytes) entries. Matches are reported at the byte they end on, at the
+// same end the longest pattern comes first. Empty patterns never match.
+/*
+   Dqn_String      keywords[] = {DQN_STRING("error"), DQN_STRING("timeout"), DQN_STRING("refused")};
+   Dqn_AhoCorasick matcher    = Dqn_AhoCorasick_InitWithArena(&arena, keywords, Dqn_ArrayCountI(keywords));
+
+   Dqn_AhoCorasickMatch match = {};
+   if (Dqn_AhoCorasick_FindFirst(&matcher, record, record_size, &match))
+       // keywords[match.pattern_index] is at record + match.offset
+
+   Dqn_List<Dqn_AhoCorasickMatch> matches = Dqn_List_InitWithArena<Dqn_AhoCorasickMatch>(&arena);
+   Dqn_AhoCorasick_FindAll(&matcher, record, record_size, &matches);
+*/
+struct Dqn_AhoCorasickMatch
+{
+    Dqn_isize pattern_index; // Index into the patterns the matcher was built from
+    Dqn_isize offset;        // Offset of the start of the match in the buffer
+    Dqn_isize size;
+};
+
+struct Dqn_AhoCorasick
+{
+    Dqn_u16    byte_class[256]; // Column of each byte in 'next', 0 for bytes in no pattern
+    Dqn_isize  class_count;
+    Dqn_isize  state_count;
+    Dqn_u32   *next;            // [state_count * class_count] Row offset of the next state, DQN_AHO_CORASICK__OUTPUT_BIT set if it ends a pattern
+    Dqn_i32   *output;          // [state_count] Longest pattern ending at the state or -1
+    Dqn_i32   *output_link;     // [state_count] Next state down the suffix chain with an output or -1
+    Dqn_isize *pattern_sizes;
+    Dqn_isize  pattern_count;
+};
+
+Dqn_u32 constexpr DQN_AHO_CORASICK__OUTPUT_BIT = 1u << 31;
+
+// Returns a zero initialised matcher if the arena could not allocate the tables
+DQN_API Dqn_AhoCorasick Dqn_AhoCorasick_InitWithArena(Dqn_ArenaAllocator *arena, Dqn_String const *patterns, Dqn_isize pattern_count);
+
+// Find the match that ends first in the buffer
+DQN_API Dqn_b32         Dqn_AhoCorasick_FindFirst    (Dqn_AhoCorasick const *matcher, char const *buf, Dqn_isize buf_len, Dqn_AhoCorasickMatch *match);
+
+// Append every match, including overlapping ones, to 'matches' and return the number appended
+DQN_API Dqn_isize       Dqn_AhoCorasick_FindAll      (Dqn_AhoCorasick const *matcher, char const *buf, Dqn_isize buf_len, Dqn_List<Dqn_AhoCorasickMatch> *matches);
 // -------------------------------------------------------------------------------------------------
 //
 // NOTE: Hashing - Dqn_FNV1A[32|64]
@@ -1987,6 +2941,100 @@ DQN_API Dqn_u32             Dqn_MurmurHash3_x86_32 (void const *key, int len, Dq
 DQN_API Dqn_MurmurHash3_128 Dqn_MurmurHash3_x64_128(void const *key, int len, Dqn_u32 seed);
 #define DQN_MURMUR_HASH3_U128_AS_U64(key, len, seed) (Dqn_MurmurHash3_x64_128(key, len, seed).e[0])
 
+// NOTE: Streaming Dqn_MurmurHash3_x64_128, hashes data that arrives in pieces (a file read in
+// chunks, the blocks of a Dqn_StringBuilder) without concatenating it first. The result is
+// identical to hashing all the pieces as one buffer with Dqn_MurmurHash3_x64_128.
+//
+// Usage
+//
+// Dqn_MurmurHash3_x64_128State state = Dqn_MurmurHash3_x64_128_Init(seed);
+// Dqn_MurmurHash3_x64_128_Update(&state, chunk1, chunk1_size);
+// Dqn_MurmurHash3_x64_128_Update(&state, chunk2, chunk2_size);
+// Dqn_MurmurHash3_128 hash = Dqn_MurmurHash3_x64_128_Final(&state);
+//
+struct Dqn_MurmurHash3_x64_128State
+{
+    Dqn_u64 h1;
+    Dqn_u64 h2;
+    Dqn_u64 size;     // Total number of bytes given to Update
+    Dqn_u8  tail[16]; // The bytes of the incomplete block, (size % 16) of them are valid
+};
+
+DQN_API Dqn_MurmurHash3_x64_128State Dqn_MurmurHash3_x64_128_Init  (Dqn_u32 seed);
+DQN_API void                         Dqn_MurmurHash3_x64_128_Update(Dqn_MurmurHash3_x64_128State *state, void const *bytes, Dqn_isize size);
+
+// The state is left untouched so more data can be added after taking the hash of what came before
+DQN_API Dqn_MurmurHash3_128          Dqn_MurmurHash3_x64_128_Final (Dqn_MurmurHash3_x64_128State const *state);
+
+// -------------------------------------------------------------------------------------------------
+//
+// NOTE: Hashing - Dqn_FastHash64
+//
+// -------------------------------------------------------------------------------------------------
+// A 64 bit non-cryptographic hash built from the same pieces as wyhash and xxHash3. Inputs up to 16
+// bytes are folded into 2 words and mixed with 2 128 bit multiplies, inputs up to 256 bytes are
+// chained through a multiply every 16 bytes. Longer inputs are consumed in 64 byte stripes by 8
+// independent accumulators which map onto SSE2/AVX2 registers.
+//
+// The long input path is picked at runtime from Dqn_CPU_Features(), every path produces the same
+// hash for the same bytes and seed so hashes can be persisted and shared between machines.
+//
+// Usage
+//
+// Dqn_u64 hash = Dqn_FastHash64(buffer, sizeof(buffer));
+// Dqn_u64 hash = Dqn_FastHash64(buffer, sizeof(buffer), seed);
+//
+enum struct Dqn_FastHashPath
+{
+    Scalar,
+    SSE2,
+    AVX2,
+};
+
+DQN_API Dqn_u64          Dqn_FastHash64         (void const *bytes, Dqn_isize size, Dqn_u64 seed = 0);
+
+// Hash using at most 'path' for long inputs, the path is capped to the one Dqn_FastHash64_Path()
+// returns if the CPU doesn't support it.
+DQN_API Dqn_u64          Dqn_FastHash64_WithPath(void const *bytes, Dqn_isize size, Dqn_u64 seed, Dqn_FastHashPath path);
+
+// Return the fastest long input path supported by the CPU and compiled in
+DQN_API Dqn_FastHashPath Dqn_FastHash64_Path    ();
+
+// -------------------------------------------------------------------------------------------------
+//
+// NOTE: Hashing - Dqn_CRC32C
+//
+// -------------------------------------------------------------------------------------------------
+// CRC-32C (Castagnoli polynomial, the checksum of iSCSI, ext4 and SSE4.2's CRC32 instruction) for
+// checking data integrity, e.g. files written and read back. Computed with the CRC32 instruction
+// over 3 interleaved streams when the CPU has SSE4.2, otherwise with slice-by-8 tables.
+//
+// Usage
+//
+// Dqn_u32 crc = Dqn_CRC32C(buffer1, sizeof(buffer1));
+// crc         = Dqn_CRC32C_Iterate(buffer2, sizeof(buffer2), crc); // Checksum of buffer1 followed by buffer2
+//
+// // Checksum 2 halves on different threads then join them
+// Dqn_u32 crc_a = Dqn_CRC32C(buffer, half);
+// Dqn_u32 crc_b = Dqn_CRC32C(buffer + half, size - half);
+// Dqn_u32 crc   = Dqn_CRC32C_Combine(crc_a, crc_b, size - half); // == Dqn_CRC32C(buffer, size)
+//
+enum struct Dqn_CRC32CPath
+{
+    Software,
+    SSE42,
+};
+
+DQN_API Dqn_u32        Dqn_CRC32C                (void const *bytes, Dqn_isize size);
+DQN_API Dqn_u32        Dqn_CRC32C_Iterate        (void const *bytes, Dqn_isize size, Dqn_u32 crc);
+
+// Continue a checksum with at most 'path', the path is capped to the one Dqn_CRC32C_Path() returns
+DQN_API Dqn_u32        Dqn_CRC32C_IterateWithPath(void const *bytes, Dqn_isize size, Dqn_u32 crc, Dqn_CRC32CPath path);
+
+// Return the checksum of A followed by B given the checksums of A and B and the size of B
+DQN_API Dqn_u32        Dqn_CRC32C_Combine        (Dqn_u32 crc_a, Dqn_u32 crc_b, Dqn_isize size_b);
+DQN_API Dqn_CRC32CPath Dqn_CRC32C_Path           ();
+
 // -------------------------------------------------------------------------------------------------
 //
 // NOTE: Template Implementation
@@ -2003,8 +3051,11 @@ void Dqn_StringMap__InitializeSize(Dqn_StringMap<T> *map, Dqn_isize size)
     Dqn_Allocator *allocator = map->allocator ? map->allocator : &map->backup_allocator;
     if (map->size == 0)
     {
-        Dqn_isize final_size = size == 0 ? 4096 : size;
-        map->values          = Dqn_Allocator_NewArray(allocator, Dqn_StringMapEntry<T> *, final_size, Dqn_ZeroMem::Yes);
+        Dqn_isize final_size = 16;
+        while (final_size < (size == 0 ? 4096 : size))
+            final_size *= 2;
+
+        map->values = Dqn_Allocator_NewArray(allocator, Dqn_StringMapEntry<T>, final_size, Dqn_ZeroMem::Yes);
         if (map->values) map->size = final_size;
     }
 }
@@ -2019,52 +3070,93 @@ Dqn_StringMap<T> Dqn_StringMap_InitWithArena(Dqn_ArenaAllocator *arena, Dqn_isiz
     return result;
 }
 
+template <typename T>
+void Dqn_StringMap_Free(Dqn_StringMap<T> *map)
+{
+    Dqn_Allocator *allocator = map->allocator ? map->allocator : &map->backup_allocator;
+    Dqn_Allocator_Free(allocator, map->values);
+    map->values = nullptr;
+    map->size   = 0;
+    map->count  = 0;
+}
+
 template <typename T>
 Dqn_u64 Dqn_StringMap_Hash(Dqn_StringMap<T> *map, Dqn_String key)
 {
     Dqn_u32 const DEFAULT_SEED = 81273182;
-    Dqn_u64       result =
-        DQN_MURMUR_HASH3_U128_AS_U64(key.str, DQN_CAST(int)key.size, map->hashing_seed ? map->hashing_seed : DEFAULT_SEED);
+    Dqn_u64       result       = Dqn_FastHash64(key.str, key.size, map->hashing_seed ? map->hashing_seed : DEFAULT_SEED);
     return result;
 }
 
+// Returns the slot holding 'key' or the empty slot where it belongs. 'hash' must not be 0, the map
+// is never full so the probe always terminates.
 template <typename T>
-Dqn_StringMapEntry<T> *Dqn_StringMap_Add(Dqn_StringMap<T> *map, Dqn_String key, T *value, Dqn_StringMapCollisionRule rule)
+Dqn_StringMapEntry<T> *Dqn_StringMap__Find(Dqn_StringMap<T> *map, Dqn_String key, Dqn_u64 hash)
 {
-    Dqn_StringMap__InitializeSize(map, 0 /*size*/);
-    Dqn_u64                hash      = Dqn_StringMap_Hash(map, key);
-    Dqn_isize              index     = hash % map->size;
-    Dqn_StringMapEntry<T> *result    = map->values[index];
-    Dqn_Allocator *        allocator = map->allocator ? map->allocator : &map->backup_allocator;
-
-    if (result)
+    Dqn_usize              mask   = DQN_CAST(Dqn_usize)(map->size - 1);
+    Dqn_usize              index  = hash & mask;
+    Dqn_StringMapEntry<T> *result = map->values + index;
+    while (result->hash && !(result->hash == hash && result->key == key))
     {
-        if (rule == Dqn_StringMapCollisionRule::Chain)
-        {
-            while (!Dqn_String_Compare(result->key, key))
-            {
-                if (result->next)
-                    result = result->next;
-                else
-                {
-                    result->next = Dqn_Allocator_New(allocator, Dqn_StringMapEntry<T>, Dqn_ZeroMem::No);
-                    result       = result->next;
-                    break;
-                }
-            }
-        }
+        index  = (index + 1) & mask;
+        result = map->values + index;
     }
-    else
+    return result;
+}
+
+template <typename T>
+Dqn_b32 Dqn_StringMap__Grow(Dqn_StringMap<T> *map)
+{
+    Dqn_Allocator *        allocator  = map->allocator ? map->allocator : &map->backup_allocator;
+    Dqn_isize              new_size   = map->size * 2;
+    Dqn_StringMapEntry<T> *new_values = Dqn_Allocator_NewArray(allocator, Dqn_StringMapEntry<T>, new_size, Dqn_ZeroMem::Yes);
+    if (!new_values)
+        return false;
+
+    // NOTE: Re-insert by the stored hash, keys never have to be hashed or compared again
+    Dqn_usize mask = DQN_CAST(Dqn_usize)(new_size - 1);
+    DQN_FOR_EACH(old_index, map->size)
     {
-        result             = Dqn_Allocator_New(allocator, Dqn_StringMapEntry<T>, Dqn_ZeroMem::No);
-        map->values[index] = result;
+        Dqn_StringMapEntry<T> const *entry = map->values + old_index;
+        if (entry->hash == 0)
+            continue;
+
+        Dqn_usize index = entry->hash & mask;
+        while (new_values[index].hash)
+            index = (index + 1) & mask;
+        new_values[index] = *entry;
     }
 
-    if (result)
+    Dqn_Allocator_Free(allocator, map->values);
+    map->values = new_values;
+    map->size   = new_size;
+    return true;
+}
+
+template <typename T>
+Dqn_StringMapEntry<T> *Dqn_StringMap_Add(Dqn_StringMap<T> *map, Dqn_String key, T *value, Dqn_StringMapCollisionRule rule)
+{
+    Dqn_StringMap__InitializeSize(map, 0 /*size*/);
+    if (!map->values)
+        return nullptr;
+
+    // NOTE: Grow at 3/4 load, this also guarantees an empty slot for probes to terminate on
+    if ((map->count + 1) * 4 > map->size * 3 && !Dqn_StringMap__Grow(map))
+        return nullptr;
+
+    Dqn_u64                hash   = Dqn_StringMap_Hash(map, key);
+    hash                          = hash ? hash : 1;
+    Dqn_StringMapEntry<T> *result = Dqn_StringMap__Find(map, key, hash);
+    if (result->hash == 0)
     {
+        result->hash  = hash;
         result->key   = key;
         result->value = value;
-        result->next  = nullptr;
+        map->count++;
+    }
+    else if (rule == Dqn_StringMapCollisionRule::Overwrite)
+    {
+        result->value = value;
     }
 
     return result;
@@ -2073,16 +3165,56 @@ Dqn_StringMapEntry<T> *Dqn_StringMap_Add(Dqn_StringMap<T> *map, Dqn_String key,
 template <typename T>
 Dqn_StringMapEntry<T> *Dqn_StringMap_Get(Dqn_StringMap<T> *map, Dqn_String key)
 {
-    Dqn_u64                hash   = Dqn_StringMap_Hash(map, key);
-    Dqn_isize              index  = hash % map->size;
     Dqn_StringMapEntry<T> *result = nullptr;
+    if (map->size)
+    {
+        Dqn_u64 hash = Dqn_StringMap_Hash(map, key);
+        hash         = hash ? hash : 1;
+        result       = Dqn_StringMap__Find(map, key, hash);
+        if (result->hash == 0) result = nullptr;
+    }
+    return result;
+}
 
-    for (result = map->values[index]; result; result = result->next)
+template <typename T>
+Dqn_isize Dqn_StringMap_GetBatch(Dqn_StringMap<T> *map, Dqn_String const *keys, Dqn_isize count, Dqn_StringMapEntry<T> **results)
+{
+    Dqn_isize result = 0;
+    if (!map->size)
     {
-        if (result->key == key)
-            break;
+        DQN_FOR_EACH(index, count)
+            results[index] = nullptr;
+        return result;
     }
 
+    Dqn_usize mask = DQN_CAST(Dqn_usize)(map->size - 1);
+    Dqn_u64   hashes[DQN_MAP_GET_BATCH_SIZE];
+    for (Dqn_isize batch = 0; batch < count; batch += DQN_MAP_GET_BATCH_SIZE)
+    {
+        Dqn_isize batch_count = DQN_M_MIN(count - batch, DQN_MAP_GET_BATCH_SIZE);
+        DQN_FOR_EACH(index, batch_count)
+        {
+            Dqn_u64 hash  = Dqn_StringMap_Hash(map, keys[batch + index]);
+            hashes[index] = hash ? hash : 1;
+            DQN_PREFETCH(map->values + (hashes[index] & mask));
+        }
+
+        // NOTE: The home slots are in flight, the stored key of a matching hash is the next miss
+        DQN_FOR_EACH(index, batch_count)
+        {
+            Dqn_StringMapEntry<T> const *entry = map->values + (hashes[index] & mask);
+            if (entry->hash == hashes[index])
+                DQN_PREFETCH(entry->key.str);
+        }
+
+        DQN_FOR_EACH(index, batch_count)
+        {
+            Dqn_StringMapEntry<T> *entry = Dqn_StringMap__Find(map, keys[batch + index], hashes[index]);
+            if (entry->hash == 0) entry = nullptr;
+            results[batch + index] = entry;
+            result += entry != nullptr;
+        }
+    }
     return result;
 }
 
@@ -2272,99 +3404,144 @@ DQN_API Dqn_b32 operator==(Dqn_Slice<T> const &lhs, Dqn_Slice<T> const &rhs)
 // NOTE: Dqn_Map Template Implementation
 //
 // -------------------------------------------------------------------------------------------------
+// Finalizer from MurmurHash3, spreads keys like pointers and sequential ids (whose low bits are
+// mostly zero or mostly the same) evenly across the slots of the map.
+DQN_FORCE_INLINE constexpr Dqn_u64 Dqn_Map__HashKey(Dqn_u64 key)
+{
+    Dqn_u64 result = key;
+    result ^= result >> 33;
+    result *= 0xff51afd7ed558ccdULL;
+    result ^= result >> 33;
+    result *= 0xc4ceb9fe1a85ec53ULL;
+    result ^= result >> 33;
+    return result;
+}
+
 template <typename T>
-Dqn_isize Dqn_Map_MemoryRequired(Dqn_isize num_values)
+DQN_FORCE_INLINE Dqn_b32 Dqn_Map__SlotIsUsed(Dqn_Map<T> const *map, Dqn_isize index)
 {
     Dqn_isize const BITS_PER_BITSET = sizeof(Dqn_MapUsageBitset) * 8;
+    Dqn_MapUsageBitset bit          = DQN_CAST(Dqn_MapUsageBitset)1 << (index % BITS_PER_BITSET);
+    Dqn_b32 result                  = (map->usage_bitsets[index / BITS_PER_BITSET] & bit) != 0;
+    return result;
+}
 
-    Dqn_isize bitsets_required      = (num_values / BITS_PER_BITSET);
-    if (num_values % BITS_PER_BITSET != 0)
-        bitsets_required += 1;
+template <typename T>
+DQN_FORCE_INLINE void Dqn_Map__SetSlotUsed(Dqn_Map<T> *map, Dqn_isize index, Dqn_b32 used)
+{
+    Dqn_isize const BITS_PER_BITSET = sizeof(Dqn_MapUsageBitset) * 8;
+    Dqn_MapUsageBitset bit          = DQN_CAST(Dqn_MapUsageBitset)1 << (index % BITS_PER_BITSET);
+    if (used) map->usage_bitsets[index / BITS_PER_BITSET] |= bit;
+    else      map->usage_bitsets[index / BITS_PER_BITSET] &= ~bit;
+}
 
-    Dqn_isize bytes_for_values = sizeof(T) * num_values;
-    Dqn_isize bytes_for_bitset = bitsets_required * sizeof(Dqn_MapUsageBitset);
-    Dqn_isize result           = bytes_for_values + bytes_for_bitset;
+template <typename T>
+DQN_FORCE_INLINE Dqn_isize Dqn_Map__HomeIndex(Dqn_Map<T> const *map, Dqn_u64 key)
+{
+    Dqn_isize result = DQN_CAST(Dqn_isize)(Dqn_Map__HashKey(key) % DQN_CAST(Dqn_u64)map->size);
     return result;
 }
 
+// Walk the probe sequence of 'key'. Returns the slot holding 'key' and sets found to true, otherwise
+// the first empty slot where it can be inserted, or -1 if the map is full and does not contain it.
 template <typename T>
-Dqn_Map<T> Dqn_Map_InitWithMemory(void *mem, Dqn_isize mem_size)
+Dqn_isize Dqn_Map__ProbeFrom(Dqn_Map<T> const *map, Dqn_u64 key, Dqn_isize home, Dqn_b32 *found)
 {
-    //
-    // NOTE: Calculate how to split up the memory for maximal usage
-    //
-    Dqn_isize bytes_for_values       = 0;
-    Dqn_isize bytes_for_usage_bitset = 0;
-    Dqn_isize values_count           = 0;
-    Dqn_isize usage_bitsets_count    = 0;
+    *found          = false;
+    Dqn_isize index = home;
+    for (Dqn_isize probe = 0; probe < map->size; probe++)
     {
-        Dqn_isize max_values    = mem_size / sizeof(T);
-        Dqn_isize mem_remaining = mem_size - (max_values * sizeof(T));
+        if (!Dqn_Map__SlotIsUsed(map, index))
+            return index;
 
-        Dqn_isize const BITS_PER_BITSET = sizeof(Dqn_MapUsageBitset) * 8;
-        Dqn_isize bitsets_required      = (max_values / BITS_PER_BITSET);
-        if (max_values % BITS_PER_BITSET != 0)
-            bitsets_required += 1;
-
-        bytes_for_usage_bitset = (bitsets_required * sizeof(Dqn_MapUsageBitset));
-        if (mem_remaining < bytes_for_usage_bitset)
+        if (map->keys[index] == key)
         {
-            Dqn_isize extra_bytes_needed = bytes_for_usage_bitset - mem_remaining;
-            Dqn_isize excess_items       = extra_bytes_needed / sizeof(T);
-            if (extra_bytes_needed % sizeof(T) != 0)
-                excess_items += 1;
-            max_values -= excess_items;
+            *found = true;
+            return index;
         }
 
-        bytes_for_values    = max_values * sizeof(T);
-        values_count        = max_values;
-        usage_bitsets_count = bitsets_required;
-
-        DQN_ASSERT(bytes_for_values > 0);
+        if (++index == map->size) index = 0;
     }
 
-    //
-    // NOTE: Generate the map
-    //
-    Dqn_isize bytes_required = bytes_for_values + bytes_for_usage_bitset;
-    (void)bytes_required;
-    DQN_ASSERT_MSG(bytes_required <= mem_size,
-                   "(bytes_for_values = %I64d, bytes_for_usage_bitset = %I64d, mem_size = %I64d)",
-                   bytes_for_values, bytes_for_usage_bitset, mem_size);
-    DQN_ASSERT_MSG(bytes_required >= 0, "(bytes_required = %I64u)", bytes_required);
+    return -1;
+}
 
-    Dqn_Map<T> result         = {};
-    result.values             = DQN_CAST(T *) mem;
-    result.usage_bitsets      = DQN_CAST(Dqn_MapUsageBitset *)(DQN_CAST(Dqn_uintptr) mem + bytes_for_values);
-    result.size               = values_count;
-    result.usage_bitsets_size = usage_bitsets_count;
+template <typename T>
+Dqn_isize Dqn_Map__Probe(Dqn_Map<T> const *map, Dqn_u64 key, Dqn_b32 *found)
+{
+    *found = false;
+    if (map->size <= 0) return -1;
+    Dqn_isize result = Dqn_Map__ProbeFrom(map, key, Dqn_Map__HomeIndex(map, key), found);
+    return result;
+}
+
+template <typename T>
+Dqn_isize Dqn_Map_MemoryRequired(Dqn_isize num_values)
+{
+    Dqn_isize const BITS_PER_BITSET = sizeof(Dqn_MapUsageBitset) * 8;
+
+    Dqn_isize bitsets_required      = (num_values / BITS_PER_BITSET);
+    if (num_values % BITS_PER_BITSET != 0)
+        bitsets_required += 1;
+
+    // NOTE: Memory is laid out as [keys][values][usage bitsets], each array aligned for its type
+    Dqn_isize bytes_for_keys   = sizeof(Dqn_u64) * num_values;
+    Dqn_isize values_offset    = DQN_CAST(Dqn_isize)Dqn_AlignAddress(bytes_for_keys, DQN_CAST(Dqn_u8)alignof(T));
+    Dqn_isize bitsets_offset   = DQN_CAST(Dqn_isize)Dqn_AlignAddress(values_offset + sizeof(T) * num_values, DQN_CAST(Dqn_u8)alignof(Dqn_MapUsageBitset));
+    Dqn_isize bytes_for_bitset = bitsets_required * sizeof(Dqn_MapUsageBitset);
+    Dqn_isize result           = bitsets_offset + bytes_for_bitset;
     return result;
 }
 
 template <typename T>
-Dqn__MapKeyLookup Dqn_Map__GetKeyLookup(Dqn_Map<T> const *map, Dqn_u64 key)
+Dqn_Map<T> Dqn_Map_InitWithMemory(void *mem, Dqn_isize mem_size)
 {
+    DQN_ASSERT_MSG(DQN_CAST(Dqn_uintptr)mem % alignof(Dqn_u64) == 0 && DQN_CAST(Dqn_uintptr)mem % alignof(T) == 0,
+                   "Map memory must be aligned to its key and value types (mem = %p)", mem);
+
+    //
+    // NOTE: Calculate how to split up the memory for maximal usage, every slot costs a key, a value
+    // and a bit of the usage bitset. Estimate from that then shave off slots lost to padding.
+    //
+    Dqn_isize const BITS_PER_SLOT = DQN_CAST(Dqn_isize)((sizeof(Dqn_u64) + sizeof(T)) * 8 + 1);
+    Dqn_isize values_count        = (mem_size * 8) / BITS_PER_SLOT;
+    while (values_count > 0 && Dqn_Map_MemoryRequired<T>(values_count) > mem_size)
+        values_count--;
+    DQN_ASSERT(values_count > 0);
+
+    //
+    // NOTE: Generate the map
+    //
     Dqn_isize const BITS_PER_BITSET = sizeof(Dqn_MapUsageBitset) * 8;
+    Dqn_isize bytes_for_keys        = sizeof(Dqn_u64) * values_count;
+    Dqn_isize values_offset         = DQN_CAST(Dqn_isize)Dqn_AlignAddress(bytes_for_keys, DQN_CAST(Dqn_u8)alignof(T));
+    Dqn_isize bitsets_offset        = DQN_CAST(Dqn_isize)Dqn_AlignAddress(values_offset + sizeof(T) * values_count, DQN_CAST(Dqn_u8)alignof(Dqn_MapUsageBitset));
 
-    Dqn__MapKeyLookup result = {};
-    result.index             = key % map->size;
-    result.bitset_index      = result.index / BITS_PER_BITSET;
-    result.bit_index         = result.index % BITS_PER_BITSET;
-    result.bitset_bit        = 1ULL << result.bit_index;
+    Dqn_Map<T> result         = {};
+    result.keys               = DQN_CAST(Dqn_u64 *) mem;
+    result.values             = DQN_CAST(T *)(DQN_CAST(Dqn_uintptr) mem + values_offset);
+    result.usage_bitsets      = DQN_CAST(Dqn_MapUsageBitset *)(DQN_CAST(Dqn_uintptr) mem + bitsets_offset);
+    result.size               = values_count;
+    result.usage_bitsets_size = (values_count + BITS_PER_BITSET - 1) / BITS_PER_BITSET;
+    DQN_MEMSET(result.usage_bitsets, 0, result.usage_bitsets_size * sizeof(Dqn_MapUsageBitset));
     return result;
 }
 
 template <typename T>
 T *Dqn_Map_FindOrMake(Dqn_Map<T> *map, Dqn_u64 key, Dqn_b32 *found)
 {
-    Dqn__MapKeyLookup lookup = Dqn_Map__GetKeyLookup(map, key);
-    T *               result = &map->values[lookup.index];
-    Dqn_b32           found_ = true;
-    if ((map->usage_bitsets[lookup.bitset_index] & lookup.bitset_bit) == 0)
+    Dqn_b32   found_ = false;
+    Dqn_isize index  = Dqn_Map__Probe(map, key, &found_);
+    T *       result = nullptr;
+    if (index != -1)
     {
-        found_ = false;
-        map->count++;
-        map->usage_bitsets[lookup.bitset_index] |= lookup.bitset_bit;
+        result = &map->values[index];
+        if (!found_)
+        {
+            map->keys[index] = key;
+            Dqn_Map__SetSlotUsed(map, index, true /*used*/);
+            map->count++;
+        }
     }
 
     if (found) *found = found_;
@@ -2376,1765 +3553,4224 @@ Dqn_b32 Dqn_Map_Add(Dqn_Map<T> *map, Dqn_u64 key, T const &value)
 {
     Dqn_b32 found = false;
     T *     entry = Dqn_Map_FindOrMake(map, key, &found);
-    if (!found) *entry = value;
-    Dqn_b32 result = (found == false);
+    if (entry && !found) *entry = value;
+    Dqn_b32 result = (entry && found == false);
     return result;
 }
 
 template <typename T>
 T *Dqn_Map_Get(Dqn_Map<T> *map, Dqn_u64 key)
 {
-    Dqn__MapKeyLookup lookup = Dqn_Map__GetKeyLookup(map, key);
-    T *result = (map->usage_bitsets[lookup.bitset_index] & lookup.bitset_bit) ? &map->values[lookup.index] : nullptr;
+    Dqn_b32   found  = false;
+    Dqn_isize index  = Dqn_Map__Probe(map, key, &found);
+    T *       result = found ? &map->values[index] : nullptr;
     return result;
 }
 
 template <typename T>
-Dqn_b32 Dqn_Map_Erase(Dqn_Map<T> *map, Dqn_u64 key)
+Dqn_isize Dqn_Map_GetBatch(Dqn_Map<T> *map, Dqn_u64 const *keys, Dqn_isize count, T **results)
 {
-    Dqn_b32           result = false;
-    Dqn__MapKeyLookup lookup = Dqn_Map__GetKeyLookup(map, key);
-    if (map->usage_bitsets[lookup.bitset_index] & lookup.bitset_bit)
+    Dqn_isize const BITS_PER_BITSET = sizeof(Dqn_MapUsageBitset) * 8;
+    Dqn_isize result                = 0;
+    if (map->size <= 0)
     {
-        result = true;
-        map->usage_bitsets[lookup.bitset_index] &= ~lookup.bitset_bit;
-        map->count--;
+        DQN_FOR_EACH(index, count)
+            results[index] = nullptr;
+        return result;
     }
 
-    DQN_ASSERT_MSG(map->count >= 0, "(count = %I64d)");
+    Dqn_isize homes[DQN_MAP_GET_BATCH_SIZE];
+    for (Dqn_isize batch = 0; batch < count; batch += DQN_MAP_GET_BATCH_SIZE)
+    {
+        Dqn_isize batch_count = DQN_M_MIN(count - batch, DQN_MAP_GET_BATCH_SIZE);
+        DQN_FOR_EACH(index, batch_count)
+        {
+            Dqn_isize home = Dqn_Map__HomeIndex(map, keys[batch + index]);
+            homes[index]   = home;
+            DQN_PREFETCH(map->usage_bitsets + (home / BITS_PER_BITSET));
+            DQN_PREFETCH(map->keys + home);
+            DQN_PREFETCH(map->values + home);
+        }
+
+        DQN_FOR_EACH(index, batch_count)
+        {
+            Dqn_b32   found = false;
+            Dqn_isize slot  = Dqn_Map__ProbeFrom(map, keys[batch + index], homes[index], &found);
+            results[batch + index] = found ? &map->values[slot] : nullptr;
+            result += found;
+        }
+    }
     return result;
 }
 
-// -------------------------------------------------------------------------------------------------
-//
-// NOTE: Dqn_StringBuilder Template Implementation
-//
-// -------------------------------------------------------------------------------------------------
-
-//
-// NOTE: Dqn_StringBuilder Internal Functions
-//
-template <Dqn_isize N>
-DQN_API void Dqn_StringBuilder__LazyInitialise(Dqn_StringBuilder<N> *builder)
+// Erase the occupied slot at 'hole'
+template <typename T>
+void Dqn_Map__EraseIndex(Dqn_Map<T> *map, Dqn_isize hole)
 {
-    builder->fixed_mem_block.mem  = builder->fixed_mem;
-    builder->fixed_mem_block.size = Dqn_ArrayCount(builder->fixed_mem);
-    builder->fixed_mem_block.used = 0;
-    builder->fixed_mem_block.next = nullptr;
-    builder->last_mem_block       = &builder->fixed_mem_block;
-}
+    //
+    // NOTE: Backward shift deletion. Walk the cluster after the erased slot and move back every entry
+    // whose home slot does not lie cyclically in (hole, index], i.e. entries that probed past the
+    // hole and would become unreachable if it was left empty. The hole is always unused so the walk
+    // terminates even when the map was full.
+    //
+    Dqn_Map__SetSlotUsed(map, hole, false /*used*/);
+    for (Dqn_isize index = (hole + 1 == map->size) ? 0 : hole + 1;
+         Dqn_Map__SlotIsUsed(map, index);
+         index = (index + 1 == map->size) ? 0 : index + 1)
+    {
+        Dqn_isize home        = Dqn_Map__HomeIndex(map, map->keys[index]);
+        Dqn_b32   reachable   = (hole <= index) ? (hole < home && home <= index)
+                                                : (hole < home || home <= index);
+        if (reachable)
+            continue;
 
-template <Dqn_isize N>
-DQN_API char *Dqn_StringBuilder__AllocateWriteBuffer(Dqn_StringBuilder<N> *builder, Dqn_isize size_required)
-{
-    if (!builder->fixed_mem_block.mem)
-    {
-        DQN_ASSERT(!builder->last_mem_block);
-        Dqn_StringBuilder__LazyInitialise(builder);
+        map->keys[hole]   = map->keys[index];
+        map->values[hole] = map->values[index];
+        Dqn_Map__SetSlotUsed(map, hole, true /*used*/);
+        Dqn_Map__SetSlotUsed(map, index, false /*used*/);
+        hole = index;
     }
 
-    Dqn_StringBuilderBlock *block = builder->last_mem_block;
-    Dqn_b32 new_block_needed = (block->size - block->used) < size_required;
-    if (new_block_needed)
+    map->count--;
+    DQN_ASSERT_MSG(map->count >= 0, "(count = %I64d)", map->count);
+}
+
+template <typename T>
+Dqn_b32 Dqn_Map_Erase(Dqn_Map<T> *map, Dqn_u64 key)
+{
+    Dqn_b32   result = false;
+    Dqn_isize index  = Dqn_Map__Probe(map, key, &result);
+    if (result)
+        Dqn_Map__EraseIndex(map, index);
+    return result;
+}
+
+template <typename T>
+Dqn_MapStats Dqn_Map_GetStats(Dqn_Map<T> const *map)
+{
+    Dqn_MapStats result = {};
+    if (map->size <= 0) return result;
+
+    Dqn_isize total_probe_length = 0;
+    for (Dqn_isize index = 0; index < map->size; index++)
     {
-        Dqn_Allocator *allocator = builder->allocator ? builder->allocator : &builder->backup_allocator;
-        Dqn_isize allocation_size = DQN_M_MAX(size_required, DQN_STRING_BUILDER_MIN_BLOCK_SIZE);
-        block                     = Dqn_Allocator_New(allocator, Dqn_StringBuilderBlock, Dqn_ZeroMem::No);
-        if (!block) return nullptr;
+        if (!Dqn_Map__SlotIsUsed(map, index))
+            continue;
 
-        *block                        = {};
-        block->mem                    = DQN_CAST(char *)Dqn_Allocator_Allocate(allocator, allocation_size, alignof(char), Dqn_ZeroMem::No);
-        block->size                   = allocation_size;
-        builder->last_mem_block->next = block;
-        builder->last_mem_block       = builder->last_mem_block->next;
+        Dqn_isize home         = Dqn_Map__HomeIndex(map, map->keys[index]);
+        Dqn_isize probe_length = ((index - home + map->size) % map->size) + 1;
+        total_probe_length    += probe_length;
+        result.max_probe_length = DQN_M_MAX(result.max_probe_length, probe_length);
     }
 
-    char *result = block->mem + block->used;
-    block->used += size_required;
+    result.load_factor = DQN_CAST(Dqn_f64)map->count / DQN_CAST(Dqn_f64)map->size;
+    if (map->count) result.average_probe_length = DQN_CAST(Dqn_f64)total_probe_length / DQN_CAST(Dqn_f64)map->count;
     return result;
 }
 
-template <Dqn_isize N>
-DQN_API char *Dqn_StringBuilder__Build(Dqn_StringBuilder<N> *builder, Dqn_Allocator *allocator, Dqn_isize *len DQN_CALL_SITE_ARGS)
+// -------------------------------------------------------------------------------------------------
+//
+// NOTE: Dqn_FlatMap Template Implementation
+//
+// -------------------------------------------------------------------------------------------------
+// Returns a bitmask where bit N is set if the N'th control word of the group equals 'ctrl_byte'
+DQN_FORCE_INLINE Dqn_u32 Dqn_FlatMap__GroupMatch(Dqn_u8 const *group, Dqn_u8 ctrl_byte)
 {
-    Dqn_isize len_ = 0;
-    if (!len) len = &len_;
-    *len = Dqn_StringBuilder_GetSize(builder);
-    auto *result  = DQN_CAST(char *)Dqn_Allocator__Allocate(allocator, *len + 1, alignof(char), Dqn_ZeroMem::No DQN_CALL_SITE_ARGS_INPUT);
-    Dqn_StringBuilder_BuildToDest(builder, result, *len + 1);
+#if defined(DQN_SSE2)
+    __m128i ctrl   = _mm_loadu_si128(DQN_CAST(__m128i const *)group);
+    Dqn_u32 result = DQN_CAST(Dqn_u32)_mm_movemask_epi8(_mm_cmpeq_epi8(ctrl, _mm_set1_epi8(DQN_CAST(char)ctrl_byte)));
+#else
+    Dqn_u32 result = 0;
+    for (Dqn_u32 index = 0; index < DQN_FLAT_MAP_GROUP_SIZE; index++)
+        result |= DQN_CAST(Dqn_u32)(group[index] == ctrl_byte) << index;
+#endif
     return result;
 }
 
-//
-// NOTE: Dqn_StringBuilder Functions
-//
-template <Dqn_isize N>
-DQN_API void Dqn_StringBuilder_InitWithArena(Dqn_StringBuilder<N> *builder, Dqn_ArenaAllocator *arena)
+// Returns a bitmask where bit N is set if the N'th slot of the group is empty or deleted. Both
+// control words have the high bit set, occupied slots store 7 bits of hash and never do.
+DQN_FORCE_INLINE Dqn_u32 Dqn_FlatMap__GroupMatchFree(Dqn_u8 const *group)
 {
-    *builder                  = {};
-    builder->backup_allocator = Dqn_Allocator_InitWithArena(arena);
-    Dqn_StringBuilder__LazyInitialise(builder);
+#if defined(DQN_SSE2)
+    Dqn_u32 result = DQN_CAST(Dqn_u32)_mm_movemask_epi8(_mm_loadu_si128(DQN_CAST(__m128i const *)group));
+#else
+    Dqn_u32 result = 0;
+    for (Dqn_u32 index = 0; index < DQN_FLAT_MAP_GROUP_SIZE; index++)
+        result |= DQN_CAST(Dqn_u32)(group[index] >> 7) << index;
+#endif
+    return result;
 }
 
-template <Dqn_isize N>
-DQN_API void Dqn_StringBuilder_InitWithAllocator(Dqn_StringBuilder<N> *builder, Dqn_Allocator *allocator)
+template <typename K, typename V>
+Dqn_isize Dqn_FlatMap_MemoryRequired(Dqn_isize num_values)
 {
-    *builder           = {};
-    builder->allocator = allocator;
-    Dqn_StringBuilder__LazyInitialise(builder);
+    using Slot     = Dqn_FlatMapSlot<K, V>;
+    Dqn_isize size = DQN_FLAT_MAP_GROUP_SIZE;
+    while (size < num_values)
+        size *= 2;
+
+    // NOTE: Memory is laid out as [ctrl][slots], the ctrl array is a multiple of the group size
+    Dqn_isize slots_offset = DQN_CAST(Dqn_isize)Dqn_AlignAddress(size, DQN_CAST(Dqn_u8)alignof(Slot));
+    Dqn_isize result       = slots_offset + size * sizeof(Slot);
+    return result;
 }
 
-template <Dqn_isize N>
-DQN_API Dqn_isize Dqn_StringBuilder_GetSize(Dqn_StringBuilder<N> const *builder)
+template <typename K, typename V>
+Dqn_FlatMap<K, V> Dqn_FlatMap_InitWithMemory(void *mem, Dqn_isize mem_size)
 {
-    Dqn_isize result = 0;
-    for (Dqn_StringBuilderBlock const *block = &builder->fixed_mem_block;
-         block;
-         block = block->next)
-    {
-        result += block->used;
-    }
+    using Slot = Dqn_FlatMapSlot<K, V>;
+    DQN_ASSERT_MSG(DQN_CAST(Dqn_uintptr)mem % alignof(Slot) == 0, "Map memory must be aligned to its slot type (mem = %p)", mem);
+
+    Dqn_isize size = DQN_FLAT_MAP_GROUP_SIZE;
+    while (Dqn_FlatMap_MemoryRequired<K, V>(size * 2) <= mem_size)
+        size *= 2;
 
+    Dqn_isize bytes_required = Dqn_FlatMap_MemoryRequired<K, V>(size);
+    (void)bytes_required;
+    DQN_ASSERT_MSG(bytes_required <= mem_size, "Not enough memory for one group of slots (mem_size = %zd)", mem_size);
+
+    Dqn_isize slots_offset   = DQN_CAST(Dqn_isize)Dqn_AlignAddress(size, DQN_CAST(Dqn_u8)alignof(Slot));
+    Dqn_FlatMap<K, V> result = {};
+    result.size              = size;
+    result.ctrl              = DQN_CAST(Dqn_u8 *) mem;
+    result.slots             = DQN_CAST(Slot *)(DQN_CAST(Dqn_uintptr) mem + slots_offset);
+    DQN_MEMSET(result.ctrl, DQN_FLAT_MAP_CTRL_EMPTY, size);
     return result;
 }
 
-template <Dqn_isize N>
-DQN_API void Dqn_StringBuilder_BuildToDest(Dqn_StringBuilder<N> const *builder, char *dest, Dqn_usize dest_size)
+// Returns the slot index holding 'key' or -1 if it's not in the map. The top bits of the hash select
+// the first group, the low 7 bits are stored in the control word to filter slots within a group.
+template <typename K, typename V>
+Dqn_isize Dqn_FlatMap__Find(Dqn_FlatMap<K, V> const *map, K key, Dqn_u64 hash)
 {
-    if (!dest) return;
-    if (dest_size == 1) { dest[0] = 0; return; }
+    Dqn_isize group_mask = (map->size / DQN_FLAT_MAP_GROUP_SIZE) - 1;
+    Dqn_isize group      = DQN_CAST(Dqn_isize)(hash >> 7) & group_mask;
+    Dqn_u8    hash_ctrl  = DQN_CAST(Dqn_u8)(hash & 0x7F);
 
-    char *ptr                 = dest;
-    char const *end           = dest + dest_size;
-    Dqn_isize remaining_space = end - ptr;
-    for (Dqn_StringBuilderBlock const *block = &builder->fixed_mem_block;
-         block && remaining_space > 0;
-         block = block->next, remaining_space = end - ptr)
+    // NOTE: Triangular probing visits every group exactly once for a power of 2 group count
+    for (Dqn_isize step = 0; step <= group_mask; step++)
     {
-        Dqn_isize num_bytes     = block->used;
-        Dqn_isize bytes_to_copy = DQN_M_MIN(num_bytes, remaining_space);
-        DQN_MEMCOPY(ptr, block->mem, bytes_to_copy);
-        ptr += bytes_to_copy;
+        Dqn_u8 const *ctrl = map->ctrl + (group * DQN_FLAT_MAP_GROUP_SIZE);
+        for (Dqn_u32 match = Dqn_FlatMap__GroupMatch(ctrl, hash_ctrl); match; match &= match - 1)
+        {
+            Dqn_isize index = (group * DQN_FLAT_MAP_GROUP_SIZE) + Dqn_CountTrailingZerosU32(match);
+            if (map->slots[index].key == key)
+                return index;
+        }
+
+        // NOTE: Inserts fill the first free slot of the probe sequence, an empty slot ends it
+        if (Dqn_FlatMap__GroupMatch(ctrl, DQN_FLAT_MAP_CTRL_EMPTY))
+            break;
+
+        group = (group + step + 1) & group_mask;
     }
 
-    if (remaining_space > 0) ptr[ 0] = 0; // Append null terminator
-    else                     ptr[-1] = 0; // Oops ran out of space. Terminate the output prematurely.
+    return -1;
 }
 
-template <Dqn_isize N>
-DQN_API Dqn_String Dqn_StringBuilder_BuildStringWithAllocator(Dqn_StringBuilder<N> *builder, Dqn_Allocator *allocator)
+template <typename K, typename V>
+V *Dqn_Map_FindOrMake(Dqn_FlatMap<K, V> *map, typename Dqn_FlatMap<K, V>::Key key, Dqn_b32 *found)
 {
-    Dqn_String result = {};
-    result.str        = Dqn_StringBuilder_Build(builder, allocator, &result.size);
-    result.cap        = result.size;
+    Dqn_u64   hash   = Dqn_Map__HashKey(DQN_CAST(Dqn_u64)key);
+    Dqn_isize index  = Dqn_FlatMap__Find(map, key, hash);
+    Dqn_b32   found_ = (index != -1);
+    if (!found_)
+    {
+        // NOTE: Only empty slots end the probe for a missing key, at high load erasing and adding
+        // keys can turn every empty slot into a tombstone and make each miss scan the whole map.
+        Dqn_isize empty = map->size - map->count - map->tombstones;
+        if (map->tombstones > map->size / 8 || (map->tombstones > empty && map->tombstones >= map->size / 32))
+            Dqn_FlatMap_Rehash(map);
+
+        Dqn_isize group_mask = (map->size / DQN_FLAT_MAP_GROUP_SIZE) - 1;
+        Dqn_isize group      = DQN_CAST(Dqn_isize)(hash >> 7) & group_mask;
+        for (Dqn_isize step = 0; step <= group_mask; step++)
+        {
+            Dqn_u32 free_slots = Dqn_FlatMap__GroupMatchFree(map->ctrl + (group * DQN_FLAT_MAP_GROUP_SIZE));
+            if (free_slots)
+            {
+                index = (group * DQN_FLAT_MAP_GROUP_SIZE) + Dqn_CountTrailingZerosU32(free_slots);
+                if (map->ctrl[index] == DQN_FLAT_MAP_CTRL_DELETED)
+                    map->tombstones--;
+
+                map->ctrl[index]      = DQN_CAST(Dqn_u8)(hash & 0x7F);
+                map->slots[index].key = key;
+                map->count++;
+                break;
+            }
+            group = (group + step + 1) & group_mask;
+        }
+    }
+
+    V *result = (index != -1) ? &map->slots[index].value : nullptr;
+    if (found) *found = found_;
     return result;
 }
 
-template <Dqn_isize N>
-DQN_API Dqn_String Dqn_StringBuilder_BuildStringWithArena(Dqn_StringBuilder<N> *builder, Dqn_ArenaAllocator *arena)
+template <typename K, typename V>
+Dqn_b32 Dqn_Map_Add(Dqn_FlatMap<K, V> *map, typename Dqn_FlatMap<K, V>::Key key, typename Dqn_FlatMap<K, V>::Value const &value)
 {
-    Dqn_Allocator allocator = Dqn_Allocator_InitWithArena(arena);
-    Dqn_String result       = Dqn_StringBuilder_BuildStringWithAllocator(builder, &allocator);
+    Dqn_b32 found = false;
+    V *     entry = Dqn_Map_FindOrMake(map, key, &found);
+    if (entry && !found) *entry = value;
+    Dqn_b32 result = (entry && found == false);
     return result;
 }
 
-template <Dqn_isize N>
-DQN_API void Dqn_StringBuilder_AppendFmtV(Dqn_StringBuilder<N> *builder, char const *fmt, va_list va)
+template <typename K, typename V>
+V *Dqn_Map_Get(Dqn_FlatMap<K, V> *map, typename Dqn_FlatMap<K, V>::Key key)
 {
-    if (!fmt) return;
-    va_list va2;
-    va_copy(va2, va);
-    Dqn_isize len     = stbsp_vsnprintf(nullptr, 0, fmt, va);
-    char *buf         = Dqn_StringBuilder__AllocateWriteBuffer(builder, len + 1);
-    stbsp_vsnprintf(buf, static_cast<int>(len + 1), fmt, va2);
-    va_end(va2);
-
-    DQN_ASSERT(builder->last_mem_block->used >= 0);
-    builder->last_mem_block->used--; // stbsp_vsnprintf null terminates, back out the null-terminator from the mem block
+    Dqn_isize index  = Dqn_FlatMap__Find(map, key, Dqn_Map__HashKey(DQN_CAST(Dqn_u64)key));
+    V *       result = (index != -1) ? &map->slots[index].value : nullptr;
+    return result;
 }
 
-template <Dqn_isize N>
-DQN_API void Dqn_StringBuilder_AppendFmt(Dqn_StringBuilder<N> *builder, char const *fmt, ...)
+template <typename K, typename V>
+Dqn_b32 Dqn_Map_Erase(Dqn_FlatMap<K, V> *map, typename Dqn_FlatMap<K, V>::Key key)
 {
-    va_list va;
-    va_start(va, fmt);
-    Dqn_StringBuilder_AppendFmtV(builder, fmt, va);
-    va_end(va);
-}
+    Dqn_isize index  = Dqn_FlatMap__Find(map, key, Dqn_Map__HashKey(DQN_CAST(Dqn_u64)key));
+    Dqn_b32   result = index != -1;
+    if (!result)
+        return result;
 
-template <Dqn_isize N>
-DQN_API void Dqn_StringBuilder_Append(Dqn_StringBuilder<N> *builder, char const *str, Dqn_isize len)
-{
-    if (!str) return;
-    if (len == -1) len = DQN_CAST(Dqn_isize)Dqn_Str_Len(str);
-    if (len == 0) return;
-    char *buf = Dqn_StringBuilder__AllocateWriteBuffer(builder, len);
-    DQN_MEMCOPY(buf, str, len);
-}
+    // NOTE: A group that still has an empty slot never had a probe sequence continue past it, so the
+    // erased slot can go back to empty. Otherwise leave a tombstone to keep later groups reachable.
+    Dqn_u8 const *group = map->ctrl + (index - (index % DQN_FLAT_MAP_GROUP_SIZE));
+    if (Dqn_FlatMap__GroupMatch(group, DQN_FLAT_MAP_CTRL_EMPTY))
+    {
+        map->ctrl[index] = DQN_FLAT_MAP_CTRL_EMPTY;
+    }
+    else
+    {
+        map->ctrl[index] = DQN_FLAT_MAP_CTRL_DELETED;
+        map->tombstones++;
+    }
 
-template <Dqn_isize N>
-DQN_API void Dqn_StringBuilder_AppendString(Dqn_StringBuilder<N> *builder, Dqn_String const string)
-{
-    if (!string.str || string.size == 0) return;
-    char *buf = Dqn_StringBuilder__AllocateWriteBuffer(builder, string.size);
-    DQN_MEMCOPY(buf, string.str, string.size);
+    map->count--;
+    DQN_ASSERT_MSG(map->count >= 0, "(count = %zd)", map->count);
+    return result;
 }
 
-template <Dqn_isize N>
-DQN_API void Dqn_StringBuilder_AppendChar(Dqn_StringBuilder<N> *builder, char ch)
+template <typename K, typename V>
+void Dqn_FlatMap_Rehash(Dqn_FlatMap<K, V> *map)
 {
-    char *buf = Dqn_StringBuilder__AllocateWriteBuffer(builder, 1);
-    *buf++    = ch;
+    // NOTE: Mark the values as DELETED and the tombstones as EMPTY then place the marked values one at
+    // a time into the first free slot of their probe sequence. A value whose own group is that first
+    // free group stays, otherwise it moves into an empty slot or swaps with a marked value that is
+    // placed next. Any value placed earlier whose probe crossed a marked slot would have stopped
+    // there, so emptying a slot that a value moved out of never cuts a probe sequence short.
+    for (Dqn_isize index = 0; index < map->size; index++)
+        map->ctrl[index] = (map->ctrl[index] & 0x80) ? DQN_FLAT_MAP_CTRL_EMPTY : DQN_FLAT_MAP_CTRL_DELETED;
+
+    Dqn_isize group_mask = (map->size / DQN_FLAT_MAP_GROUP_SIZE) - 1;
+    for (Dqn_isize index = 0; index < map->size; index++)
+    {
+        if (map->ctrl[index] != DQN_FLAT_MAP_CTRL_DELETED)
+            continue;
+
+        Dqn_u64   hash   = Dqn_Map__HashKey(DQN_CAST(Dqn_u64)map->slots[index].key);
+        Dqn_isize group  = DQN_CAST(Dqn_isize)(hash >> 7) & group_mask;
+        Dqn_isize target = index;
+        for (Dqn_isize step = 0; step <= group_mask; step++)
+        {
+            Dqn_u32 free_slots = Dqn_FlatMap__GroupMatchFree(map->ctrl + (group * DQN_FLAT_MAP_GROUP_SIZE));
+            if (free_slots)
+            {
+                target = (group * DQN_FLAT_MAP_GROUP_SIZE) + Dqn_CountTrailingZerosU32(free_slots);
+                break;
+            }
+            group = (group + step + 1) & group_mask;
+        }
+
+        Dqn_u8 hash_ctrl = DQN_CAST(Dqn_u8)(hash & 0x7F);
+        if (target / DQN_FLAT_MAP_GROUP_SIZE == index / DQN_FLAT_MAP_GROUP_SIZE)
+        {
+            map->ctrl[index] = hash_ctrl;
+        }
+        else if (map->ctrl[target] == DQN_FLAT_MAP_CTRL_EMPTY)
+        {
+            map->slots[target] = map->slots[index];
+            map->ctrl[target]  = hash_ctrl;
+            map->ctrl[index]   = DQN_FLAT_MAP_CTRL_EMPTY;
+        }
+        else
+        {
+            DQN_SWAP(map->slots[target], map->slots[index]);
+            map->ctrl[target] = hash_ctrl;
+            index--; // NOTE: Place the value that was swapped into 'index'
+        }
+    }
+
+    map->tombstones = 0;
 }
 
-template <Dqn_isize N>
-DQN_API void Dqn_StringBuilder_Free(Dqn_StringBuilder<N> *builder)
+template <typename K, typename V>
+Dqn_MapStats Dqn_Map_GetStats(Dqn_FlatMap<K, V> const *map)
 {
-    for (Dqn_StringBuilderBlock *block = builder->fixed_mem_block.next;
-         block;
-         block = block->next)
+    Dqn_MapStats result = {};
+    if (map->size <= 0) return result;
+
+    Dqn_isize group_mask         = (map->size / DQN_FLAT_MAP_GROUP_SIZE) - 1;
+    Dqn_isize total_probe_length = 0;
+    for (Dqn_isize index = 0; index < map->size; index++)
     {
-        Dqn_StringBuilderBlock *block_to_free = block;
-        Dqn_Allocator_Free(&builder->allocator, block_to_free->mem);
-        Dqn_Allocator_Free(&builder->allocator, block_to_free);
+        if (map->ctrl[index] & 0x80)
+            continue;
+
+        Dqn_u64   hash         = Dqn_Map__HashKey(DQN_CAST(Dqn_u64)map->slots[index].key);
+        Dqn_isize group        = DQN_CAST(Dqn_isize)(hash >> 7) & group_mask;
+        Dqn_isize target_group = index / DQN_FLAT_MAP_GROUP_SIZE;
+        Dqn_isize probe_length = 1;
+        for (Dqn_isize step = 0; group != target_group; step++, probe_length++)
+            group = (group + step + 1) & group_mask;
+
+        total_probe_length     += probe_length;
+        result.max_probe_length = DQN_M_MAX(result.max_probe_length, probe_length);
     }
-    Dqn_StringBuilder__LazyInitialise(builder);
+
+    result.load_factor = DQN_CAST(Dqn_f64)map->count / DQN_CAST(Dqn_f64)map->size;
+    if (map->count) result.average_probe_length = DQN_CAST(Dqn_f64)total_probe_length / DQN_CAST(Dqn_f64)map->count;
+    return result;
 }
 
 // -------------------------------------------------------------------------------------------------
 //
-// NOTE: Dqn_FixedArray Template Implementation
+// NOTE: Dqn_GrowableMap Template Implementation
 //
 // -------------------------------------------------------------------------------------------------
-
-template <typename T> void Dqn__EraseStableFromCArray(T *array, Dqn_isize size, Dqn_isize max, Dqn_isize index)
-{
-    DQN_ASSERT(index >= 0 && index < size);
-    DQN_ASSERT(size <= max); (void)max;
-    Dqn_isize next_index    = DQN_M_MIN(index + 1, size);
-    Dqn_usize bytes_to_copy = (size - next_index) * sizeof(T);
-    memmove(array + index, array + next_index, bytes_to_copy);
-}
-
-DQN_FIXED_ARRAY_TEMPLATE
-DQN_API DQN_FIXED_ARRAY_TEMPLATE_DECL Dqn_FixedArray_Init(T const *item, int num)
+template <typename T>
+Dqn_Map<T> Dqn_GrowableMap__AllocateTable(Dqn_GrowableMap<T> *map, Dqn_isize size)
 {
-    DQN_FIXED_ARRAY_TEMPLATE_DECL result = {};
-    Dqn_FixedArray_Add(&result, item, num);
+    Dqn_isize  mem_size = Dqn_Map_MemoryRequired<T>(size);
+    Dqn_u8     align    = DQN_CAST(Dqn_u8)(alignof(T) > alignof(Dqn_u64) ? alignof(T) : alignof(Dqn_u64));
+    void      *mem      = Dqn_Allocator_Allocate(&map->allocator, mem_size, align, Dqn_ZeroMem::No);
+    Dqn_Map<T> result   = {};
+    if (mem) result = Dqn_Map_InitWithMemory<T>(mem, mem_size);
     return result;
 }
 
-DQN_FIXED_ARRAY_TEMPLATE
-DQN_API Dqn_Slice<T> Dqn_FixedArray_Slice(DQN_FIXED_ARRAY_TEMPLATE_DECL *a)
+// Migrate up to 'slots' slots of the old table into the current one, freeing the old table once it
+// has been emptied. Erasing from the old table shifts later entries of the cluster back into the
+// cursor's slot, so the cursor only advances past empty slots and every slot before it stays empty.
+template <typename T>
+void Dqn_GrowableMap__RehashStep(Dqn_GrowableMap<T> *map, Dqn_isize slots)
 {
-    Dqn_Slice<T> result = {a->data, a->size};
-    return result;
-}
-
+    Dqn_Map<T> *old_map = &map->old_map;
+    for (Dqn_isize step = 0; step < slots && old_map->count > 0; step++)
+    {
+        if (Dqn_Map__SlotIsUsed(old_map, map->rehash_cursor))
+        {
+            T *dest = Dqn_Map_FindOrMake(&map->map, old_map->keys[map->rehash_cursor]);
+            DQN_ASSERT_MSG(dest, "The current table is sized to fit every entry of the old table");
+            *dest = old_map->values[map->rehash_cursor];
+            Dqn_Map__EraseIndex(old_map, map->rehash_cursor);
+        }
+        else
+        {
+            map->rehash_cursor++;
+        }
+    }
 
-DQN_FIXED_ARRAY_TEMPLATE
-DQN_API Dqn_isize Dqn_FixedArray_Max(DQN_FIXED_ARRAY_TEMPLATE_DECL const *)
-{
-    Dqn_isize result = MAX_;
-    return result;
+    if (old_map->size && old_map->count == 0)
+    {
+        Dqn_Allocator_Free(&map->allocator, old_map->keys);
+        *old_map           = {};
+        map->rehash_cursor = 0;
+    }
 }
 
-DQN_FIXED_ARRAY_TEMPLATE
-DQN_API Dqn_isize Dqn_FixedArray_GetIndex(DQN_FIXED_ARRAY_TEMPLATE_DECL const *a, T const *entry)
+template <typename T>
+Dqn_GrowableMap<T> Dqn_GrowableMap_InitWithAllocator(Dqn_Allocator allocator, Dqn_isize initial_size)
 {
-    DQN_ASSERT(entry >= a->begin() && entry <= a->end());
-    Dqn_isize result = a->end() - entry;
+    Dqn_GrowableMap<T> result = {};
+    result.allocator          = allocator;
+    if (initial_size > 0)
+        result.map = Dqn_GrowableMap__AllocateTable(&result, DQN_M_MAX(initial_size, DQN_GROWABLE_MAP_MIN_SIZE));
     return result;
 }
 
-DQN_FIXED_ARRAY_TEMPLATE
-DQN_API T *Dqn_FixedArray_Add(DQN_FIXED_ARRAY_TEMPLATE_DECL *a, T const *items, Dqn_isize num)
+template <typename T>
+void Dqn_GrowableMap_Free(Dqn_GrowableMap<T> *map)
 {
-    DQN_ASSERT(a->size + num <= MAX_);
-    T *result = static_cast<T *>(DQN_MEMCOPY(a->data + a->size, items, sizeof(T) * num));
-    a->size += num;
-    return result;
+    if (map->map.size)     Dqn_Allocator_Free(&map->allocator, map->map.keys);
+    if (map->old_map.size) Dqn_Allocator_Free(&map->allocator, map->old_map.keys);
+    Dqn_Allocator allocator = map->allocator;
+    *map                    = {};
+    map->allocator          = allocator;
 }
 
-DQN_FIXED_ARRAY_TEMPLATE
-DQN_API T *Dqn_FixedArray_Add(DQN_FIXED_ARRAY_TEMPLATE_DECL *a, T const &item)
+template <typename T>
+T *Dqn_Map_FindOrMake(Dqn_GrowableMap<T> *map, Dqn_u64 key, Dqn_b32 *found)
 {
-    DQN_ASSERT(a->size < MAX_);
-    a->data[a->size++] = item;
-    return &a->data[a->size - 1];
-}
+    if (map->old_map.size)
+        Dqn_GrowableMap__RehashStep(map, map->rehash_step ? map->rehash_step : DQN_GROWABLE_MAP_REHASH_STEP);
 
-DQN_FIXED_ARRAY_TEMPLATE
-DQN_API T *Dqn_FixedArray_Make(DQN_FIXED_ARRAY_TEMPLATE_DECL *a, Dqn_isize num)
-{
-    DQN_ASSERT(a->size + num <= MAX_);
-    T *result = a->data + a->size;
-    a->size += num;
-    return result;
-}
-
-DQN_FIXED_ARRAY_TEMPLATE
-DQN_API void Dqn_FixedArray_Clear(DQN_FIXED_ARRAY_TEMPLATE_DECL *a, Dqn_ZeroMem zero_mem)
-{
-    a->size = 0;
-    Dqn__ZeroMemBytes(a->data, sizeof(T) * MAX_, zero_mem);
-}
+    Dqn_b32 found_ = false;
+    T *     result = Dqn_Map_Get(&map->map, key);
+    if (result)
+    {
+        found_ = true;
+    }
+    else if (map->old_map.size && (result = Dqn_Map_Get(&map->old_map, key)))
+    {
+        found_ = true;
+    }
+    else
+    {
+        // NOTE: Grow at 3/4 load, linear probing degrades quickly past that. Entries still in the old
+        // table are counted so finishing the migration below can never overfill the current table.
+        if ((map->map.count + map->old_map.count + 1) * 4 > map->map.size * 3)
+        {
+            // NOTE: The step size normally finishes the migration long before the next resize,
+            // unless rehash_step was configured too small to keep up.
+            if (map->old_map.size)
+                Dqn_GrowableMap__RehashStep(map, map->old_map.size);
+
+            Dqn_isize  new_size  = map->map.size ? map->map.size * 2 : DQN_GROWABLE_MAP_MIN_SIZE;
+            Dqn_Map<T> new_table = Dqn_GrowableMap__AllocateTable(map, new_size);
+            if (new_table.size)
+            {
+                if (map->map.size)
+                {
+                    map->old_map = map->map;
+                    map->resize_count++;
+                }
+                map->map = new_table;
+            }
+            else
+            {
+                DQN_LOG_E("Failed to allocate %$$d for a map of %zd entries", Dqn_Map_MemoryRequired<T>(new_size), new_size);
+            }
+        }
 
-DQN_FIXED_ARRAY_TEMPLATE
-DQN_API void Dqn_FixedArray_EraseStable(DQN_FIXED_ARRAY_TEMPLATE_DECL *a, Dqn_isize index)
-{
-    Dqn__EraseStableFromCArray<T>(a->data, a->size--, MAX_, index);
-}
+        if (map->map.size)
+            result = Dqn_Map_FindOrMake(&map->map, key);
+    }
 
-DQN_FIXED_ARRAY_TEMPLATE
-DQN_API void Dqn_FixedArray_EraseUnstable(DQN_FIXED_ARRAY_TEMPLATE_DECL *a, Dqn_isize index)
-{
-    DQN_ASSERT(index >= 0 && index < a->size);
-    if (--a->size == 0) return;
-    a->data[index] = a->data[a->size];
+    if (found) *found = found_;
+    return result;
 }
 
-DQN_FIXED_ARRAY_TEMPLATE
-DQN_API void Dqn_FixedArray_Pop(DQN_FIXED_ARRAY_TEMPLATE_DECL *a, Dqn_isize num, Dqn_ZeroMem zero_mem)
+template <typename T>
+Dqn_b32 Dqn_Map_Add(Dqn_GrowableMap<T> *map, Dqn_u64 key, T const &value)
 {
-    DQN_ASSERT(a->size - num >= 0);
-    a->size -= num;
-    void *    begin = a->data + a->size;
-    void *    end   = a->data + (a->size + num);
-    Dqn_isize bytes = DQN_CAST(Dqn_isize) end - DQN_CAST(Dqn_isize) begin;
-    Dqn__ZeroMemBytes(begin, bytes, zero_mem);
+    Dqn_b32 found = false;
+    T *     entry = Dqn_Map_FindOrMake(map, key, &found);
+    if (entry && !found) *entry = value;
+    Dqn_b32 result = (entry && found == false);
+    return result;
 }
 
-DQN_FIXED_ARRAY_TEMPLATE
-DQN_API T *Dqn_FixedArray_Peek(DQN_FIXED_ARRAY_TEMPLATE_DECL *a)
+template <typename T>
+T *Dqn_Map_Get(Dqn_GrowableMap<T> *map, Dqn_u64 key)
 {
-    T *result = (a->size == 0) ? nullptr : a->data + (a->size - 1);
+    T *result = map->map.size ? Dqn_Map_Get(&map->map, key) : nullptr;
+    if (!result && map->old_map.size)
+        result = Dqn_Map_Get(&map->old_map, key);
     return result;
 }
 
-DQN_FIXED_ARRAY_TEMPLATE
-DQN_API T Dqn_FixedArray_PeekCopy(DQN_FIXED_ARRAY_TEMPLATE_DECL const *a)
+template <typename T>
+Dqn_b32 Dqn_Map_Erase(Dqn_GrowableMap<T> *map, Dqn_u64 key)
 {
-    DQN_ASSERT(a->size > 0);
-    T const *result = a->data + (a->size - 1);
-    return *result;
+    Dqn_b32 result = map->map.size && Dqn_Map_Erase(&map->map, key);
+    if (!result && map->old_map.size)
+        result = Dqn_Map_Erase(&map->old_map, key);
+    return result;
 }
 
-template <typename T, int MAX_, typename IsEqual>
-DQN_API T *Dqn_FixedArray_Find(DQN_FIXED_ARRAY_TEMPLATE_DECL *a, IsEqual IsEqualProc)
+template <typename T>
+Dqn_MapStats Dqn_Map_GetStats(Dqn_GrowableMap<T> const *map)
 {
-    for (T &entry : (*a))
-    {
-        if (IsEqualProc(entry))
-            return &entry;
-    }
-    return nullptr;
-}
+    Dqn_MapStats result    = {};
+    Dqn_isize    count     = map->map.count + map->old_map.count;
+    Dqn_MapStats map_stats = {};
+    Dqn_MapStats old_stats = {};
+    if (map->map.size)     map_stats = Dqn_Map_GetStats(&map->map);
+    if (map->old_map.size) old_stats = Dqn_Map_GetStats(&map->old_map);
 
-// return: True if the entry was found, false if not- the entry is made using Dqn_FixedArray_Make() in this case
-template <typename T, int MAX_, typename IsEqual>
-DQN_API Dqn_b32 Dqn_FixedArray_FindElseMake(DQN_FIXED_ARRAY_TEMPLATE_DECL *a, T **entry, IsEqual IsEqualProc)
-{
-    Dqn_b32 result = true;
-    T *search  = Dqn_FixedArray_Find(a, IsEqualProc);
-    if (!search)
+    if (map->map.size) result.load_factor = DQN_CAST(Dqn_f64)count / DQN_CAST(Dqn_f64)map->map.size;
+    if (count)
     {
-        result = false;
-        search = Dqn_FixedArray_Make(a, 1);
+        result.average_probe_length = ((map_stats.average_probe_length * map->map.count) +
+                                       (old_stats.average_probe_length * map->old_map.count)) / DQN_CAST(Dqn_f64)count;
     }
-
-    *entry = search;
+    result.max_probe_length = DQN_M_MAX(map_stats.max_probe_length, old_stats.max_probe_length);
+    result.resize_count     = map->resize_count;
     return result;
 }
 
-DQN_FIXED_ARRAY_TEMPLATE
-DQN_API T *Dqn_FixedArray_Find(DQN_FIXED_ARRAY_TEMPLATE_DECL *a, T *find)
-{
-    for (T &entry : (*a))
-    {
-        if (*find == entry)
-            return entry;
-    }
-    return nullptr;
-}
-
 // -------------------------------------------------------------------------------------------------
 //
-// NOTE: Dqn_Array Template Implementation
+// NOTE: Dqn_ConcurrentMap Template Implementation
 //
 // -------------------------------------------------------------------------------------------------
+// The high bits of the hash pick the shard, Dqn_Map picks the slot with the low bits so keys that
+// share a shard still spread across its table.
 template <typename T>
-DQN_API Dqn_Array<T> Dqn_Array_InitWithMemory(T *memory, Dqn_isize max, Dqn_isize size)
-{
-    Dqn_Array<T> result = {};
-    result.allocator    = Dqn_Allocator_InitWithNull();
-    result.data         = memory;
-    result.size         = size;
-    result.max          = max;
-    return result;
-}
-
-template <typename T>
-DQN_API Dqn_Array<T> Dqn_Array__InitWithAllocatorNoGrow(Dqn_Allocator *allocator, Dqn_isize max, Dqn_isize size, Dqn_ZeroMem zero_mem DQN_CALL_SITE_ARGS)
+DQN_FORCE_INLINE Dqn_ConcurrentMapShard<T> *Dqn_ConcurrentMap__Shard(Dqn_ConcurrentMap<T> *map, Dqn_u64 key)
 {
-    T *memory           = DQN_CAST(T *)Dqn_Allocator__Allocate(allocator, sizeof(T) * max, alignof(T), zero_mem DQN_CALL_SITE_ARGS_INPUT);
-    Dqn_Array<T> result = Dqn_Array_InitWithMemory(memory, max, size);
+    Dqn_u64 index = map->shard_shift < 64 ? Dqn_Map__HashKey(key) >> map->shard_shift : 0;
+    Dqn_ConcurrentMapShard<T> *result = map->shards + index;
     return result;
 }
 
 template <typename T>
-DQN_API bool Dqn_Array__Reserve(Dqn_Array<T> *a, Dqn_isize size DQN_CALL_SITE_ARGS)
+Dqn_b32 Dqn_ConcurrentMap_InitWithAllocator(Dqn_ConcurrentMap<T> *map, Dqn_Allocator allocator, Dqn_isize shard_count)
 {
-    if (size <= a->size) return true;
-    T *new_ptr = DQN_CAST(T *)Dqn_Allocator__Allocate(&a->allocator, sizeof(T) * size, alignof(T), Dqn_ZeroMem::Yes DQN_CALL_SITE_ARGS_INPUT);
-    if (!new_ptr) return false;
+    *map             = {};
+    map->allocator   = allocator;
+    map->shard_count = 1;
+    map->shard_shift = 64;
+    while (map->shard_count < shard_count)
+    {
+        map->shard_count *= 2;
+        map->shard_shift--;
+    }
 
-    if (a->data)
+    map->shards = DQN_CAST(Dqn_ConcurrentMapShard<T> *)Dqn_Allocator_Allocate(&map->allocator,
+                                                                            DQN_ISIZEOF(Dqn_ConcurrentMapShard<T>) * map->shard_count,
+                                                                            DQN_CAST(Dqn_u8)DQN_CONCURRENT_MAP_CACHE_LINE_SIZE,
+                                                                            Dqn_ZeroMem::Yes);
+    if (!map->shards)
     {
-        // NOTE(doyle): Realloc, I don't like and don't support. Use virtual arrays
-        DQN_MEMCOPY(new_ptr, a->data, a->size * sizeof(T));
-        Dqn_Allocator_Free(&a->allocator, a->data);
+        DQN_LOG_E("Failed to allocate %zd shards for a concurrent map", map->shard_count);
+        map->shard_count = 0;
+        return false;
     }
 
-    a->data = new_ptr;
-    a->max  = size;
+    DQN_FOR_EACH(index, map->shard_count)
+        map->shards[index].map = Dqn_GrowableMap_InitWithAllocator<T>(allocator);
     return true;
 }
 
 template <typename T>
-DQN_API void Dqn_Array_Free(Dqn_Array<T> *a)
+void Dqn_ConcurrentMap_Free(Dqn_ConcurrentMap<T> *map)
 {
-    Dqn_Allocator_Free(&a->allocator, a->data);
+    DQN_FOR_EACH(index, map->shard_count)
+        Dqn_GrowableMap_Free(&map->shards[index].map);
+
+    if (map->shards) Dqn_Allocator_Free(&map->allocator, map->shards);
+    Dqn_Allocator allocator = map->allocator;
+    *map                    = {};
+    map->allocator          = allocator;
 }
 
 template <typename T>
-DQN_API bool Dqn_Array__GrowIfNeeded(Dqn_Array<T> *a, Dqn_isize num_to_add DQN_CALL_SITE_ARGS)
+Dqn_b32 Dqn_ConcurrentMap_Add(Dqn_ConcurrentMap<T> *map, Dqn_u64 key, T const &value)
 {
-    Dqn_isize new_size = a->size + num_to_add;
-    bool result        = true;
-    if (new_size > a->max)
-    {
-        Dqn_isize num_items = DQN_M_MAX(4, DQN_M_MAX(new_size, (a->max * 2)));
-        result              = Dqn_Array__Reserve(a, num_items DQN_CALL_SITE_ARGS_INPUT);
-    }
-
+    if (!map->shards) return false;
+    Dqn_ConcurrentMapShard<T> *shard = Dqn_ConcurrentMap__Shard(map, key);
+    Dqn_TicketMutex_Begin(&shard->mutex);
+    Dqn_b32 result = Dqn_Map_Add(&shard->map, key, value);
+    Dqn_TicketMutex_End(&shard->mutex);
     return result;
 }
 
 template <typename T>
-DQN_API T *Dqn_Array__AddArray(Dqn_Array<T> *a, T const *items, Dqn_isize num DQN_CALL_SITE_ARGS)
+Dqn_b32 Dqn_ConcurrentMap_Set(Dqn_ConcurrentMap<T> *map, Dqn_u64 key, T const &value)
 {
-    if (!Dqn_Array__GrowIfNeeded(a, num DQN_CALL_SITE_ARGS_INPUT))
-        return nullptr;
-    T *result = static_cast<T *>(DQN_MEMCOPY(a->data + a->size, items, sizeof(T) * num));
-    a->size += num;
+    if (!map->shards) return false;
+    Dqn_ConcurrentMapShard<T> *shard = Dqn_ConcurrentMap__Shard(map, key);
+    Dqn_TicketMutex_Begin(&shard->mutex);
+    T *entry = Dqn_Map_FindOrMake(&shard->map, key);
+    if (entry) *entry = value;
+    Dqn_TicketMutex_End(&shard->mutex);
+    Dqn_b32 result = entry != nullptr;
     return result;
 }
 
 template <typename T>
-DQN_API T *Dqn_Array__Add(Dqn_Array<T> *a, T const &item DQN_CALL_SITE_ARGS)
-{
-    if (!Dqn_Array__GrowIfNeeded(a, 1 DQN_CALL_SITE_ARGS_INPUT))
-        return nullptr;
-    a->data[a->size++] = item;
-    return &a->data[a->size - 1];
-}
-template <typename T>
-DQN_API T *Dqn_Array__Make(Dqn_Array<T> *a, Dqn_isize num DQN_CALL_SITE_ARGS)
+Dqn_b32 Dqn_ConcurrentMap_Get(Dqn_ConcurrentMap<T> *map, Dqn_u64 key, T *value)
 {
-    if (!Dqn_Array__GrowIfNeeded(a, num DQN_CALL_SITE_ARGS_INPUT))
-        return nullptr;
-    T *result = a->data + a->size;
-    a->size += num;
+    if (!map->shards) return false;
+    Dqn_ConcurrentMapShard<T> *shard = Dqn_ConcurrentMap__Shard(map, key);
+    Dqn_TicketMutex_Begin(&shard->mutex);
+    T *entry = Dqn_Map_Get(&shard->map, key);
+    if (entry && value) *value = *entry;
+    Dqn_TicketMutex_End(&shard->mutex);
+    Dqn_b32 result = entry != nullptr;
     return result;
 }
 
 template <typename T>
-DQN_API void Dqn_Array_Clear(Dqn_Array<T> *a, Dqn_ZeroMem zero_mem)
+Dqn_b32 Dqn_ConcurrentMap_Erase(Dqn_ConcurrentMap<T> *map, Dqn_u64 key)
 {
-    a->size = 0;
-    Dqn__ZeroMemBytes(a->data, sizeof(T) * a->max, zero_mem);
+    if (!map->shards) return false;
+    Dqn_ConcurrentMapShard<T> *shard = Dqn_ConcurrentMap__Shard(map, key);
+    Dqn_TicketMutex_Begin(&shard->mutex);
+    Dqn_b32 result = Dqn_Map_Erase(&shard->map, key);
+    Dqn_TicketMutex_End(&shard->mutex);
+    return result;
 }
 
 template <typename T>
-DQN_API void Dqn_Array_EraseStable(Dqn_Array<T> *a, Dqn_isize index)
+Dqn_isize Dqn_ConcurrentMap_Count(Dqn_ConcurrentMap<T> *map)
 {
-    Dqn__EraseStableFromCArray<T>(a->data, a->size--, a->max, index);
+    Dqn_isize result = 0;
+    DQN_FOR_EACH(index, map->shard_count)
+    {
+        Dqn_ConcurrentMapShard<T> *shard = map->shards + index;
+        Dqn_TicketMutex_Begin(&shard->mutex);
+        result += shard->map.map.count + shard->map.old_map.count;
+        Dqn_TicketMutex_End(&shard->mutex);
+    }
+    return result;
 }
 
-template <typename T>
-DQN_API void Dqn_Array_EraseUnstable(Dqn_Array<T> *a, Dqn_isize index)
+// -------------------------------------------------------------------------------------------------
+//
+// NOTE: Dqn_StringBuilder Template Implementation
+//
+// -------------------------------------------------------------------------------------------------
+
+//
+// NOTE: Dqn_StringBuilder Internal Functions
+//
+template <Dqn_isize N>
+DQN_API void Dqn_StringBuilder__LazyInitialise(Dqn_StringBuilder<N> *builder)
 {
-    DQN_ASSERT(index >= 0 && index < a->size);
-    if (--a->size == 0) return;
-    a->data[index] = a->data[a->size];
+    builder->fixed_mem_block.mem  = builder->fixed_mem;
+    builder->fixed_mem_block.size = Dqn_ArrayCount(builder->fixed_mem);
+    builder->fixed_mem_block.used = 0;
+    builder->fixed_mem_block.next = nullptr;
+    builder->last_mem_block       = &builder->fixed_mem_block;
 }
 
-template <typename T>
-DQN_API void Dqn_Array_Pop(Dqn_Array<T> *a, Dqn_isize num, Dqn_ZeroMem zero_mem)
+template <Dqn_isize N>
+DQN_API char *Dqn_StringBuilder__AllocateWriteBuffer(Dqn_StringBuilder<N> *builder, Dqn_isize size_required)
 {
-    DQN_ASSERT(a->size - num >= 0);
-    a->size -= num;
+    if (!builder->fixed_mem_block.mem)
+    {
+        DQN_ASSERT(!builder->last_mem_block);
+        Dqn_StringBuilder__LazyInitialise(builder);
+    }
 
-    void *begin     = a->data + a->size;
-    void *end       = a->data + (a->size + num);
-    Dqn_isize bytes = DQN_CAST(Dqn_isize) end - DQN_CAST(Dqn_isize) begin;
-    Dqn__ZeroMemBytes(begin, bytes, zero_mem);
+    Dqn_StringBuilderBlock *block = builder->last_mem_block;
+    Dqn_b32 new_block_needed = (block->size - block->used) < size_required;
+    if (new_block_needed)
+    {
+        Dqn_Allocator *allocator = builder->allocator ? builder->allocator : &builder->backup_allocator;
+        Dqn_isize allocation_size = DQN_M_MAX(size_required, DQN_STRING_BUILDER_MIN_BLOCK_SIZE);
+        block                     = DQN_CAST(Dqn_StringBuilderBlock *)Dqn_Allocator_Allocate(allocator, DQN_ISIZEOF(*block) + allocation_size, alignof(Dqn_StringBuilderBlock), Dqn_ZeroMem::No);
+        if (!block) return nullptr;
+
+        *block                        = {};
+        block->mem                    = DQN_CAST(char *)(block + 1);
+        block->size                   = allocation_size;
+        builder->last_mem_block->next = block;
+        builder->last_mem_block       = builder->last_mem_block->next;
+    }
+
+    char *result = block->mem + block->used;
+    block->used += size_required;
+    return result;
 }
 
-template <typename T>
-DQN_API T *Dqn_Array_Peek(Dqn_Array<T> *a)
+template <Dqn_isize N>
+DQN_API char *Dqn_StringBuilder__Build(Dqn_StringBuilder<N> *builder, Dqn_Allocator *allocator, Dqn_isize *len DQN_CALL_SITE_ARGS)
 {
-    T *result = (a->size == 0) ? nullptr : a->data + (a->size - 1);
+    Dqn_isize len_ = 0;
+    if (!len) len = &len_;
+    *len = Dqn_StringBuilder_GetSize(builder);
+    auto *result  = DQN_CAST(char *)Dqn_Allocator__Allocate(allocator, *len + 1, alignof(char), Dqn_ZeroMem::No DQN_CALL_SITE_ARGS_INPUT);
+    Dqn_StringBuilder_BuildToDest(builder, result, *len + 1);
     return result;
 }
 
-// -------------------------------------------------------------------------------------------------
 //
-// NOTE: Dqn_List Template Implementation
+// NOTE: Dqn_StringBuilder Functions
 //
-// -------------------------------------------------------------------------------------------------
-template <typename T>
-DQN_API Dqn_List<T> Dqn_List_InitWithArena(Dqn_ArenaAllocator *arena, Dqn_isize chunk_size)
+template <Dqn_isize N>
+DQN_API void Dqn_StringBuilder_InitWithArena(Dqn_StringBuilder<N> *builder, Dqn_ArenaAllocator *arena)
 {
-    Dqn_List<T> result      = {};
-    result.backup_allocator = Dqn_Allocator_InitWithArena(arena);
-    result.chunk_size       = chunk_size;
-    return result;
+    *builder                  = {};
+    builder->backup_allocator = Dqn_Allocator_InitWithArena(arena);
+    Dqn_StringBuilder__LazyInitialise(builder);
 }
 
-template <typename T>
-DQN_API Dqn_List<T> Dqn_List_InitWithAllocator(Dqn_Allocator *allocator, Dqn_isize chunk_size)
+template <Dqn_isize N>
+DQN_API void Dqn_StringBuilder_InitWithAllocator(Dqn_StringBuilder<N> *builder, Dqn_Allocator *allocator)
 {
-    Dqn_List<T> result = {};
-    result.chunk_size  = chunk_size;
-    result.allocator   = allocator;
-    return result;
+    *builder           = {};
+    builder->allocator = allocator;
+    Dqn_StringBuilder__LazyInitialise(builder);
 }
 
-template <typename T>
-DQN_API T *Dqn_List__Make(Dqn_List<T> *list, Dqn_isize count DQN_CALL_SITE_ARGS)
+template <Dqn_isize N>
+DQN_API Dqn_isize Dqn_StringBuilder_GetSize(Dqn_StringBuilder<N> const *builder)
 {
-    if (list->chunk_size == 0)
-        list->chunk_size = 128;
+    Dqn_isize result = 0;
+    for (Dqn_StringBuilderBlock const *block = &builder->fixed_mem_block;
+         block;
+         block = block->next)
+    {
+        result += block->used;
+    }
+
+    return result;
+}
+
+template <Dqn_isize N>
+DQN_API void Dqn_StringBuilder_BuildToDest(Dqn_StringBuilder<N> const *builder, char *dest, Dqn_usize dest_size)
+{
+    if (!dest) return;
+    if (dest_size == 1) { dest[0] = 0; return; }
+
+    char *ptr                 = dest;
+    char const *end           = dest + dest_size;
+    Dqn_isize remaining_space = end - ptr;
+    for (Dqn_StringBuilderBlock const *block = &builder->fixed_mem_block;
+         block && remaining_space > 0;
+         block = block->next, remaining_space = end - ptr)
+    {
+        Dqn_isize num_bytes     = block->used;
+        Dqn_isize bytes_to_copy = DQN_M_MIN(num_bytes, remaining_space);
+        DQN_MEMCOPY(ptr, block->mem, bytes_to_copy);
+        ptr += bytes_to_copy;
+    }
+
+    if (remaining_space > 0) ptr[ 0] = 0; // Append null terminator
+    else                     ptr[-1] = 0; // Oops ran out of space. Terminate the output prematurely.
+}
+
+template <Dqn_isize N>
+DQN_API Dqn_String Dqn_StringBuilder_BuildStringWithAllocator(Dqn_StringBuilder<N> *builder, Dqn_Allocator *allocator)
+{
+    Dqn_String result = {};
+    result.str        = Dqn_StringBuilder_Build(builder, allocator, &result.size);
+    result.cap        = result.size;
+    return result;
+}
+
+template <Dqn_isize N>
+DQN_API Dqn_String Dqn_StringBuilder_BuildStringWithArena(Dqn_StringBuilder<N> *builder, Dqn_ArenaAllocator *arena)
+{
+    Dqn_Allocator allocator = Dqn_Allocator_InitWithArena(arena);
+    Dqn_String result       = Dqn_StringBuilder_BuildStringWithAllocator(builder, &allocator);
+    return result;
+}
+
+template <Dqn_isize N>
+DQN_API void Dqn_StringBuilder_AppendFmtV(Dqn_StringBuilder<N> *builder, char const *fmt, va_list va)
+{
+    if (!fmt) return;
+    va_list va2;
+    va_copy(va2, va);
+    Dqn_isize len     = stbsp_vsnprintf(nullptr, 0, fmt, va);
+    char *buf         = Dqn_StringBuilder__AllocateWriteBuffer(builder, len + 1);
+    stbsp_vsnprintf(buf, static_cast<int>(len + 1), fmt, va2);
+    va_end(va2);
+
+    DQN_ASSERT(builder->last_mem_block->used >= 0);
+    builder->last_mem_block->used--; // stbsp_vsnprintf null terminates, back out the null-terminator from the mem block
+}
+
+template <Dqn_isize N>
+DQN_API void Dqn_StringBuilder_AppendFmt(Dqn_StringBuilder<N> *builder, char const *fmt, ...)
+{
+    va_list va;
+    va_start(va, fmt);
+    Dqn_StringBuilder_AppendFmtV(builder, fmt, va);
+    va_end(va);
+}
+
+template <Dqn_isize N>
+DQN_API void Dqn_StringBuilder_Append(Dqn_StringBuilder<N> *builder, char const *str, Dqn_isize len)
+{
+    if (!str) return;
+    if (len == -1) len = DQN_CAST(Dqn_isize)Dqn_Str_Len(str);
+    if (len == 0) return;
+    char *buf = Dqn_StringBuilder__AllocateWriteBuffer(builder, len);
+    DQN_MEMCOPY(buf, str, len);
+}
+
+template <Dqn_isize N>
+DQN_API void Dqn_StringBuilder_AppendString(Dqn_StringBuilder<N> *builder, Dqn_String const string)
+{
+    if (!string.str || string.size == 0) return;
+    char *buf = Dqn_StringBuilder__AllocateWriteBuffer(builder, string.size);
+    DQN_MEMCOPY(buf, string.str, string.size);
+}
+
+template <Dqn_isize N>
+DQN_API void Dqn_StringBuilder_AppendChar(Dqn_StringBuilder<N> *builder, char ch)
+{
+    char *buf = Dqn_StringBuilder__AllocateWriteBuffer(builder, 1);
+    *buf++    = ch;
+}
+
+template <Dqn_isize N>
+DQN_API void Dqn_StringBuilder_AppendU64Array(Dqn_StringBuilder<N> *builder, Dqn_u64 const *values, Dqn_isize values_size, Dqn_String separator, Dqn_b32 comma_sep)
+{
+    Dqn_isize const BATCH_SIZE = 64;
+    for (Dqn_isize batch_start = 0; batch_start < values_size; batch_start += BATCH_SIZE)
+    {
+        Dqn_isize batch_end = DQN_M_MIN(batch_start + BATCH_SIZE, values_size);
+        Dqn_isize size      = separator.size * (batch_end - batch_start - (batch_end == values_size ? 1 : 0));
+        for (Dqn_isize index = batch_start; index < batch_end; index++)
+            size += Dqn_U64ToStrSize(values[index], comma_sep);
+
+        char *buf = Dqn_StringBuilder__AllocateWriteBuffer(builder, size);
+        if (!buf) return;
+
+        for (Dqn_isize index = batch_start; index < batch_end; index++)
+        {
+            buf += Dqn_U64ToStrBuffer(values[index], buf, comma_sep);
+            if (index + 1 < values_size)
+            {
+                DQN_MEMCOPY(buf, separator.str, DQN_CAST(size_t)separator.size);
+                buf += separator.size;
+            }
+        }
+    }
+}
+
+template <Dqn_isize N>
+DQN_API void Dqn_StringBuilder_Free(Dqn_StringBuilder<N> *builder)
+{
+    Dqn_Allocator *allocator = builder->allocator ? builder->allocator : &builder->backup_allocator;
+    for (Dqn_StringBuilderBlock *block = builder->fixed_mem_block.next; block;)
+    {
+        Dqn_StringBuilderBlock *block_to_free = block;
+        block                                 = block->next;
+        Dqn_Allocator_Free(allocator, block_to_free);
+    }
+    Dqn_StringBuilder__LazyInitialise(builder);
+}
+
+// -------------------------------------------------------------------------------------------------
+//
+// NOTE: Dqn_FixedArray Template Implementation
+//
+// -------------------------------------------------------------------------------------------------
+
+template <typename T> void Dqn__EraseStableFromCArray(T *array, Dqn_isize size, Dqn_isize max, Dqn_isize index)
+{
+    DQN_ASSERT(index >= 0 && index < size);
+    DQN_ASSERT(size <= max); (void)max;
+    Dqn_isize next_index    = DQN_M_MIN(index + 1, size);
+    Dqn_usize bytes_to_copy = (size - next_index) * sizeof(T);
+    memmove(array + index, array + next_index, bytes_to_copy);
+}
+
+DQN_FIXED_ARRAY_TEMPLATE
+DQN_API DQN_FIXED_ARRAY_TEMPLATE_DECL Dqn_FixedArray_Init(T const *item, int num)
+{
+    DQN_FIXED_ARRAY_TEMPLATE_DECL result = {};
+    Dqn_FixedArray_Add(&result, item, num);
+    return result;
+}
+
+DQN_FIXED_ARRAY_TEMPLATE
+DQN_API Dqn_Slice<T> Dqn_FixedArray_Slice(DQN_FIXED_ARRAY_TEMPLATE_DECL *a)
+{
+    Dqn_Slice<T> result = {a->data, a->size};
+    return result;
+}
+
+
+DQN_FIXED_ARRAY_TEMPLATE
+DQN_API Dqn_isize Dqn_FixedArray_Max(DQN_FIXED_ARRAY_TEMPLATE_DECL const *)
+{
+    Dqn_isize result = MAX_;
+    return result;
+}
+
+DQN_FIXED_ARRAY_TEMPLATE
+DQN_API Dqn_isize Dqn_FixedArray_GetIndex(DQN_FIXED_ARRAY_TEMPLATE_DECL const *a, T const *entry)
+{
+    DQN_ASSERT(entry >= a->begin() && entry <= a->end());
+    Dqn_isize result = a->end() - entry;
+    return result;
+}
+
+DQN_FIXED_ARRAY_TEMPLATE
+DQN_API T *Dqn_FixedArray_Add(DQN_FIXED_ARRAY_TEMPLATE_DECL *a, T const *items, Dqn_isize num)
+{
+    DQN_ASSERT(a->size + num <= MAX_);
+    T *result = static_cast<T *>(DQN_MEMCOPY(a->data + a->size, items, sizeof(T) * num));
+    a->size += num;
+    return result;
+}
+
+DQN_FIXED_ARRAY_TEMPLATE
+DQN_API T *Dqn_FixedArray_Add(DQN_FIXED_ARRAY_TEMPLATE_DECL *a, T const &item)
+{
+    DQN_ASSERT(a->size < MAX_);
+    a->data[a->size++] = item;
+    return &a->data[a->size - 1];
+}
+
+DQN_FIXED_ARRAY_TEMPLATE
+DQN_API T *Dqn_FixedArray_Make(DQN_FIXED_ARRAY_TEMPLATE_DECL *a, Dqn_isize num)
+{
+    DQN_ASSERT(a->size + num <= MAX_);
+    T *result = a->data + a->size;
+    a->size += num;
+    return result;
+}
+
+DQN_FIXED_ARRAY_TEMPLATE
+DQN_API void Dqn_FixedArray_Clear(DQN_FIXED_ARRAY_TEMPLATE_DECL *a, Dqn_ZeroMem zero_mem)
+{
+    a->size = 0;
+    Dqn__ZeroMemBytes(a->data, sizeof(T) * MAX_, zero_mem);
+}
+
+DQN_FIXED_ARRAY_TEMPLATE
+DQN_API void Dqn_FixedArray_EraseStable(DQN_FIXED_ARRAY_TEMPLATE_DECL *a, Dqn_isize index)
+{
+    Dqn__EraseStableFromCArray<T>(a->data, a->size--, MAX_, index);
+}
+
+DQN_FIXED_ARRAY_TEMPLATE
+DQN_API void Dqn_FixedArray_EraseUnstable(DQN_FIXED_ARRAY_TEMPLATE_DECL *a, Dqn_isize index)
+{
+    DQN_ASSERT(index >= 0 && index < a->size);
+    if (--a->size == 0) return;
+    a->data[index] = a->data[a->size];
+}
+
+DQN_FIXED_ARRAY_TEMPLATE
+DQN_API void Dqn_FixedArray_Pop(DQN_FIXED_ARRAY_TEMPLATE_DECL *a, Dqn_isize num, Dqn_ZeroMem zero_mem)
+{
+    DQN_ASSERT(a->size - num >= 0);
+    a->size -= num;
+    void *    begin = a->data + a->size;
+    void *    end   = a->data + (a->size + num);
+    Dqn_isize bytes = DQN_CAST(Dqn_isize) end - DQN_CAST(Dqn_isize) begin;
+    Dqn__ZeroMemBytes(begin, bytes, zero_mem);
+}
+
+DQN_FIXED_ARRAY_TEMPLATE
+DQN_API T *Dqn_FixedArray_Peek(DQN_FIXED_ARRAY_TEMPLATE_DECL *a)
+{
+    T *result = (a->size == 0) ? nullptr : a->data + (a->size - 1);
+    return result;
+}
+
+DQN_FIXED_ARRAY_TEMPLATE
+DQN_API T Dqn_FixedArray_PeekCopy(DQN_FIXED_ARRAY_TEMPLATE_DECL const *a)
+{
+    DQN_ASSERT(a->size > 0);
+    T const *result = a->data + (a->size - 1);
+    return *result;
+}
+
+template <typename T, int MAX_, typename IsEqual>
+DQN_API T *Dqn_FixedArray_Find(DQN_FIXED_ARRAY_TEMPLATE_DECL *a, IsEqual IsEqualProc)
+{
+    for (T &entry : (*a))
+    {
+        if (IsEqualProc(entry))
+            return &entry;
+    }
+    return nullptr;
+}
+
+// return: True if the entry was found, false if not- the entry is made using Dqn_FixedArray_Make() in this case
+template <typename T, int MAX_, typename IsEqual>
+DQN_API Dqn_b32 Dqn_FixedArray_FindElseMake(DQN_FIXED_ARRAY_TEMPLATE_DECL *a, T **entry, IsEqual IsEqualProc)
+{
+    Dqn_b32 result = true;
+    T *search  = Dqn_FixedArray_Find(a, IsEqualProc);
+    if (!search)
+    {
+        result = false;
+        search = Dqn_FixedArray_Make(a, 1);
+    }
+
+    *entry = search;
+    return result;
+}
+
+DQN_FIXED_ARRAY_TEMPLATE
+DQN_API T *Dqn_FixedArray_Find(DQN_FIXED_ARRAY_TEMPLATE_DECL *a, T *find)
+{
+    for (T &entry : (*a))
+    {
+        if (*find == entry)
+            return entry;
+    }
+    return nullptr;
+}
+
+// -------------------------------------------------------------------------------------------------
+//
+// NOTE: Dqn_Array Template Implementation
+//
+// -------------------------------------------------------------------------------------------------
+template <typename T>
+DQN_API Dqn_Array<T> Dqn_Array_InitWithMemory(T *memory, Dqn_isize max, Dqn_isize size)
+{
+    Dqn_Array<T> result = {};
+    result.allocator    = Dqn_Allocator_InitWithNull();
+    result.data         = memory;
+    result.size         = size;
+    result.max          = max;
+    return result;
+}
+
+template <typename T>
+DQN_API Dqn_Array<T> Dqn_Array__InitWithAllocatorNoGrow(Dqn_Allocator *allocator, Dqn_isize max, Dqn_isize size, Dqn_ZeroMem zero_mem DQN_CALL_SITE_ARGS)
+{
+    T *memory           = DQN_CAST(T *)Dqn_Allocator__Allocate(allocator, sizeof(T) * max, alignof(T), zero_mem DQN_CALL_SITE_ARGS_INPUT);
+    Dqn_Array<T> result = Dqn_Array_InitWithMemory(memory, max, size);
+    return result;
+}
+
+template <typename T>
+DQN_API bool Dqn_Array__Reserve(Dqn_Array<T> *a, Dqn_isize size DQN_CALL_SITE_ARGS)
+{
+    if (size <= a->max) return true;
+    T *new_ptr = DQN_CAST(T *)Dqn_Allocator__Allocate(&a->allocator, sizeof(T) * size, alignof(T), Dqn_ZeroMem::Yes DQN_CALL_SITE_ARGS_INPUT);
+    if (!new_ptr) return false;
+
+    if (a->data)
+    {
+        // NOTE(doyle): Realloc, I don't like and don't support. Use virtual arrays
+        DQN_MEMCOPY(new_ptr, a->data, a->size * sizeof(T));
+        Dqn_Allocator_Free(&a->allocator, a->data);
+    }
+
+    a->data = new_ptr;
+    a->max  = size;
+    return true;
+}
+
+template <typename T>
+DQN_API void Dqn_Array_Free(Dqn_Array<T> *a)
+{
+    Dqn_Allocator_Free(&a->allocator, a->data);
+}
+
+template <typename T>
+DQN_API bool Dqn_Array__GrowIfNeeded(Dqn_Array<T> *a, Dqn_isize num_to_add DQN_CALL_SITE_ARGS)
+{
+    Dqn_isize new_size = a->size + num_to_add;
+    bool result        = true;
+    if (new_size > a->max)
+    {
+        Dqn_isize num_items = DQN_M_MAX(4, DQN_M_MAX(new_size, (a->max * 2)));
+        result              = Dqn_Array__Reserve(a, num_items DQN_CALL_SITE_ARGS_INPUT);
+    }
+
+    return result;
+}
+
+template <typename T>
+DQN_API T *Dqn_Array__AddArray(Dqn_Array<T> *a, T const *items, Dqn_isize num DQN_CALL_SITE_ARGS)
+{
+    if (!Dqn_Array__GrowIfNeeded(a, num DQN_CALL_SITE_ARGS_INPUT))
+        return nullptr;
+    T *result = static_cast<T *>(DQN_MEMCOPY(a->data + a->size, items, sizeof(T) * num));
+    a->size += num;
+    return result;
+}
+
+template <typename T>
+DQN_API T *Dqn_Array__Add(Dqn_Array<T> *a, T const &item DQN_CALL_SITE_ARGS)
+{
+    if (!Dqn_Array__GrowIfNeeded(a, 1 DQN_CALL_SITE_ARGS_INPUT))
+        return nullptr;
+    a->data[a->size++] = item;
+    return &a->data[a->size - 1];
+}
+template <typename T>
+DQN_API T *Dqn_Array__Make(Dqn_Array<T> *a, Dqn_isize num DQN_CALL_SITE_ARGS)
+{
+    if (!Dqn_Array__GrowIfNeeded(a, num DQN_CALL_SITE_ARGS_INPUT))
+        return nullptr;
+    T *result = a->data + a->size;
+    a->size += num;
+    return result;
+}
+
+template <typename T>
+DQN_API void Dqn_Array_Clear(Dqn_Array<T> *a, Dqn_ZeroMem zero_mem)
+{
+    a->size = 0;
+    Dqn__ZeroMemBytes(a->data, sizeof(T) * a->max, zero_mem);
+}
+
+template <typename T>
+DQN_API void Dqn_Array_EraseStable(Dqn_Array<T> *a, Dqn_isize index)
+{
+    Dqn__EraseStableFromCArray<T>(a->data, a->size--, a->max, index);
+}
+
+template <typename T>
+DQN_API void Dqn_Array_EraseUnstable(Dqn_Array<T> *a, Dqn_isize index)
+{
+    DQN_ASSERT(index >= 0 && index < a->size);
+    if (--a->size == 0) return;
+    a->data[index] = a->data[a->size];
+}
+
+template <typename T>
+DQN_API void Dqn_Array_Pop(Dqn_Array<T> *a, Dqn_isize num, Dqn_ZeroMem zero_mem)
+{
+    DQN_ASSERT(a->size - num >= 0);
+    a->size -= num;
+
+    void *begin     = a->data + a->size;
+    void *end       = a->data + (a->size + num);
+    Dqn_isize bytes = DQN_CAST(Dqn_isize) end - DQN_CAST(Dqn_isize) begin;
+    Dqn__ZeroMemBytes(begin, bytes, zero_mem);
+}
+
+template <typename T>
+DQN_API T *Dqn_Array_Peek(Dqn_Array<T> *a)
+{
+    T *result = (a->size == 0) ? nullptr : a->data + (a->size - 1);
+    return result;
+}
+
+// -------------------------------------------------------------------------------------------------
+//
+// NOTE: Dqn_List Template Implementation
+//
+// -------------------------------------------------------------------------------------------------
+template <typename T>
+DQN_API Dqn_List<T> Dqn_List_InitWithArena(Dqn_ArenaAllocator *arena, Dqn_isize chunk_size)
+{
+    Dqn_List<T> result      = {};
+    result.backup_allocator = Dqn_Allocator_InitWithArena(arena);
+    result.chunk_size       = chunk_size;
+    return result;
+}
+
+template <typename T>
+DQN_API Dqn_List<T> Dqn_List_InitWithAllocator(Dqn_Allocator *allocator, Dqn_isize chunk_size)
+{
+    Dqn_List<T> result = {};
+    result.chunk_size  = chunk_size;
+    result.allocator   = allocator;
+    return result;
+}
+
+template <typename T>
+DQN_API Dqn_isize Dqn_List_ChunkAllocationSize(Dqn_isize chunk_size)
+{
+    Dqn_isize header_size = DQN_ISIZEOF(Dqn_ListChunk<T>);
+    header_size           = (header_size + (alignof(T) - 1)) & ~DQN_CAST(Dqn_isize)(alignof(T) - 1);
+    Dqn_isize result      = header_size + (DQN_ISIZEOF(T) * chunk_size);
+    return result;
+}
+
+template <typename T>
+DQN_API T *Dqn_List__Make(Dqn_List<T> *list, Dqn_isize count DQN_CALL_SITE_ARGS)
+{
+    if (list->chunk_size == 0)
+        list->chunk_size = 128;
+
+    Dqn_Allocator *allocator = list->allocator ? list->allocator : &list->backup_allocator;
+    if (!list->tail || (list->tail->count + count) > list->tail->size)
+    {
+        Dqn_isize items     = DQN_M_MAX(list->chunk_size, count);
+        Dqn_u8    alignment = DQN_CAST(Dqn_u8)DQN_M_MAX(alignof(Dqn_ListChunk<T>), alignof(T));
+        auto     *tail      = (Dqn_ListChunk<T> *)Dqn_Allocator__Allocate(allocator, Dqn_List_ChunkAllocationSize<T>(items), alignment, Dqn_ZeroMem::Yes DQN_CALL_SITE_ARGS_INPUT);
+        if (!tail)
+          return nullptr;
+
+        tail->data = (T *)Dqn_AlignAddress(DQN_CAST(Dqn_uintptr)(tail + 1), alignof(T));
+        tail->size = items;
+
+        if (list->tail)
+            list->tail->next = tail;
+
+        list->tail = tail;
+
+        if (!list->head)
+            list->head = list->tail;
+    }
+
+    T *result = list->tail->data + list->tail->count;
+    list->tail->count += count;
+    list->count += count;
+    return result;
+}
+
+template <typename T>
+Dqn_b32 Dqn_List_Iterate(Dqn_List<T> *list, Dqn_ListIterator<T> *iterator)
+{
+    Dqn_b32 result = false;
+    if (!iterator->init)
+    {
+        *iterator       = {};
+        iterator->chunk = list->head;
+        iterator->init  = true;
+    }
+
+    if (iterator->chunk)
+    {
+        if (iterator->chunk_data_index >= iterator->chunk->count)
+        {
+            iterator->chunk            = iterator->chunk->next;
+            iterator->chunk_data_index = 0;
+        }
+
+        if (iterator->chunk)
+        {
+            iterator->data = iterator->chunk->data + iterator->chunk_data_index++;
+            result         = true;
+        }
+    }
+
+    if (!iterator->chunk)
+    {
+        DQN_ASSERT(result == false);
+    }
+    return result;
+}
+
+// -------------------------------------------------------------------------------------------------
+//
+// NOTE: Dqn_PerfectHash Template Implementation
+//
+// -------------------------------------------------------------------------------------------------
+constexpr Dqn_u64 Dqn_PerfectHash__Read64(char const *key)
+{
+    Dqn_u64 result = DQN_CAST(Dqn_u64)DQN_CAST(Dqn_u8)key[0] <<  0 | DQN_CAST(Dqn_u64)DQN_CAST(Dqn_u8)key[1] <<  8 |
+                     DQN_CAST(Dqn_u64)DQN_CAST(Dqn_u8)key[2] << 16 | DQN_CAST(Dqn_u64)DQN_CAST(Dqn_u8)key[3] << 24 |
+                     DQN_CAST(Dqn_u64)DQN_CAST(Dqn_u8)key[4] << 32 | DQN_CAST(Dqn_u64)DQN_CAST(Dqn_u8)key[5] << 40 |
+                     DQN_CAST(Dqn_u64)DQN_CAST(Dqn_u8)key[6] << 48 | DQN_CAST(Dqn_u64)DQN_CAST(Dqn_u8)key[7] << 56;
+    return result;
+}
+
+// Strings are read 8 bytes at a time with shifts so the hash can run at compile time, compilers fold
+// the shifts into a single load at runtime. A string of 8 or more bytes reads its tail as the last 8
+// bytes shifted down past the bytes already hashed instead of a loop with an unpredictable trip
+// count. Finished with the Dqn_Map finalizer as the high bits pick the bucket.
+constexpr Dqn_u64 Dqn_PerfectHash__Hash(char const *key, Dqn_isize size)
+{
+    Dqn_u64   hash  = DQN_CAST(Dqn_u64)size * 0x9E3779B97F4A7C15ULL;
+    Dqn_isize index = 0;
+    for (; index + 8 <= size; index += 8)
+    {
+        hash = (hash ^ Dqn_PerfectHash__Read64(key + index)) * 0xff51afd7ed558ccdULL;
+        hash ^= hash >> 32;
+    }
+
+    Dqn_u64 tail = 0;
+    if (index < size)
+    {
+        if (size >= 8)
+        {
+            tail = Dqn_PerfectHash__Read64(key + size - 8) >> ((8 - (size - index)) * 8);
+        }
+        else
+        {
+            for (Dqn_isize byte = 0; byte < size; byte++)
+                tail |= DQN_CAST(Dqn_u64)DQN_CAST(Dqn_u8)key[byte] << (byte * 8);
+        }
+    }
+    hash = (hash ^ tail) * 0xff51afd7ed558ccdULL;
+
+    Dqn_u64 result = Dqn_Map__HashKey(hash);
+    return result;
+}
+
+constexpr Dqn_isize Dqn_PerfectHash__Bucket(Dqn_u64 hash, Dqn_isize bucket_count)
+{
+    Dqn_isize result = DQN_CAST(Dqn_isize)(((hash >> 32) * DQN_CAST(Dqn_u64)bucket_count) >> 32);
+    return result;
+}
+
+constexpr Dqn_isize Dqn_PerfectHash__Slot(Dqn_u64 hash, Dqn_u32 seed, Dqn_isize slot_count)
+{
+    Dqn_isize result = DQN_CAST(Dqn_isize)(Dqn_Map__HashKey(hash + seed * 0x9E3779B97F4A7C15ULL) & DQN_CAST(Dqn_u64)(slot_count - 1));
+    return result;
+}
+
+constexpr Dqn_b32 Dqn_PerfectHash__Equals(char const *lhs, Dqn_isize lhs_size, char const *rhs, Dqn_isize rhs_size)
+{
+    if (lhs_size != rhs_size)
+        return false;
+
+    for (Dqn_isize i = 0; i < lhs_size; i++)
+        if (lhs[i] != rhs[i])
+            return false;
+    return true;
+}
+
+template <Dqn_isize N>
+constexpr Dqn_PerfectHash<N> Dqn_PerfectHash_Init(char const *const (&keys)[N])
+{
+    Dqn_isize constexpr SLOT_COUNT = Dqn_PerfectHash__SlotCount(N);
+    Dqn_PerfectHash<N> result      = {};
+    for (Dqn_isize slot_index = 0; slot_index < SLOT_COUNT; slot_index++)
+        result.slots[slot_index] = -1;
+
+    // NOTE: Hash the keys and count the keys in each bucket
+    Dqn_u64   hashes[N]           = {};
+    Dqn_isize bucket_start[N + 1] = {};
+    for (Dqn_isize key_index = 0; key_index < N; key_index++)
+    {
+        Dqn_isize size = 0;
+        while (keys[key_index][size])
+            size++;
+
+        for (Dqn_isize other_index = 0; other_index < key_index; other_index++)
+        {
+            if (Dqn_PerfectHash__Equals(keys[key_index], size, result.keys[other_index], result.key_sizes[other_index]))
+                return result;
+        }
+
+        result.keys[key_index]      = keys[key_index];
+        result.key_sizes[key_index] = size;
+        hashes[key_index]           = Dqn_PerfectHash__Hash(keys[key_index], size);
+        bucket_start[Dqn_PerfectHash__Bucket(hashes[key_index], N) + 1]++;
+    }
+
+    // NOTE: Sort the keys by bucket, bucket 'i' owns order[bucket_start[i], bucket_start[i + 1])
+    Dqn_isize max_bucket_size = 0;
+    for (Dqn_isize bucket = 0; bucket < N; bucket++)
+    {
+        max_bucket_size          = DQN_M_MAX(max_bucket_size, bucket_start[bucket + 1]);
+        bucket_start[bucket + 1] += bucket_start[bucket];
+    }
+
+    Dqn_isize order[N]        = {};
+    Dqn_isize bucket_used[N]  = {};
+    for (Dqn_isize key_index = 0; key_index < N; key_index++)
+    {
+        Dqn_isize bucket = Dqn_PerfectHash__Bucket(hashes[key_index], N);
+        order[bucket_start[bucket] + bucket_used[bucket]++] = key_index;
+    }
+
+    // NOTE: Seed the largest buckets first while the table is mostly empty
+    for (Dqn_isize bucket_size = max_bucket_size; bucket_size > 0; bucket_size--)
+    {
+        for (Dqn_isize bucket = 0; bucket < N; bucket++)
+        {
+            Dqn_isize start = bucket_start[bucket];
+            if (bucket_start[bucket + 1] - start != bucket_size)
+                continue;
+
+            Dqn_b32 seeded = false;
+            for (Dqn_u32 seed = 0; !seeded && seed < DQN_PERFECT_HASH_MAX_SEED_ATTEMPTS; seed++)
+            {
+                seeded = true;
+                for (Dqn_isize index = start; seeded && index < start + bucket_size; index++)
+                {
+                    Dqn_isize slot = Dqn_PerfectHash__Slot(hashes[order[index]], seed, SLOT_COUNT);
+                    seeded         = result.slots[slot] == -1;
+                    for (Dqn_isize prev = start; seeded && prev < index; prev++)
+                        seeded = slot != Dqn_PerfectHash__Slot(hashes[order[prev]], seed, SLOT_COUNT);
+                }
+
+                if (seeded)
+                {
+                    result.seeds[bucket] = seed;
+                    for (Dqn_isize index = start; index < start + bucket_size; index++)
+                        result.slots[Dqn_PerfectHash__Slot(hashes[order[index]], seed, SLOT_COUNT)] = DQN_CAST(Dqn_i32)order[index];
+                }
+            }
+
+            if (!seeded)
+                return result;
+        }
+    }
+
+    result.valid = true;
+    return result;
+}
+
+template <Dqn_isize N>
+constexpr Dqn_i32 Dqn_PerfectHash__Candidate(Dqn_PerfectHash<N> const *table, char const *key, Dqn_isize size)
+{
+    Dqn_u64 hash   = Dqn_PerfectHash__Hash(key, size);
+    Dqn_u32 seed   = table->seeds[Dqn_PerfectHash__Bucket(hash, N)];
+    Dqn_i32 result = table->slots[Dqn_PerfectHash__Slot(hash, seed, Dqn_PerfectHash__SlotCount(N))];
+    return result;
+}
+
+template <Dqn_isize N>
+constexpr Dqn_isize Dqn_PerfectHash_Find(Dqn_PerfectHash<N> const *table, char const *key, Dqn_isize size)
+{
+    Dqn_i32   index  = Dqn_PerfectHash__Candidate(table, key, size);
+    Dqn_isize result = (index != -1 && Dqn_PerfectHash__Equals(key, size, table->keys[index], table->key_sizes[index])) ? index : -1;
+    return result;
+}
+
+template <Dqn_isize N>
+DQN_API Dqn_isize Dqn_PerfectHash_Find(Dqn_PerfectHash<N> const *table, Dqn_String key)
+{
+    // NOTE: Same as the constexpr Find but compares with memcmp instead of a byte loop
+    Dqn_i32   index  = Dqn_PerfectHash__Candidate(table, key.str, key.size);
+    Dqn_isize result = -1;
+    if (index != -1 && table->key_sizes[index] == key.size && DQN_MEMCMP(table->keys[index], key.str, DQN_CAST(size_t)key.size) == 0)
+        result = index;
+    return result;
+}
+
+// -------------------------------------------------------------------------------------------------
+//
+// NOTE: Dqn_ArenaAllocator Inline Implementation
+//
+// -------------------------------------------------------------------------------------------------
+DQN_FORCE_INLINE void *Dqn_ArenaAllocator__BumpBlock(Dqn_ArenaAllocatorBlock *block, Dqn_isize size, Dqn_u8 alignment)
+{
+    DQN_ASSERT_MSG(alignment > 0 && (alignment & (alignment - 1)) == 0, "Alignment must be a power of 2, %u", alignment);
+    Dqn_uintptr memory   = DQN_CAST(Dqn_uintptr)block->memory;
+    Dqn_uintptr aligned  = (memory + block->used + (alignment - 1)) & ~DQN_CAST(Dqn_uintptr)(alignment - 1);
+    Dqn_isize   new_used = DQN_CAST(Dqn_isize)(aligned - memory) + size;
+
+    void *result = nullptr;
+    if (new_used <= block->size)
+    {
+        block->used = new_used;
+        result      = DQN_CAST(void *)aligned;
+    }
+    return result;
+}
+
+DQN_FORCE_INLINE void *Dqn_ArenaAllocator__Allocate(Dqn_ArenaAllocator *arena, Dqn_isize size, Dqn_u8 alignment, Dqn_ZeroMem zero_mem DQN_CALL_SITE_ARGS)
+{
+    void *result = arena->curr_mem_block ? Dqn_ArenaAllocator__BumpBlock(arena->curr_mem_block, size, alignment) : nullptr;
+    if (!result)
+    {
+        result = Dqn_ArenaAllocator__AllocateSlowPath(arena, size, alignment DQN_CALL_SITE_ARGS_INPUT);
+        if (!result) return result;
+    }
+
+#if defined(DQN_MEMZERO_DEBUG_BYTE)
+    Dqn__ZeroMemBytes(result, DQN_CAST(Dqn_usize)size, zero_mem);
+#else
+    if (zero_mem == Dqn_ZeroMem::Yes) DQN_MEMSET(result, 0, DQN_CAST(size_t)size);
+#endif
+
+#if DQN_ALLOCATION_TRACING
+    Dqn_AllocationTracer_Add(arena->tracer, result, size DQN_CALL_SITE_ARGS_INPUT);
+#endif
+    return result;
+}
+
+#if defined(DQN_COMPILER_W32_MSVC)
+    #pragma warning(pop)
+#endif
+#endif // DQN_H
+
+// -------------------------------------------------------------------------------------------------
+//
+// NOTE: Implementation
+//
+// -------------------------------------------------------------------------------------------------
+#if defined(DQN_IMPLEMENTATION)
+#if !defined(DQN_STB_SPRINTF_HEADER_ONLY)
+    #define STB_SPRINTF_IMPLEMENTATION
+#endif
+#include <stdio.h> // fprintf, FILE, stdout, stderr
+#include <time.h>  // Dqn_EpochTimeToLocalDate
+
+#if defined(DQN_OS_WIN32)
+
+    #if !defined(DQN_NO_WIN32_SHWLAPI_H)
+        #pragma comment(lib, "shlwapi.lib")
+        extern "C" int PathFileExistsA(char const *path);
+    #endif // !defined(DQN_NO_WIN32_SHWLAPI_H)
+
+    #if !defined(DQN_NO_WIN32_WINDOWS_H)
+        #pragma comment(lib, "shlwapi.lib")
+
+        // Taken from Windows.h
+        typedef int BOOL;
+        typedef void * HWND;
+        typedef void * HMODULE;
+
+        typedef union {
+            struct {
+                DWORD LowPart;
+                DWORD HighPart;
+            } DUMMYSTRUCTNAME;
+            struct {
+                DWORD LowPart;
+                DWORD HighPart;
+            } u;
+            Dqn_u64 QuadPart;
+        } ULARGE_INTEGER;
+
+        typedef struct
+        {
+            DWORD dwLowDateTime;
+            DWORD dwHighDateTime;
+        } FILETIME;
+
+        typedef struct
+        {
+            DWORD dwFileAttributes;
+            FILETIME ftCreationTime;
+            FILETIME ftLastAccessTime;
+            FILETIME ftLastWriteTime;
+            DWORD nFileSizeHigh;
+            DWORD nFileSizeLow;
+        } WIN32_FILE_ATTRIBUTE_DATA;
+
+        typedef enum
+        {
+            GetFileExInfoStandard,
+            GetFileExMaxInfoLevel
+        } GET_FILEEX_INFO_LEVELS;
+
+        typedef struct {
+            DWORD nLength;
+            void *lpSecurityDescriptor;
+            bool bInheritHandle;
+        } SECURITY_ATTRIBUTES;
+
+        typedef struct {
+            union {
+                DWORD dwOemId;          // Obsolete field...do not use
+                struct {
+                    Dqn_u16 wProcessorArchitecture;
+                    Dqn_u16 wReserved;
+                } DUMMYSTRUCTNAME;
+            } DUMMYUNIONNAME;
+            DWORD dwPageSize;
+            void *lpMinimumApplicationAddress;
+            void *lpMaximumApplicationAddress;
+            DWORD *dwActiveProcessorMask;
+            DWORD dwNumberOfProcessors;
+            DWORD dwProcessorType;
+            DWORD dwAllocationGranularity;
+            Dqn_u16 wProcessorLevel;
+            Dqn_u16 wProcessorRevision;
+        } SYSTEM_INFO;
+
+        //
+        // NOTE: Wait/Synchronization
+        //
+        #define INFINITE 0xFFFFFFFF // Infinite timeout
+
+        //
+        // NOTE: MultiByteToWideChar
+        //
+        #define CP_UTF8 65001       // UTF-8 translation
+
+        //
+        // NOTE: FormatMessageA
+        //
+        #define FORMAT_MESSAGE_FROM_SYSTEM 0x00001000
+        #define MAKELANGID(p, s) ((((unsigned short  )(s)) << 10) | (unsigned short  )(p))
+        #define SUBLANG_DEFAULT 0x01    // user default
+        #define LANG_NEUTRAL 0x00
+
+        //
+        // NOTE: VirtualAlloc
+        //
+        // NOTE: Allocation Type
+        #define MEM_RESERVE 0x00002000
+        #define MEM_COMMIT 0x00001000
+
+        // NOTE: Free Type
+        #define MEM_DECOMMIT 0x00004000
+        #define MEM_RELEASE 0x00008000
+
+        // NOTE: Protect
+        #define PAGE_NOACCESS 0x01
+        #define PAGE_READWRITE 0x04
+
+        //
+        // NOTE: Win32 Functions
+        //
+        extern "C"
+        {
+        long          _InterlockedExchangeAdd  (long volatile *addend, long value);
+        __int64       _InterlockedExchangeAdd64(__int64 volatile *addend, __int64 value);
+        BOOL          CloseHandle              (void *object);
+        BOOL          CopyFileA                (char const *existing_file_name, char const *new_file_name, BOOL fail_if_exists);
+        BOOL          FreeLibrary              (void *lib_module);
+        BOOL          QueryPerformanceCounter  (LARGE_INTEGER *performance_count);
+        BOOL          QueryPerformanceFrequency(LARGE_INTEGER *frequency);
+        BOOL          ReleaseSemaphore         (void *semaphore, long release_count, long *prev_count);
+        BOOL          VirtualFree              (void *address, size_t size, DWORD free_type);
+        DWORD         FormatMessageA           (DWORD flags, void *source, DWORD message_id, DWORD language_id, char *buffer, DWORD size, va_list *args);
+        DWORD         GetFileAttributesExA     (char const *file_name, GET_FILEEX_INFO_LEVELS info_level, WIN32_FILE_ATTRIBUTE_DATA *file_information);
+        DWORD         GetLastError             ();
+        DWORD         WaitForSingleObject      (void *handle, DWORD milliseconds);
+        unsigned int  GetWindowModuleFileNameA (void *hwnd, char *file_name, unsigned int file_name_max);
+        void          GetSystemInfo            (SYSTEM_INFO *system_info);
+        void         *CreateSemaphoreA         (SECURITY_ATTRIBUTES *security_attributes, long initial_count, long max_count, char *lpName);
+        void         *CreateThread             (SECURITY_ATTRIBUTES *thread_attributes, size_t stack_size, DWORD (*start_function)(void *), void *user_context, DWORD creation_flags, DWORD *thread_id);
+        void         *GetProcAddress           (void *hmodule, char const *proc_name);
+        void         *LoadLibraryA             (char const *file_name);
+        void         *VirtualAlloc             (void *address, size_t size, DWORD allocation_type, DWORD protect);
+        int           MultiByteToWideChar      (unsigned int CodePage, DWORD dwFlags, char const *lpMultiByteStr, int cbMultiByte, wchar_t *lpWideCharStr, int cchWideChar);
+        }
+    #endif // !defined(DQN_NO_WIN32_MINIMAL_HEADER)
+#else // !defined(DQN_OS_WIN32)
+  #include <unistd.h>   // access, sysconf
+  #include <sys/mman.h> // mmap, mprotect, madvise, munmap
+#endif
+
+Dqn_Lib dqn__lib;
+
+DQN_API void Dqn__ZeroMemBytes(void *ptr, Dqn_usize count, Dqn_ZeroMem zero_mem)
+{
+    if (zero_mem == Dqn_ZeroMem::Yes)
+    {
+        DQN_MEMSET(ptr, 0, count);
+    }
+    else
+    {
+#if defined(DQN_MEMZERO_DEBUG_BYTE)
+        DQN_MEMSET(ptr, DQN_MEMZERO_DEBUG_BYTE, count);
+#endif
+    }
+}
+
+// -------------------------------------------------------------------------------------------------
+//
+// NOTE: Intrinsics
+//
+// -------------------------------------------------------------------------------------------------
+#if defined(DQN_COMPILER_GCC) || defined(DQN_COMPILER_CLANG)
+#include <cpuid.h>
+#endif
+
+// -------------------------------------------------------------------------------------------------
+//
+// NOTE: CPUID
+//
+// -------------------------------------------------------------------------------------------------
+Dqn_CPUIDRegisters Dqn_CPUID(int function_id, int sub_function_id)
+{
+    Dqn_CPUIDRegisters result = {};
+#if defined(DQN_COMPILER_W32_MSVC) || defined(DQN_COMPILER_W32_CLANG)
+    __cpuidex(DQN_CAST(int *)result.array, function_id, sub_function_id);
+#elif defined(DQN_COMPILER_GCC) || defined(DQN_COMPILER_CLANG)
+    __get_cpuid_count(function_id, sub_function_id, &result.array[0] /*eax*/, &result.array[1] /*ebx*/, &result.array[2] /*ecx*/ , &result.array[3] /*edx*/);
+#else
+    #error "Compiler not supported"
+#endif
+    return result;
+}
+
+DQN_API Dqn_CPUFeatures Dqn_CPU_Features()
+{
+    if (!dqn__lib.cpu_features_queried)
+    {
+        Dqn_CPUFeatures    features = {};
+        Dqn_CPUIDRegisters leaf0    = Dqn_CPUID(0);
+        Dqn_u32            max_leaf = leaf0.array[0];
+        if (max_leaf >= 1)
+        {
+            Dqn_CPUIDRegisters leaf1 = Dqn_CPUID(1);
+            features.sse2            = (leaf1.array[3] /*edx*/ >> 26) & 1;
+            features.sse42           = (leaf1.array[2] /*ecx*/ >> 20) & 1;
+
+            // NOTE: AVX registers are only usable if the OS has enabled XSAVE of the SSE and AVX state
+            Dqn_b32 os_saves_avx = false;
+            Dqn_b32 osxsave      = (leaf1.array[2] /*ecx*/ >> 27) & 1;
+            Dqn_b32 avx          = (leaf1.array[2] /*ecx*/ >> 28) & 1;
+            if (osxsave && avx)
+            {
+#if defined(DQN_COMPILER_W32_MSVC) || defined(DQN_COMPILER_W32_CLANG)
+                Dqn_u64 xcr0 = _xgetbv(0);
+#else
+                Dqn_u32 xcr0_lo = 0, xcr0_hi = 0;
+                asm volatile("xgetbv" : "=a"(xcr0_lo), "=d"(xcr0_hi) : "c"(0));
+                Dqn_u64 xcr0 = (DQN_CAST(Dqn_u64)xcr0_hi << 32) | xcr0_lo;
+#endif
+                os_saves_avx = (xcr0 & 0x6) == 0x6;
+            }
+
+            if (os_saves_avx && max_leaf >= 7)
+            {
+                Dqn_CPUIDRegisters leaf7 = Dqn_CPUID(7, 0);
+                features.avx2            = (leaf7.array[1] /*ebx*/ >> 5) & 1;
+            }
+        }
+
+        dqn__lib.cpu_features = features;
+        Dqn_CompilerWriteBarrierAndCPUWriteFence;
+        dqn__lib.cpu_features_queried = true;
+    }
+
+    Dqn_CPUFeatures result = dqn__lib.cpu_features;
+    return result;
+}
+
+// -------------------------------------------------------------------------------------------------
+//
+// NOTE: Dqn_TicketMutex
+//
+// -------------------------------------------------------------------------------------------------
+void Dqn_TicketMutex_Begin(Dqn_TicketMutex *mutex)
+{
+    unsigned int ticket = Dqn_AtomicAddU32(&mutex->ticket, 1);
+    Dqn_TicketMutex_BeginTicket(mutex, ticket);
+}
+
+void Dqn_TicketMutex_End(Dqn_TicketMutex *mutex)
+{
+    Dqn_AtomicAddU32(&mutex->serving, 1);
+}
+
+unsigned int Dqn_TicketMutex_MakeTicket(Dqn_TicketMutex *mutex)
+{
+    unsigned int result = Dqn_AtomicAddU32(&mutex->ticket, 1);
+    return result;
+}
+
+void Dqn_TicketMutex_BeginTicket(const Dqn_TicketMutex *mutex, unsigned int ticket)
+{
+    DQN_ASSERT_MSG(DQN_CAST(int)(ticket - mutex->serving) >= 0,
+                   "Mutex skipped ticket? Was ticket generated by the correct mutex via MakeTicket? ticket = %u, "
+                   "mutex->serving = %u",
+                   ticket,
+                   mutex->serving);
+    while(ticket != mutex->serving)
+    {
+        // NOTE: Use spinlock intrinsic
+        _mm_pause();
+    }
+}
+
+Dqn_b32 Dqn_TicketMutex_CanLock(const Dqn_TicketMutex *mutex, unsigned int ticket)
+{
+    DQN_ASSERT_MSG(DQN_CAST(int)(ticket - mutex->serving) >= 0,
+                   "Mutex skipped ticket? Was ticket generated by the correct mutex via MakeTicket? ticket = %u, "
+                   "mutex->serving = %u",
+                   ticket,
+                   mutex->serving);
+    Dqn_b32 result = (ticket == mutex->serving);
+    return result;
+}
+
+
+// -------------------------------------------------------------------------------------------------
+//
+// NOTE: Dqn_Fmt Implementation
+//
+// -------------------------------------------------------------------------------------------------
+DQN_API Dqn_isize Dqn_FmtVLenNoNullTerminator(char const *fmt, va_list args)
+{
+    va_list args_copy;
+    va_copy(args_copy, args);
+    Dqn_isize result = stbsp_vsnprintf(nullptr, 0, fmt, args_copy);
+    va_end(args_copy);
+    return result;
+}
+
+DQN_API Dqn_isize Dqn_FmtLenNoNullTerminator(char const *fmt, ...)
+{
+    va_list args;
+    va_start(args, fmt);
+    Dqn_isize result = stbsp_vsnprintf(nullptr, 0, fmt, args);
+    va_end(args);
+    return result;
+}
+
+DQN_API Dqn_isize Dqn_FmtVLen(char const *fmt, va_list args)
+{
+    va_list args_copy;
+    va_copy(args_copy, args);
+    Dqn_isize result = stbsp_vsnprintf(nullptr, 0, fmt, args_copy) + 1;
+    va_end(args_copy);
+    return result;
+}
+
+DQN_API Dqn_isize Dqn_FmtLen(char const *fmt, ...)
+{
+    va_list args;
+    va_start(args, fmt);
+    Dqn_isize result = stbsp_vsnprintf(nullptr, 0, fmt, args) + 1;
+    va_end(args);
+    return result;
+}
+
+// -------------------------------------------------------------------------------------------------
+//
+// NOTE: Dqn_Log
+//
+// -------------------------------------------------------------------------------------------------
+DQN_API void Dqn_LogV(Dqn_LogType type,
+                      void *      user_data,
+                      char const *file,
+                      Dqn_usize   file_len,
+                      char const *func,
+                      Dqn_usize   func_len,
+                      Dqn_usize   line,
+                      char const *fmt,
+                      va_list     va)
+{
+    (void)user_data;
+
+    int         file_name_len = 0;
+    char const *file_name     = Dqn_Str_FileNameFromPath(file, DQN_CAST(int) file_len, &file_name_len);
+
+    FILE *handle = (type == Dqn_LogType::Error) ? stderr : stdout;
+    fprintf(handle,
+            "[%s] %.*s:%05I64u:%.*s ",
+            Dqn_LogTypeString[DQN_CAST(int) type],
+            file_name_len,
+            file_name,
+            line,
+            DQN_CAST(int)func_len,
+            func);
+
+    // NOTE: Use the callback version of stb_sprintf to allow us to chunk logs and print arbitrary
+    // sized format strings without needing to size it up first.
+    auto stb_vsprintf_callback = [](char *buf, void *user, int len) -> char * {
+        fprintf(DQN_CAST(FILE *)user, "%.*s", len, buf);
+        return buf;
+    };
+
+    char stb_buffer[STB_SPRINTF_MIN * 2] = {};
+    stbsp_vsprintfcb(stb_vsprintf_callback, handle, stb_buffer, fmt, va);
+    fputc('\n', handle);
+}
+
+DQN_API void Dqn_Log(Dqn_LogType type, void *user_data, char const *file, Dqn_usize file_len, char const *func, Dqn_usize func_len, Dqn_usize line, char const *fmt, ...)
+{
+    va_list va;
+    va_start(va, fmt);
+    Dqn_LogV(type, user_data, file, file_len, func, func_len, line, fmt, va);
+    va_end(va);
+}
+
+DQN_API void Dqn_Log_SetCallback(Dqn_LogProc *proc, void *user_data)
+{
+    dqn__lib.LogCallback   = proc;
+    dqn__lib.log_user_data = user_data;
+}
+
+// -------------------------------------------------------------------------------------------------
+//
+// Dqn_Align*
+//
+// -------------------------------------------------------------------------------------------------
+DQN_API Dqn_uintptr Dqn_AlignAddressEnsuringSpace(Dqn_uintptr address, Dqn_u8 alignment)
+{
+    Dqn_uintptr remainder       = address % alignment;
+    Dqn_uintptr offset_to_align = alignment - remainder;
+    Dqn_uintptr result          = address + offset_to_align;
+    DQN_ASSERT(result % alignment == 0);
+    DQN_ASSERT(result >= address);
+    DQN_ASSERT(offset_to_align >= 1 && offset_to_align <= alignment);
+    return result;
+}
+
+DQN_API Dqn_uintptr Dqn_AlignAddress(Dqn_uintptr address, Dqn_u8 alignment)
+{
+    Dqn_uintptr result = address;
+    if (alignment > 0)
+    {
+        Dqn_uintptr remainder = result % alignment;
+        if (remainder > 0)
+        {
+            Dqn_uintptr offset_to_align = alignment - remainder;
+            result += offset_to_align;
+        }
+    }
+    return result;
+}
+
+// -------------------------------------------------------------------------------------------------
+//
+// Dqn_PointerMetadata
+//
+// -------------------------------------------------------------------------------------------------
+DQN_API Dqn_isize Dqn_PointerMetadata_SizeRequired(Dqn_isize size, Dqn_u8 alignment)
+{
+    DQN_ASSERT(alignment > 0);
+    if (alignment <= 0) alignment = 1;
+    Dqn_isize result = size + DQN_CAST(Dqn_i8)(alignment - 1) + DQN_CAST(Dqn_isize)sizeof(Dqn_PointerMetadata);
+    return result;
+}
+
+DQN_API char *Dqn_PointerMetadata_Init(void *ptr, Dqn_isize size, Dqn_u8 alignment)
+{
+    DQN_ASSERT_MSG(alignment == 1 || (alignment & 1) == 0, "Alignment must be a power of 2, %u", alignment);
+
+    // NOTE: Given a pointer, it can misaligned by up to (Alignment - 1) bytes.
+    // After calculating the offset to apply on the aligned ptr, we store the
+    // allocation metadata right before the ptr for convenience, so that we just
+    // need to walk back sizeof(metadata) bytes to get to the metadata from the
+    // pointer.
+
+    //                                                         [Metadata Is Stored Here]
+    // [Raw Pointer] -> [Metadata Storage] [Unaligned Pointer] [Offset to Align Pointer] [Aligned Pointer]
+
+    // NOTE: In the scenario where the pointer is already aligned after the
+    // [Metadata Storage] bytes, we use the bytes allocated for the metadata
+    // storage, instead of storing it into the offset storage bytes.
+
+    //                  [Metadata Is Stored Here]
+    // [Raw Pointer] -> [Metadata Storage]        [Aligned Pointer]
+
+    // Offset is [0->Alignment-1] bytes from the Unaligned ptr.
+    auto raw_ptr       = DQN_CAST(uintptr_t) ptr;
+    auto unaligned_ptr = raw_ptr + sizeof(Dqn_PointerMetadata);
+    auto result        = DQN_CAST(uintptr_t) unaligned_ptr;
+
+    if ((unaligned_ptr % alignment) > 0)
+    {
+        uintptr_t unaligned_to_aligned_offset = alignment - (unaligned_ptr % alignment);
+        result += unaligned_to_aligned_offset;
+    }
+    DQN_ASSERT(result % alignment == 0);
+    DQN_ASSERT(result >= raw_ptr);
+    ptrdiff_t difference = DQN_CAST(ptrdiff_t)result - DQN_CAST(ptrdiff_t)raw_ptr;
+    DQN_ASSERT(difference <= DQN_CAST(Dqn_u8)-1);
+
+    auto *metadata_ptr      = DQN_CAST(Dqn_PointerMetadata *)(result - sizeof(Dqn_PointerMetadata));
+    metadata_ptr->alignment = alignment;
+    metadata_ptr->offset    = DQN_CAST(Dqn_u8)difference;
+    metadata_ptr->size      = size;
+    return DQN_CAST(char *)result;
+}
+
+DQN_API Dqn_PointerMetadata Dqn_PointerMetadata_Get(void *ptr)
+{
+    auto *aligned_ptr = DQN_CAST(char *) ptr;
+    auto result       = *DQN_CAST(Dqn_PointerMetadata *)(aligned_ptr - sizeof(Dqn_PointerMetadata));
+    return result;
+}
+
+DQN_API char *Dqn_PointerMetadata_GetRawPointer(void *ptr)
+{
+    Dqn_PointerMetadata metadata = Dqn_PointerMetadata_Get(ptr);
+    char *result                 = DQN_CAST(char *) ptr - metadata.offset;
+    return result;
+}
+
+// -------------------------------------------------------------------------------------------------
+//
+// NOTE: Dqn_AllocationTracer
+//
+// -------------------------------------------------------------------------------------------------
+Dqn_AllocationTracer Dqn_AllocationTracer_InitWithMemory(void *mem, Dqn_usize mem_size)
+{
+    Dqn_AllocationTracer result = {};
+    result.map                  = Dqn_Map_InitWithMemory<Dqn_AllocationTrace>(mem, mem_size);
+    return result;
+}
+
+void Dqn_AllocationTracer_Add(Dqn_AllocationTracer *tracer, void *ptr, Dqn_usize size DQN_CALL_SITE_ARGS)
+{
+#if DQN_ALLOCATION_TRACING
+    if (!tracer) return;
+    Dqn_AllocationTrace trace = {};
+    trace.ptr                 = ptr;
+    trace.size                = size;
+    trace.file                = file_;
+    trace.func                = func_;
+    trace.line                = line_;
+    trace.msg                 = msg_;
+
+    Dqn_TicketMutex_Begin(&tracer->mutex);
+    Dqn_b32 added = Dqn_Map_Add(&tracer->map, DQN_CAST(Dqn_u64) ptr, trace);
+    DQN_ASSERT_MSG(added, "Pointer traced twice or trace map is full (ptr = %p)", ptr);
+    Dqn_TicketMutex_End(&tracer->mutex);
+#else
+    (void)tracer; (void)ptr; (void)size;
+#endif
+}
+
+void Dqn_AllocationTracer_Remove(Dqn_AllocationTracer *tracer, void *ptr)
+{
+#if DQN_ALLOCATION_TRACING
+    if (!tracer) return;
+    Dqn_TicketMutex_Begin(&tracer->mutex);
+    Dqn_AllocationTrace *trace = Dqn_Map_Get(&tracer->map, DQN_CAST(Dqn_u64) ptr);
+    DQN_ASSERT_MSG(trace->ptr == ptr, "(trace->ptr = %Ix, raw_ptr = %Ix", trace->ptr, ptr);
+
+    Dqn_Map_Erase(&tracer->map, DQN_CAST(Dqn_u64) ptr);
+    Dqn_TicketMutex_End(&tracer->mutex);
+#else
+    (void)tracer; (void)ptr;
+#endif
+}
+
+// -------------------------------------------------------------------------------------------------
+//
+// NOTE: Dqn_CRTAllocator
+//
+// -------------------------------------------------------------------------------------------------
+DQN_API Dqn_CRTAllocator Dqn_CRTAllocator_InitWithProcs(Dqn_CRTAllocator_MallocProc *malloc_proc, Dqn_CRTAllocator_ReallocProc *realloc_proc, Dqn_CRTAllocator_FreeProc *free_proc)
+{
+    Dqn_CRTAllocator result = {};
+    result.malloc           = malloc_proc;
+    result.realloc          = realloc_proc;
+    result.free             = free_proc;
+    return result;
+}
+
+DQN_API void *Dqn_CRTAllocator__Malloc(Dqn_CRTAllocator *allocator, Dqn_usize size DQN_CALL_SITE_ARGS)
+{
+    void *result = allocator->malloc ? allocator->malloc(size) : DQN_MALLOC(size);
+    if (result)
+    {
+        Dqn_AtomicAddU64(&allocator->malloc_bytes, size);
+        Dqn_AtomicAddU64(&allocator->malloc_count, 1ULL);
+        Dqn_AllocationTracer_Add(allocator->tracer, result, size DQN_CALL_SITE_ARGS_INPUT);
+    }
+
+    return result;
+}
+
+DQN_API void *Dqn_CRTAllocator__Realloc(Dqn_CRTAllocator *allocator, void *ptr, Dqn_usize size DQN_CALL_SITE_ARGS)
+{
+    void *result = allocator->realloc ? allocator->realloc(ptr, size) : DQN_REALLOC(ptr, size);
+    if (result)
+    {
+        Dqn_AtomicAddU64(&allocator->realloc_bytes, size);
+        Dqn_AtomicAddU64(&allocator->realloc_count, 1ULL);
+        Dqn_AllocationTracer_Add(allocator->tracer, result, size DQN_CALL_SITE_ARGS_INPUT);
+        if (result != ptr) Dqn_AllocationTracer_Remove(allocator->tracer, ptr);
+    }
+
+    return result;
+}
+
+DQN_API void Dqn_CRTAllocator__Free(Dqn_CRTAllocator *allocator, void *ptr)
+{
+    if (ptr)
+    {
+        Dqn_AtomicAddU64(&allocator->free_count, 1ULL);
+        Dqn_AllocationTracer_Remove(allocator->tracer, ptr);
+    }
+    allocator->free ? allocator->free(ptr) : DQN_FREE(ptr);
+}
+
+// -------------------------------------------------------------------------------------------------
+//
+// NOTE: Dqn_Allocator
+//
+// -------------------------------------------------------------------------------------------------
+DQN_API Dqn_Allocator Dqn_Allocator_InitWithNull()
+{
+    Dqn_Allocator result = {};
+    result.type          = Dqn_AllocatorType::Null;
+    return result;
+}
+
+DQN_API Dqn_Allocator Dqn_Allocator_InitWithHeap()
+{
+    Dqn_Allocator result = {};
+    result.type          = Dqn_AllocatorType::Heap;
+    return result;
+}
+
+DQN_API Dqn_Allocator Dqn_Allocator_InitWithXHeap()
+{
+    Dqn_Allocator result = {};
+    result.type          = Dqn_AllocatorType::XHeap;
+    return result;
+}
+
+DQN_API Dqn_Allocator Dqn_Allocator_InitWithArena(Dqn_ArenaAllocator *arena)
+{
+    Dqn_Allocator result = {};
+    result.type          = Dqn_AllocatorType::Arena;
+    result.context.arena = arena;
+    return result;
+}
+
+DQN_API Dqn_Allocator Dqn_Allocator_InitWithPool(Dqn_PoolAllocator *pool)
+{
+    Dqn_Allocator result = {};
+    result.type          = Dqn_AllocatorType::Pool;
+    result.context.pool  = pool;
+    return result;
+}
+
+DQN_API Dqn_Allocator Dqn_Allocator_InitWithSlab(Dqn_SlabAllocator *slab)
+{
+    Dqn_Allocator result = {};
+    result.type          = Dqn_AllocatorType::Slab;
+    result.context.slab  = slab;
+    return result;
+}
+
+DQN_API Dqn_Allocator Dqn_Allocator_InitWithThreadCache(Dqn_ThreadCacheAllocator *thread_cache)
+{
+    Dqn_Allocator result        = {};
+    result.type                 = Dqn_AllocatorType::ThreadCache;
+    result.context.thread_cache = thread_cache;
+    return result;
+}
+
+DQN_API Dqn_Allocator Dqn_Allocator_InitWithProcs(Dqn_Allocator_CustomAllocateProc *allocate_proc, Dqn_Allocator_CustomFreeProc *free_proc)
+{
+    Dqn_Allocator result   = {};
+    result.type            = Dqn_AllocatorType::Custom;
+    result.custom.allocate = allocate_proc;
+    result.custom.free     = free_proc;
+    return result;
+}
+
+void Dqn_Allocator_Free(Dqn_Allocator *allocator, void *ptr)
+{
+    if (!ptr) return;
+    Dqn_isize bytes_freed = 0;
+    switch (allocator->type)
+    {
+        case Dqn_AllocatorType::Null: return;
+        default: break;
+
+        case Dqn_AllocatorType::Heap:
+        case Dqn_AllocatorType::XHeap:
+        {
+            Dqn_PointerMetadata meta    = Dqn_PointerMetadata_Get(ptr);
+            char *              raw_ptr = Dqn_PointerMetadata_GetRawPointer(ptr);
+            DQN_FREE(raw_ptr);
+            bytes_freed = meta.size;
+        }
+        break;
+
+        case Dqn_AllocatorType::Custom:
+        {
+            if (allocator->custom.free)
+                bytes_freed = allocator->custom.free(ptr, allocator->context.user);
+        }
+        break;
+
+        case Dqn_AllocatorType::Arena:
+            break;
+
+        case Dqn_AllocatorType::Pool:
+        {
+            if (ptr)
+            {
+                Dqn_PoolAllocator_Free(allocator->context.pool, ptr);
+                bytes_freed = allocator->context.pool->slot_size;
+            }
+        }
+        break;
+
+        case Dqn_AllocatorType::Slab:
+        {
+            bytes_freed = Dqn_SlabAllocator_AllocationSize(ptr);
+            Dqn_SlabAllocator_Free(allocator->context.slab, ptr);
+        }
+        break;
+
+        case Dqn_AllocatorType::ThreadCache:
+        {
+            Dqn_ThreadCacheAllocator_Free(allocator->context.thread_cache, ptr);
+        }
+        break;
+    }
+
+    if (ptr)
+    {
+        if (allocator->type != Dqn_AllocatorType::ThreadCache)
+        {
+            allocator->allocations--;
+            DQN_ASSERT(allocator->allocations >= 0);
+            DQN_ASSERT_MSG(allocator->bytes_allocated >= bytes_freed,
+                           "bytes_allocated = %jd, bytes_freed = %jd",
+                           allocator->bytes_allocated,
+                           bytes_freed);
+            allocator->bytes_allocated -= bytes_freed;
+        }
+
+#if DQN_ALLOCATION_TRACING
+        Dqn_AllocationTracer_Remove(allocator->tracer, ptr);
+#endif
+    }
+}
+
+DQN_API void *Dqn_Allocator__Allocate(Dqn_Allocator *allocator, Dqn_isize size, Dqn_u8 alignment, Dqn_ZeroMem zero_mem DQN_CALL_SITE_ARGS)
+{
+    char *result = nullptr;
+    switch (allocator->type)
+    {
+        default:
+        case Dqn_AllocatorType::Null:
+        {
+            DQN_LOG_W("Requested allocation on null allocator");
+            return result;
+        }
 
-    Dqn_Allocator *allocator = list->allocator ? list->allocator : &list->backup_allocator;
-    if (!list->tail || (list->tail->count + count) > list->tail->size)
+        case Dqn_AllocatorType::Heap:
+        case Dqn_AllocatorType::XHeap:
+        {
+            size      = Dqn_PointerMetadata_SizeRequired(size, alignment);
+            void *ptr = zero_mem == Dqn_ZeroMem::Yes ? DQN_CALLOC(1, DQN_CAST(size_t)size) : DQN_MALLOC(size);
+            result = Dqn_PointerMetadata_Init(ptr, size, alignment);
+            if (!result && allocator->type == Dqn_AllocatorType::XHeap)
+            {
+                DQN_ASSERT(result);
+            }
+        }
+        break;
+
+        case Dqn_AllocatorType::Arena:
+        {
+            result = DQN_CAST(char *)Dqn_ArenaAllocator__Allocate(allocator->context.arena, size, alignment, zero_mem DQN_CALL_SITE_ARGS_INPUT);
+        }
+        break;
+
+        case Dqn_AllocatorType::Pool:
+        {
+            // NOTE: Account for the whole slot so that freeing it balances the allocator's stats
+            result = DQN_CAST(char *)Dqn_PoolAllocator__AllocateType(allocator->context.pool, size, alignment, zero_mem DQN_CALL_SITE_ARGS_INPUT);
+            size   = allocator->context.pool->slot_size;
+        }
+        break;
+
+        case Dqn_AllocatorType::Slab:
+        {
+            result = DQN_CAST(char *)Dqn_SlabAllocator__Allocate(allocator->context.slab, size, alignment, zero_mem DQN_CALL_SITE_ARGS_INPUT);
+            size   = Dqn_SlabAllocator_AllocationSize(result);
+        }
+        break;
+
+        case Dqn_AllocatorType::ThreadCache:
+        {
+            result = DQN_CAST(char *)Dqn_ThreadCacheAllocator__Allocate(allocator->context.thread_cache, size, alignment, zero_mem DQN_CALL_SITE_ARGS_INPUT);
+        }
+        break;
+
+        case Dqn_AllocatorType::Custom:
+        {
+            if (allocator->custom.allocate)
+                result = DQN_CAST(char *)allocator->custom.allocate(size, alignment, allocator->context.user DQN_CALL_SITE_ARGS_INPUT);
+        }
+        break;
+    }
+
+    if (result)
     {
-        auto *tail = (Dqn_ListChunk<T> * )Dqn_Allocator__Allocate(allocator, sizeof(Dqn_ListChunk<T>), alignof(Dqn_ListChunk<T>), Dqn_ZeroMem::Yes DQN_CALL_SITE_ARGS_INPUT);
-        if (!tail)
-          return nullptr;
+        if (allocator->type != Dqn_AllocatorType::ThreadCache)
+        {
+            allocator->allocations++;
+            allocator->total_allocations++;
+            allocator->bytes_allocated += size;
+            allocator->total_bytes_allocated += size;
+        }
+
+#if DQN_ALLOCATION_TRACING
+        Dqn_AllocationTracer_Add(allocator->tracer, result, size DQN_CALL_SITE_ARGS_INPUT);
+#endif
+    }
+
+    return result;
+}
+
+// -------------------------------------------------------------------------------------------------
+//
+// NOTE: Dqn_String
+//
+// -------------------------------------------------------------------------------------------------
+DQN_API Dqn_String Dqn_String_Init(char const *str, Dqn_isize size)
+{
+    Dqn_String result = {};
+    result.str_       = str;
+    result.size       = size;
+    result.cap        = size;
+    return result;
+}
+
+DQN_API Dqn_String Dqn_String__InitFmtV(Dqn_Allocator *allocator, char const *fmt, va_list va DQN_CALL_SITE_ARGS)
+{
+    Dqn_String result = {};
+    va_list va2;
+    va_copy(va2, va);
+    result.size = stbsp_vsnprintf(nullptr, 0, fmt, va);
+    result.str  = allocator ? DQN_CAST(char *)Dqn_Allocator__Allocate(allocator, result.size + 1, alignof(char), Dqn_ZeroMem::No DQN_CALL_SITE_ARGS_INPUT)
+                            : DQN_CAST(char *)DQN_MALLOC(result.size + 1);
+    if (result.str)
+    {
+        stbsp_vsnprintf(result.str, Dqn_Safe_TruncateISizeToInt(result.size + 1), fmt, va2);
+        result.str[result.size] = 0;
+        result.cap              = result.size;
+    }
+    va_end(va2);
+    return result;
+}
+
+DQN_API Dqn_String Dqn_String__InitFmt(Dqn_Allocator *allocator DQN_CALL_SITE_ARGS, char const *fmt, ...)
+{
+    va_list va;
+    va_start(va, fmt);
+    Dqn_String result = Dqn_String__InitFmtV(allocator, fmt, va DQN_CALL_SITE_ARGS_INPUT);
+    va_end(va);
+    return result;
+}
+
+DQN_API Dqn_String Dqn_String__InitArenaFmt(Dqn_ArenaAllocator *arena DQN_CALL_SITE_ARGS, char const *fmt, ...)
+{
+    Dqn_Allocator allocator = Dqn_Allocator_InitWithArena(arena);
+    va_list va;
+    va_start(va, fmt);
+    Dqn_String result = Dqn_String__InitFmtV(&allocator, fmt, va DQN_CALL_SITE_ARGS_INPUT);
+    va_end(va);
+    return result;
+}
+
+DQN_API Dqn_String Dqn_String__InitArenaFmtV(Dqn_ArenaAllocator *arena DQN_CALL_SITE_ARGS, char const *fmt, va_list va DQN_CALL_SITE_ARGS)
+{
+    Dqn_Allocator allocator = Dqn_Allocator_InitWithArena(arena);
+    Dqn_String result = Dqn_String__InitFmtV(&allocator, fmt, va DQN_CALL_SITE_ARGS_INPUT);
+    return result;
+}
+
+DQN_API Dqn_String Dqn_String_Allocate(Dqn_Allocator *allocator, Dqn_isize size, Dqn_ZeroMem zero_mem)
+{
+    Dqn_String result = {};
+    result.str        = Dqn_Allocator_NewArray(allocator, char, size, zero_mem);
+    result.cap        = size;
+    return result;
+}
+
+DQN_API Dqn_String Dqn_String_ArenaAllocate(Dqn_ArenaAllocator *arena, Dqn_isize size, Dqn_ZeroMem zero_mem)
+{
+    Dqn_String result = {};
+    result.str        = Dqn_ArenaAllocator_NewArray(arena, char, size, zero_mem);
+    result.cap        = size;
+    return result;
+}
+
+DQN_API Dqn_b32 Dqn_String_Compare(Dqn_String const lhs, Dqn_String const rhs)
+{
+    Dqn_b32 result = false;
+    if (lhs.size == rhs.size)
+        result = (DQN_MEMCMP(lhs.str, rhs.str, DQN_CAST(size_t)lhs.size) == 0);
+    return result;
+}
+
+DQN_API Dqn_b32 Dqn_String_CompareCaseInsensitive(Dqn_String const lhs, Dqn_String const rhs)
+{
+    Dqn_b32 result = (lhs.size == rhs.size);
+    for (Dqn_isize index = 0; index < lhs.size && result; index++)
+        result = (Dqn_Char_ToLower(lhs.str[index]) == Dqn_Char_ToLower(rhs.str[index]));
+    return result;
+}
+
+#define Dqn_String_Copy(src, allocator) Dqn_String__Copy(src, allocator DQN_CALL_SITE(""))
+DQN_API Dqn_String Dqn_String__Copy(Dqn_String const src, Dqn_Allocator *allocator DQN_CALL_SITE_ARGS)
+{
+    Dqn_String result = src;
+    result.str        = allocator ? DQN_CAST(char *)Dqn_Allocator__Allocate(allocator, result.size, alignof(char), Dqn_ZeroMem::No DQN_CALL_SITE_ARGS_INPUT) :
+                                    DQN_CAST(char *)DQN_MALLOC(result.size);
+    result.cap        = result.size;
+    DQN_MEMCOPY(result.str, src.str, DQN_CAST(size_t)result.size);
+    return result;
+}
+
+DQN_API Dqn_String Dqn_String_TrimWhitespaceAround(Dqn_String const src)
+{
+    Dqn_String result = {};
+    result.str_       = Dqn_Str_TrimWhitespaceAround(src.str, src.size, &result.size);
+    return result;
+}
+
+DQN_API Dqn_b32 operator==(Dqn_String const &lhs, Dqn_String const &rhs)
+{
+    Dqn_b32 result = lhs.size == rhs.size && (DQN_MEMCMP(lhs.str, rhs.str, lhs.size) == 0);
+    return result;
+}
+
+DQN_API Dqn_b32 Dqn_String_AppendFmtV(Dqn_String *str, char const *fmt, va_list va)
+{
+    va_list va2;
+    va_copy(va2, va);
+    Dqn_isize require = stbsp_vsnprintf(nullptr, 0, fmt, va) + 1;
+    Dqn_isize space   = str->cap - str->size;
+    Dqn_b32 result    = require <= space;
+
+    if (!result)
+    {
+        DQN_LOG_W("Insufficient space in string: require=%I64d, space=%I64d", require, space);
+        return result;
+    }
+
+    str->size += stbsp_vsnprintf(str->str + str->size, static_cast<int>(space), fmt, va2);
+    va_end(va2);
+    return result;
+}
+
+DQN_API Dqn_b32 Dqn_String_AppendFmt(Dqn_String *str, char const *fmt, ...)
+{
+    va_list va;
+    va_start(va, fmt);
+    Dqn_b32 result = Dqn_String_AppendFmtV(str, fmt, va);
+    va_end(va);
+    return result;
+}
+
+DQN_API void Dqn_String_Free(Dqn_String *string, Dqn_Allocator *allocator)
+{
+    if (allocator) Dqn_Allocator_Free(allocator, string->str);
+    else           DQN_FREE(string->str);
+    *string = {};
+}
+
+DQN_API Dqn_b32 Dqn_String_StartsWith(Dqn_String string, Dqn_String prefix)
+{
+    Dqn_b32 result = false;
+    if (prefix.size > string.size)
+        return result;
+
+    result = DQN_MEMCMP(string.str, prefix.str, prefix.size) == 0;
+    return result;
+}
+
+struct Dqn_String__Splitter
+{
+    Dqn_String            src;
+    Dqn_List<Dqn_String> *splits;
+    Dqn_isize             begin; // Start of the piece being scanned
+    Dqn_isize             count;
+    Dqn_b32               failed;
+};
+
+DQN_FILE_SCOPE Dqn_String__SplitSet Dqn_String__MakeSplitSet(Dqn_String delimiters)
+{
+    Dqn_String__SplitSet result = {};
+    DQN_FOR_EACH(index, delimiters.size)
+    {
+        Dqn_u8 byte = DQN_CAST(Dqn_u8)delimiters.str[index];
+        if (result.is_delimiter[byte])
+            continue;
 
-        Dqn_isize items = DQN_M_MAX(list->chunk_size, count);
-        tail->data      = (T * )Dqn_Allocator__Allocate(allocator, sizeof(T) * items, alignof(T), Dqn_ZeroMem::Yes DQN_CALL_SITE_ARGS_INPUT);
-        tail->size      = items;
+        if (result.count < Dqn_ArrayCountI(result.first_four))
+            result.first_four[result.count] = delimiters.str[index];
+        result.is_delimiter[byte] = true;
+        result.low_nibble_bits[byte >> 7][byte & 0xF] |= DQN_CAST(Dqn_u8)(1 << ((byte >> 4) & 7));
+        result.count++;
+    }
+
+    for (Dqn_isize index = DQN_M_MIN(result.count, 4); result.count && index < 4; index++)
+        result.first_four[index] = result.first_four[0];
+    return result;
+}
 
-        if (!tail->data)
+DQN_FORCE_INLINE void Dqn_String__SplitterEmit(Dqn_String__Splitter *splitter, Dqn_isize end)
+{
+    if (end > splitter->begin && !splitter->failed)
+    {
+        Dqn_String *split = Dqn_List_Make(splitter->splits, 1);
+        if (split)
         {
-            Dqn_Allocator_Free(allocator, tail);
-            return nullptr;
+            *split = Dqn_String_Init(splitter->src.str + splitter->begin, end - splitter->begin);
+            splitter->count++;
+        }
+        else
+        {
+            splitter->failed = true;
         }
+    }
+    splitter->begin = end + 1;
+}
 
-        if (list->tail)
-            list->tail->next = tail;
+#if defined(DQN_SSE2)
+// NOTE: Only valid for sets of up to 4 delimiters, 'delimiters' has each of them in every lane
+DQN_FORCE_INLINE Dqn_u32 Dqn_String__DelimiterMaskSSE2(__m128i block, __m128i const *delimiters)
+{
+    __m128i eq     = _mm_or_si128(_mm_or_si128(_mm_cmpeq_epi8(block, delimiters[0]), _mm_cmpeq_epi8(block, delimiters[1])),
+                                  _mm_or_si128(_mm_cmpeq_epi8(block, delimiters[2]), _mm_cmpeq_epi8(block, delimiters[3])));
+    Dqn_u32 result = DQN_CAST(Dqn_u32)_mm_movemask_epi8(eq);
+    return result;
+}
+
+DQN_FILE_SCOPE Dqn_isize Dqn_String__SplitSSE2(Dqn_String__Splitter *splitter, Dqn_String__SplitSet const *set)
+{
+    __m128i const delimiters[] = {_mm_set1_epi8(set->first_four[0]), _mm_set1_epi8(set->first_four[1]),
+                                  _mm_set1_epi8(set->first_four[2]), _mm_set1_epi8(set->first_four[3])};
+
+    Dqn_isize pos = 0;
+    for (; pos + 16 <= splitter->src.size && !splitter->failed; pos += 16)
+    {
+        __m128i block = _mm_loadu_si128(DQN_CAST(__m128i const *)(splitter->src.str + pos));
+        for (Dqn_u32 mask = Dqn_String__DelimiterMaskSSE2(block, delimiters); mask; mask &= mask - 1)
+            Dqn_String__SplitterEmit(splitter, pos + Dqn_CountTrailingZerosU32(mask));
+    }
+    return pos;
+}
+
+DQN_FILE_SCOPE Dqn_isize Dqn_String__FindDelimiterSSE2(char const *src, Dqn_isize size, Dqn_String__SplitSet const *set)
+{
+    __m128i const delimiters[] = {_mm_set1_epi8(set->first_four[0]), _mm_set1_epi8(set->first_four[1]),
+                                  _mm_set1_epi8(set->first_four[2]), _mm_set1_epi8(set->first_four[3])};
+
+    Dqn_isize pos = 0;
+    for (; pos + 16 <= size; pos += 16)
+    {
+        Dqn_u32 mask = Dqn_String__DelimiterMaskSSE2(_mm_loadu_si128(DQN_CAST(__m128i const *)(src + pos)), delimiters);
+        if (mask)
+            return pos + Dqn_CountTrailingZerosU32(mask);
+    }
+    return pos;
+}
+#endif // DQN_SSE2
+
+#if defined(DQN_AVX2)
+// NOTE: Bit (high nibble & 7) of the low nibble's entry in the table for the top bit of each byte
+DQN_AVX2_FUNCTION DQN_FORCE_INLINE Dqn_u32 Dqn_String__DelimiterMaskAVX2(__m256i block, __m256i low_bits_0, __m256i low_bits_1)
+{
+    __m256i high_bit    = _mm256_setr_epi8(1, 2, 4, 8, 16, 32, 64, -128, 1, 2, 4, 8, 16, 32, 64, -128,
+                                           1, 2, 4, 8, 16, 32, 64, -128, 1, 2, 4, 8, 16, 32, 64, -128);
+    __m256i nibble_mask = _mm256_set1_epi8(0xF);
+    __m256i low         = _mm256_and_si256(block, nibble_mask);
+    __m256i high        = _mm256_and_si256(_mm256_srli_epi16(block, 4), nibble_mask);
+    __m256i bits        = _mm256_blendv_epi8(_mm256_shuffle_epi8(low_bits_0, low), _mm256_shuffle_epi8(low_bits_1, low), block);
+    __m256i bit         = _mm256_shuffle_epi8(high_bit, high);
+    Dqn_u32 result      = DQN_CAST(Dqn_u32)_mm256_movemask_epi8(_mm256_cmpeq_epi8(_mm256_and_si256(bits, bit), bit));
+    return result;
+}
 
-        list->tail = tail;
+DQN_AVX2_FUNCTION DQN_FILE_SCOPE Dqn_isize Dqn_String__SplitAVX2(Dqn_String__Splitter *splitter, Dqn_String__SplitSet const *set)
+{
+    __m256i low_bits_0 = _mm256_broadcastsi128_si256(_mm_loadu_si128(DQN_CAST(__m128i const *)set->low_nibble_bits[0]));
+    __m256i low_bits_1 = _mm256_broadcastsi128_si256(_mm_loadu_si128(DQN_CAST(__m128i const *)set->low_nibble_bits[1]));
 
-        if (!list->head)
-            list->head = list->tail;
+    Dqn_isize pos = 0;
+    for (; pos + 32 <= splitter->src.size && !splitter->failed; pos += 32)
+    {
+        __m256i block = _mm256_loadu_si256(DQN_CAST(__m256i const *)(splitter->src.str + pos));
+        for (Dqn_u32 mask = Dqn_String__DelimiterMaskAVX2(block, low_bits_0, low_bits_1); mask; mask &= mask - 1)
+            Dqn_String__SplitterEmit(splitter, pos + Dqn_CountTrailingZerosU32(mask));
     }
+    return pos;
+}
 
-    T *result = list->tail->data + list->tail->count;
-    list->tail->count += count;
-    list->count += count;
-    return result;
+DQN_AVX2_FUNCTION DQN_FILE_SCOPE Dqn_isize Dqn_String__FindDelimiterAVX2(char const *src, Dqn_isize size, Dqn_String__SplitSet const *set)
+{
+    __m256i low_bits_0 = _mm256_broadcastsi128_si256(_mm_loadu_si128(DQN_CAST(__m128i const *)set->low_nibble_bits[0]));
+    __m256i low_bits_1 = _mm256_broadcastsi128_si256(_mm_loadu_si128(DQN_CAST(__m128i const *)set->low_nibble_bits[1]));
+
+    Dqn_isize pos = 0;
+    for (; pos + 32 <= size; pos += 32)
+    {
+        Dqn_u32 mask = Dqn_String__DelimiterMaskAVX2(_mm256_loadu_si256(DQN_CAST(__m256i const *)(src + pos)), low_bits_0, low_bits_1);
+        if (mask)
+            return pos + Dqn_CountTrailingZerosU32(mask);
+    }
+    return pos;
 }
+#endif // DQN_AVX2
 
-template <typename T>
-Dqn_b32 Dqn_List_Iterate(Dqn_List<T> *list, Dqn_ListIterator<T> *iterator)
+// NOTE: Return the index of the first delimiter in 'src' or 'size' if there is none
+DQN_FILE_SCOPE Dqn_isize Dqn_String__FindDelimiter(char const *src, Dqn_isize size, Dqn_String__SplitSet const *set)
 {
-    Dqn_b32 result = false;
-    if (!iterator->init)
+    // NOTE: Tokens are usually short, don't pay for the SIMD setup until there's a register's worth
+    Dqn_isize pos = 0;
+    for (; pos < size && pos < 16; pos++)
     {
-        *iterator       = {};
-        iterator->chunk = list->head;
-        iterator->init  = true;
+        if (set->is_delimiter[DQN_CAST(Dqn_u8)src[pos]])
+            return pos;
     }
 
-    if (iterator->chunk)
+#if defined(DQN_AVX2)
+    if (Dqn_CPU_Features().avx2)
+        pos += Dqn_String__FindDelimiterAVX2(src + pos, size - pos, set);
+    else
+#endif
     {
-        if (iterator->chunk_data_index >= iterator->chunk->count)
+#if defined(DQN_SSE2)
+        if (set->count <= Dqn_ArrayCountI(set->first_four))
+            pos += Dqn_String__FindDelimiterSSE2(src + pos, size - pos, set);
+#endif
+    }
+
+    while (pos < size && !set->is_delimiter[DQN_CAST(Dqn_u8)src[pos]])
+        pos++;
+    return pos;
+}
+
+DQN_API Dqn_isize Dqn_String_SplitToList(Dqn_String src, Dqn_String delimiters, Dqn_List<Dqn_String> *splits)
+{
+    Dqn_String__Splitter splitter = {};
+    splitter.src                  = src;
+    splitter.splits               = splits;
+    if (!src.str || src.size <= 0)
+        return splitter.count;
+
+    // NOTE: The SIMD loops return the position they stopped at, the bytes that don't fill a
+    // register are checked by the scalar loop.
+    Dqn_String__SplitSet set = Dqn_String__MakeSplitSet(delimiters);
+    Dqn_isize            pos = 0;
+    if (set.count)
+    {
+#if defined(DQN_AVX2)
+        if (Dqn_CPU_Features().avx2)
+            pos = Dqn_String__SplitAVX2(&splitter, &set);
+        else
+#endif
         {
-            iterator->chunk            = iterator->chunk->next;
-            iterator->chunk_data_index = 0;
+#if defined(DQN_SSE2)
+            if (set.count <= Dqn_ArrayCountI(set.first_four))
+                pos = Dqn_String__SplitSSE2(&splitter, &set);
+#endif
         }
 
-        if (iterator->chunk)
+        for (; pos < src.size && !splitter.failed; pos++)
         {
-            iterator->data = iterator->chunk->data + iterator->chunk_data_index++;
-            result         = true;
+            if (set.is_delimiter[DQN_CAST(Dqn_u8)src.str[pos]])
+                Dqn_String__SplitterEmit(&splitter, pos);
         }
     }
 
-    if (!iterator->chunk)
+    Dqn_String__SplitterEmit(&splitter, src.size);
+    return splitter.count;
+}
+
+DQN_API Dqn_Slice<Dqn_String> Dqn_String_Split(Dqn_String src, Dqn_Allocator *allocator)
+{
+    // NOTE: Split into a list on the scratch arena so the input is only read once, then copy the
+    // lines out now that the count is known.
+    Dqn_ScratchArena     scratch = Dqn_Scratch_Get(allocator && allocator->type == Dqn_AllocatorType::Arena ? allocator->context.arena : nullptr);
+    Dqn_List<Dqn_String> lines   = Dqn_List_InitWithArena<Dqn_String>(scratch.arena, 4096);
+    Dqn_isize            count   = Dqn_String_SplitToList(src, DQN_STRING("\r\n"), &lines);
+
+    Dqn_Slice<Dqn_String> result = Dqn_Slice_Allocate(allocator, Dqn_String, count, Dqn_ZeroMem::No);
+    if (result.data)
     {
-        DQN_ASSERT(result == false);
+        Dqn_isize index = 0;
+        for (Dqn_ListIterator<Dqn_String> it = {}; Dqn_List_Iterate(&lines, &it) && index < count;)
+            result[index++] = *it.data;
     }
     return result;
 }
 
-#if defined(DQN_COMPILER_W32_MSVC)
-    #pragma warning(pop)
-#endif
-#endif // DQN_H
-
 // -------------------------------------------------------------------------------------------------
 //
-// NOTE: Implementation
+// NOTE: Dqn_StringTokenizer
 //
 // -------------------------------------------------------------------------------------------------
-#if defined(DQN_IMPLEMENTATION)
-#if !defined(DQN_STB_SPRINTF_HEADER_ONLY)
-    #define STB_SPRINTF_IMPLEMENTATION
-#endif
-#include <stdio.h> // fprintf, FILE, stdout, stderr
-#include <time.h>  // Dqn_EpochTimeToLocalDate
+DQN_API Dqn_StringTokenizer Dqn_StringTokenizer_InitWithDelimiters(Dqn_String src, Dqn_String delimiters)
+{
+    Dqn_StringTokenizer result = {};
+    result.src                 = src;
+    result.set                 = Dqn_String__MakeSplitSet(delimiters);
+    return result;
+}
 
-#if defined(DQN_OS_WIN32)
+DQN_API Dqn_StringTokenizer Dqn_StringTokenizer_InitLines(Dqn_String src)
+{
+    Dqn_StringTokenizer result = Dqn_StringTokenizer_InitWithDelimiters(src, DQN_STRING("\r\n"));
+    return result;
+}
 
-    #if !defined(DQN_NO_WIN32_SHWLAPI_H)
-        #pragma comment(lib, "shlwapi.lib")
-        extern "C" int PathFileExistsA(char const *path);
-    #endif // !defined(DQN_NO_WIN32_SHWLAPI_H)
+DQN_API Dqn_StringTokenizer Dqn_StringTokenizer_InitWords(Dqn_String src)
+{
+    char      whitespace[8];
+    Dqn_isize count = 0;
+    for (int ch = 0; ch < 256 && count < Dqn_ArrayCountI(whitespace); ch++)
+    {
+        if (Dqn_Char_IsWhitespace(DQN_CAST(char)ch))
+            whitespace[count++] = DQN_CAST(char)ch;
+    }
 
-    #if !defined(DQN_NO_WIN32_WINDOWS_H)
-        #pragma comment(lib, "shlwapi.lib")
+    Dqn_StringTokenizer result = Dqn_StringTokenizer_InitWithDelimiters(src, Dqn_String_Init(whitespace, count));
+    return result;
+}
 
-        // Taken from Windows.h
-        typedef int BOOL;
-        typedef void * HWND;
-        typedef void * HMODULE;
+DQN_API Dqn_b32 Dqn_StringTokenizer_Next(Dqn_StringTokenizer *tokenizer)
+{
+    Dqn_String const *src   = &tokenizer->src;
+    Dqn_isize         begin = tokenizer->pos;
+    while (begin < src->size && tokenizer->set.is_delimiter[DQN_CAST(Dqn_u8)src->str[begin]])
+        begin++;
 
-        typedef union {
-            struct {
-                DWORD LowPart;
-                DWORD HighPart;
-            } DUMMYSTRUCTNAME;
-            struct {
-                DWORD LowPart;
-                DWORD HighPart;
-            } u;
-            Dqn_u64 QuadPart;
-        } ULARGE_INTEGER;
+    if (begin >= src->size)
+    {
+        tokenizer->pos   = src->size;
+        tokenizer->token = {};
+        return false;
+    }
 
-        typedef struct
-        {
-            DWORD dwLowDateTime;
-            DWORD dwHighDateTime;
-        } FILETIME;
+    Dqn_isize size   = Dqn_String__FindDelimiter(src->str + begin, src->size - begin, &tokenizer->set);
+    tokenizer->token = Dqn_String_Init(src->str + begin, size);
+    tokenizer->pos   = begin + size;
+    return true;
+}
 
-        typedef struct
-        {
-            DWORD dwFileAttributes;
-            FILETIME ftCreationTime;
-            FILETIME ftLastAccessTime;
-            FILETIME ftLastWriteTime;
-            DWORD nFileSizeHigh;
-            DWORD nFileSizeLow;
-        } WIN32_FILE_ATTRIBUTE_DATA;
+DQN_API Dqn_String Dqn_StringTokenizer_Rest(Dqn_StringTokenizer const *tokenizer)
+{
+    Dqn_String result = Dqn_String_Init(tokenizer->src.str + tokenizer->pos, tokenizer->src.size - tokenizer->pos);
+    return result;
+}
 
-        typedef enum
+// -------------------------------------------------------------------------------------------------
+//
+// NOTE: Dqn_StringInterner
+//
+// -------------------------------------------------------------------------------------------------
+DQN_API Dqn_StringInterner Dqn_StringInterner_InitWithArena(Dqn_ArenaAllocator *arena, Dqn_b32 thread_safe)
+{
+    Dqn_StringInterner result = {};
+    result.arena              = arena;
+    result.thread_safe        = thread_safe;
+    result.map                = Dqn_StringMap_InitWithArena<Dqn_InternedString>(arena, 1024);
+    result.entries.allocator  = Dqn_Allocator_InitWithArena(arena);
+    return result;
+}
+
+DQN_API Dqn_InternedString Dqn_StringInterner_Intern(Dqn_StringInterner *interner, Dqn_String string)
+{
+    Dqn_InternedString result = {};
+    if (interner->thread_safe) Dqn_TicketMutex_Begin(&interner->mutex);
+
+    Dqn_StringMapEntry<Dqn_InternedString> *entry = Dqn_StringMap_Get(&interner->map, string);
+    if (entry)
+    {
+        result = *entry->value;
+    }
+    else if (DQN_CAST(Dqn_u64)interner->entries.size < DQN_U32_MAX)
+    {
+        // NOTE: The entry and the canonical copy of the string are a single allocation
+        auto *interned = DQN_CAST(Dqn_InternedString *)Dqn_ArenaAllocator_Allocate(interner->arena,
+                                                                                 sizeof(Dqn_InternedString) + string.size + 1,
+                                                                                 alignof(Dqn_InternedString),
+                                                                                 Dqn_ZeroMem::No);
+        if (interned)
         {
-            GetFileExInfoStandard,
-            GetFileExMaxInfoLevel
-        } GET_FILEEX_INFO_LEVELS;
+            char *str = DQN_CAST(char *)(interned + 1);
+            DQN_MEMCOPY(str, string.str, string.size);
+            str[string.size] = 0;
+
+            interned->string = Dqn_String_Init(str, string.size);
+            interned->id     = DQN_CAST(Dqn_u32)(interner->entries.size + 1);
+            // NOTE: Append before publishing to the map so a failed append never leaves the map
+            // handing out an id that has no entry. Undo the append if the map insert fails.
+            if (Dqn_Array_Add(&interner->entries, *interned))
+            {
+                if (Dqn_StringMap_Add(&interner->map, interned->string, interned, Dqn_StringMapCollisionRule::Stop))
+                    result = *interned;
+                else
+                    Dqn_Array_Pop(&interner->entries, 1);
+            }
+        }
+    }
 
-        typedef struct {
-            DWORD nLength;
-            void *lpSecurityDescriptor;
-            bool bInheritHandle;
-        } SECURITY_ATTRIBUTES;
+    if (interner->thread_safe) Dqn_TicketMutex_End(&interner->mutex);
+    return result;
+}
 
-        typedef struct {
-            union {
-                DWORD dwOemId;          // Obsolete field...do not use
-                struct {
-                    Dqn_u16 wProcessorArchitecture;
-                    Dqn_u16 wReserved;
-                } DUMMYSTRUCTNAME;
-            } DUMMYUNIONNAME;
-            DWORD dwPageSize;
-            void *lpMinimumApplicationAddress;
-            void *lpMaximumApplicationAddress;
-            DWORD *dwActiveProcessorMask;
-            DWORD dwNumberOfProcessors;
-            DWORD dwProcessorType;
-            DWORD dwAllocationGranularity;
-            Dqn_u16 wProcessorLevel;
-            Dqn_u16 wProcessorRevision;
-        } SYSTEM_INFO;
+DQN_API Dqn_InternedString Dqn_StringInterner_Find(Dqn_StringInterner *interner, Dqn_String string)
+{
+    Dqn_InternedString result = {};
+    if (interner->thread_safe) Dqn_TicketMutex_Begin(&interner->mutex);
+    Dqn_StringMapEntry<Dqn_InternedString> *entry = Dqn_StringMap_Get(&interner->map, string);
+    if (entry) result = *entry->value;
+    if (interner->thread_safe) Dqn_TicketMutex_End(&interner->mutex);
+    return result;
+}
 
-        //
-        // NOTE: Wait/Synchronization
-        //
-        #define INFINITE 0xFFFFFFFF // Infinite timeout
+DQN_API Dqn_String Dqn_StringInterner_StringFromID(Dqn_StringInterner *interner, Dqn_u32 id)
+{
+    Dqn_String result = {};
+    if (interner->thread_safe) Dqn_TicketMutex_Begin(&interner->mutex);
+    if (id > 0 && DQN_CAST(Dqn_isize)id <= interner->entries.size)
+        result = interner->entries.data[id - 1].string;
+    if (interner->thread_safe) Dqn_TicketMutex_End(&interner->mutex);
+    return result;
+}
 
-        //
-        // NOTE: MultiByteToWideChar
-        //
-        #define CP_UTF8 65001       // UTF-8 translation
+// -------------------------------------------------------------------------------------------------
+//
+// NOTE: Dqn_AhoCorasick
+//
+// -------------------------------------------------------------------------------------------------
+DQN_API Dqn_AhoCorasick Dqn_AhoCorasick_InitWithArena(Dqn_ArenaAllocator *arena, Dqn_String const *patterns, Dqn_isize pattern_count)
+{
+    Dqn_AhoCorasick result = {};
 
-        //
-        // NOTE: FormatMessageA
-        //
-        #define FORMAT_MESSAGE_FROM_SYSTEM 0x00001000
-        #define MAKELANGID(p, s) ((((unsigned short  )(s)) << 10) | (unsigned short  )(p))
-        #define SUBLANG_DEFAULT 0x01    // user default
-        #define LANG_NEUTRAL 0x00
+    // NOTE: Give each byte used by a pattern its own column, the trie has at most 1 state per byte
+    Dqn_isize max_states = 1;
+    result.class_count   = 1;
+    DQN_FOR_EACH(pattern_index, pattern_count)
+    {
+        Dqn_String const *pattern = patterns + pattern_index;
+        max_states               += pattern->size;
+        DQN_FOR_EACH(index, pattern->size)
+        {
+            Dqn_u16 *byte_class = result.byte_class + DQN_CAST(Dqn_u8)pattern->str[index];
+            if (*byte_class == 0)
+                *byte_class = DQN_CAST(Dqn_u16)result.class_count++;
+        }
+    }
 
-        //
-        // NOTE: VirtualAlloc
-        //
-        // NOTE: Allocation Type
-        #define MEM_RESERVE 0x00002000
-        #define MEM_COMMIT 0x00001000
+    if (DQN_CAST(Dqn_u64)(max_states * result.class_count) >= DQN_AHO_CORASICK__OUTPUT_BIT)
+    {
+        DQN_LOG_E("Aho-Corasick table of %zd states and %zd byte classes is too large", max_states, result.class_count);
+        return {};
+    }
 
-        // NOTE: Free Type
-        #define MEM_RELEASE 0x00008000
+    // NOTE: Only the tables the matcher keeps go in 'arena', the failure links and BFS queue are
+    // build temporaries. On failure 'arena' is rewound to where it was.
+    Dqn_ScratchArena         scratch      = Dqn_Scratch_Get(arena);
+    Dqn_ArenaAllocatorRegion arena_region = Dqn_ArenaAllocator_BeginRegion(arena);
+    Dqn_isize const          class_count  = result.class_count;
+    auto *fail                            = Dqn_ArenaAllocator_NewArray(scratch.arena, Dqn_i32, max_states, Dqn_ZeroMem::No);
+    auto *queue                           = Dqn_ArenaAllocator_NewArray(scratch.arena, Dqn_i32, max_states, Dqn_ZeroMem::No);
+    auto *next                            = Dqn_ArenaAllocator_NewArray(arena, Dqn_u32, max_states * class_count, Dqn_ZeroMem::No);
+    result.output                         = Dqn_ArenaAllocator_NewArray(arena, Dqn_i32, max_states, Dqn_ZeroMem::No);
+    result.output_link                    = Dqn_ArenaAllocator_NewArray(arena, Dqn_i32, max_states, Dqn_ZeroMem::No);
+    result.pattern_sizes                  = Dqn_ArenaAllocator_NewArray(arena, Dqn_isize, pattern_count, Dqn_ZeroMem::No);
+    if (!next || !fail || !queue || !result.output || !result.output_link || (pattern_count && !result.pattern_sizes))
+    {
+        Dqn_ArenaAllocator_EndRegion(arena_region);
+        return {};
+    }
 
-        // NOTE: Protect
-        #define PAGE_READWRITE 0x04
+    // NOTE: Build the trie, transitions are state indexes while building, DQN_U32_MAX if missing
+    DQN_MEMSET(next, 0xFF, sizeof(*next) * max_states * class_count);
+    DQN_MEMSET(result.output, 0xFF, sizeof(*result.output) * max_states);
+    result.state_count   = 1;
+    result.pattern_count = pattern_count;
+    DQN_FOR_EACH(pattern_index, pattern_count)
+    {
+        Dqn_String const *pattern           = patterns + pattern_index;
+        result.pattern_sizes[pattern_index] = pattern->size;
+        if (pattern->size == 0)
+            continue;
 
-        //
-        // NOTE: Win32 Functions
-        //
-        extern "C"
+        Dqn_isize state = 0;
+        DQN_FOR_EACH(index, pattern->size)
         {
-        long          _InterlockedExchangeAdd  (long volatile *addend, long value);
-        __int64       _InterlockedExchangeAdd64(__int64 volatile *addend, __int64 value);
-        BOOL          CopyFileA                (char const *existing_file_name, char const *new_file_name, BOOL fail_if_exists);
-        BOOL          FreeLibrary              (void *lib_module);
-        BOOL          QueryPerformanceCounter  (LARGE_INTEGER *performance_count);
-        BOOL          QueryPerformanceFrequency(LARGE_INTEGER *frequency);
-        BOOL          ReleaseSemaphore         (void *semaphore, long release_count, long *prev_count);
-        BOOL          VirtualFree              (void *address, size_t size, DWORD free_type);
-        DWORD         FormatMessageA           (DWORD flags, void *source, DWORD message_id, DWORD language_id, char *buffer, DWORD size, va_list *args);
-        DWORD         GetFileAttributesExA     (char const *file_name, GET_FILEEX_INFO_LEVELS info_level, WIN32_FILE_ATTRIBUTE_DATA *file_information);
-        DWORD         GetLastError             ();
-        DWORD         WaitForSingleObject      (void *handle, DWORD milliseconds);
-        unsigned int  GetWindowModuleFileNameA (void *hwnd, char *file_name, unsigned int file_name_max);
-        void          GetSystemInfo            (SYSTEM_INFO *system_info);
-        void         *CreateSemaphoreA         (SECURITY_ATTRIBUTES *security_attributes, long initial_count, long max_count, char *lpName);
-        void         *CreateThread             (SECURITY_ATTRIBUTES *thread_attributes, size_t stack_size, DWORD (*start_function)(void *), void *user_context, DWORD creation_flags, DWORD *thread_id);
-        void         *GetProcAddress           (void *hmodule, char const *proc_name);
-        void         *LoadLibraryA             (char const *file_name);
-        void         *VirtualAlloc             (void *address, size_t size, DWORD allocation_type, DWORD protect);
-        int           MultiByteToWideChar      (unsigned int CodePage, DWORD dwFlags, char const *lpMultiByteStr, int cbMultiByte, wchar_t *lpWideCharStr, int cchWideChar);
+            Dqn_u32 *transition = next + (state * class_count) + result.byte_class[DQN_CAST(Dqn_u8)pattern->str[index]];
+            if (*transition == DQN_U32_MAX)
+                *transition = DQN_CAST(Dqn_u32)result.state_count++;
+            state = *transition;
         }
-    #endif // !defined(DQN_NO_WIN32_MINIMAL_HEADER)
-#else // !defined(DQN_OS_WIN32)
-  #include <unistd.h> // access
-#endif
 
-Dqn_Lib dqn__lib;
+        if (result.output[state] == -1) // NOTE: Duplicates report the first pattern
+            result.output[state] = DQN_CAST(Dqn_i32)pattern_index;
+    }
 
-DQN_API void Dqn__ZeroMemBytes(void *ptr, Dqn_usize count, Dqn_ZeroMem zero_mem)
+    // NOTE: Breadth first, a state's failure link (the longest suffix of it that is also in the trie)
+    // is always shallower, so missing transitions can be copied from the failure state's row.
+    Dqn_isize queue_head = 0, queue_tail = 0;
+    fail[0]               = 0;
+    result.output_link[0] = -1;
+    queue[queue_tail++]   = 0;
+    while (queue_head < queue_tail)
+    {
+        Dqn_i32  state = queue[queue_head++];
+        Dqn_u32 *row   = next + (state * class_count);
+        DQN_FOR_EACH(column, class_count)
+        {
+            Dqn_u32 fail_next = state ? next[(fail[state] * class_count) + column] : 0;
+            if (row[column] == DQN_U32_MAX)
+            {
+                row[column] = fail_next;
+                continue;
+            }
+
+            Dqn_i32 child             = DQN_CAST(Dqn_i32)row[column];
+            fail[child]               = DQN_CAST(Dqn_i32)fail_next;
+            result.output_link[child] = result.output[fail_next] != -1 ? fail[child] : result.output_link[fail_next];
+            queue[queue_tail++]       = child;
+        }
+    }
+
+    // NOTE: Turn the state indexes into row offsets flagged if they end a pattern so the scan loop
+    // is a load and an add per byte and only looks at the outputs on a match.
+    DQN_FOR_EACH(index, result.state_count * class_count)
+    {
+        Dqn_u32 state = next[index];
+        next[index]   = DQN_CAST(Dqn_u32)(state * class_count);
+        if (result.output[state] != -1 || result.output_link[state] != -1)
+            next[index] |= DQN_AHO_CORASICK__OUTPUT_BIT;
+    }
+
+    result.next = next;
+    return result;
+}
+
+DQN_API Dqn_b32 Dqn_AhoCorasick_FindFirst(Dqn_AhoCorasick const *matcher, char const *buf, Dqn_isize buf_len, Dqn_AhoCorasickMatch *match)
 {
-    if (zero_mem == Dqn_ZeroMem::Yes)
+    if (!matcher->next)
+        return false;
+
+    Dqn_u32 row = 0;
+    for (Dqn_isize index = 0; index < buf_len; index++)
     {
-        DQN_MEMSET(ptr, 0, count);
+        Dqn_u32 value = matcher->next[row + matcher->byte_class[DQN_CAST(Dqn_u8)buf[index]]];
+        row           = value & ~DQN_AHO_CORASICK__OUTPUT_BIT;
+        if (value & DQN_AHO_CORASICK__OUTPUT_BIT)
+        {
+            Dqn_isize state   = row / matcher->class_count;
+            Dqn_i32   pattern = matcher->output[state] != -1 ? matcher->output[state] : matcher->output[matcher->output_link[state]];
+            if (match)
+            {
+                match->pattern_index = pattern;
+                match->size          = matcher->pattern_sizes[pattern];
+                match->offset        = index + 1 - match->size;
+            }
+            return true;
+        }
     }
-    else
+    return false;
+}
+
+DQN_API Dqn_isize Dqn_AhoCorasick_FindAll(Dqn_AhoCorasick const *matcher, char const *buf, Dqn_isize buf_len, Dqn_List<Dqn_AhoCorasickMatch> *matches)
+{
+    Dqn_isize result = 0;
+    if (!matcher->next)
+        return result;
+
+    Dqn_u32 row = 0;
+    for (Dqn_isize index = 0; index < buf_len; index++)
     {
-#if defined(DQN_MEMZERO_DEBUG_BYTE)
-        DQN_MEMSET(ptr, DQN_MEMZERO_DEBUG_BYTE, count);
-#endif
+        Dqn_u32 value = matcher->next[row + matcher->byte_class[DQN_CAST(Dqn_u8)buf[index]]];
+        row           = value & ~DQN_AHO_CORASICK__OUTPUT_BIT;
+        if ((value & DQN_AHO_CORASICK__OUTPUT_BIT) == 0)
+            continue;
+
+        Dqn_i32 state = DQN_CAST(Dqn_i32)(row / matcher->class_count);
+        if (matcher->output[state] == -1)
+            state = matcher->output_link[state];
+
+        for (; state != -1; state = matcher->output_link[state])
+        {
+            Dqn_AhoCorasickMatch *match = Dqn_List_Make(matches, 1);
+            if (!match)
+                return result;
+
+            match->pattern_index = matcher->output[state];
+            match->size          = matcher->pattern_sizes[match->pattern_index];
+            match->offset        = index + 1 - match->size;
+            result++;
+        }
     }
+    return result;
 }
 
 // -------------------------------------------------------------------------------------------------
 //
-// NOTE: Intrinsics
-//
-// -------------------------------------------------------------------------------------------------
-#if defined(DQN_COMPILER_GCC) || defined(DQN_COMPILER_CLANG)
-#include <cpuid.h>
-#endif
-
-// -------------------------------------------------------------------------------------------------
-//
-// NOTE: CPUID
+// NOTE: Dqn_VirtualMem
 //
 // -------------------------------------------------------------------------------------------------
-Dqn_CPUIDRegisters Dqn_CPUID(int function_id)
+DQN_API Dqn_isize Dqn_VirtualMem_PageSize()
 {
-    Dqn_CPUIDRegisters result = {};
-#if defined(DQN_COMPILER_W32_MSVC) || defined(DQN_COMPILER_W32_CLANG)
-    __cpuid(DQN_CAST(int *)result.array, function_id);
-#elif defined(DQN_COMPILER_GCC) || defined(DQN_COMPILER_CLANG)
-    __get_cpuid(function_id, &result.array[0] /*eax*/, &result.array[1] /*ebx*/, &result.array[2] /*ecx*/ , &result.array[3] /*edx*/);
+    if (dqn__lib.os_page_size == 0)
+    {
+#if defined(DQN_OS_WIN32)
+        SYSTEM_INFO system_info = {};
+        GetSystemInfo(&system_info);
+        dqn__lib.os_page_size = DQN_CAST(Dqn_isize)system_info.dwPageSize;
 #else
-    #error "Compiler not supported"
+        dqn__lib.os_page_size = DQN_CAST(Dqn_isize)sysconf(_SC_PAGESIZE);
 #endif
-    return result;
-}
+    }
 
-// -------------------------------------------------------------------------------------------------
-//
-// NOTE: Dqn_TicketMutex
-//
-// -------------------------------------------------------------------------------------------------
-void Dqn_TicketMutex_Begin(Dqn_TicketMutex *mutex)
-{
-    unsigned int ticket = Dqn_AtomicAddU32(&mutex->ticket, 1);
-    Dqn_TicketMutex_BeginTicket(mutex, ticket);
+    Dqn_isize result = dqn__lib.os_page_size;
+    return result;
 }
 
-void Dqn_TicketMutex_End(Dqn_TicketMutex *mutex)
+DQN_API void *Dqn_VirtualMem_Reserve(Dqn_isize size)
 {
-    Dqn_AtomicAddU32(&mutex->serving, 1);
+#if defined(DQN_OS_WIN32)
+    void *result = VirtualAlloc(nullptr, DQN_CAST(size_t)size, MEM_RESERVE, PAGE_NOACCESS);
+#else
+    void *result = mmap(nullptr, DQN_CAST(size_t)size, PROT_NONE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE, -1, 0);
+    if (result == MAP_FAILED) result = nullptr;
+#endif
+    return result;
 }
 
-unsigned int Dqn_TicketMutex_MakeTicket(Dqn_TicketMutex *mutex)
+DQN_API Dqn_b32 Dqn_VirtualMem_Commit(void *ptr, Dqn_isize size)
 {
-    unsigned int result = Dqn_AtomicAddU32(&mutex->ticket, 1);
+#if defined(DQN_OS_WIN32)
+    Dqn_b32 result = VirtualAlloc(ptr, DQN_CAST(size_t)size, MEM_COMMIT, PAGE_READWRITE) != nullptr;
+#else
+    Dqn_b32 result = mprotect(ptr, DQN_CAST(size_t)size, PROT_READ | PROT_WRITE) == 0;
+#endif
     return result;
 }
 
-void Dqn_TicketMutex_BeginTicket(const Dqn_TicketMutex *mutex, unsigned int ticket)
+DQN_API void Dqn_VirtualMem_Decommit(void *ptr, Dqn_isize size)
 {
-    DQN_ASSERT_MSG(ticket <= mutex->serving,
-                   "Mutex skipped ticket? Was ticket generated by the correct mutex via MakeTicket? ticket = %u, "
-                   "mutex->serving = %u",
-                   ticket,
-                   mutex->serving);
-    while(ticket != mutex->serving)
-    {
-        // NOTE: Use spinlock intrinsic
-        _mm_pause();
-    }
+#if defined(DQN_OS_WIN32)
+    VirtualFree(ptr, DQN_CAST(size_t)size, MEM_DECOMMIT);
+#else
+    // NOTE: MADV_DONTNEED on a private anonymous mapping drops the pages, the next access after
+    // recommitting is zero-filled, matching the behaviour of MEM_DECOMMIT on Win32.
+    madvise(ptr, DQN_CAST(size_t)size, MADV_DONTNEED);
+    mprotect(ptr, DQN_CAST(size_t)size, PROT_NONE);
+#endif
 }
 
-Dqn_b32 Dqn_TicketMutex_CanLock(const Dqn_TicketMutex *mutex, unsigned int ticket)
+DQN_API void Dqn_VirtualMem_Release(void *ptr, Dqn_isize size)
 {
-    DQN_ASSERT_MSG(ticket <= mutex->serving,
-                   "Mutex skipped ticket? Was ticket generated by the correct mutex via MakeTicket? ticket = %u, "
-                   "mutex->serving = %u",
-                   ticket,
-                   mutex->serving);
-    Dqn_b32 result = (ticket == mutex->serving);
-    return result;
+#if defined(DQN_OS_WIN32)
+    (void)size;
+    VirtualFree(ptr, 0, MEM_RELEASE);
+#else
+    munmap(ptr, DQN_CAST(size_t)size);
+#endif
 }
 
-
 // -------------------------------------------------------------------------------------------------
 //
-// NOTE: Dqn_Fmt Implementation
+// NOTE: Dqn_ArenaAllocator
 //
 // -------------------------------------------------------------------------------------------------
-DQN_API Dqn_isize Dqn_FmtVLenNoNullTerminator(char const *fmt, va_list args)
+DQN_FILE_SCOPE Dqn_isize Dqn_ArenaAllocator__RoundUpToMultiple(Dqn_isize size, Dqn_isize multiple)
 {
-    va_list args_copy;
-    va_copy(args_copy, args);
-    Dqn_isize result = stbsp_vsnprintf(nullptr, 0, fmt, args_copy);
-    va_end(args_copy);
+    Dqn_isize result = ((size + (multiple - 1)) / multiple) * multiple;
     return result;
 }
 
-DQN_API Dqn_isize Dqn_FmtLenNoNullTerminator(char const *fmt, ...)
+// Grow the committed range of a virtual memory arena's block so it can hold at least 'size' bytes.
+DQN_API Dqn_b32 Dqn_ArenaAllocator__CommitVirtualMemory(Dqn_ArenaAllocator *arena, Dqn_ArenaAllocatorBlock *block, Dqn_isize size)
 {
-    va_list args;
-    va_start(args, fmt);
-    Dqn_isize result = stbsp_vsnprintf(nullptr, 0, fmt, args);
-    va_end(args);
-    return result;
+    DQN_ASSERT(arena->reserve_size);
+    Dqn_isize header_size    = DQN_CAST(Dqn_u8 *)block->memory - DQN_CAST(Dqn_u8 *)block;
+    Dqn_isize committed_size = header_size + block->size;
+    Dqn_isize required_size  = header_size + size;
+    if (required_size <= committed_size) return true;
+    if (required_size > arena->reserve_size) return false;
+
+    Dqn_isize new_committed_size = Dqn_ArenaAllocator__RoundUpToMultiple(required_size, arena->commit_granularity);
+    new_committed_size           = DQN_M_MIN(new_committed_size, arena->reserve_size);
+    if (!Dqn_VirtualMem_Commit(DQN_CAST(Dqn_u8 *)block + committed_size, new_committed_size - committed_size))
+        return false;
+
+    block->size = new_committed_size - header_size;
+    return true;
 }
 
-DQN_API Dqn_isize Dqn_FmtVLen(char const *fmt, va_list args)
+// Shrink the committed range of a virtual memory arena's block back down to the commit granularity.
+DQN_API void Dqn_ArenaAllocator__DecommitVirtualMemory(Dqn_ArenaAllocator *arena, Dqn_ArenaAllocatorBlock *block)
 {
-    va_list args_copy;
-    va_copy(args_copy, args);
-    Dqn_isize result = stbsp_vsnprintf(nullptr, 0, fmt, args_copy) + 1;
-    va_end(args_copy);
-    return result;
+    DQN_ASSERT(arena->reserve_size);
+    Dqn_isize header_size    = DQN_CAST(Dqn_u8 *)block->memory - DQN_CAST(Dqn_u8 *)block;
+    Dqn_isize committed_size = header_size + block->size;
+    if (committed_size <= arena->commit_granularity) return;
+
+    Dqn_VirtualMem_Decommit(DQN_CAST(Dqn_u8 *)block + arena->commit_granularity, committed_size - arena->commit_granularity);
+    block->size = arena->commit_granularity - header_size;
 }
 
-DQN_API Dqn_isize Dqn_FmtLen(char const *fmt, ...)
+DQN_API Dqn_ArenaAllocatorBlock *Dqn_ArenaAllocator__AllocateBlock(Dqn_ArenaAllocator *arena, Dqn_isize requested_size DQN_CALL_SITE_ARGS)
 {
-    va_list args;
-    va_start(args, fmt);
-    Dqn_isize result = stbsp_vsnprintf(nullptr, 0, fmt, args) + 1;
-    va_end(args);
+    Dqn_isize min_block_size = arena->min_block_size;
+    if (min_block_size == 0) min_block_size = DQN_MEM_ARENA_DEFAULT_MIN_BLOCK_SIZE;
+
+    Dqn_isize mem_block_size = DQN_M_MAX(min_block_size, requested_size);
+    auto const allocate_size = DQN_CAST(Dqn_isize)(sizeof(*arena->curr_mem_block) + mem_block_size);
+    Dqn_Allocator *allocator = arena->allocator ? arena->allocator : &arena->backup_allocator;
+    auto *result             = DQN_CAST(Dqn_ArenaAllocatorBlock *)Dqn_Allocator__Allocate(allocator, allocate_size, alignof(Dqn_ArenaAllocatorBlock), Dqn_ZeroMem::No DQN_CALL_SITE_ARGS_INPUT);
+    if (!result) return result;
+
+    *result        = {};
+    result->size   = mem_block_size;
+    result->memory = DQN_CAST(Dqn_u8 *)result + sizeof(*result);
+    arena->total_allocated_mem_blocks++;
     return result;
 }
 
-// -------------------------------------------------------------------------------------------------
-//
-// NOTE: Dqn_Log
-//
-// -------------------------------------------------------------------------------------------------
-DQN_API void Dqn_LogV(Dqn_LogType type,
-                      void *      user_data,
-                      char const *file,
-                      Dqn_usize   file_len,
-                      char const *func,
-                      Dqn_usize   func_len,
-                      Dqn_usize   line,
-                      char const *fmt,
-                      va_list     va)
+DQN_API void Dqn_ArenaAllocator__FreeBlock(Dqn_ArenaAllocator *arena, Dqn_ArenaAllocatorBlock *block)
 {
-    (void)user_data;
-
-    int         file_name_len = 0;
-    char const *file_name     = Dqn_Str_FileNameFromPath(file, DQN_CAST(int) file_len, &file_name_len);
+    if (!block)
+        return;
 
-    FILE *handle = (type == Dqn_LogType::Error) ? stderr : stdout;
-    fprintf(handle,
-            "[%s] %.*s:%05I64u:%.*s ",
-            Dqn_LogTypeString[DQN_CAST(int) type],
-            file_name_len,
-            file_name,
-            line,
-            DQN_CAST(int)func_len,
-            func);
+    if (block->next)
+        block->next->prev = block->prev;
 
-    // NOTE: Use the callback version of stb_sprintf to allow us to chunk logs and print arbitrary
-    // sized format strings without needing to size it up first.
-    auto stb_vsprintf_callback = [](char *buf, void *user, int len) -> char * {
-        fprintf(DQN_CAST(FILE *)user, "%.*s", len, buf);
-        return buf;
-    };
+    if (block->prev)
+        block->prev->next = block->next;
 
-    char stb_buffer[STB_SPRINTF_MIN * 2] = {};
-    stbsp_vsprintfcb(stb_vsprintf_callback, handle, stb_buffer, fmt, va);
-    fputc('\n', handle);
+    Dqn_Allocator *allocator = arena->allocator ? arena->allocator : &arena->backup_allocator;
+    Dqn_Allocator_Free(allocator, block);
 }
 
-DQN_API void Dqn_Log(Dqn_LogType type, void *user_data, char const *file, Dqn_usize file_len, char const *func, Dqn_usize func_len, Dqn_usize line, char const *fmt, ...)
+DQN_API void Dqn_ArenaAllocator__AttachBlock(Dqn_ArenaAllocator *arena, Dqn_ArenaAllocatorBlock *new_block)
 {
-    va_list va;
-    va_start(va, fmt);
-    Dqn_LogV(type, user_data, file, file_len, func, func_len, line, fmt, va);
-    va_end(va);
+    if (arena->top_mem_block)
+    {
+        DQN_ASSERT(arena->top_mem_block->next == nullptr);
+        arena->top_mem_block->next = new_block;
+        new_block->prev            = arena->top_mem_block;
+        arena->top_mem_block       = new_block;
+    }
+    else
+    {
+        arena->top_mem_block  = new_block;
+        arena->curr_mem_block = new_block;
+    }
 }
 
-DQN_API void Dqn_Log_SetCallback(Dqn_LogProc *proc, void *user_data)
+DQN_API Dqn_ArenaAllocator Dqn_ArenaAllocator_InitWithNewAllocator(Dqn_Allocator allocator, Dqn_isize size, Dqn_AllocationTracer *tracer DQN_CALL_SITE_ARGS)
 {
-    dqn__lib.LogCallback   = proc;
-    dqn__lib.log_user_data = user_data;
-}
+    Dqn_ArenaAllocator result = {};
+    result.backup_allocator   = allocator;
+    result.tracer             = tracer;
+    if (size > 0)
+    {
+        DQN_ASSERT_MSG(size >= DQN_ISIZEOF(*result.curr_mem_block), "(%I64u >= %I64u) There needs to be enough space to encode the Dqn_ArenaAllocatorBlock struct into the memory buffer", size, sizeof(*result.curr_mem_block));
+        Dqn_ArenaAllocatorBlock *mem_block = Dqn_ArenaAllocator__AllocateBlock(&result, size DQN_CALL_SITE_ARGS_INPUT);
+        Dqn_ArenaAllocator__AttachBlock(&result, mem_block);
+    }
 
-// -------------------------------------------------------------------------------------------------
-//
-// Dqn_Align*
-//
-// -------------------------------------------------------------------------------------------------
-DQN_API Dqn_uintptr Dqn_AlignAddressEnsuringSpace(Dqn_uintptr address, Dqn_u8 alignment)
-{
-    Dqn_uintptr remainder       = address % alignment;
-    Dqn_uintptr offset_to_align = alignment - remainder;
-    Dqn_uintptr result          = address + offset_to_align;
-    DQN_ASSERT(result % alignment == 0);
-    DQN_ASSERT(result >= address);
-    DQN_ASSERT(offset_to_align >= 1 && offset_to_align <= alignment);
     return result;
 }
 
-DQN_API Dqn_uintptr Dqn_AlignAddress(Dqn_uintptr address, Dqn_u8 alignment)
+DQN_API Dqn_ArenaAllocator Dqn_ArenaAllocator_InitWithAllocator(Dqn_Allocator *allocator, Dqn_isize size, Dqn_AllocationTracer *tracer DQN_CALL_SITE_ARGS)
 {
-    Dqn_uintptr result = address;
-    if (alignment > 0)
+    Dqn_ArenaAllocator result = {};
+    result.allocator          = allocator;
+    result.tracer             = tracer;
+    if (size > 0)
     {
-        Dqn_uintptr remainder = result % alignment;
-        if (remainder > 0)
-        {
-            Dqn_uintptr offset_to_align = alignment - remainder;
-            result += offset_to_align;
-        }
+        DQN_ASSERT_MSG(size >= DQN_ISIZEOF(*result.curr_mem_block), "(%I64u >= %I64u) There needs to be enough space to encode the Dqn_ArenaAllocatorBlock struct into the memory buffer", size, sizeof(*result.curr_mem_block));
+        Dqn_ArenaAllocatorBlock *mem_block = Dqn_ArenaAllocator__AllocateBlock(&result, size DQN_CALL_SITE_ARGS_INPUT);
+        Dqn_ArenaAllocator__AttachBlock(&result, mem_block);
     }
     return result;
 }
 
-// -------------------------------------------------------------------------------------------------
-//
-// Dqn_PointerMetadata
-//
-// -------------------------------------------------------------------------------------------------
-DQN_API Dqn_isize Dqn_PointerMetadata_SizeRequired(Dqn_isize size, Dqn_u8 alignment)
+DQN_API Dqn_ArenaAllocator Dqn_ArenaAllocator_InitWithMemory(void *memory, Dqn_isize size, Dqn_AllocationTracer *tracer)
 {
-    DQN_ASSERT(alignment > 0);
-    if (alignment <= 0) alignment = 1;
-    Dqn_isize result = size + DQN_CAST(Dqn_i8)(alignment - 1) + DQN_CAST(Dqn_isize)sizeof(Dqn_PointerMetadata);
+    Dqn_ArenaAllocator result = {};
+    result.tracer             = tracer;
+
+    DQN_ASSERT_MSG(size >= DQN_ISIZEOF(*result.curr_mem_block), "(%I64u >= %I64u) There needs to be enough space to encode the Dqn_ArenaAllocatorBlock struct into the memory buffer", size, sizeof(*result.curr_mem_block));
+    result.backup_allocator = Dqn_Allocator_InitWithNull();
+    auto *mem_block     = DQN_CAST(Dqn_ArenaAllocatorBlock *) memory;
+    *mem_block          = {};
+    mem_block->memory   = DQN_CAST(Dqn_u8 *) memory + sizeof(*mem_block);
+    mem_block->size     = size - DQN_CAST(Dqn_isize)sizeof(*mem_block);
+    Dqn_ArenaAllocator__AttachBlock(&result, mem_block);
     return result;
 }
 
-DQN_API char *Dqn_PointerMetadata_Init(void *ptr, Dqn_isize size, Dqn_u8 alignment)
+DQN_API Dqn_ArenaAllocator Dqn_ArenaAllocator_InitWithVirtualMemory(Dqn_isize reserve_size, Dqn_isize commit_granularity, Dqn_AllocationTracer *tracer)
 {
-    DQN_ASSERT_MSG(alignment == 1 || (alignment & 1) == 0, "Alignment must be a power of 2, %u", alignment);
-
-    // NOTE: Given a pointer, it can misaligned by up to (Alignment - 1) bytes.
-    // After calculating the offset to apply on the aligned ptr, we store the
-    // allocation metadata right before the ptr for convenience, so that we just
-    // need to walk back sizeof(metadata) bytes to get to the metadata from the
-    // pointer.
+    Dqn_ArenaAllocator result = {};
+    result.tracer             = tracer;
+    result.backup_allocator   = Dqn_Allocator_InitWithNull();
 
-    //                                                         [Metadata Is Stored Here]
-    // [Raw Pointer] -> [Metadata Storage] [Unaligned Pointer] [Offset to Align Pointer] [Aligned Pointer]
+    Dqn_isize page_size = Dqn_VirtualMem_PageSize();
+    if (commit_granularity <= 0) commit_granularity = DQN_MEM_ARENA_DEFAULT_COMMIT_GRANULARITY;
+    reserve_size       = Dqn_ArenaAllocator__RoundUpToMultiple(reserve_size, page_size);
+    commit_granularity = Dqn_ArenaAllocator__RoundUpToMultiple(commit_granularity, page_size);
+    commit_granularity = DQN_M_MIN(commit_granularity, reserve_size);
+    DQN_ASSERT_MSG(commit_granularity >= DQN_ISIZEOF(*result.curr_mem_block), "(%zd >= %zu) There needs to be enough space to encode the Dqn_ArenaAllocatorBlock struct into the memory buffer", commit_granularity, sizeof(*result.curr_mem_block));
 
-    // NOTE: In the scenario where the pointer is already aligned after the
-    // [Metadata Storage] bytes, we use the bytes allocated for the metadata
-    // storage, instead of storing it into the offset storage bytes.
+    void *memory = Dqn_VirtualMem_Reserve(reserve_size);
+    if (!memory)
+    {
+        DQN_LOG_E("Failed to reserve %$$d of virtual memory for the arena", reserve_size);
+        return result;
+    }
 
-    //                  [Metadata Is Stored Here]
-    // [Raw Pointer] -> [Metadata Storage]        [Aligned Pointer]
+    if (!Dqn_VirtualMem_Commit(memory, commit_granularity))
+    {
+        DQN_LOG_E("Failed to commit %$$d of virtual memory for the arena", commit_granularity);
+        Dqn_VirtualMem_Release(memory, reserve_size);
+        return result;
+    }
 
-    // Offset is [0->Alignment-1] bytes from the Unaligned ptr.
-    auto raw_ptr       = DQN_CAST(uintptr_t) ptr;
-    auto unaligned_ptr = raw_ptr + sizeof(Dqn_PointerMetadata);
-    auto result        = DQN_CAST(uintptr_t) unaligned_ptr;
+    auto *mem_block                   = DQN_CAST(Dqn_ArenaAllocatorBlock *) memory;
+    *mem_block                        = {};
+    mem_block->memory                 = DQN_CAST(Dqn_u8 *) memory + sizeof(*mem_block);
+    mem_block->size                   = commit_granularity - DQN_CAST(Dqn_isize)sizeof(*mem_block);
+    result.reserve_size               = reserve_size;
+    result.commit_granularity         = commit_granularity;
+    result.total_allocated_mem_blocks = 1;
+    Dqn_ArenaAllocator__AttachBlock(&result, mem_block);
+    return result;
+}
 
-    if ((unaligned_ptr % alignment) > 0)
+DQN_API void Dqn_ArenaAllocator_Free(Dqn_ArenaAllocator *arena)
+{
+    if (arena->reserve_size)
     {
-        uintptr_t unaligned_to_aligned_offset = alignment - (unaligned_ptr % alignment);
-        result += unaligned_to_aligned_offset;
+        // NOTE: The only block lives at the start of the reserved range
+        if (arena->top_mem_block)
+            Dqn_VirtualMem_Release(arena->top_mem_block, arena->reserve_size);
+    }
+    else
+    {
+        for (Dqn_ArenaAllocatorBlock *mem_block = arena->top_mem_block; mem_block;)
+        {
+            Dqn_ArenaAllocatorBlock *block_to_free = mem_block;
+            mem_block                              = block_to_free->prev;
+            Dqn_ArenaAllocator__FreeBlock(arena, block_to_free);
+        }
     }
-    DQN_ASSERT(result % alignment == 0);
-    DQN_ASSERT(result >= raw_ptr);
-    ptrdiff_t difference = DQN_CAST(ptrdiff_t)result - DQN_CAST(ptrdiff_t)raw_ptr;
-    DQN_ASSERT(difference <= DQN_CAST(Dqn_u8)-1);
 
-    auto *metadata_ptr      = DQN_CAST(Dqn_PointerMetadata *)(result - sizeof(Dqn_PointerMetadata));
-    metadata_ptr->alignment = alignment;
-    metadata_ptr->offset    = DQN_CAST(Dqn_u8)difference;
-    metadata_ptr->size      = size;
-    return DQN_CAST(char *)result;
+    auto allocator           = arena->allocator;
+    auto highest_used_mark   = arena->highest_used_mark;
+    *arena                   = {};
+    arena->highest_used_mark = highest_used_mark;
+    arena->allocator         = allocator;
 }
 
-DQN_API Dqn_PointerMetadata Dqn_PointerMetadata_Get(void *ptr)
+DQN_API Dqn_b32 Dqn_ArenaAllocator_Reserve_(Dqn_ArenaAllocator *arena, Dqn_isize size DQN_CALL_SITE_ARGS)
 {
-    auto *aligned_ptr = DQN_CAST(char *) ptr;
-    auto result       = *DQN_CAST(Dqn_PointerMetadata *)(aligned_ptr - sizeof(Dqn_PointerMetadata));
-    return result;
+    if (arena->top_mem_block)
+    {
+        Dqn_isize remaining_space = arena->top_mem_block->size - arena->top_mem_block->used;
+        if (remaining_space >= size) return true;
+    }
+
+    if (arena->reserve_size)
+    {
+        Dqn_ArenaAllocatorBlock *block = arena->top_mem_block;
+        Dqn_b32 result                 = block && Dqn_ArenaAllocator__CommitVirtualMemory(arena, block, block->used + size);
+        return result;
+    }
+
+    Dqn_ArenaAllocatorBlock *new_block = Dqn_ArenaAllocator__AllocateBlock(arena, size DQN_CALL_SITE_ARGS_INPUT);
+    if (!new_block) return false;
+    Dqn_ArenaAllocator__AttachBlock(arena, new_block);
+    return true;
 }
 
-DQN_API char *Dqn_PointerMetadata_GetRawPointer(void *ptr)
+DQN_API void Dqn_ArenaAllocator_ResetUsage(Dqn_ArenaAllocator *arena, Dqn_ZeroMem zero_mem)
 {
-    Dqn_PointerMetadata metadata = Dqn_PointerMetadata_Get(ptr);
-    char *result                 = DQN_CAST(char *) ptr - metadata.offset;
-    return result;
+    arena->usage_before_last_reset   = 0;
+    arena->wastage_before_last_reset = 0;
+    for (Dqn_ArenaAllocatorBlock *block = arena->top_mem_block; block; block = block->prev)
+    {
+        arena->usage_before_last_reset += block->used;
+        if (block->prev)
+            arena->wastage_before_last_reset += (block->size - block->used);
+        else
+            arena->curr_mem_block = block;
+
+        // NOTE: Decommit before zeroing, decommitted pages are zero when they are committed again.
+        if (arena->reserve_size)
+            Dqn_ArenaAllocator__DecommitVirtualMemory(arena, block);
+
+        Dqn__ZeroMemBytes(block->memory, DQN_CAST(size_t)DQN_M_MIN(block->used, block->size), zero_mem);
+        block->used = 0;
+    }
 }
 
-// -------------------------------------------------------------------------------------------------
-//
-// NOTE: Dqn_AllocationTracer
-//
-// -------------------------------------------------------------------------------------------------
-Dqn_AllocationTracer Dqn_AllocationTracer_InitWithMemory(void *mem, Dqn_usize mem_size)
+DQN_API Dqn_ArenaAllocatorRegion Dqn_ArenaAllocator_BeginRegion(Dqn_ArenaAllocator *arena)
 {
-    Dqn_AllocationTracer result = {};
-    result.map                  = Dqn_Map_InitWithMemory<Dqn_AllocationTrace>(mem, mem_size);
+    Dqn_ArenaAllocatorRegion result  = {};
+    result.arena               = arena;
+    result.curr_mem_block      = arena->curr_mem_block;
+    result.curr_mem_block_used = (arena->curr_mem_block) ? arena->curr_mem_block->used : 0;
+    result.top_mem_block       = arena->top_mem_block;
     return result;
 }
 
-void Dqn_AllocationTracer_Add(Dqn_AllocationTracer *tracer, void *ptr, Dqn_usize size DQN_CALL_SITE_ARGS)
+DQN_API void Dqn_ArenaAllocator_EndRegion(Dqn_ArenaAllocatorRegion region)
 {
-#if DQN_ALLOCATION_TRACING
-    if (!tracer) return;
-    Dqn_AllocationTrace trace = {};
-    trace.ptr                 = ptr;
-    trace.size                = size;
-    trace.file                = file_;
-    trace.func                = func_;
-    trace.line                = line_;
-    trace.msg                 = msg_;
-
-    Dqn_TicketMutex_Begin(&tracer->mutex);
-    Dqn_b32 added = Dqn_Map_Add(&tracer->table, DQN_CAST(Dqn_u64) ptr, trace);
-    if (!added)
+    while (region.top_mem_block != region.arena->top_mem_block)
     {
-        // Dqn_AllocationTrace *other = Dqn_Map_Get(&tracer->table, DQN_CAST(Dqn_u64) ptr);
-        DQN_ASSERT_MSG(added, "Hash table collision on %Ix", ptr);
+        Dqn_ArenaAllocatorBlock *block_to_free = region.arena->top_mem_block;
+        if (region.arena->curr_mem_block == block_to_free)
+            region.arena->curr_mem_block = block_to_free->prev;
+        region.arena->top_mem_block = block_to_free->prev;
+        Dqn_ArenaAllocator__FreeBlock(region.arena, block_to_free);
     }
-    Dqn_TicketMutex_End(&tracer->mutex);
-#else
-    (void)tracer; (void)ptr; (void)size;
-#endif
+
+    for (Dqn_ArenaAllocatorBlock *mem_block = region.arena->top_mem_block; mem_block != region.curr_mem_block; mem_block = mem_block->prev)
+        mem_block->used = 0;
+
+    if (region.arena->curr_mem_block)
+        region.arena->curr_mem_block->used = region.curr_mem_block_used;
+    region = {};
 }
 
-void Dqn_AllocationTracer_Remove(Dqn_AllocationTracer *tracer, void *ptr)
+Dqn_ArenaAllocatorScopedRegion Dqn_ArenaAllocator_MakeScopedRegion(Dqn_ArenaAllocator *arena)
 {
-#if DQN_ALLOCATION_TRACING
-    if (!tracer) return;
-    Dqn_TicketMutex_Begin(&tracer->mutex);
-    Dqn_AllocationTrace *trace = Dqn_Map_Get(&tracer->table, DQN_CAST(Dqn_u64) ptr);
-    DQN_ASSERT_MSG(trace->ptr == ptr, "(trace->ptr = %Ix, raw_ptr = %Ix", trace->ptr, ptr);
+    return Dqn_ArenaAllocatorScopedRegion(arena);
+}
 
-    Dqn_Map_Erase(&tracer->table, DQN_CAST(Dqn_u64) ptr);
-    Dqn_TicketMutex_End(&tracer->mutex);
-#else
-    (void)tracer; (void)ptr;
-#endif
+Dqn_ArenaAllocatorScopedRegion::Dqn_ArenaAllocatorScopedRegion(Dqn_ArenaAllocator *arena)
+{
+    this->region = Dqn_ArenaAllocator_BeginRegion(arena);
 }
 
-// -------------------------------------------------------------------------------------------------
-//
-// NOTE: Dqn_CRTAllocator
-//
-// -------------------------------------------------------------------------------------------------
-DQN_API Dqn_CRTAllocator Dqn_CRTAllocator_InitWithProcs(Dqn_CRTAllocator_MallocProc *malloc_proc, Dqn_CRTAllocator_ReallocProc *realloc_proc, Dqn_CRTAllocator_FreeProc *free_proc)
+Dqn_ArenaAllocatorScopedRegion::~Dqn_ArenaAllocatorScopedRegion()
 {
-    Dqn_CRTAllocator result = {};
-    result.malloc           = malloc_proc;
-    result.realloc          = realloc_proc;
-    result.free             = free_proc;
-    return result;
+    if (this->region.arena) // NOTE: Null when the region was moved out, see Dqn_ScratchArena
+        Dqn_ArenaAllocator_EndRegion(this->region);
 }
 
-DQN_API void *Dqn_CRTAllocator__Malloc(Dqn_CRTAllocator *allocator, Dqn_usize size DQN_CALL_SITE_ARGS)
+DQN_API void *Dqn_ArenaAllocator__AllocateSlowPath(Dqn_ArenaAllocator *arena, Dqn_isize size, Dqn_u8 alignment DQN_CALL_SITE_ARGS)
 {
-    void *result = allocator->malloc ? allocator->malloc(size) : DQN_MALLOC(size);
-    if (result)
+    // NOTE: Blocks after the current block are empty, retained from a prior ResetUsage or EndRegion
+    if (arena->curr_mem_block)
     {
-        Dqn_AtomicAddU64(&allocator->malloc_bytes, size);
-        Dqn_AtomicAddU64(&allocator->malloc_count, 1ULL);
-        Dqn_AllocationTracer_Add(allocator->tracer, result, size DQN_CALL_SITE_ARGS_INPUT);
+        for (Dqn_ArenaAllocatorBlock *mem_block = arena->curr_mem_block->next; mem_block; mem_block = mem_block->next)
+        {
+            void *result = Dqn_ArenaAllocator__BumpBlock(mem_block, size, alignment);
+            if (result)
+            {
+                arena->curr_mem_block = mem_block;
+                return result;
+            }
+        }
+    }
+
+    // NOTE: Block memory is only guaranteed to be aligned to the block header, so request enough
+    // space for the worst case padding to align the allocation in the new block.
+    Dqn_isize allocation_size = size + (alignment - 1);
+    if (arena->reserve_size)
+    {
+        // NOTE: Virtual memory arenas grow their only block in place
+        Dqn_ArenaAllocatorBlock *block = arena->top_mem_block;
+        if (!block || !Dqn_ArenaAllocator__CommitVirtualMemory(arena, block, block->used + allocation_size))
+        {
+            DQN_LOG_E("Virtual memory arena could not commit %$$d, the arena has reserved %$$d", allocation_size, arena->reserve_size);
+            return nullptr;
+        }
+    }
+    else
+    {
+        Dqn_ArenaAllocatorBlock *new_block = Dqn_ArenaAllocator__AllocateBlock(arena, allocation_size DQN_CALL_SITE_ARGS_INPUT);
+        if (!new_block) return nullptr;
+        Dqn_ArenaAllocator__AttachBlock(arena, new_block);
     }
 
+    arena->curr_mem_block = arena->top_mem_block;
+    void *result          = Dqn_ArenaAllocator__BumpBlock(arena->curr_mem_block, size, alignment);
+    DQN_ASSERT(result);
     return result;
 }
 
-DQN_API void *Dqn_CRTAllocator__Realloc(Dqn_CRTAllocator *allocator, void *ptr, Dqn_usize size DQN_CALL_SITE_ARGS)
+DQN_API Dqn_ArenaAllocatorStats Dqn_ArenaAllocator_GetStats(Dqn_ArenaAllocator const *arena)
 {
-    void *result = allocator->realloc ? allocator->realloc(ptr, size) : DQN_REALLOC(ptr, size);
-    if (result)
+    Dqn_ArenaAllocatorStats result = {};
+    result.total_blocks            = arena->total_allocated_mem_blocks;
+    for (Dqn_ArenaAllocatorBlock const *block = arena->top_mem_block; block; block = block->prev)
     {
-        Dqn_AtomicAddU64(&allocator->realloc_bytes, size);
-        Dqn_AtomicAddU64(&allocator->realloc_count, 1ULL);
-        Dqn_AllocationTracer_Add(allocator->tracer, result, size DQN_CALL_SITE_ARGS_INPUT);
-        if (result != ptr) Dqn_AllocationTracer_Remove(allocator->tracer, ptr);
+        result.total_allocated += block->size;
+        result.total_used += block->used;
+        if (block != arena->top_mem_block)
+            result.total_wasted += block->size - block->used;
     }
-
     return result;
 }
 
-DQN_API void Dqn_CRTAllocator__Free(Dqn_CRTAllocator *allocator, void *ptr)
+Dqn_String const DQN_ARENA_ALLOCATOR__STATS_FMT = DQN_STRING("%s: %$$.3d/%$$.3d (wasted %$$.3d - %d blks)");
+DQN_API void Dqn_ArenaAllocator_DumpStatsToLog(Dqn_ArenaAllocator const *arena, char const *label)
 {
-    if (ptr)
-    {
-        Dqn_AtomicAddU64(&allocator->free_count, 1ULL);
-        Dqn_AllocationTracer_Remove(allocator->tracer, ptr);
-    }
-    allocator->free ? allocator->free(ptr) : DQN_FREE(ptr);
+    Dqn_ArenaAllocatorStats stats = Dqn_ArenaAllocator_GetStats(arena);
+    DQN_LOG_M(DQN_ARENA_ALLOCATOR__STATS_FMT.str,
+              label,
+              stats.total_used,
+              stats.total_allocated,
+              stats.total_wasted,
+              stats.total_blocks);
+}
+
+DQN_API Dqn_FixedString<512> Dqn_ArenaAllocator_StatsString(Dqn_ArenaAllocator const *arena, char const *label)
+{
+    Dqn_ArenaAllocatorStats stats = Dqn_ArenaAllocator_GetStats(arena);
+    auto                    result = Dqn_FixedString_InitFmt<512>(DQN_ARENA_ALLOCATOR__STATS_FMT.str,
+                                               label,
+                                               stats.total_used,
+                                               stats.total_allocated,
+                                               stats.total_wasted,
+                                               stats.total_blocks);
+    return result;
 }
 
 // -------------------------------------------------------------------------------------------------
 //
-// NOTE: Dqn_Allocator
+// NOTE: Dqn_ConcurrentArenaAllocator
 //
 // -------------------------------------------------------------------------------------------------
-DQN_API Dqn_Allocator Dqn_Allocator_InitWithNull()
+DQN_API Dqn_ConcurrentArenaAllocator Dqn_ConcurrentArenaAllocator_InitWithNewAllocator(Dqn_Allocator allocator, Dqn_isize size, Dqn_AllocationTracer *tracer DQN_CALL_SITE_ARGS)
 {
-    Dqn_Allocator result = {};
-    result.type          = Dqn_AllocatorType::Null;
+    Dqn_ConcurrentArenaAllocator result = {};
+    result.arena                        = Dqn_ArenaAllocator_InitWithNewAllocator(allocator, size, tracer DQN_CALL_SITE_ARGS_INPUT);
+    result.curr_mem_block               = result.arena.curr_mem_block;
     return result;
 }
 
-DQN_API Dqn_Allocator Dqn_Allocator_InitWithHeap()
+DQN_API void Dqn_ConcurrentArenaAllocator_Free(Dqn_ConcurrentArenaAllocator *arena)
 {
-    Dqn_Allocator result = {};
-    result.type          = Dqn_AllocatorType::Heap;
-    return result;
+    Dqn_ArenaAllocator_Free(&arena->arena);
+    arena->curr_mem_block = nullptr;
 }
 
-DQN_API Dqn_Allocator Dqn_Allocator_InitWithXHeap()
+DQN_FILE_SCOPE void Dqn_ConcurrentArenaAllocator__ClampUsage(Dqn_ConcurrentArenaAllocator *arena)
 {
-    Dqn_Allocator result = {};
-    result.type          = Dqn_AllocatorType::XHeap;
-    return result;
+    // NOTE: Threads that fail to fit into a block have still advanced its offset past the end
+    for (Dqn_ArenaAllocatorBlock *block = arena->arena.top_mem_block; block; block = block->prev)
+        block->used = DQN_M_MIN(block->used, block->size);
 }
 
-DQN_API Dqn_Allocator Dqn_Allocator_InitWithArena(Dqn_ArenaAllocator *arena)
+DQN_API void Dqn_ConcurrentArenaAllocator_ResetUsage(Dqn_ConcurrentArenaAllocator *arena, Dqn_ZeroMem zero_mem)
 {
-    Dqn_Allocator result = {};
-    result.type          = Dqn_AllocatorType::Arena;
-    result.context.arena = arena;
+    Dqn_ConcurrentArenaAllocator__ClampUsage(arena);
+    Dqn_ArenaAllocator_ResetUsage(&arena->arena, zero_mem);
+    arena->curr_mem_block = arena->arena.curr_mem_block;
+}
+
+DQN_API Dqn_ArenaAllocatorStats Dqn_ConcurrentArenaAllocator_GetStats(Dqn_ConcurrentArenaAllocator const *arena)
+{
+    Dqn_ArenaAllocatorStats result = {};
+    result.total_blocks            = arena->arena.total_allocated_mem_blocks;
+    for (Dqn_ArenaAllocatorBlock const *block = arena->arena.top_mem_block; block; block = block->prev)
+    {
+        Dqn_isize used = DQN_M_MIN(block->used, block->size);
+        result.total_allocated += block->size;
+        result.total_used += used;
+        if (block != arena->arena.top_mem_block)
+            result.total_wasted += block->size - used;
+    }
     return result;
 }
 
-DQN_API Dqn_Allocator Dqn_Allocator_InitWithProcs(Dqn_Allocator_CustomAllocateProc *allocate_proc, Dqn_Allocator_CustomFreeProc *free_proc)
+// Move the arena off 'full_block', either to the next retained block or a newly chained block.
+// return: The block to allocate from, nullptr if a new block could not be allocated.
+DQN_FILE_SCOPE Dqn_ArenaAllocatorBlock *Dqn_ConcurrentArenaAllocator__Grow(Dqn_ConcurrentArenaAllocator *arena, Dqn_ArenaAllocatorBlock *full_block, Dqn_isize allocation_size DQN_CALL_SITE_ARGS)
 {
-    Dqn_Allocator result   = {};
-    result.type            = Dqn_AllocatorType::Custom;
-    result.custom.allocate = allocate_proc;
-    result.custom.free     = free_proc;
-    return result;
-}
+    Dqn_TicketMutex_Begin(&arena->mutex);
+    Dqn_ArenaAllocatorBlock *result = arena->curr_mem_block;
 
-void Dqn_Allocator_Free(Dqn_Allocator *allocator, void *ptr)
-{
-    Dqn_isize bytes_freed = 0;
-    switch (allocator->type)
+    // NOTE: If the current block changed another thread has already moved the arena along
+    if (result == full_block)
     {
-        case Dqn_AllocatorType::Null: return;
-        default: break;
-
-        case Dqn_AllocatorType::Heap:
-        case Dqn_AllocatorType::XHeap:
+        result = full_block ? full_block->next : nullptr;
+        if (!result)
         {
-            Dqn_PointerMetadata meta    = Dqn_PointerMetadata_Get(ptr);
-            char *              raw_ptr = Dqn_PointerMetadata_GetRawPointer(ptr);
-            DQN_FREE(raw_ptr);
-            bytes_freed = meta.size;
+            result = Dqn_ArenaAllocator__AllocateBlock(&arena->arena, allocation_size DQN_CALL_SITE_ARGS_INPUT);
+            if (result) Dqn_ArenaAllocator__AttachBlock(&arena->arena, result);
         }
-        break;
 
-        case Dqn_AllocatorType::Custom:
+        if (result)
         {
-            if (allocator->custom.free)
-                bytes_freed = allocator->custom.free(ptr, allocator->context.user);
+            // NOTE: The block must be fully initialised before other threads can observe it
+            Dqn_CompilerWriteBarrierAndCPUWriteFence;
+            arena->arena.curr_mem_block = result;
+            arena->curr_mem_block       = result;
         }
-        break;
-
-        case Dqn_AllocatorType::Arena:
-            break;
     }
 
-    if (ptr)
-    {
-        allocator->allocations--;
-        DQN_ASSERT(allocator->allocations >= 0);
-        DQN_ASSERT_MSG(allocator->bytes_allocated >= bytes_freed,
-                       "bytes_allocated = %jd, bytes_freed = %jd",
-                       allocator->bytes_allocated,
-                       bytes_freed);
-        allocator->bytes_allocated -= bytes_freed;
-
-#if DQN_ALLOCATION_TRACING
-        Dqn_AllocationTracer_Remove(allocator->tracer, ptr);
-#endif
-    }
+    Dqn_TicketMutex_End(&arena->mutex);
+    return result;
 }
 
-DQN_API void *Dqn_Allocator__Allocate(Dqn_Allocator *allocator, Dqn_isize size, Dqn_u8 alignment, Dqn_ZeroMem zero_mem DQN_CALL_SITE_ARGS)
+DQN_API void *Dqn_ConcurrentArenaAllocator__Allocate(Dqn_ConcurrentArenaAllocator *arena, Dqn_isize size, Dqn_u8 alignment, Dqn_ZeroMem zero_mem DQN_CALL_SITE_ARGS)
 {
-    char *result = nullptr;
-    switch (allocator->type)
-    {
-        default:
-        case Dqn_AllocatorType::Null:
-        {
-            DQN_LOG_W("Requested allocation on null allocator");
-            return result;
-        }
+    DQN_ASSERT_MSG(alignment > 0 && (alignment & (alignment - 1)) == 0, "Alignment must be a power of 2, %u", alignment);
+    Dqn_isize allocation_size = size + (alignment - 1);
 
-        case Dqn_AllocatorType::Heap:
-        case Dqn_AllocatorType::XHeap:
+    void *result = nullptr;
+    for (Dqn_ArenaAllocatorBlock *block = arena->curr_mem_block; !result;)
+    {
+        if (block)
         {
-            size      = Dqn_PointerMetadata_SizeRequired(size, alignment);
-            void *ptr = zero_mem == Dqn_ZeroMem::Yes ? DQN_CALLOC(1, DQN_CAST(size_t)size) : DQN_MALLOC(size);
-            result = Dqn_PointerMetadata_Init(ptr, size, alignment);
-            if (!result && allocator->type == Dqn_AllocatorType::XHeap)
+            Dqn_isize offset = Dqn_AtomicAddISize(&block->used, allocation_size);
+            if (offset + allocation_size <= block->size)
             {
-                DQN_ASSERT(result);
+                Dqn_uintptr address = DQN_CAST(Dqn_uintptr)block->memory + offset;
+                Dqn_uintptr aligned = (address + (alignment - 1)) & ~DQN_CAST(Dqn_uintptr)(alignment - 1);
+                result              = DQN_CAST(void *)aligned;
+                break;
             }
         }
-        break;
-
-        case Dqn_AllocatorType::Arena:
-        {
-            result = DQN_CAST(char *)Dqn_ArenaAllocator__Allocate(allocator->context.arena, size, alignment, zero_mem DQN_CALL_SITE_ARGS_INPUT);
-        }
-        break;
 
-        case Dqn_AllocatorType::Custom:
-        {
-            if (allocator->custom.allocate)
-                result = DQN_CAST(char *)allocator->custom.allocate(size, alignment, allocator->context.user DQN_CALL_SITE_ARGS_INPUT);
-        }
-        break;
+        block = Dqn_ConcurrentArenaAllocator__Grow(arena, block, allocation_size DQN_CALL_SITE_ARGS_INPUT);
+        if (!block) return nullptr;
     }
 
-    if (result)
-    {
-        allocator->allocations++;
-        allocator->total_allocations++;
-        allocator->bytes_allocated += size;
-        allocator->total_bytes_allocated += size;
-
+    Dqn__ZeroMemBytes(result, DQN_CAST(Dqn_usize)size, zero_mem);
 #if DQN_ALLOCATION_TRACING
-        Dqn_AllocationTracer_Add(allocator->tracer, result, size DQN_CALL_SITE_ARGS_INPUT);
+    Dqn_AllocationTracer_Add(arena->arena.tracer, result, size DQN_CALL_SITE_ARGS_INPUT);
 #endif
-    }
-
     return result;
 }
 
 // -------------------------------------------------------------------------------------------------
 //
-// NOTE: Dqn_String
+// NOTE: Dqn_PoolAllocator
 //
 // -------------------------------------------------------------------------------------------------
-DQN_API Dqn_String Dqn_String_Init(char const *str, Dqn_isize size)
+DQN_API Dqn_PoolAllocator Dqn_PoolAllocator_InitWithArena(Dqn_ArenaAllocator *arena, Dqn_isize slot_size, Dqn_u8 slot_alignment, Dqn_isize slots_per_chunk)
 {
-    Dqn_String result = {};
-    result.str_       = str;
-    result.size       = size;
-    result.cap        = size;
+    DQN_ASSERT_MSG(slot_alignment > 0 && (slot_alignment & (slot_alignment - 1)) == 0, "Alignment must be a power of 2, %u", slot_alignment);
+    Dqn_PoolAllocator result = {};
+    result.arena             = arena;
+    result.slot_alignment    = DQN_M_MAX(slot_alignment, DQN_CAST(Dqn_u8)alignof(Dqn_PoolAllocatorSlot));
+    result.slot_size         = DQN_M_MAX(slot_size, DQN_ISIZEOF(Dqn_PoolAllocatorSlot));
+    result.slot_size         = (result.slot_size + (result.slot_alignment - 1)) & ~DQN_CAST(Dqn_isize)(result.slot_alignment - 1);
+    result.slots_per_chunk   = slots_per_chunk > 0 ? slots_per_chunk : DQN_POOL_ALLOCATOR_DEFAULT_SLOTS_PER_CHUNK;
     return result;
 }
 
-DQN_API Dqn_String Dqn_String__InitFmtV(Dqn_Allocator *allocator, char const *fmt, va_list va DQN_CALL_SITE_ARGS)
+DQN_API void Dqn_PoolAllocator_Free(Dqn_PoolAllocator *pool, void *ptr)
 {
-    Dqn_String result = {};
-    va_list va2;
-    va_copy(va2, va);
-    result.size = stbsp_vsnprintf(nullptr, 0, fmt, va);
-    result.str  = allocator ? DQN_CAST(char *)Dqn_Allocator__Allocate(allocator, result.size + 1, alignof(char), Dqn_ZeroMem::No DQN_CALL_SITE_ARGS_INPUT)
-                            : DQN_CAST(char *)DQN_MALLOC(result.size + 1);
-    if (result.str)
+    if (!ptr) return;
+    DQN_ASSERT_MSG(pool->slots_in_use > 0, "Freeing a pointer from a pool with no slots in use, ptr = %p", ptr);
+    auto *slot      = DQN_CAST(Dqn_PoolAllocatorSlot *)ptr;
+    slot->next      = pool->free_list;
+    pool->free_list = slot;
+    pool->slots_in_use--;
+}
+
+DQN_API void *Dqn_PoolAllocator__Allocate(Dqn_PoolAllocator *pool, Dqn_ZeroMem zero_mem DQN_CALL_SITE_ARGS)
+{
+    if (!pool->free_list)
     {
-        stbsp_vsnprintf(result.str, Dqn_Safe_TruncateISizeToInt(result.size + 1), fmt, va2);
-        result.str[result.size] = 0;
-        result.cap              = result.size;
+        auto *chunk = DQN_CAST(char *)Dqn_ArenaAllocator__Allocate(pool->arena, pool->slot_size * pool->slots_per_chunk, pool->slot_alignment, Dqn_ZeroMem::No DQN_CALL_SITE_ARGS_INPUT);
+        if (!chunk) return nullptr;
+
+        // NOTE: Push in reverse so that slots are handed out in address order
+        for (Dqn_isize index = pool->slots_per_chunk - 1; index >= 0; index--)
+        {
+            auto *slot      = DQN_CAST(Dqn_PoolAllocatorSlot *)(chunk + (index * pool->slot_size));
+            slot->next      = pool->free_list;
+            pool->free_list = slot;
+        }
+        pool->total_slots += pool->slots_per_chunk;
     }
-    va_end(va2);
+
+    void *result    = pool->free_list;
+    pool->free_list = pool->free_list->next;
+    pool->slots_in_use++;
+    Dqn__ZeroMemBytes(result, DQN_CAST(Dqn_usize)pool->slot_size, zero_mem);
     return result;
 }
 
-DQN_API Dqn_String Dqn_String__InitFmt(Dqn_Allocator *allocator DQN_CALL_SITE_ARGS, char const *fmt, ...)
+DQN_API void *Dqn_PoolAllocator__AllocateType(Dqn_PoolAllocator *pool, Dqn_isize size, Dqn_u8 alignment, Dqn_ZeroMem zero_mem DQN_CALL_SITE_ARGS)
 {
-    va_list va;
-    va_start(va, fmt);
-    Dqn_String result = Dqn_String__InitFmtV(allocator, fmt, va DQN_CALL_SITE_ARGS_INPUT);
-    va_end(va);
+    if (size > pool->slot_size || alignment > pool->slot_alignment)
+    {
+        DQN_LOG_E("Requested allocation does not fit in the pool's slots, size = %jd, alignment = %u, slot_size = %jd, slot_alignment = %u",
+                  size, alignment, pool->slot_size, pool->slot_alignment);
+        return nullptr;
+    }
+
+    void *result = Dqn_PoolAllocator__Allocate(pool, zero_mem DQN_CALL_SITE_ARGS_INPUT);
     return result;
 }
 
-DQN_API Dqn_String Dqn_String__InitArenaFmt(Dqn_ArenaAllocator *arena DQN_CALL_SITE_ARGS, char const *fmt, ...)
+// -------------------------------------------------------------------------------------------------
+//
+// NOTE: Dqn_SlabAllocator
+//
+// -------------------------------------------------------------------------------------------------
+DQN_FILE_SCOPE Dqn_SlabAllocatorSlab *Dqn_SlabAllocator__GetSlab(void const *ptr)
 {
-    Dqn_Allocator allocator = Dqn_Allocator_InitWithArena(arena);
-    va_list va;
-    va_start(va, fmt);
-    Dqn_String result = Dqn_String__InitFmtV(&allocator, fmt, va DQN_CALL_SITE_ARGS_INPUT);
-    va_end(va);
+    auto *result = DQN_CAST(Dqn_SlabAllocatorSlab *)(DQN_CAST(Dqn_uintptr)ptr & ~DQN_CAST(Dqn_uintptr)(DQN_SLAB_ALLOCATOR_SLAB_SIZE - 1));
     return result;
 }
 
-DQN_API Dqn_String Dqn_String__InitArenaFmtV(Dqn_ArenaAllocator *arena DQN_CALL_SITE_ARGS, char const *fmt, va_list va DQN_CALL_SITE_ARGS)
+DQN_FILE_SCOPE Dqn_isize Dqn_SlabAllocator__RoundUp(Dqn_isize value, Dqn_isize multiple)
 {
-    Dqn_Allocator allocator = Dqn_Allocator_InitWithArena(arena);
-    Dqn_String result = Dqn_String__InitFmtV(&allocator, fmt, va DQN_CALL_SITE_ARGS_INPUT);
+    Dqn_isize result = (value + (multiple - 1)) & ~(multiple - 1);
     return result;
 }
 
-DQN_API Dqn_String Dqn_String_Allocate(Dqn_Allocator *allocator, Dqn_isize size, Dqn_ZeroMem zero_mem)
+// Reserve 'size' bytes of address space whose start is aligned to a slab and commit 'commit_size'
+// bytes of it. The header of the first slab is filled out and the reservation is tracked by 'slab'.
+DQN_FILE_SCOPE Dqn_SlabAllocatorSlab *Dqn_SlabAllocator__Reserve(Dqn_SlabAllocator *slab, Dqn_isize size, Dqn_isize commit_size)
 {
-    Dqn_String result = {};
-    result.str        = Dqn_Allocator_NewArray(allocator, char, size, zero_mem);
-    result.cap        = size;
+    Dqn_isize reserve_size = size + DQN_SLAB_ALLOCATOR_SLAB_SIZE; // NOTE: Slack to align the start to a slab
+    void *reserve_base     = Dqn_VirtualMem_Reserve(reserve_size);
+    if (!reserve_base)
+        return nullptr;
+
+    auto *result = DQN_CAST(Dqn_SlabAllocatorSlab *)Dqn_SlabAllocator__RoundUp(DQN_CAST(Dqn_isize)reserve_base, DQN_SLAB_ALLOCATOR_SLAB_SIZE);
+    if (!Dqn_VirtualMem_Commit(result, Dqn_SlabAllocator__RoundUp(commit_size, Dqn_VirtualMem_PageSize())))
+    {
+        Dqn_VirtualMem_Release(reserve_base, reserve_size);
+        return nullptr;
+    }
+
+    *result              = {};
+    result->reserve_base = reserve_base;
+    result->reserve_size = reserve_size;
+    result->next         = slab->reservations;
+    if (slab->reservations) slab->reservations->prev = result;
+    slab->reservations = result;
     return result;
 }
 
-DQN_API Dqn_String Dqn_String_ArenaAllocate(Dqn_ArenaAllocator *arena, Dqn_isize size, Dqn_ZeroMem zero_mem)
+DQN_FILE_SCOPE Dqn_b32 Dqn_SlabAllocator__RefillSizeClass(Dqn_SlabAllocator *slab, Dqn_isize size_class_index)
 {
-    Dqn_String result = {};
-    result.str        = Dqn_ArenaAllocator_NewArray(arena, char, size, zero_mem);
-    result.cap        = size;
-    return result;
+    Dqn_SlabAllocatorSlab *new_slab = nullptr;
+    if (slab->span_cursor != slab->span_end)
+    {
+        if (!Dqn_VirtualMem_Commit(slab->span_cursor, DQN_SLAB_ALLOCATOR_SLAB_SIZE))
+            return false;
+        new_slab  = DQN_CAST(Dqn_SlabAllocatorSlab *)slab->span_cursor;
+        *new_slab = {};
+    }
+    else
+    {
+        new_slab = Dqn_SlabAllocator__Reserve(slab, DQN_SLAB_ALLOCATOR_SPAN_SIZE, DQN_SLAB_ALLOCATOR_SLAB_SIZE);
+        if (!new_slab)
+            return false;
+        slab->span_end = DQN_CAST(char *)new_slab + DQN_SLAB_ALLOCATOR_SPAN_SIZE;
+        slab->total_spans++;
+    }
+
+    slab->span_cursor    = DQN_CAST(char *)new_slab + DQN_SLAB_ALLOCATOR_SLAB_SIZE;
+    new_slab->size_class = size_class_index;
+
+    // NOTE: Slots are aligned to their size, so an allocation is aligned to any power of 2 up to its size class
+    Dqn_SlabAllocatorSizeClass *size_class = slab->size_classes + size_class_index;
+    Dqn_isize first_slot                   = Dqn_SlabAllocator__RoundUp(DQN_ISIZEOF(*new_slab), size_class->slot_size);
+    Dqn_isize slot_count                   = (DQN_SLAB_ALLOCATOR_SLAB_SIZE - first_slot) / size_class->slot_size;
+    for (Dqn_isize index = slot_count - 1; index >= 0; index--)
+    {
+        auto *slot            = DQN_CAST(Dqn_SlabAllocatorSlot *)(DQN_CAST(char *)new_slab + first_slot + (index * size_class->slot_size));
+        slot->next            = size_class->free_list;
+        size_class->free_list = slot;
+    }
+
+    size_class->total_slots += slot_count;
+    size_class->total_slabs++;
+    return true;
 }
 
-DQN_API Dqn_b32 Dqn_String_Compare(Dqn_String const lhs, Dqn_String const rhs)
+DQN_API void Dqn_SlabAllocator_Release(Dqn_SlabAllocator *slab)
 {
-    Dqn_b32 result = false;
-    if (lhs.size == rhs.size)
-        result = (DQN_MEMCMP(lhs.str, rhs.str, DQN_CAST(size_t)lhs.size) == 0);
-    return result;
+    for (Dqn_SlabAllocatorSlab *reservation = slab->reservations; reservation;)
+    {
+        Dqn_SlabAllocatorSlab *next = reservation->next;
+        Dqn_VirtualMem_Release(reservation->reserve_base, reservation->reserve_size);
+        reservation = next;
+    }
+    *slab = {};
 }
 
-DQN_API Dqn_b32 Dqn_String_CompareCaseInsensitive(Dqn_String const lhs, Dqn_String const rhs)
+DQN_API void Dqn_SlabAllocator_Free(Dqn_SlabAllocator *slab, void *ptr)
 {
-    Dqn_b32 result = (lhs.size == rhs.size);
-    for (Dqn_isize index = 0; index < lhs.size && result; index++)
-        result = (Dqn_Char_ToLower(lhs.str[index]) == Dqn_Char_ToLower(rhs.str[index]));
-    return result;
+    if (!ptr) return;
+#if DQN_ALLOCATION_TRACING
+    Dqn_AllocationTracer_Remove(slab->tracer, ptr);
+#endif
+
+    Dqn_SlabAllocatorSlab *owner = Dqn_SlabAllocator__GetSlab(ptr);
+    if (owner->size_class == DQN_SLAB_ALLOCATOR_LARGE_SIZE_CLASS)
+    {
+        if (owner->prev) owner->prev->next  = owner->next;
+        else             slab->reservations = owner->next;
+        if (owner->next) owner->next->prev  = owner->prev;
+
+        slab->large_allocations--;
+        slab->large_bytes -= owner->large_size;
+        Dqn_VirtualMem_Release(owner->reserve_base, owner->reserve_size);
+        return;
+    }
+
+    DQN_ASSERT_MSG(owner->size_class >= 0 && owner->size_class < DQN_SLAB_ALLOCATOR_SIZE_CLASS_COUNT, "Pointer was not allocated from a slab allocator, ptr = %p", ptr);
+    Dqn_SlabAllocatorSizeClass *size_class = slab->size_classes + owner->size_class;
+    auto *slot                             = DQN_CAST(Dqn_SlabAllocatorSlot *)ptr;
+    slot->next                             = size_class->free_list;
+    size_class->free_list                  = slot;
+    size_class->slots_in_use--;
 }
 
-#define Dqn_String_Copy(src, allocator) Dqn_String__Copy(src, allocator DQN_CALL_SITE(""))
-DQN_API Dqn_String Dqn_String__Copy(Dqn_String const src, Dqn_Allocator *allocator DQN_CALL_SITE_ARGS)
+DQN_API Dqn_isize Dqn_SlabAllocator_AllocationSize(void const *ptr)
 {
-    Dqn_String result = src;
-    result.str        = allocator ? DQN_CAST(char *)Dqn_Allocator__Allocate(allocator, result.size, alignof(char), Dqn_ZeroMem::No DQN_CALL_SITE_ARGS_INPUT) :
-                                    DQN_CAST(char *)DQN_MALLOC(result.size);
-    result.cap        = result.size;
-    DQN_MEMCOPY(result.str, src.str, DQN_CAST(size_t)result.size);
+    if (!ptr) return 0;
+    Dqn_SlabAllocatorSlab const *owner = Dqn_SlabAllocator__GetSlab(ptr);
+    Dqn_isize result = owner->size_class == DQN_SLAB_ALLOCATOR_LARGE_SIZE_CLASS
+                           ? owner->large_size
+                           : DQN_SLAB_ALLOCATOR_MIN_SLOT_SIZE << owner->size_class;
     return result;
 }
 
-DQN_API Dqn_String Dqn_String_TrimWhitespaceAround(Dqn_String const src)
+DQN_API void Dqn_SlabAllocator_DumpStatsToLog(Dqn_SlabAllocator const *slab, char const *label)
 {
-    Dqn_String result = {};
-    result.str_       = Dqn_Str_TrimWhitespaceAround(src.str, src.size, &result.size);
-    return result;
+    DQN_LOG_M("%s: %zd spans, %zd large allocations (%$$.3zd)", label, slab->total_spans, slab->large_allocations, slab->large_bytes);
+    DQN_FOR_EACH(index, DQN_SLAB_ALLOCATOR_SIZE_CLASS_COUNT)
+    {
+        Dqn_SlabAllocatorSizeClass const *size_class = slab->size_classes + index;
+        if (size_class->total_slabs == 0) continue;
+        DQN_LOG_M("  %5zd bytes: %zd/%zd slots in use (%zd slabs, %zd allocations)",
+                  DQN_SLAB_ALLOCATOR_MIN_SLOT_SIZE << index,
+                  size_class->slots_in_use,
+                  size_class->total_slots,
+                  size_class->total_slabs,
+                  size_class->total_allocations);
+    }
 }
 
-DQN_API Dqn_b32 operator==(Dqn_String const &lhs, Dqn_String const &rhs)
+DQN_API void *Dqn_SlabAllocator__Allocate(Dqn_SlabAllocator *slab, Dqn_isize size, Dqn_u8 alignment, Dqn_ZeroMem zero_mem DQN_CALL_SITE_ARGS)
 {
-    Dqn_b32 result = lhs.size == rhs.size && (DQN_MEMCMP(lhs.str, rhs.str, lhs.size) == 0);
+    DQN_ASSERT_MSG(alignment > 0 && (alignment & (alignment - 1)) == 0, "Alignment must be a power of 2, %u", alignment);
+    Dqn_isize slot_size        = DQN_M_MAX(DQN_M_MAX(size, DQN_CAST(Dqn_isize)alignment), DQN_SLAB_ALLOCATOR_MIN_SLOT_SIZE);
+    Dqn_isize size_class_index = 0;
+    while ((DQN_SLAB_ALLOCATOR_MIN_SLOT_SIZE << size_class_index) < slot_size)
+        size_class_index++;
+
+    void *result = nullptr;
+    if (size_class_index >= DQN_SLAB_ALLOCATOR_SIZE_CLASS_COUNT)
+    {
+        Dqn_isize header_size        = Dqn_SlabAllocator__RoundUp(DQN_ISIZEOF(Dqn_SlabAllocatorSlab), alignment);
+        Dqn_SlabAllocatorSlab *large = Dqn_SlabAllocator__Reserve(slab, header_size + size, header_size + size);
+        if (!large)
+            return result;
+
+        large->size_class  = DQN_SLAB_ALLOCATOR_LARGE_SIZE_CLASS;
+        large->large_size  = size;
+        slab->large_allocations++;
+        slab->large_bytes += size;
+        result = DQN_CAST(char *)large + header_size;
+    }
+    else
+    {
+        Dqn_SlabAllocatorSizeClass *size_class = slab->size_classes + size_class_index;
+        size_class->slot_size                  = DQN_SLAB_ALLOCATOR_MIN_SLOT_SIZE << size_class_index;
+        if (!size_class->free_list && !Dqn_SlabAllocator__RefillSizeClass(slab, size_class_index))
+            return result;
+
+        result                = size_class->free_list;
+        size_class->free_list = size_class->free_list->next;
+        size_class->slots_in_use++;
+        size_class->total_allocations++;
+    }
+
+    Dqn__ZeroMemBytes(result, DQN_CAST(Dqn_usize)size, zero_mem);
+#if DQN_ALLOCATION_TRACING
+    Dqn_AllocationTracer_Add(slab->tracer, result, size DQN_CALL_SITE_ARGS_INPUT);
+#endif
     return result;
 }
 
-DQN_API Dqn_b32 Dqn_String_AppendFmtV(Dqn_String *str, char const *fmt, va_list va)
+// -------------------------------------------------------------------------------------------------
+//
+// NOTE: Dqn_ThreadCacheAllocator
+//
+// -------------------------------------------------------------------------------------------------
+Dqn_i32 const DQN_THREAD_CACHE__LARGE_SIZE_CLASS = -1;
+struct Dqn_ThreadCacheAllocator__Header
 {
-    va_list va2;
-    va_copy(va2, va);
-    Dqn_isize require = stbsp_vsnprintf(nullptr, 0, fmt, va) + 1;
-    Dqn_isize space   = str->cap - str->size;
-    Dqn_b32 result    = require <= space;
+    Dqn_i32   size_class; // Index into the size classes or DQN_THREAD_CACHE__LARGE_SIZE_CLASS
+    Dqn_u32   offset;     // Large allocations only: bytes from the backing allocation to the user pointer
+    Dqn_isize large_size; // Large allocations only: the requested size
+};
+static_assert(sizeof(Dqn_ThreadCacheAllocator__Header) <= DQN_THREAD_CACHE_HEADER_SIZE, "Slot header must fit in the space reserved before the user pointer");
 
-    if (!result)
+struct Dqn_ThreadCache__Context
+{
+    ~Dqn_ThreadCache__Context();
+    Dqn_ThreadCacheAllocatorThread threads[DQN_THREAD_CACHE_MAX_ALLOCATORS_PER_THREAD];
+};
+
+DQN_THREAD_LOCAL Dqn_ThreadCache__Context dqn__thread_cache_context;
+
+Dqn_ThreadCache__Context::~Dqn_ThreadCache__Context()
+{
+    for (Dqn_ThreadCacheAllocatorThread &thread : this->threads)
     {
-        DQN_LOG_W("Insufficient space in string: require=%I64d, space=%I64d", require, space);
-        return result;
+        if (thread.allocator)
+            Dqn_ThreadCacheAllocator_FlushThread(thread.allocator);
     }
+}
 
-    str->size += stbsp_vsnprintf(str->str + str->size, static_cast<int>(space), fmt, va2);
-    va_end(va2);
-    return result;
+#if !defined(DQN_NO_ASSERT)
+Dqn_ThreadCacheAllocator::~Dqn_ThreadCacheAllocator()
+{
+    DQN_ASSERT_MSG(!this->threads && !this->chunks,
+                   "Dqn_ThreadCacheAllocator_Release must be called before the allocator goes away, threads that used it flush into it when they exit");
 }
+#endif
 
-DQN_API Dqn_b32 Dqn_String_AppendFmt(Dqn_String *str, char const *fmt, ...)
+DQN_FILE_SCOPE Dqn_ThreadCacheAllocator__Header *Dqn_ThreadCacheAllocator__GetHeader(void const *ptr)
 {
-    va_list va;
-    va_start(va, fmt);
-    Dqn_b32 result = Dqn_String_AppendFmtV(str, fmt, va);
-    va_end(va);
+    auto *result = DQN_CAST(Dqn_ThreadCacheAllocator__Header *)(DQN_CAST(Dqn_uintptr)ptr - DQN_THREAD_CACHE_HEADER_SIZE);
     return result;
 }
 
-DQN_API void Dqn_String_Free(Dqn_String *string, Dqn_Allocator *allocator)
+// NOTE: Per thread counters and magazine counts are only written by their thread but are read by
+// Dqn_ThreadCacheAllocator_GetStats on any thread, so they are updated with relaxed atomics.
+DQN_FILE_SCOPE void Dqn_ThreadCacheAllocator__Add(Dqn_isize *value, Dqn_isize amount)
 {
-    if (allocator) Dqn_Allocator_Free(allocator, string->str);
-    else           DQN_FREE(string->str);
-    *string = {};
+    Dqn_AtomicStoreISizeRelaxed(value, Dqn_AtomicLoadISizeRelaxed(value) + amount);
 }
 
-DQN_API Dqn_b32 Dqn_String_StartsWith(Dqn_String string, Dqn_String prefix)
+DQN_FILE_SCOPE void Dqn_ThreadCacheAllocator__CountAllocation(Dqn_ThreadCacheAllocatorCounters *counters, Dqn_isize bytes)
 {
-    Dqn_b32 result = false;
-    if (prefix.size > string.size)
-        return result;
+    Dqn_ThreadCacheAllocator__Add(&counters->bytes_allocated, bytes);
+    Dqn_ThreadCacheAllocator__Add(&counters->allocations, 1);
+    Dqn_ThreadCacheAllocator__Add(&counters->total_bytes_allocated, bytes);
+    Dqn_ThreadCacheAllocator__Add(&counters->total_allocations, 1);
+}
 
-    result = DQN_MEMCMP(string.str, prefix.str, prefix.size) == 0;
-    return result;
+DQN_FILE_SCOPE void Dqn_ThreadCacheAllocator__AddCounters(Dqn_ThreadCacheAllocatorCounters *dest, Dqn_ThreadCacheAllocatorCounters const *src)
+{
+    dest->bytes_allocated       += Dqn_AtomicLoadISizeRelaxed(&src->bytes_allocated);
+    dest->allocations           += Dqn_AtomicLoadISizeRelaxed(&src->allocations);
+    dest->total_bytes_allocated += Dqn_AtomicLoadISizeRelaxed(&src->total_bytes_allocated);
+    dest->total_allocations     += Dqn_AtomicLoadISizeRelaxed(&src->total_allocations);
 }
 
-DQN_API Dqn_Slice<Dqn_String> Dqn_String_Split(Dqn_String src, Dqn_Allocator *allocator)
+// return: The calling thread's cache for 'allocator' or nullptr if it has not registered one.
+DQN_FILE_SCOPE Dqn_ThreadCacheAllocatorThread *Dqn_ThreadCacheAllocator__FindThread(Dqn_ThreadCacheAllocator const *allocator)
 {
-    enum StringSplitStage
+    for (Dqn_ThreadCacheAllocatorThread &thread : dqn__thread_cache_context.threads)
     {
-        StringSplitStage_Enumerate,
-        StringSplitStage_Write,
-        StringSplitStage_Count,
-    };
+        if (thread.allocator == allocator)
+            return &thread;
+    }
+    return nullptr;
+}
+
+// Find or register the calling thread's cache for 'allocator'.
+// return: nullptr if the thread already has caches for DQN_THREAD_CACHE_MAX_ALLOCATORS_PER_THREAD allocators.
+DQN_FILE_SCOPE Dqn_ThreadCacheAllocatorThread *Dqn_ThreadCacheAllocator__GetThread(Dqn_ThreadCacheAllocator *allocator)
+{
+    Dqn_ThreadCacheAllocatorThread *result = Dqn_ThreadCacheAllocator__FindThread(allocator);
+    if (result)
+        return result;
+
+    for (Dqn_ThreadCacheAllocatorThread &thread : dqn__thread_cache_context.threads)
+    {
+        if (!thread.allocator)
+        {
+            result = &thread;
+            break;
+        }
+    }
+
+    if (result)
+    {
+        *result           = {};
+        result->allocator = allocator;
+        Dqn_TicketMutex_Begin(&allocator->mutex);
+        result->next = allocator->threads;
+        if (allocator->threads) allocator->threads->prev = result;
+        allocator->threads = result;
+        Dqn_TicketMutex_End(&allocator->mutex);
+    }
 
-    Dqn_Slice<Dqn_String> result      = {};
-    int                   split_index = 0;
-    int                   split_count = 0;
+    return result;
+}
 
-    for (int stage = StringSplitStage_Enumerate;
-         stage < StringSplitStage_Count;
-         stage++)
+// Pop up to 'count' slots of 'size_class' off the shared free list, allocating a new batch of slots
+// from the backing allocator if the list is empty. The caller must hold the mutex.
+DQN_FILE_SCOPE Dqn_ThreadCacheAllocatorSlot *Dqn_ThreadCacheAllocator__TakeShared(Dqn_ThreadCacheAllocator *allocator, Dqn_isize size_class, Dqn_isize count, Dqn_isize *taken DQN_CALL_SITE_ARGS)
+{
+    *taken = 0;
+    if (!allocator->free_lists[size_class])
     {
-        char const *begin = src.str;
-        char const *end   = src.str;
+        Dqn_isize stride = DQN_THREAD_CACHE_HEADER_SIZE + (DQN_THREAD_CACHE_MIN_SLOT_SIZE << size_class);
+        auto *chunk      = DQN_CAST(char *)Dqn_Allocator__Allocate(allocator->backing, DQN_THREAD_CACHE_HEADER_SIZE + (stride * allocator->batch_size), DQN_THREAD_CACHE_HEADER_SIZE, Dqn_ZeroMem::No DQN_CALL_SITE_ARGS_INPUT);
+        if (!chunk) return nullptr;
 
-        if (stage == StringSplitStage_Write)
-            result = Dqn_Slice_Allocate(allocator, Dqn_String, split_count, Dqn_ZeroMem::No);
+        auto *chunk_link  = DQN_CAST(Dqn_ThreadCacheAllocatorSlot *)chunk;
+        chunk_link->next  = allocator->chunks;
+        allocator->chunks = chunk_link;
 
-        for (;;)
+        // NOTE: The first slot starts after the chunk's link, each slot is a header followed by the user's memory
+        for (Dqn_isize index = allocator->batch_size - 1; index >= 0; index--)
         {
-            while (end[0] != '\r' && end[0] != '\n' && end[0] != 0)
-                end++;
-
-            if (end[0] == 0)
-                break;
-
-            auto split = Dqn_String_Init(begin, end - begin);
-            begin      = end + 1;
-            end        = begin;
-
-            if (split.size == 0)
-                continue;
-            else
-            {
-                if (stage == StringSplitStage_Enumerate) split_count++;
-                else result[split_index++] = split;
-            }
+            char *user                               = chunk + DQN_THREAD_CACHE_HEADER_SIZE + (index * stride) + DQN_THREAD_CACHE_HEADER_SIZE;
+            Dqn_ThreadCacheAllocator__Header *header = Dqn_ThreadCacheAllocator__GetHeader(user);
+            *header                                  = {};
+            header->size_class                       = DQN_CAST(Dqn_i32)size_class;
+
+            auto *slot                        = DQN_CAST(Dqn_ThreadCacheAllocatorSlot *)user;
+            slot->next                        = allocator->free_lists[size_class];
+            allocator->free_lists[size_class] = slot;
         }
+        allocator->free_list_counts[size_class] += allocator->batch_size;
     }
 
-    DQN_ASSERT(split_count == split_index);
+    Dqn_ThreadCacheAllocatorSlot *result = allocator->free_lists[size_class];
+    Dqn_ThreadCacheAllocatorSlot *last   = result;
+    for (*taken = 1; *taken < count && last->next; (*taken)++)
+        last = last->next;
+
+    allocator->free_lists[size_class]        = last->next;
+    allocator->free_list_counts[size_class] -= *taken;
+    last->next                               = nullptr;
     return result;
 }
 
-// -------------------------------------------------------------------------------------------------
-//
-// NOTE: Dqn_ArenaAllocator
-//
-// -------------------------------------------------------------------------------------------------
-DQN_API Dqn_ArenaAllocatorBlock *Dqn_ArenaAllocator__AllocateBlock(Dqn_ArenaAllocator *arena, Dqn_isize requested_size DQN_CALL_SITE_ARGS)
+// Push a list of 'count' slots of 'size_class' onto the shared free list. The caller must hold the mutex.
+DQN_FILE_SCOPE void Dqn_ThreadCacheAllocator__GiveShared(Dqn_ThreadCacheAllocator *allocator, Dqn_isize size_class, Dqn_ThreadCacheAllocatorSlot *slots, Dqn_isize count)
 {
-    Dqn_isize min_block_size = arena->min_block_size;
-    if (min_block_size == 0) min_block_size = DQN_MEM_ARENA_DEFAULT_MIN_BLOCK_SIZE;
+    if (!slots) return;
+    Dqn_ThreadCacheAllocatorSlot *last = slots;
+    while (last->next)
+        last = last->next;
 
-    Dqn_isize mem_block_size = DQN_M_MAX(min_block_size, requested_size);
-    auto const allocate_size = DQN_CAST(Dqn_isize)(sizeof(*arena->curr_mem_block) + mem_block_size);
-    Dqn_Allocator *allocator = arena->allocator ? arena->allocator : &arena->backup_allocator;
-    auto *result             = DQN_CAST(Dqn_ArenaAllocatorBlock *)Dqn_Allocator__Allocate(allocator, allocate_size, alignof(Dqn_ArenaAllocatorBlock), Dqn_ZeroMem::No DQN_CALL_SITE_ARGS_INPUT);
-    if (!result) return result;
+    last->next                               = allocator->free_lists[size_class];
+    allocator->free_lists[size_class]        = slots;
+    allocator->free_list_counts[size_class] += count;
+}
 
-    *result        = {};
-    result->size   = mem_block_size;
-    result->memory = DQN_CAST(Dqn_u8 *)result + sizeof(*result);
-    arena->total_allocated_mem_blocks++;
+DQN_API Dqn_ThreadCacheAllocator Dqn_ThreadCacheAllocator_Init(Dqn_Allocator *backing, Dqn_isize batch_size)
+{
+    Dqn_ThreadCacheAllocator result = {};
+    result.backing                  = backing;
+    result.batch_size               = batch_size > 0 ? batch_size : DQN_THREAD_CACHE_DEFAULT_BATCH_SIZE;
     return result;
 }
 
-DQN_API void Dqn_ArenaAllocator__FreeBlock(Dqn_ArenaAllocator *arena, Dqn_ArenaAllocatorBlock *block)
+DQN_API void Dqn_ThreadCacheAllocator_Release(Dqn_ThreadCacheAllocator *allocator)
 {
-    if (!block)
-        return;
-
-    if (block->next)
-        block->next->prev = block->prev;
+    Dqn_TicketMutex_Begin(&allocator->mutex);
+    for (Dqn_ThreadCacheAllocatorThread *thread = allocator->threads; thread; thread = thread->next)
+        thread->allocator = nullptr;
 
-    if (block->prev)
-        block->prev->next = block->next;
+    for (Dqn_ThreadCacheAllocatorSlot *chunk = allocator->chunks; chunk;)
+    {
+        Dqn_ThreadCacheAllocatorSlot *next = chunk->next;
+        Dqn_Allocator_Free(allocator->backing, chunk);
+        chunk = next;
+    }
+    Dqn_TicketMutex_End(&allocator->mutex);
 
-    Dqn_Allocator *allocator = arena->allocator ? arena->allocator : &arena->backup_allocator;
-    Dqn_Allocator_Free(allocator, block);
+    Dqn_Allocator *backing = allocator->backing;
+    Dqn_isize batch_size   = allocator->batch_size;
+    *allocator             = Dqn_ThreadCacheAllocator_Init(backing, batch_size);
 }
 
-DQN_API void Dqn_ArenaAllocator__AttachBlock(Dqn_ArenaAllocator *arena, Dqn_ArenaAllocatorBlock *new_block)
+DQN_API void Dqn_ThreadCacheAllocator_FlushThread(Dqn_ThreadCacheAllocator *allocator)
 {
-    if (arena->top_mem_block)
-    {
-        DQN_ASSERT(arena->top_mem_block->next == nullptr);
-        arena->top_mem_block->next = new_block;
-        new_block->prev            = arena->top_mem_block;
-        arena->top_mem_block       = new_block;
-    }
-    else
-    {
-        arena->top_mem_block  = new_block;
-        arena->curr_mem_block = new_block;
-    }
+    Dqn_ThreadCacheAllocatorThread *thread = Dqn_ThreadCacheAllocator__FindThread(allocator);
+    if (!thread) return;
+    Dqn_TicketMutex_Begin(&allocator->mutex);
+    DQN_FOR_EACH(size_class, DQN_THREAD_CACHE_SIZE_CLASS_COUNT)
+        Dqn_ThreadCacheAllocator__GiveShared(allocator, size_class, thread->magazines[size_class].slots, thread->magazines[size_class].count);
+    Dqn_ThreadCacheAllocator__AddCounters(&allocator->retired, &thread->counters);
+
+    if (thread->prev) thread->prev->next  = thread->next;
+    else              allocator->threads  = thread->next;
+    if (thread->next) thread->next->prev  = thread->prev;
+    Dqn_TicketMutex_End(&allocator->mutex);
+    *thread = {};
 }
 
-DQN_API Dqn_ArenaAllocator Dqn_ArenaAllocator_InitWithNewAllocator(Dqn_Allocator allocator, Dqn_isize size, Dqn_AllocationTracer *tracer DQN_CALL_SITE_ARGS)
+DQN_API Dqn_ThreadCacheAllocatorStats Dqn_ThreadCacheAllocator_GetStats(Dqn_ThreadCacheAllocator *allocator)
 {
-    Dqn_ArenaAllocator result = {};
-    result.backup_allocator   = allocator;
-    result.tracer             = tracer;
-    if (size > 0)
+    Dqn_ThreadCacheAllocatorCounters counters = {};
+    Dqn_ThreadCacheAllocatorStats    result   = {};
+    Dqn_TicketMutex_Begin(&allocator->mutex);
+    Dqn_ThreadCacheAllocator__AddCounters(&counters, &allocator->retired);
+    for (Dqn_ThreadCacheAllocatorThread const *thread = allocator->threads; thread; thread = thread->next)
     {
-        DQN_ASSERT_MSG(size >= DQN_ISIZEOF(*result.curr_mem_block), "(%I64u >= %I64u) There needs to be enough space to encode the Dqn_ArenaAllocatorBlock struct into the memory buffer", size, sizeof(*result.curr_mem_block));
-        Dqn_ArenaAllocatorBlock *mem_block = Dqn_ArenaAllocator__AllocateBlock(&result, size DQN_CALL_SITE_ARGS_INPUT);
-        Dqn_ArenaAllocator__AttachBlock(&result, mem_block);
+        Dqn_ThreadCacheAllocator__AddCounters(&counters, &thread->counters);
+        DQN_FOR_EACH(size_class, DQN_THREAD_CACHE_SIZE_CLASS_COUNT)
+            result.cached_slots += Dqn_AtomicLoadISizeRelaxed(&thread->magazines[size_class].count);
+        result.threads++;
     }
 
+    DQN_FOR_EACH(size_class, DQN_THREAD_CACHE_SIZE_CLASS_COUNT)
+        result.shared_slots += allocator->free_list_counts[size_class];
+    Dqn_TicketMutex_End(&allocator->mutex);
+
+    result.bytes_allocated       = counters.bytes_allocated;
+    result.allocations           = counters.allocations;
+    result.total_bytes_allocated = counters.total_bytes_allocated;
+    result.total_allocations     = counters.total_allocations;
     return result;
 }
 
-DQN_API Dqn_ArenaAllocator Dqn_ArenaAllocator_InitWithAllocator(Dqn_Allocator *allocator, Dqn_isize size, Dqn_AllocationTracer *tracer DQN_CALL_SITE_ARGS)
+DQN_API Dqn_isize Dqn_ThreadCacheAllocator_AllocationSize(void const *ptr)
 {
-    Dqn_ArenaAllocator result = {};
-    result.allocator          = allocator;
-    result.tracer             = tracer;
-    if (size > 0)
-    {
-        DQN_ASSERT_MSG(size >= DQN_ISIZEOF(*result.curr_mem_block), "(%I64u >= %I64u) There needs to be enough space to encode the Dqn_ArenaAllocatorBlock struct into the memory buffer", size, sizeof(*result.curr_mem_block));
-        Dqn_ArenaAllocatorBlock *mem_block = Dqn_ArenaAllocator__AllocateBlock(&result, size DQN_CALL_SITE_ARGS_INPUT);
-        Dqn_ArenaAllocator__AttachBlock(&result, mem_block);
-    }
+    if (!ptr) return 0;
+    Dqn_ThreadCacheAllocator__Header const *header = Dqn_ThreadCacheAllocator__GetHeader(ptr);
+    Dqn_isize result = header->size_class == DQN_THREAD_CACHE__LARGE_SIZE_CLASS
+                           ? header->large_size
+                           : DQN_THREAD_CACHE_MIN_SLOT_SIZE << header->size_class;
     return result;
 }
 
-DQN_API Dqn_ArenaAllocator Dqn_ArenaAllocator_InitWithMemory(void *memory, Dqn_isize size, Dqn_AllocationTracer *tracer)
+DQN_API void Dqn_ThreadCacheAllocator_Free(Dqn_ThreadCacheAllocator *allocator, void *ptr)
 {
-    Dqn_ArenaAllocator result = {};
-    result.tracer             = tracer;
+    if (!ptr) return;
 
-    DQN_ASSERT_MSG(size >= DQN_ISIZEOF(*result.curr_mem_block), "(%I64u >= %I64u) There needs to be enough space to encode the Dqn_ArenaAllocatorBlock struct into the memory buffer", size, sizeof(*result.curr_mem_block));
-    result.backup_allocator = Dqn_Allocator_InitWithNull();
-    auto *mem_block     = DQN_CAST(Dqn_ArenaAllocatorBlock *) memory;
-    *mem_block          = {};
-    mem_block->memory   = DQN_CAST(Dqn_u8 *) memory + sizeof(*mem_block);
-    mem_block->size     = size - DQN_CAST(Dqn_isize)sizeof(*mem_block);
-    Dqn_ArenaAllocator__AttachBlock(&result, mem_block);
-    return result;
-}
+    // NOTE: Only use a cache the thread already has, a thread that only frees memory allocated by
+    // other threads (i.e. a consumer) returns the slots straight to the shared free lists.
+    Dqn_ThreadCacheAllocator__Header const *header = Dqn_ThreadCacheAllocator__GetHeader(ptr);
+    Dqn_ThreadCacheAllocatorThread *thread         = Dqn_ThreadCacheAllocator__FindThread(allocator);
+    Dqn_isize bytes                                = Dqn_ThreadCacheAllocator_AllocationSize(ptr);
 
-DQN_API void Dqn_ArenaAllocator_Free(Dqn_ArenaAllocator *arena)
-{
-    for (Dqn_ArenaAllocatorBlock *mem_block = arena->top_mem_block; mem_block;)
+    if (header->size_class == DQN_THREAD_CACHE__LARGE_SIZE_CLASS)
+    {
+        char *raw = DQN_CAST(char *)ptr - header->offset;
+        Dqn_TicketMutex_Begin(&allocator->mutex);
+        Dqn_Allocator_Free(allocator->backing, raw);
+        if (!thread)
+        {
+            allocator->retired.bytes_allocated -= bytes;
+            allocator->retired.allocations--;
+        }
+        Dqn_TicketMutex_End(&allocator->mutex);
+    }
+    else if (thread)
+    {
+        Dqn_ThreadCacheAllocatorMagazine *magazine = thread->magazines + header->size_class;
+        auto *slot                                 = DQN_CAST(Dqn_ThreadCacheAllocatorSlot *)ptr;
+        slot->next                                 = magazine->slots;
+        magazine->slots                            = slot;
+        Dqn_ThreadCacheAllocator__Add(&magazine->count, 1);
+
+        // NOTE: Drain a batch back to the shared list so slots freed on this thread can be used by others
+        if (magazine->count >= allocator->batch_size * 2)
+        {
+            Dqn_ThreadCacheAllocatorSlot *drain = magazine->slots;
+            Dqn_ThreadCacheAllocatorSlot *last  = drain;
+            for (Dqn_isize index = 1; index < allocator->batch_size; index++)
+                last = last->next;
+            magazine->slots = last->next;
+            Dqn_ThreadCacheAllocator__Add(&magazine->count, -allocator->batch_size);
+            last->next      = nullptr;
+
+            Dqn_TicketMutex_Begin(&allocator->mutex);
+            Dqn_ThreadCacheAllocator__GiveShared(allocator, header->size_class, drain, allocator->batch_size);
+            Dqn_TicketMutex_End(&allocator->mutex);
+        }
+    }
+    else
     {
-        Dqn_ArenaAllocatorBlock *block_to_free = mem_block;
-        mem_block                              = block_to_free->prev;
-        Dqn_ArenaAllocator__FreeBlock(arena, block_to_free);
+        Dqn_TicketMutex_Begin(&allocator->mutex);
+        auto *slot = DQN_CAST(Dqn_ThreadCacheAllocatorSlot *)ptr;
+        slot->next = nullptr;
+        Dqn_ThreadCacheAllocator__GiveShared(allocator, header->size_class, slot, 1);
+        allocator->retired.bytes_allocated -= bytes;
+        allocator->retired.allocations--;
+        Dqn_TicketMutex_End(&allocator->mutex);
     }
 
-    auto allocator           = arena->allocator;
-    auto highest_used_mark   = arena->highest_used_mark;
-    *arena                   = {};
-    arena->highest_used_mark = highest_used_mark;
-    arena->allocator         = allocator;
+    if (thread)
+    {
+        Dqn_ThreadCacheAllocator__Add(&thread->counters.bytes_allocated, -bytes);
+        Dqn_ThreadCacheAllocator__Add(&thread->counters.allocations, -1);
+    }
 }
 
-DQN_API Dqn_b32 Dqn_ArenaAllocator_Reserve_(Dqn_ArenaAllocator *arena, Dqn_isize size DQN_CALL_SITE_ARGS)
+DQN_API void *Dqn_ThreadCacheAllocator__Allocate(Dqn_ThreadCacheAllocator *allocator, Dqn_isize size, Dqn_u8 alignment, Dqn_ZeroMem zero_mem DQN_CALL_SITE_ARGS)
 {
-    if (arena->top_mem_block)
+    DQN_ASSERT_MSG(alignment > 0 && (alignment & (alignment - 1)) == 0, "Alignment must be a power of 2, %u", alignment);
+    Dqn_ThreadCacheAllocatorThread *thread = Dqn_ThreadCacheAllocator__GetThread(allocator);
+    Dqn_isize size_class                   = 0;
+    while ((DQN_THREAD_CACHE_MIN_SLOT_SIZE << size_class) < size && size_class < DQN_THREAD_CACHE_SIZE_CLASS_COUNT)
+        size_class++;
+
+    char *result = nullptr;
+    if (size_class == DQN_THREAD_CACHE_SIZE_CLASS_COUNT || alignment > DQN_THREAD_CACHE_HEADER_SIZE)
     {
-        Dqn_isize remaining_space = arena->top_mem_block->size - arena->top_mem_block->used;
-        if (remaining_space >= size) return true;
+        Dqn_isize offset = DQN_M_MAX(DQN_THREAD_CACHE_HEADER_SIZE, DQN_CAST(Dqn_isize)alignment);
+        Dqn_TicketMutex_Begin(&allocator->mutex);
+        char *raw = DQN_CAST(char *)Dqn_Allocator__Allocate(allocator->backing, offset + size, DQN_CAST(Dqn_u8)offset, Dqn_ZeroMem::No DQN_CALL_SITE_ARGS_INPUT);
+        Dqn_TicketMutex_End(&allocator->mutex);
+        if (!raw) return result;
+
+        result                                   = raw + offset;
+        Dqn_ThreadCacheAllocator__Header *header = Dqn_ThreadCacheAllocator__GetHeader(result);
+        header->size_class                       = DQN_THREAD_CACHE__LARGE_SIZE_CLASS;
+        header->offset                           = DQN_CAST(Dqn_u32)offset;
+        header->large_size                       = size;
     }
+    else if (thread)
+    {
+        Dqn_ThreadCacheAllocatorMagazine *magazine = thread->magazines + size_class;
+        if (!magazine->slots)
+        {
+            Dqn_TicketMutex_Begin(&allocator->mutex);
+            magazine->slots = Dqn_ThreadCacheAllocator__TakeShared(allocator, size_class, allocator->batch_size, &magazine->count DQN_CALL_SITE_ARGS_INPUT);
+            Dqn_TicketMutex_End(&allocator->mutex);
+            if (!magazine->slots) return result;
+        }
 
-    Dqn_ArenaAllocatorBlock *new_block = Dqn_ArenaAllocator__AllocateBlock(arena, size DQN_CALL_SITE_ARGS_INPUT);
-    if (!new_block) return false;
-    Dqn_ArenaAllocator__AttachBlock(arena, new_block);
-    return true;
-}
-
-DQN_API void Dqn_ArenaAllocator_ResetUsage(Dqn_ArenaAllocator *arena, Dqn_ZeroMem zero_mem)
-{
-    arena->usage_before_last_reset   = 0;
-    arena->wastage_before_last_reset = 0;
-    for (Dqn_ArenaAllocatorBlock *block = arena->top_mem_block; block; block = block->prev)
+        result          = DQN_CAST(char *)magazine->slots;
+        magazine->slots = magazine->slots->next;
+        Dqn_ThreadCacheAllocator__Add(&magazine->count, -1);
+    }
+    else
     {
-        arena->usage_before_last_reset += block->used;
-        if (block->prev)
-            arena->wastage_before_last_reset += (block->size - block->used);
-        else
-            arena->curr_mem_block = block;
+        Dqn_isize taken = 0;
+        Dqn_TicketMutex_Begin(&allocator->mutex);
+        result = DQN_CAST(char *)Dqn_ThreadCacheAllocator__TakeShared(allocator, size_class, 1, &taken DQN_CALL_SITE_ARGS_INPUT);
+        Dqn_TicketMutex_End(&allocator->mutex);
+        if (!result) return result;
+    }
 
-        Dqn__ZeroMemBytes(block->memory, DQN_CAST(size_t)block->used, zero_mem);
-        block->used = 0;
+    Dqn_isize bytes = Dqn_ThreadCacheAllocator_AllocationSize(result);
+    if (thread)
+    {
+        Dqn_ThreadCacheAllocator__CountAllocation(&thread->counters, bytes);
+    }
+    else
+    {
+        Dqn_TicketMutex_Begin(&allocator->mutex);
+        Dqn_ThreadCacheAllocator__CountAllocation(&allocator->retired, bytes);
+        Dqn_TicketMutex_End(&allocator->mutex);
     }
-}
 
-DQN_API Dqn_ArenaAllocatorRegion Dqn_ArenaAllocator_BeginRegion(Dqn_ArenaAllocator *arena)
-{
-    Dqn_ArenaAllocatorRegion result  = {};
-    result.arena               = arena;
-    result.curr_mem_block      = arena->curr_mem_block;
-    result.curr_mem_block_used = (arena->curr_mem_block) ? arena->curr_mem_block->used : 0;
-    result.top_mem_block       = arena->top_mem_block;
+    Dqn__ZeroMemBytes(result, DQN_CAST(Dqn_usize)size, zero_mem);
     return result;
 }
 
-DQN_API void Dqn_ArenaAllocator_EndRegion(Dqn_ArenaAllocatorRegion region)
+// -------------------------------------------------------------------------------------------------
+//
+// NOTE: Dqn_ScratchArena
+//
+// -------------------------------------------------------------------------------------------------
+struct Dqn_Scratch__ThreadContext
 {
-    while (region.top_mem_block != region.arena->top_mem_block)
-    {
-        Dqn_ArenaAllocatorBlock *block_to_free = region.arena->top_mem_block;
-        if (region.arena->curr_mem_block == block_to_free)
-            region.arena->curr_mem_block = block_to_free->prev;
-        region.arena->top_mem_block = block_to_free->prev;
-        Dqn_ArenaAllocator__FreeBlock(region.arena, block_to_free);
-    }
+    ~Dqn_Scratch__ThreadContext();
+    Dqn_b32            initialised;
+    Dqn_ArenaAllocator arenas[DQN_SCRATCH_ARENA_COUNT];
+};
 
-    for (Dqn_ArenaAllocatorBlock *mem_block = region.arena->top_mem_block; mem_block != region.curr_mem_block; mem_block = mem_block->prev)
-        mem_block->used = 0;
+DQN_THREAD_LOCAL Dqn_Scratch__ThreadContext dqn__scratch_context;
 
-    if (region.arena->curr_mem_block)
-        region.arena->curr_mem_block->used = region.curr_mem_block_used;
-    region = {};
+Dqn_Scratch__ThreadContext::~Dqn_Scratch__ThreadContext()
+{
+    for (Dqn_ArenaAllocator &arena : this->arenas)
+        Dqn_ArenaAllocator_Free(&arena);
 }
 
-Dqn_ArenaAllocatorScopedRegion Dqn_ArenaAllocator_MakeScopedRegion(Dqn_ArenaAllocator *arena)
+Dqn_ScratchArena::Dqn_ScratchArena(Dqn_ArenaAllocator *arena)
+: arena(arena)
+, allocator(Dqn_Allocator_InitWithArena(arena))
+, region(arena)
 {
-    return Dqn_ArenaAllocatorScopedRegion(arena);
 }
 
-Dqn_ArenaAllocatorScopedRegion::Dqn_ArenaAllocatorScopedRegion(Dqn_ArenaAllocator *arena)
+Dqn_ScratchArena::Dqn_ScratchArena(Dqn_ScratchArena &&other)
+: arena(other.arena)
+, allocator(other.allocator)
+, region(other.region)
 {
-    this->region = Dqn_ArenaAllocator_BeginRegion(arena);
+    other.region.region = {};
 }
 
-Dqn_ArenaAllocatorScopedRegion::~Dqn_ArenaAllocatorScopedRegion()
+DQN_API Dqn_ScratchArena Dqn_Scratch_Get(Dqn_ArenaAllocator const *conflict_arena)
 {
-    Dqn_ArenaAllocator_EndRegion(this->region);
+    return Dqn_Scratch_GetExcluding(&conflict_arena, conflict_arena ? 1 : 0);
 }
 
-DQN_API void *Dqn_ArenaAllocator__Allocate(Dqn_ArenaAllocator *arena, Dqn_isize size, Dqn_u8 alignment, Dqn_ZeroMem zero_mem DQN_CALL_SITE_ARGS)
+DQN_API Dqn_ScratchArena Dqn_Scratch_GetExcluding(Dqn_ArenaAllocator const *const *conflict_arenas, Dqn_isize conflict_arenas_size)
 {
-    Dqn_isize allocation_size  = size + (alignment - 1);
-    Dqn_b32 need_new_mem_block = true;
-    for (Dqn_ArenaAllocatorBlock *mem_block = arena->curr_mem_block; mem_block; mem_block = mem_block->next)
+    Dqn_Scratch__ThreadContext *context = &dqn__scratch_context;
+    if (!context->initialised)
     {
-        Dqn_b32 can_fit_in_block = (mem_block->used + allocation_size) <= mem_block->size;
-        if (can_fit_in_block)
+        context->initialised = true;
+        for (Dqn_ArenaAllocator &arena : context->arenas)
         {
-            arena->curr_mem_block = mem_block;
-            need_new_mem_block    = false;
-            break;
+            arena = Dqn_ArenaAllocator_InitWithVirtualMemory(DQN_CAST(Dqn_isize)DQN_SCRATCH_ARENA_RESERVE_SIZE);
+            if (!arena.top_mem_block) // NOTE: Fall back to heap allocated blocks if the reservation failed
+                arena.backup_allocator = Dqn_Allocator_InitWithHeap();
         }
     }
 
-    if (need_new_mem_block)
+    Dqn_ArenaAllocator *arena = nullptr;
+    for (Dqn_ArenaAllocator &scratch : context->arenas)
     {
-        Dqn_ArenaAllocatorBlock *new_block = Dqn_ArenaAllocator__AllocateBlock(arena, allocation_size DQN_CALL_SITE_ARGS_INPUT);
-        if (!new_block) return nullptr;
-        Dqn_ArenaAllocator__AttachBlock(arena, new_block);
-        arena->curr_mem_block = arena->top_mem_block;
-    }
+        Dqn_b32 conflicts = false;
+        for (Dqn_isize index = 0; index < conflict_arenas_size && !conflicts; index++)
+            conflicts = (conflict_arenas[index] == &scratch);
 
-    Dqn_uintptr address = DQN_CAST(Dqn_uintptr) arena->curr_mem_block->memory + arena->curr_mem_block->used;
-    void *result        = DQN_CAST(void *) Dqn_AlignAddress(address, alignment);
-
-    arena->curr_mem_block->used += allocation_size;
-    DQN_ASSERT(arena->curr_mem_block->used <= arena->curr_mem_block->size);
-    Dqn__ZeroMemBytes(DQN_CAST(void *)address, allocation_size, zero_mem);
-    Dqn_AllocationTracer_Add(arena->tracer, DQN_CAST(void *)address, allocation_size DQN_CALL_SITE_ARGS_INPUT);
-    return result;
-}
+        if (!conflicts)
+        {
+            arena = &scratch;
+            break;
+        }
+    }
 
-DQN_API Dqn_ArenaAllocatorStats Dqn_ArenaAllocator_GetStats(Dqn_ArenaAllocator const *arena)
-{
-    Dqn_ArenaAllocatorStats result = {};
-    result.total_blocks            = arena->total_allocated_mem_blocks;
-    for (Dqn_ArenaAllocatorBlock const *block = arena->top_mem_block; block; block = block->prev)
+    if (!arena)
     {
-        result.total_allocated += block->size;
-        result.total_used += block->used;
-        if (block != arena->top_mem_block)
-            result.total_wasted += block->size - block->used;
+        DQN_HARD_ASSERT_MSG(arena, "Every scratch arena conflicts with the %zd arena(s) given, increase DQN_SCRATCH_ARENA_COUNT (currently %d)", conflict_arenas_size, DQN_SCRATCH_ARENA_COUNT);
+        arena = &context->arenas[0];
     }
-    return result;
-}
-
-Dqn_String const DQN_ARENA_ALLOCATOR__STATS_FMT = DQN_STRING("%s: %$$.3d/%$$.3d (wasted %$$.3d - %d blks)");
-DQN_API void Dqn_ArenaAllocator_DumpStatsToLog(Dqn_ArenaAllocator const *arena, char const *label)
-{
-    Dqn_ArenaAllocatorStats stats = Dqn_ArenaAllocator_GetStats(arena);
-    DQN_LOG_M(DQN_ARENA_ALLOCATOR__STATS_FMT.str,
-              label,
-              stats.total_used,
-              stats.total_allocated,
-              stats.total_wasted,
-              stats.total_blocks);
-}
 
-DQN_API Dqn_FixedString<512> Dqn_ArenaAllocator_StatsString(Dqn_ArenaAllocator const *arena, char const *label)
-{
-    Dqn_ArenaAllocatorStats stats = Dqn_ArenaAllocator_GetStats(arena);
-    auto                    result = Dqn_FixedString_InitFmt<512>(DQN_ARENA_ALLOCATOR__STATS_FMT.str,
-                                               label,
-                                               stats.total_used,
-                                               stats.total_allocated,
-                                               stats.total_wasted,
-                                               stats.total_blocks);
-    return result;
+    return Dqn_ScratchArena(arena);
 }
 
 // -------------------------------------------------------------------------------------------------
@@ -4644,7 +8280,7 @@ DQN_API Dqn_i64 Dqn_Safe_MulI64(Dqn_i64 a, Dqn_i64 b)
 DQN_API Dqn_u64 Dqn_Safe_AddU64(Dqn_u64 a, Dqn_u64 b)
 {
     DQN_ASSERT_MSG(a <= DQN_U64_MAX - b, "%I64u <= %I64u", a, DQN_U64_MAX - b);
-    Dqn_u64 result = (a <= DQN_U64_MAX / b) ? (a + b) : DQN_U64_MAX;
+    Dqn_u64 result = (a <= DQN_U64_MAX - b) ? (a + b) : DQN_U64_MAX;
     return result;
 }
 
@@ -4824,44 +8460,153 @@ DQN_API char const *Dqn_Str_FindMulti(char const *buf, char const *find_list[],
     return result;
 }
 
-DQN_API char const *Dqn_Str_Find(char const *buf, char const *find, Dqn_isize buf_len, Dqn_isize find_len, Dqn_b32 case_insensitive)
+DQN_FILE_SCOPE Dqn_b32 Dqn_Str__FindEquals(char const *a, char const *b, Dqn_isize size, Dqn_b32 case_insensitive)
 {
-    if (find_len == 0) return nullptr;
-    if (buf_len < 0) buf_len = DQN_CAST(Dqn_isize)Dqn_Str_Len(buf);
-    if (find_len < 0) find_len = DQN_CAST(Dqn_isize)Dqn_Str_Len(find);
+    Dqn_b32 result = true;
+    if (case_insensitive)
+    {
+        for (Dqn_isize index = 0; result && index < size; index++)
+            result = Dqn_Char_ToLower(a[index]) == Dqn_Char_ToLower(b[index]);
+    }
+    else
+    {
+        result = size == 0 || memcmp(a, b, DQN_CAST(size_t)size) == 0;
+    }
+    return result;
+}
 
-    char const *buf_end = buf + buf_len;
+// NOTE: Boyer-Moore-Horspool, after a mismatch the buffer byte under the end of the needle decides how
+// far the needle can shift. Used without SIMD and for the positions left over by the SIMD loops.
+DQN_FILE_SCOPE char const *Dqn_Str__FindHorspool(char const *buf, Dqn_isize buf_len, char const *find, Dqn_isize find_len, Dqn_b32 case_insensitive)
+{
+    Dqn_u8 skip[256];
+    memset(skip, DQN_CAST(int)DQN_M_MIN(find_len, 255), sizeof(skip));
+    for (Dqn_isize index = 0; index < find_len - 1; index++)
+    {
+        char ch                   = case_insensitive ? Dqn_Char_ToLower(find[index]) : find[index];
+        skip[DQN_CAST(Dqn_u8)ch] = DQN_CAST(Dqn_u8)DQN_M_MIN(find_len - 1 - index, 255);
+    }
+
+    char        last   = case_insensitive ? Dqn_Char_ToLower(find[find_len - 1]) : find[find_len - 1];
     char const *result = nullptr;
-    for (; buf != buf_end; ++buf)
+    for (Dqn_isize pos = 0; !result && pos <= buf_len - find_len;)
     {
-        Dqn_isize remaining = static_cast<Dqn_isize>(buf_end - buf);
-        if (remaining < find_len) break;
+        char ch = buf[pos + find_len - 1];
+        ch      = case_insensitive ? Dqn_Char_ToLower(ch) : ch;
+        if (ch == last && Dqn_Str__FindEquals(buf + pos, find, find_len - 1, case_insensitive))
+            result = buf + pos;
+        pos += skip[DQN_CAST(Dqn_u8)ch];
+    }
+    return result;
+}
 
-        Dqn_b32 matched = true;
-        for (Dqn_isize index = 0; index < find_len; index++)
-        {
-            char lhs = buf[index];
-            char rhs = find[index];
+// NOTE: SIMD search, compare a register's worth of positions against the needle's first and last byte
+// at once and only compare the rest of the needle where both match. For case insensitive searches
+// letters are compared with the 0x20 (lowercase) bit set on both sides which can also let through a
+// few non-letters, those are rejected by the full compare.
+struct Dqn_Str__FindFilter
+{
+    char first;
+    char last;
+    char first_case_bit; // 0x20 if the byte is a letter and the search is case insensitive
+    char last_case_bit;
+};
+
+DQN_FILE_SCOPE Dqn_Str__FindFilter Dqn_Str__MakeFindFilter(char const *find, Dqn_isize find_len, Dqn_b32 case_insensitive)
+{
+    Dqn_Str__FindFilter result = {};
+    char first                 = Dqn_Char_ToLower(find[0]);
+    char last                  = Dqn_Char_ToLower(find[find_len - 1]);
+    result.first_case_bit      = (case_insensitive && first >= 'a' && first <= 'z') ? 0x20 : 0;
+    result.last_case_bit       = (case_insensitive && last  >= 'a' && last  <= 'z') ? 0x20 : 0;
+    result.first               = find[0]            | result.first_case_bit;
+    result.last                = find[find_len - 1] | result.last_case_bit;
+    return result;
+}
+
+#if defined(DQN_SSE2)
+DQN_FILE_SCOPE Dqn_isize Dqn_Str__FindSSE2(char const *buf, Dqn_isize buf_len, char const *find, Dqn_isize find_len, Dqn_b32 case_insensitive, char const **result)
+{
+    Dqn_Str__FindFilter filter         = Dqn_Str__MakeFindFilter(find, find_len, case_insensitive);
+    __m128i             first          = _mm_set1_epi8(filter.first);
+    __m128i             last           = _mm_set1_epi8(filter.last);
+    __m128i             first_case_bit = _mm_set1_epi8(filter.first_case_bit);
+    __m128i             last_case_bit  = _mm_set1_epi8(filter.last_case_bit);
 
-            if (case_insensitive)
+    Dqn_isize pos = 0;
+    for (; pos + find_len - 1 + 16 <= buf_len; pos += 16)
+    {
+        __m128i block_first = _mm_or_si128(_mm_loadu_si128(DQN_CAST(__m128i const *)(buf + pos)), first_case_bit);
+        __m128i block_last  = _mm_or_si128(_mm_loadu_si128(DQN_CAST(__m128i const *)(buf + pos + find_len - 1)), last_case_bit);
+        __m128i eq          = _mm_and_si128(_mm_cmpeq_epi8(block_first, first), _mm_cmpeq_epi8(block_last, last));
+        for (Dqn_u32 mask = DQN_CAST(Dqn_u32)_mm_movemask_epi8(eq); mask; mask &= mask - 1)
+        {
+            char const *candidate = buf + pos + Dqn_CountTrailingZerosU32(mask);
+            if (find_len <= 2 || Dqn_Str__FindEquals(candidate + 1, find + 1, find_len - 2, case_insensitive))
             {
-                lhs = Dqn_Char_ToLower(lhs);
-                rhs = Dqn_Char_ToLower(rhs);
+                *result = candidate;
+                return pos;
             }
+        }
+    }
+    return pos;
+}
+#endif // DQN_SSE2
+
+#if defined(DQN_AVX2)
+DQN_AVX2_FUNCTION DQN_FILE_SCOPE Dqn_isize Dqn_Str__FindAVX2(char const *buf, Dqn_isize buf_len, char const *find, Dqn_isize find_len, Dqn_b32 case_insensitive, char const **result)
+{
+    Dqn_Str__FindFilter filter         = Dqn_Str__MakeFindFilter(find, find_len, case_insensitive);
+    __m256i             first          = _mm256_set1_epi8(filter.first);
+    __m256i             last           = _mm256_set1_epi8(filter.last);
+    __m256i             first_case_bit = _mm256_set1_epi8(filter.first_case_bit);
+    __m256i             last_case_bit  = _mm256_set1_epi8(filter.last_case_bit);
 
-            if (lhs != rhs)
+    Dqn_isize pos = 0;
+    for (; pos + find_len - 1 + 32 <= buf_len; pos += 32)
+    {
+        __m256i block_first = _mm256_or_si256(_mm256_loadu_si256(DQN_CAST(__m256i const *)(buf + pos)), first_case_bit);
+        __m256i block_last  = _mm256_or_si256(_mm256_loadu_si256(DQN_CAST(__m256i const *)(buf + pos + find_len - 1)), last_case_bit);
+        __m256i eq          = _mm256_and_si256(_mm256_cmpeq_epi8(block_first, first), _mm256_cmpeq_epi8(block_last, last));
+        for (Dqn_u32 mask = DQN_CAST(Dqn_u32)_mm256_movemask_epi8(eq); mask; mask &= mask - 1)
+        {
+            char const *candidate = buf + pos + Dqn_CountTrailingZerosU32(mask);
+            if (find_len <= 2 || Dqn_Str__FindEquals(candidate + 1, find + 1, find_len - 2, case_insensitive))
             {
-                matched = false;
-                break;
+                *result = candidate;
+                return pos;
             }
         }
+    }
+    return pos;
+}
+#endif // DQN_AVX2
 
-        if (matched)
-        {
-            result = buf;
-            break;
-        }
+DQN_API char const *Dqn_Str_Find(char const *buf, char const *find, Dqn_isize buf_len, Dqn_isize find_len, Dqn_b32 case_insensitive)
+{
+    if (find_len == 0) return nullptr;
+    if (buf_len < 0) buf_len = DQN_CAST(Dqn_isize)Dqn_Str_Len(buf);
+    if (find_len < 0) find_len = DQN_CAST(Dqn_isize)Dqn_Str_Len(find);
+    if (find_len == 0) return buf_len ? buf : nullptr; // An empty null-terminated needle matches at the start
+    if (find_len > buf_len) return nullptr;
+
+    // NOTE: The SIMD loops return the position they stopped at, the last few positions that don't
+    // fill a register are searched by Horspool.
+    char const *result = nullptr;
+    Dqn_isize   pos    = 0;
+#if defined(DQN_AVX2)
+    if (Dqn_CPU_Features().avx2)
+        pos = Dqn_Str__FindAVX2(buf, buf_len, find, find_len, case_insensitive, &result);
+    else
+#endif
+    {
+#if defined(DQN_SSE2)
+        pos = Dqn_Str__FindSSE2(buf, buf_len, find, find_len, case_insensitive, &result);
+#endif
     }
+
+    if (!result)
+        result = Dqn_Str__FindHorspool(buf + pos, buf_len - pos, find, find_len, case_insensitive);
     return result;
 }
 
@@ -4985,112 +8730,1126 @@ DQN_API char const *Dqn_Str_SkipToNextWordInPlace(char const **src)
     return *src;
 }
 
-DQN_API char const *Dqn_Str_SkipWhitespaceInPlace(char const **src)
+DQN_API char const *Dqn_Str_SkipWhitespaceInPlace(char const **src)
+{
+    *src = Dqn_Str_SkipWhitespace(*src);
+    return *src;
+}
+
+DQN_API char const *Dqn_Str_TrimWhitespaceAround(char const *src, Dqn_isize size, Dqn_isize *new_size)
+{
+    char const *result = src;
+    if (new_size) *new_size = 0;
+    if (size <= 0) return result;
+
+    char const *start = result;
+    char const *end   = start + (size - 1);
+    while (Dqn_Char_IsWhitespace(start[0])) start++;
+    while (end != start && Dqn_Char_IsWhitespace(end[0])) end--;
+
+    result = start;
+    if (new_size) *new_size = ((end - start) + 1);
+    return result;
+}
+
+DQN_API char const *Dqn_Str_TrimPrefix(char const *src, Dqn_isize size, char const *prefix, Dqn_isize prefix_size, Dqn_isize *trimmed_size)
+{
+    char const *result = src;
+    if (size >= prefix_size)
+    {
+        Dqn_b32 prefix_matched = true;
+        for (Dqn_isize prefix_index = 0;
+             prefix_index < prefix_size && prefix_matched;
+             prefix_index++)
+        {
+            char prefix_ch = prefix[prefix_index];
+            char src_ch    = src[prefix_index];
+            prefix_matched = src_ch == prefix_ch;
+        }
+
+        if (prefix_matched)
+        {
+            result += prefix_size;
+            *trimmed_size = size - prefix_size;
+        }
+    }
+
+    return result;
+}
+
+
+DQN_FILE_SCOPE Dqn_u64 Dqn_Str__Pow10U64(Dqn_isize exponent)
+{
+    DQN_LOCAL_PERSIST Dqn_u64 const POW10[] =
+    {
+        1ULL, 10ULL, 100ULL, 1000ULL, 10000ULL, 100000ULL, 1000000ULL, 10000000ULL, 100000000ULL,
+        1000000000ULL, 10000000000ULL, 100000000000ULL, 1000000000000ULL, 10000000000000ULL,
+        100000000000000ULL, 1000000000000000ULL, 10000000000000000ULL, 100000000000000000ULL,
+        1000000000000000000ULL, 10000000000000000000ULL,
+    };
+    DQN_ASSERT(exponent >= 0 && exponent < Dqn_ArrayCountI(POW10));
+    Dqn_u64 result = POW10[exponent];
+    return result;
+}
+
+// NOTE: Load up to 8 bytes of 'buf' and parse the leading digits in them. The chunk's bytes are
+// checked for '0'-'9' in parallel, the bytes up to the first non-digit are shifted to the top so the
+// bytes below act as leading zeros and are combined pairwise, 2 -> 4 -> 8 digits, with 3 multiplies.
+// return: The number of leading digits, 8 if the chunk is all digits.
+DQN_FORCE_INLINE Dqn_isize Dqn_Str__LoadDigits8(char const *buf, Dqn_isize size, Dqn_u64 *value)
+{
+    Dqn_u64 chunk = 0; // NOTE: Bytes past the end are 0 which is not a digit
+    DQN_MEMCOPY(&chunk, buf, DQN_CAST(size_t)DQN_M_MAX(DQN_M_MIN(size, DQN_ISIZEOF(chunk)), 0));
+
+    Dqn_u64 not_digit = ((chunk & 0xF0F0F0F0F0F0F0F0ULL) ^ 0x3030303030303030ULL) |
+                        (((chunk + 0x0606060606060606ULL) & 0xF0F0F0F0F0F0F0F0ULL) ^ 0x3030303030303030ULL);
+    Dqn_isize result    = not_digit ? Dqn_CountTrailingZerosU64(not_digit) / 8 : 8;
+    if (result)
+    {
+        chunk <<= 8 * (8 - result);
+        chunk   = ((chunk & 0x0F0F0F0F0F0F0F0FULL) * 2561) >> 8;
+        chunk   = ((chunk & 0x00FF00FF00FF00FFULL) * 6553601) >> 16;
+        chunk   = ((chunk & 0x0000FFFF0000FFFFULL) * 42949672960001ULL) >> 32;
+    }
+    else
+    {
+        chunk = 0;
+    }
+
+    *value = chunk;
+    return result;
+}
+
+// NOTE: Parse the leading digits of 'buf' 8 at a time. The digits are accumulated modulo 2^64,
+// overflow is checked once at the end from the digit count.
+DQN_FILE_SCOPE Dqn_isize Dqn_Str__ParseDigits(char const *buf, Dqn_isize size, Dqn_u64 *value, Dqn_b32 *overflow)
+{
+    Dqn_u64   result = 0;
+    Dqn_isize pos    = 0;
+    while (pos < size)
+    {
+        Dqn_u64   chunk  = 0;
+        Dqn_isize digits = Dqn_Str__LoadDigits8(buf + pos, size - pos, &chunk);
+        if (digits == 0)
+            break;
+
+        result  = (result * Dqn_Str__Pow10U64(digits)) + chunk;
+        pos    += digits;
+        if (digits < 8)
+            break;
+    }
+
+    // NOTE: 19 digits always fit, past that compare the significant digits against DQN_U64_MAX
+    *overflow = false;
+    if (pos > 19)
+    {
+        Dqn_isize zeros = 0;
+        while (zeros < pos && buf[zeros] == '0')
+            zeros++;
+
+        Dqn_isize significant = pos - zeros;
+        *overflow = significant > 20 || (significant == 20 && DQN_MEMCMP(buf + zeros, "18446744073709551615", 20) > 0);
+    }
+
+    *value = *overflow ? DQN_U64_MAX : result;
+    return pos;
+}
+
+// NOTE: Dqn_Str_ToU64/ToI64, digits separated by 'separator' are joined into one number. Returns
+// the number's magnitude saturated to DQN_U64_MAX.
+DQN_FILE_SCOPE Dqn_u64 Dqn_Str__ToU64Separated(char const *buf, Dqn_isize len, char separator)
+{
+    Dqn_u64   result = 0;
+    Dqn_isize pos    = 0;
+    while (pos < len)
+    {
+        Dqn_u64   group    = 0;
+        Dqn_b32   overflow = false;
+        Dqn_isize digits   = Dqn_Str__ParseDigits(buf + pos, len - pos, &group, &overflow);
+        if (digits == 0)
+            break;
+
+        if (pos == 0)
+        {
+            result = group;
+        }
+        else
+        {
+            overflow |= (result != 0) && (digits > 19 || result > (DQN_U64_MAX - group) / Dqn_Str__Pow10U64(digits));
+            if (!overflow)
+                result = (result * (digits > 19 ? 0 : Dqn_Str__Pow10U64(digits))) + group;
+        }
+
+        if (overflow)
+            return DQN_U64_MAX;
+
+        pos += digits;
+        while (pos < len && buf[pos] == separator)
+            pos++;
+    }
+    return result;
+}
+
+DQN_API Dqn_u64 Dqn_Str_ToU64(char const *buf, int len, char separator)
+{
+    Dqn_u64 result = 0;
+    if (!buf) return result;
+    if (len == -1) len = Dqn_Safe_TruncateUSizeToInt(Dqn_Str_Len(buf));
+    if (len == 0) return result;
+
+    char const *buf_ptr = Dqn_Str_SkipWhitespace(buf);
+    len -= static_cast<int>(buf_ptr - buf);
+    result = Dqn_Str__ToU64Separated(buf_ptr, len, separator);
+    return result;
+}
+
+DQN_API Dqn_i64 Dqn_Str_ToI64(char const *buf, int len, char separator)
+{
+    Dqn_i64 result = 0;
+    if (!buf) return result;
+    if (len == -1) len = Dqn_Safe_TruncateUSizeToInt(Dqn_Str_Len(buf));
+    if (len == 0) return result;
+
+    char const *buf_ptr = Dqn_Str_SkipWhitespace(buf);
+    len -= static_cast<int>(buf_ptr - buf);
+
+    Dqn_b32 negative = (len > 0 && buf_ptr[0] == '-');
+    if (negative)
+    {
+        ++buf_ptr;
+        --len;
+    }
+
+    Dqn_u64 magnitude = Dqn_Str__ToU64Separated(buf_ptr, len, separator);
+    if (negative) result = magnitude >= DQN_CAST(Dqn_u64)DQN_I64_MAX + 1 ? DQN_I64_MIN : -DQN_CAST(Dqn_i64)magnitude;
+    else          result = magnitude >= DQN_CAST(Dqn_u64)DQN_I64_MAX     ? DQN_I64_MAX : DQN_CAST(Dqn_i64)magnitude;
+    return result;
+}
+
+DQN_API Dqn_isize Dqn_Str_ParseU64(char const *buf, Dqn_isize size, Dqn_u64 *value)
+{
+    Dqn_b32   overflow = false;
+    Dqn_isize result   = Dqn_Str__ParseDigits(buf, size, value, &overflow);
+    if (overflow)
+        result = 0;
+    return result;
+}
+
+DQN_API Dqn_isize Dqn_Str_ParseI64(char const *buf, Dqn_isize size, Dqn_i64 *value)
+{
+    *value = 0;
+    if (size <= 0)
+        return 0;
+
+    Dqn_b32   negative = buf[0] == '-';
+    Dqn_isize sign     = (negative || buf[0] == '+') ? 1 : 0;
+
+    Dqn_u64   magnitude = 0;
+    Dqn_b32   overflow  = false;
+    Dqn_isize digits    = Dqn_Str__ParseDigits(buf + sign, size - sign, &magnitude, &overflow);
+    if (digits == 0)
+        return 0;
+
+    Dqn_u64 limit = negative ? DQN_CAST(Dqn_u64)DQN_I64_MAX + 1 : DQN_CAST(Dqn_u64)DQN_I64_MAX;
+    if (overflow || magnitude > limit)
+    {
+        *value = negative ? DQN_I64_MIN : DQN_I64_MAX;
+        return 0;
+    }
+
+    *value = negative ? DQN_CAST(Dqn_i64)(0 - magnitude) : DQN_CAST(Dqn_i64)magnitude;
+    return sign + digits;
+}
+
+template <typename T>
+DQN_FILE_SCOPE Dqn_isize Dqn_Str__ParseColumn(char const *buf, Dqn_isize size, char delimiter, T *values, Dqn_isize values_size, Dqn_isize *consumed, Dqn_isize (*parse)(char const *, Dqn_isize, T *))
+{
+    Dqn_isize result = 0;
+    Dqn_isize pos    = 0;
+    while (result < values_size && pos < size)
+    {
+        Dqn_isize entry = pos;
+        while (entry < size && (buf[entry] == ' ' || buf[entry] == '\t'))
+            entry++;
+
+        Dqn_isize digits = parse(buf + entry, size - entry, values + result);
+        if (digits == 0)
+            break;
+
+        entry += digits;
+        while (entry < size && (buf[entry] == ' ' || buf[entry] == '\t' || buf[entry] == '\r'))
+            entry++;
+
+        if (entry < size && buf[entry] != delimiter)
+            break;
+
+        pos = entry + 1;
+        result++;
+    }
+
+    if (consumed)
+        *consumed = DQN_M_MIN(pos, size);
+    return result;
+}
+
+DQN_API Dqn_isize Dqn_Str_ParseU64Column(char const *buf, Dqn_isize size, char delimiter, Dqn_u64 *values, Dqn_isize values_size, Dqn_isize *consumed)
+{
+    Dqn_isize result = Dqn_Str__ParseColumn(buf, size, delimiter, values, values_size, consumed, Dqn_Str_ParseU64);
+    return result;
+}
+
+DQN_API Dqn_isize Dqn_Str_ParseI64Column(char const *buf, Dqn_isize size, char delimiter, Dqn_i64 *values, Dqn_isize values_size, Dqn_isize *consumed)
+{
+    Dqn_isize result = Dqn_Str__ParseColumn(buf, size, delimiter, values, values_size, consumed, Dqn_Str_ParseI64);
+    return result;
+}
+
+// -------------------------------------------------------------------------------------------------
+// NOTE: Dqn_Str_ToF64/Dqn_F64ToStr
+// -------------------------------------------------------------------------------------------------
+// NOTE: 10^exponent for exponent in [DQN_F64__POW10_MIN, DQN_F64__POW10_MAX] as {high, low} 64 bits
+// of the 128 bit value normalised so the top bit is set, rounded down. The parser scales mantissas by
+// it and the formatter derives its 126 bit 10^-k constants from it, g = (value >> 2) + 1.
+#define DQN_F64__POW10_MIN -342
+#define DQN_F64__POW10_MAX 324
+DQN_FILE_SCOPE Dqn_u64 const DQN_F64__POW10[DQN_F64__POW10_MAX - DQN_F64__POW10_MIN + 1][2] =
+{
+    {0xEEF453D6923BD65AULL, 0x113FAA2906A13B3FULL}, {0x9558B4661B6565F8ULL, 0x4AC7CA59A424C507ULL},
+    {0xBAAEE17FA23EBF76ULL, 0x5D79BCF00D2DF649ULL}, {0xE95A99DF8ACE6F53ULL, 0xF4D82C2C107973DCULL},
+    {0x91D8A02BB6C10594ULL, 0x79071B9B8A4BE869ULL}, {0xB64EC836A47146F9ULL, 0x9748E2826CDEE284ULL},
+    {0xE3E27A444D8D98B7ULL, 0xFD1B1B2308169B25ULL}, {0x8E6D8C6AB0787F72ULL, 0xFE30F0F5E50E20F7ULL},
+    {0xB208EF855C969F4FULL, 0xBDBD2D335E51A935ULL}, {0xDE8B2B66B3BC4723ULL, 0xAD2C788035E61382ULL},
+    {0x8B16FB203055AC76ULL, 0x4C3BCB5021AFCC31ULL}, {0xADDCB9E83C6B1793ULL, 0xDF4ABE242A1BBF3DULL},
+    {0xD953E8624B85DD78ULL, 0xD71D6DAD34A2AF0DULL}, {0x87D4713D6F33AA6BULL, 0x8672648C40E5AD68ULL},
+    {0xA9C98D8CCB009506ULL, 0x680EFDAF511F18C2ULL}, {0xD43BF0EFFDC0BA48ULL, 0x0212BD1B2566DEF2ULL},
+    {0x84A57695FE98746DULL, 0x014BB630F7604B57ULL}, {0xA5CED43B7E3E9188ULL, 0x419EA3BD35385E2DULL},
+    {0xCF42894A5DCE35EAULL, 0x52064CAC828675B9ULL}, {0x818995CE7AA0E1B2ULL, 0x7343EFEBD1940993ULL},
+    {0xA1EBFB4219491A1FULL, 0x1014EBE6C5F90BF8ULL}, {0xCA66FA129F9B60A6ULL, 0xD41A26E077774EF6ULL},
+    {0xFD00B897478238D0ULL, 0x8920B098955522B4ULL}, {0x9E20735E8CB16382ULL, 0x55B46E5F5D5535B0ULL},
+    {0xC5A890362FDDBC62ULL, 0xEB2189F734AA831DULL}, {0xF712B443BBD52B7BULL, 0xA5E9EC7501D523E4ULL},
+    {0x9A6BB0AA55653B2DULL, 0x47B233C92125366EULL}, {0xC1069CD4EABE89F8ULL, 0x999EC0BB696E840AULL},
+    {0xF148440A256E2C76ULL, 0xC00670EA43CA250DULL}, {0x96CD2A865764DBCAULL, 0x380406926A5E5728ULL},
+    {0xBC807527ED3E12BCULL, 0xC605083704F5ECF2ULL}, {0xEBA09271E88D976BULL, 0xF7864A44C633682EULL},
+    {0x93445B8731587EA3ULL, 0x7AB3EE6AFBE0211DULL}, {0xB8157268FDAE9E4CULL, 0x5960EA05BAD82964ULL},
+    {0xE61ACF033D1A45DFULL, 0x6FB92487298E33BDULL}, {0x8FD0C16206306BABULL, 0xA5D3B6D479F8E056ULL},
+    {0xB3C4F1BA87BC8696ULL, 0x8F48A4899877186CULL}, {0xE0B62E2929ABA83CULL, 0x331ACDABFE94DE87ULL},
+    {0x8C71DCD9BA0B4925ULL, 0x9FF0C08B7F1D0B14ULL}, {0xAF8E5410288E1B6FULL, 0x07ECF0AE5EE44DD9ULL},
+    {0xDB71E91432B1A24AULL, 0xC9E82CD9F69D6150ULL}, {0x892731AC9FAF056EULL, 0xBE311C083A225CD2ULL},
+    {0xAB70FE17C79AC6CAULL, 0x6DBD630A48AAF406ULL}, {0xD64D3D9DB981787DULL, 0x092CBBCCDAD5B108ULL},
+    {0x85F0468293F0EB4EULL, 0x25BBF56008C58EA5ULL}, {0xA76C582338ED2621ULL, 0xAF2AF2B80AF6F24EULL},
+    {0xD1476E2C07286FAAULL, 0x1AF5AF660DB4AEE1ULL}, {0x82CCA4DB847945CAULL, 0x50D98D9FC890ED4DULL},
+    {0xA37FCE126597973CULL, 0xE50FF107BAB528A0ULL}, {0xCC5FC196FEFD7D0CULL, 0x1E53ED49A96272C8ULL},
+    {0xFF77B1FCBEBCDC4FULL, 0x25E8E89C13BB0F7AULL}, {0x9FAACF3DF73609B1ULL, 0x77B191618C54E9ACULL},
+    {0xC795830D75038C1DULL, 0xD59DF5B9EF6A2417ULL}, {0xF97AE3D0D2446F25ULL, 0x4B0573286B44AD1DULL},
+    {0x9BECCE62836AC577ULL, 0x4EE367F9430AEC32ULL}, {0xC2E801FB244576D5ULL, 0x229C41F793CDA73FULL},
+    {0xF3A20279ED56D48AULL, 0x6B43527578C1110FULL}, {0x9845418C345644D6ULL, 0x830A13896B78AAA9ULL},
+    {0xBE5691EF416BD60CULL, 0x23CC986BC656D553ULL}, {0xEDEC366B11C6CB8FULL, 0x2CBFBE86B7EC8AA8ULL},
+    {0x94B3A202EB1C3F39ULL, 0x7BF7D71432F3D6A9ULL}, {0xB9E08A83A5E34F07ULL, 0xDAF5CCD93FB0CC53ULL},
+    {0xE858AD248F5C22C9ULL, 0xD1B3400F8F9CFF68ULL}, {0x91376C36D99995BEULL, 0x23100809B9C21FA1ULL},
+    {0xB58547448FFFFB2DULL, 0xABD40A0C2832A78AULL}, {0xE2E69915B3FFF9F9ULL, 0x16C90C8F323F516CULL},
+    {0x8DD01FAD907FFC3BULL, 0xAE3DA7D97F6792E3ULL}, {0xB1442798F49FFB4AULL, 0x99CD11CFDF41779CULL},
+    {0xDD95317F31C7FA1DULL, 0x40405643D711D583ULL}, {0x8A7D3EEF7F1CFC52ULL, 0x482835EA666B2572ULL},
+    {0xAD1C8EAB5EE43B66ULL, 0xDA3243650005EECFULL}, {0xD863B256369D4A40ULL, 0x90BED43E40076A82ULL},
+    {0x873E4F75E2224E68ULL, 0x5A7744A6E804A291ULL}, {0xA90DE3535AAAE202ULL, 0x711515D0A205CB36ULL},
+    {0xD3515C2831559A83ULL, 0x0D5A5B44CA873E03ULL}, {0x8412D9991ED58091ULL, 0xE858790AFE9486C2ULL},
+    {0xA5178FFF668AE0B6ULL, 0x626E974DBE39A872ULL}, {0xCE5D73FF402D98E3ULL, 0xFB0A3D212DC8128FULL},
+    {0x80FA687F881C7F8EULL, 0x7CE66634BC9D0B99ULL}, {0xA139029F6A239F72ULL, 0x1C1FFFC1EBC44E80ULL},
+    {0xC987434744AC874EULL, 0xA327FFB266B56220ULL}, {0xFBE9141915D7A922ULL, 0x4BF1FF9F0062BAA8ULL},
+    {0x9D71AC8FADA6C9B5ULL, 0x6F773FC3603DB4A9ULL}, {0xC4CE17B399107C22ULL, 0xCB550FB4384D21D3ULL},
+    {0xF6019DA07F549B2BULL, 0x7E2A53A146606A48ULL}, {0x99C102844F94E0FBULL, 0x2EDA7444CBFC426DULL},
+    {0xC0314325637A1939ULL, 0xFA911155FEFB5308ULL}, {0xF03D93EEBC589F88ULL, 0x793555AB7EBA27CAULL},
+    {0x96267C7535B763B5ULL, 0x4BC1558B2F3458DEULL}, {0xBBB01B9283253CA2ULL, 0x9EB1AAEDFB016F16ULL},
+    {0xEA9C227723EE8BCBULL, 0x465E15A979C1CADCULL}, {0x92A1958A7675175FULL, 0x0BFACD89EC191EC9ULL},
+    {0xB749FAED14125D36ULL, 0xCEF980EC671F667BULL}, {0xE51C79A85916F484ULL, 0x82B7E12780E7401AULL},
+    {0x8F31CC0937AE58D2ULL, 0xD1B2ECB8B0908810ULL}, {0xB2FE3F0B8599EF07ULL, 0x861FA7E6DCB4AA15ULL},
+    {0xDFBDCECE67006AC9ULL, 0x67A791E093E1D49AULL}, {0x8BD6A141006042BDULL, 0xE0C8BB2C5C6D24E0ULL},
+    {0xAECC49914078536DULL, 0x58FAE9F773886E18ULL}, {0xDA7F5BF590966848ULL, 0xAF39A475506A899EULL},
+    {0x888F99797A5E012DULL, 0x6D8406C952429603ULL}, {0xAAB37FD7D8F58178ULL, 0xC8E5087BA6D33B83ULL},
+    {0xD5605FCDCF32E1D6ULL, 0xFB1E4A9A90880A64ULL}, {0x855C3BE0A17FCD26ULL, 0x5CF2EEA09A55067FULL},
+    {0xA6B34AD8C9DFC06FULL, 0xF42FAA48C0EA481EULL}, {0xD0601D8EFC57B08BULL, 0xF13B94DAF124DA26ULL},
+    {0x823C12795DB6CE57ULL, 0x76C53D08D6B70858ULL}, {0xA2CB1717B52481EDULL, 0x54768C4B0C64CA6EULL},
+    {0xCB7DDCDDA26DA268ULL, 0xA9942F5DCF7DFD09ULL}, {0xFE5D54150B090B02ULL, 0xD3F93B35435D7C4CULL},
+    {0x9EFA548D26E5A6E1ULL, 0xC47BC5014A1A6DAFULL}, {0xC6B8E9B0709F109AULL, 0x359AB6419CA1091BULL},
+    {0xF867241C8CC6D4C0ULL, 0xC30163D203C94B62ULL}, {0x9B407691D7FC44F8ULL, 0x79E0DE63425DCF1DULL},
+    {0xC21094364DFB5636ULL, 0x985915FC12F542E4ULL}, {0xF294B943E17A2BC4ULL, 0x3E6F5B7B17B2939DULL},
+    {0x979CF3CA6CEC5B5AULL, 0xA705992CEECF9C42ULL}, {0xBD8430BD08277231ULL, 0x50C6FF782A838353ULL},
+    {0xECE53CEC4A314EBDULL, 0xA4F8BF5635246428ULL}, {0x940F4613AE5ED136ULL, 0x871B7795E136BE99ULL},
+    {0xB913179899F68584ULL, 0x28E2557B59846E3FULL}, {0xE757DD7EC07426E5ULL, 0x331AEADA2FE589CFULL},
+    {0x9096EA6F3848984FULL, 0x3FF0D2C85DEF7621ULL}, {0xB4BCA50B065ABE63ULL, 0x0FED077A756B53A9ULL},
+    {0xE1EBCE4DC7F16DFBULL, 0xD3E8495912C62894ULL}, {0x8D3360F09CF6E4BDULL, 0x64712DD7ABBBD95CULL},
+    {0xB080392CC4349DECULL, 0xBD8D794D96AACFB3ULL}, {0xDCA04777F541C567ULL, 0xECF0D7A0FC5583A0ULL},
+    {0x89E42CAAF9491B60ULL, 0xF41686C49DB57244ULL}, {0xAC5D37D5B79B6239ULL, 0x311C2875C522CED5ULL},
+    {0xD77485CB25823AC7ULL, 0x7D633293366B828BULL}, {0x86A8D39EF77164BCULL, 0xAE5DFF9C02033197ULL},
+    {0xA8530886B54DBDEBULL, 0xD9F57F830283FDFCULL}, {0xD267CAA862A12D66ULL, 0xD072DF63C324FD7BULL},
+    {0x8380DEA93DA4BC60ULL, 0x4247CB9E59F71E6DULL}, {0xA46116538D0DEB78ULL, 0x52D9BE85F074E608ULL},
+    {0xCD795BE870516656ULL, 0x67902E276C921F8BULL}, {0x806BD9714632DFF6ULL, 0x00BA1CD8A3DB53B6ULL},
+    {0xA086CFCD97BF97F3ULL, 0x80E8A40ECCD228A4ULL}, {0xC8A883C0FDAF7DF0ULL, 0x6122CD128006B2CDULL},
+    {0xFAD2A4B13D1B5D6CULL, 0x796B805720085F81ULL}, {0x9CC3A6EEC6311A63ULL, 0xCBE3303674053BB0ULL},
+    {0xC3F490AA77BD60FCULL, 0xBEDBFC4411068A9CULL}, {0xF4F1B4D515ACB93BULL, 0xEE92FB5515482D44ULL},
+    {0x991711052D8BF3C5ULL, 0x751BDD152D4D1C4AULL}, {0xBF5CD54678EEF0B6ULL, 0xD262D45A78A0635DULL},
+    {0xEF340A98172AACE4ULL, 0x86FB897116C87C34ULL}, {0x9580869F0E7AAC0EULL, 0xD45D35E6AE3D4DA0ULL},
+    {0xBAE0A846D2195712ULL, 0x8974836059CCA109ULL}, {0xE998D258869FACD7ULL, 0x2BD1A438703FC94BULL},
+    {0x91FF83775423CC06ULL, 0x7B6306A34627DDCFULL}, {0xB67F6455292CBF08ULL, 0x1A3BC84C17B1D542ULL},
+    {0xE41F3D6A7377EECAULL, 0x20CABA5F1D9E4A93ULL}, {0x8E938662882AF53EULL, 0x547EB47B7282EE9CULL},
+    {0xB23867FB2A35B28DULL, 0xE99E619A4F23AA43ULL}, {0xDEC681F9F4C31F31ULL, 0x6405FA00E2EC94D4ULL},
+    {0x8B3C113C38F9F37EULL, 0xDE83BC408DD3DD04ULL}, {0xAE0B158B4738705EULL, 0x9624AB50B148D445ULL},
+    {0xD98DDAEE19068C76ULL, 0x3BADD624DD9B0957ULL}, {0x87F8A8D4CFA417C9ULL, 0xE54CA5D70A80E5D6ULL},
+    {0xA9F6D30A038D1DBCULL, 0x5E9FCF4CCD211F4CULL}, {0xD47487CC8470652BULL, 0x7647C3200069671FULL},
+    {0x84C8D4DFD2C63F3BULL, 0x29ECD9F40041E073ULL}, {0xA5FB0A17C777CF09ULL, 0xF468107100525890ULL},
+    {0xCF79CC9DB955C2CCULL, 0x7182148D4066EEB4ULL}, {0x81AC1FE293D599BFULL, 0xC6F14CD848405530ULL},
+    {0xA21727DB38CB002FULL, 0xB8ADA00E5A506A7CULL}, {0xCA9CF1D206FDC03BULL, 0xA6D90811F0E4851CULL},
+    {0xFD442E4688BD304AULL, 0x908F4A166D1DA663ULL}, {0x9E4A9CEC15763E2EULL, 0x9A598E4E043287FEULL},
+    {0xC5DD44271AD3CDBAULL, 0x40EFF1E1853F29FDULL}, {0xF7549530E188C128ULL, 0xD12BEE59E68EF47CULL},
+    {0x9A94DD3E8CF578B9ULL, 0x82BB74F8301958CEULL}, {0xC13A148E3032D6E7ULL, 0xE36A52363C1FAF01ULL},
+    {0xF18899B1BC3F8CA1ULL, 0xDC44E6C3CB279AC1ULL}, {0x96F5600F15A7B7E5ULL, 0x29AB103A5EF8C0B9ULL},
+    {0xBCB2B812DB11A5DEULL, 0x7415D448F6B6F0E7ULL}, {0xEBDF661791D60F56ULL, 0x111B495B3464AD21ULL},
+    {0x936B9FCEBB25C995ULL, 0xCAB10DD900BEEC34ULL}, {0xB84687C269EF3BFBULL, 0x3D5D514F40EEA742ULL},
+    {0xE65829B3046B0AFAULL, 0x0CB4A5A3112A5112ULL}, {0x8FF71A0FE2C2E6DCULL, 0x47F0E785EABA72ABULL},
+    {0xB3F4E093DB73A093ULL, 0x59ED216765690F56ULL}, {0xE0F218B8D25088B8ULL, 0x306869C13EC3532CULL},
+    {0x8C974F7383725573ULL, 0x1E414218C73A13FBULL}, {0xAFBD2350644EEACFULL, 0xE5D1929EF90898FAULL},
+    {0xDBAC6C247D62A583ULL, 0xDF45F746B74ABF39ULL}, {0x894BC396CE5DA772ULL, 0x6B8BBA8C328EB783ULL},
+    {0xAB9EB47C81F5114FULL, 0x066EA92F3F326564ULL}, {0xD686619BA27255A2ULL, 0xC80A537B0EFEFEBDULL},
+    {0x8613FD0145877585ULL, 0xBD06742CE95F5F36ULL}, {0xA798FC4196E952E7ULL, 0x2C48113823B73704ULL},
+    {0xD17F3B51FCA3A7A0ULL, 0xF75A15862CA504C5ULL}, {0x82EF85133DE648C4ULL, 0x9A984D73DBE722FBULL},
+    {0xA3AB66580D5FDAF5ULL, 0xC13E60D0D2E0EBBAULL}, {0xCC963FEE10B7D1B3ULL, 0x318DF905079926A8ULL},
+    {0xFFBBCFE994E5C61FULL, 0xFDF17746497F7052ULL}, {0x9FD561F1FD0F9BD3ULL, 0xFEB6EA8BEDEFA633ULL},
+    {0xC7CABA6E7C5382C8ULL, 0xFE64A52EE96B8FC0ULL}, {0xF9BD690A1B68637BULL, 0x3DFDCE7AA3C673B0ULL},
+    {0x9C1661A651213E2DULL, 0x06BEA10CA65C084EULL}, {0xC31BFA0FE5698DB8ULL, 0x486E494FCFF30A62ULL},
+    {0xF3E2F893DEC3F126ULL, 0x5A89DBA3C3EFCCFAULL}, {0x986DDB5C6B3A76B7ULL, 0xF89629465A75E01CULL},
+    {0xBE89523386091465ULL, 0xF6BBB397F1135823ULL}, {0xEE2BA6C0678B597FULL, 0x746AA07DED582E2CULL},
+    {0x94DB483840B717EFULL, 0xA8C2A44EB4571CDCULL}, {0xBA121A4650E4DDEBULL, 0x92F34D62616CE413ULL},
+    {0xE896A0D7E51E1566ULL, 0x77B020BAF9C81D17ULL}, {0x915E2486EF32CD60ULL, 0x0ACE1474DC1D122EULL},
+    {0xB5B5ADA8AAFF80B8ULL, 0x0D819992132456BAULL}, {0xE3231912D5BF60E6ULL, 0x10E1FFF697ED6C69ULL},
+    {0x8DF5EFABC5979C8FULL, 0xCA8D3FFA1EF463C1ULL}, {0xB1736B96B6FD83B3ULL, 0xBD308FF8A6B17CB2ULL},
+    {0xDDD0467C64BCE4A0ULL, 0xAC7CB3F6D05DDBDEULL}, {0x8AA22C0DBEF60EE4ULL, 0x6BCDF07A423AA96BULL},
+    {0xAD4AB7112EB3929DULL, 0x86C16C98D2C953C6ULL}, {0xD89D64D57A607744ULL, 0xE871C7BF077BA8B7ULL},
+    {0x87625F056C7C4A8BULL, 0x11471CD764AD4972ULL}, {0xA93AF6C6C79B5D2DULL, 0xD598E40D3DD89BCFULL},
+    {0xD389B47879823479ULL, 0x4AFF1D108D4EC2C3ULL}, {0x843610CB4BF160CBULL, 0xCEDF722A585139BAULL},
+    {0xA54394FE1EEDB8FEULL, 0xC2974EB4EE658828ULL}, {0xCE947A3DA6A9273EULL, 0x733D226229FEEA32ULL},
+    {0x811CCC668829B887ULL, 0x0806357D5A3F525FULL}, {0xA163FF802A3426A8ULL, 0xCA07C2DCB0CF26F7ULL},
+    {0xC9BCFF6034C13052ULL, 0xFC89B393DD02F0B5ULL}, {0xFC2C3F3841F17C67ULL, 0xBBAC2078D443ACE2ULL},
+    {0x9D9BA7832936EDC0ULL, 0xD54B944B84AA4C0DULL}, {0xC5029163F384A931ULL, 0x0A9E795E65D4DF11ULL},
+    {0xF64335BCF065D37DULL, 0x4D4617B5FF4A16D5ULL}, {0x99EA0196163FA42EULL, 0x504BCED1BF8E4E45ULL},
+    {0xC06481FB9BCF8D39ULL, 0xE45EC2862F71E1D6ULL}, {0xF07DA27A82C37088ULL, 0x5D767327BB4E5A4CULL},
+    {0x964E858C91BA2655ULL, 0x3A6A07F8D510F86FULL}, {0xBBE226EFB628AFEAULL, 0x890489F70A55368BULL},
+    {0xEADAB0ABA3B2DBE5ULL, 0x2B45AC74CCEA842EULL}, {0x92C8AE6B464FC96FULL, 0x3B0B8BC90012929DULL},
+    {0xB77ADA0617E3BBCBULL, 0x09CE6EBB40173744ULL}, {0xE55990879DDCAABDULL, 0xCC420A6A101D0515ULL},
+    {0x8F57FA54C2A9EAB6ULL, 0x9FA946824A12232DULL}, {0xB32DF8E9F3546564ULL, 0x47939822DC96ABF9ULL},
+    {0xDFF9772470297EBDULL, 0x59787E2B93BC56F7ULL}, {0x8BFBEA76C619EF36ULL, 0x57EB4EDB3C55B65AULL},
+    {0xAEFAE51477A06B03ULL, 0xEDE622920B6B23F1ULL}, {0xDAB99E59958885C4ULL, 0xE95FAB368E45ECEDULL},
+    {0x88B402F7FD75539BULL, 0x11DBCB0218EBB414ULL}, {0xAAE103B5FCD2A881ULL, 0xD652BDC29F26A119ULL},
+    {0xD59944A37C0752A2ULL, 0x4BE76D3346F0495FULL}, {0x857FCAE62D8493A5ULL, 0x6F70A4400C562DDBULL},
+    {0xA6DFBD9FB8E5B88EULL, 0xCB4CCD500F6BB952ULL}, {0xD097AD07A71F26B2ULL, 0x7E2000A41346A7A7ULL},
+    {0x825ECC24C873782FULL, 0x8ED400668C0C28C8ULL}, {0xA2F67F2DFA90563BULL, 0x728900802F0F32FAULL},
+    {0xCBB41EF979346BCAULL, 0x4F2B40A03AD2FFB9ULL}, {0xFEA126B7D78186BCULL, 0xE2F610C84987BFA8ULL},
+    {0x9F24B832E6B0F436ULL, 0x0DD9CA7D2DF4D7C9ULL}, {0xC6EDE63FA05D3143ULL, 0x91503D1C79720DBBULL},
+    {0xF8A95FCF88747D94ULL, 0x75A44C6397CE912AULL}, {0x9B69DBE1B548CE7CULL, 0xC986AFBE3EE11ABAULL},
+    {0xC24452DA229B021BULL, 0xFBE85BADCE996168ULL}, {0xF2D56790AB41C2A2ULL, 0xFAE27299423FB9C3ULL},
+    {0x97C560BA6B0919A5ULL, 0xDCCD879FC967D41AULL}, {0xBDB6B8E905CB600FULL, 0x5400E987BBC1C920ULL},
+    {0xED246723473E3813ULL, 0x290123E9AAB23B68ULL}, {0x9436C0760C86E30BULL, 0xF9A0B6720AAF6521ULL},
+    {0xB94470938FA89BCEULL, 0xF808E40E8D5B3E69ULL}, {0xE7958CB87392C2C2ULL, 0xB60B1D1230B20E04ULL},
+    {0x90BD77F3483BB9B9ULL, 0xB1C6F22B5E6F48C2ULL}, {0xB4ECD5F01A4AA828ULL, 0x1E38AEB6360B1AF3ULL},
+    {0xE2280B6C20DD5232ULL, 0x25C6DA63C38DE1B0ULL}, {0x8D590723948A535FULL, 0x579C487E5A38AD0EULL},
+    {0xB0AF48EC79ACE837ULL, 0x2D835A9DF0C6D851ULL}, {0xDCDB1B2798182244ULL, 0xF8E431456CF88E65ULL},
+    {0x8A08F0F8BF0F156BULL, 0x1B8E9ECB641B58FFULL}, {0xAC8B2D36EED2DAC5ULL, 0xE272467E3D222F3FULL},
+    {0xD7ADF884AA879177ULL, 0x5B0ED81DCC6ABB0FULL}, {0x86CCBB52EA94BAEAULL, 0x98E947129FC2B4E9ULL},
+    {0xA87FEA27A539E9A5ULL, 0x3F2398D747B36224ULL}, {0xD29FE4B18E88640EULL, 0x8EEC7F0D19A03AADULL},
+    {0x83A3EEEEF9153E89ULL, 0x1953CF68300424ACULL}, {0xA48CEAAAB75A8E2BULL, 0x5FA8C3423C052DD7ULL},
+    {0xCDB02555653131B6ULL, 0x3792F412CB06794DULL}, {0x808E17555F3EBF11ULL, 0xE2BBD88BBEE40BD0ULL},
+    {0xA0B19D2AB70E6ED6ULL, 0x5B6ACEAEAE9D0EC4ULL}, {0xC8DE047564D20A8BULL, 0xF245825A5A445275ULL},
+    {0xFB158592BE068D2EULL, 0xEED6E2F0F0D56712ULL}, {0x9CED737BB6C4183DULL, 0x55464DD69685606BULL},
+    {0xC428D05AA4751E4CULL, 0xAA97E14C3C26B886ULL}, {0xF53304714D9265DFULL, 0xD53DD99F4B3066A8ULL},
+    {0x993FE2C6D07B7FABULL, 0xE546A8038EFE4029ULL}, {0xBF8FDB78849A5F96ULL, 0xDE98520472BDD033ULL},
+    {0xEF73D256A5C0F77CULL, 0x963E66858F6D4440ULL}, {0x95A8637627989AADULL, 0xDDE7001379A44AA8ULL},
+    {0xBB127C53B17EC159ULL, 0x5560C018580D5D52ULL}, {0xE9D71B689DDE71AFULL, 0xAAB8F01E6E10B4A6ULL},
+    {0x9226712162AB070DULL, 0xCAB3961304CA70E8ULL}, {0xB6B00D69BB55C8D1ULL, 0x3D607B97C5FD0D22ULL},
+    {0xE45C10C42A2B3B05ULL, 0x8CB89A7DB77C506AULL}, {0x8EB98A7A9A5B04E3ULL, 0x77F3608E92ADB242ULL},
+    {0xB267ED1940F1C61CULL, 0x55F038B237591ED3ULL}, {0xDF01E85F912E37A3ULL, 0x6B6C46DEC52F6688ULL},
+    {0x8B61313BBABCE2C6ULL, 0x2323AC4B3B3DA015ULL}, {0xAE397D8AA96C1B77ULL, 0xABEC975E0A0D081AULL},
+    {0xD9C7DCED53C72255ULL, 0x96E7BD358C904A21ULL}, {0x881CEA14545C7575ULL, 0x7E50D64177DA2E54ULL},
+    {0xAA242499697392D2ULL, 0xDDE50BD1D5D0B9E9ULL}, {0xD4AD2DBFC3D07787ULL, 0x955E4EC64B44E864ULL},
+    {0x84EC3C97DA624AB4ULL, 0xBD5AF13BEF0B113EULL}, {0xA6274BBDD0FADD61ULL, 0xECB1AD8AEACDD58EULL},
+    {0xCFB11EAD453994BAULL, 0x67DE18EDA5814AF2ULL}, {0x81CEB32C4B43FCF4ULL, 0x80EACF948770CED7ULL},
+    {0xA2425FF75E14FC31ULL, 0xA1258379A94D028DULL}, {0xCAD2F7F5359A3B3EULL, 0x096EE45813A04330ULL},
+    {0xFD87B5F28300CA0DULL, 0x8BCA9D6E188853FCULL}, {0x9E74D1B791E07E48ULL, 0x775EA264CF55347DULL},
+    {0xC612062576589DDAULL, 0x95364AFE032A819DULL}, {0xF79687AED3EEC551ULL, 0x3A83DDBD83F52204ULL},
+    {0x9ABE14CD44753B52ULL, 0xC4926A9672793542ULL}, {0xC16D9A0095928A27ULL, 0x75B7053C0F178293ULL},
+    {0xF1C90080BAF72CB1ULL, 0x5324C68B12DD6338ULL}, {0x971DA05074DA7BEEULL, 0xD3F6FC16EBCA5E03ULL},
+    {0xBCE5086492111AEAULL, 0x88F4BB1CA6BCF584ULL}, {0xEC1E4A7DB69561A5ULL, 0x2B31E9E3D06C32E5ULL},
+    {0x9392EE8E921D5D07ULL, 0x3AFF322E62439FCFULL}, {0xB877AA3236A4B449ULL, 0x09BEFEB9FAD487C2ULL},
+    {0xE69594BEC44DE15BULL, 0x4C2EBE687989A9B3ULL}, {0x901D7CF73AB0ACD9ULL, 0x0F9D37014BF60A10ULL},
+    {0xB424DC35095CD80FULL, 0x538484C19EF38C94ULL}, {0xE12E13424BB40E13ULL, 0x2865A5F206B06FB9ULL},
+    {0x8CBCCC096F5088CBULL, 0xF93F87B7442E45D3ULL}, {0xAFEBFF0BCB24AAFEULL, 0xF78F69A51539D748ULL},
+    {0xDBE6FECEBDEDD5BEULL, 0xB573440E5A884D1BULL}, {0x89705F4136B4A597ULL, 0x31680A88F8953030ULL},
+    {0xABCC77118461CEFCULL, 0xFDC20D2B36BA7C3DULL}, {0xD6BF94D5E57A42BCULL, 0x3D32907604691B4CULL},
+    {0x8637BD05AF6C69B5ULL, 0xA63F9A49C2C1B10FULL}, {0xA7C5AC471B478423ULL, 0x0FCF80DC33721D53ULL},
+    {0xD1B71758E219652BULL, 0xD3C36113404EA4A8ULL}, {0x83126E978D4FDF3BULL, 0x645A1CAC083126E9ULL},
+    {0xA3D70A3D70A3D70AULL, 0x3D70A3D70A3D70A3ULL}, {0xCCCCCCCCCCCCCCCCULL, 0xCCCCCCCCCCCCCCCCULL},
+    {0x8000000000000000ULL, 0x0000000000000000ULL}, {0xA000000000000000ULL, 0x0000000000000000ULL},
+    {0xC800000000000000ULL, 0x0000000000000000ULL}, {0xFA00000000000000ULL, 0x0000000000000000ULL},
+    {0x9C40000000000000ULL, 0x0000000000000000ULL}, {0xC350000000000000ULL, 0x0000000000000000ULL},
+    {0xF424000000000000ULL, 0x0000000000000000ULL}, {0x9896800000000000ULL, 0x0000000000000000ULL},
+    {0xBEBC200000000000ULL, 0x0000000000000000ULL}, {0xEE6B280000000000ULL, 0x0000000000000000ULL},
+    {0x9502F90000000000ULL, 0x0000000000000000ULL}, {0xBA43B74000000000ULL, 0x0000000000000000ULL},
+    {0xE8D4A51000000000ULL, 0x0000000000000000ULL}, {0x9184E72A00000000ULL, 0x0000000000000000ULL},
+    {0xB5E620F480000000ULL, 0x0000000000000000ULL}, {0xE35FA931A0000000ULL, 0x0000000000000000ULL},
+    {0x8E1BC9BF04000000ULL, 0x0000000000000000ULL}, {0xB1A2BC2EC5000000ULL, 0x0000000000000000ULL},
+    {0xDE0B6B3A76400000ULL, 0x0000000000000000ULL}, {0x8AC7230489E80000ULL, 0x0000000000000000ULL},
+    {0xAD78EBC5AC620000ULL, 0x0000000000000000ULL}, {0xD8D726B7177A8000ULL, 0x0000000000000000ULL},
+    {0x878678326EAC9000ULL, 0x0000000000000000ULL}, {0xA968163F0A57B400ULL, 0x0000000000000000ULL},
+    {0xD3C21BCECCEDA100ULL, 0x0000000000000000ULL}, {0x84595161401484A0ULL, 0x0000000000000000ULL},
+    {0xA56FA5B99019A5C8ULL, 0x0000000000000000ULL}, {0xCECB8F27F4200F3AULL, 0x0000000000000000ULL},
+    {0x813F3978F8940984ULL, 0x4000000000000000ULL}, {0xA18F07D736B90BE5ULL, 0x5000000000000000ULL},
+    {0xC9F2C9CD04674EDEULL, 0xA400000000000000ULL}, {0xFC6F7C4045812296ULL, 0x4D00000000000000ULL},
+    {0x9DC5ADA82B70B59DULL, 0xF020000000000000ULL}, {0xC5371912364CE305ULL, 0x6C28000000000000ULL},
+    {0xF684DF56C3E01BC6ULL, 0xC732000000000000ULL}, {0x9A130B963A6C115CULL, 0x3C7F400000000000ULL},
+    {0xC097CE7BC90715B3ULL, 0x4B9F100000000000ULL}, {0xF0BDC21ABB48DB20ULL, 0x1E86D40000000000ULL},
+    {0x96769950B50D88F4ULL, 0x1314448000000000ULL}, {0xBC143FA4E250EB31ULL, 0x17D955A000000000ULL},
+    {0xEB194F8E1AE525FDULL, 0x5DCFAB0800000000ULL}, {0x92EFD1B8D0CF37BEULL, 0x5AA1CAE500000000ULL},
+    {0xB7ABC627050305ADULL, 0xF14A3D9E40000000ULL}, {0xE596B7B0C643C719ULL, 0x6D9CCD05D0000000ULL},
+    {0x8F7E32CE7BEA5C6FULL, 0xE4820023A2000000ULL}, {0xB35DBF821AE4F38BULL, 0xDDA2802C8A800000ULL},
+    {0xE0352F62A19E306EULL, 0xD50B2037AD200000ULL}, {0x8C213D9DA502DE45ULL, 0x4526F422CC340000ULL},
+    {0xAF298D050E4395D6ULL, 0x9670B12B7F410000ULL}, {0xDAF3F04651D47B4CULL, 0x3C0CDD765F114000ULL},
+    {0x88D8762BF324CD0FULL, 0xA5880A69FB6AC800ULL}, {0xAB0E93B6EFEE0053ULL, 0x8EEA0D047A457A00ULL},
+    {0xD5D238A4ABE98068ULL, 0x72A4904598D6D880ULL}, {0x85A36366EB71F041ULL, 0x47A6DA2B7F864750ULL},
+    {0xA70C3C40A64E6C51ULL, 0x999090B65F67D924ULL}, {0xD0CF4B50CFE20765ULL, 0xFFF4B4E3F741CF6DULL},
+    {0x82818F1281ED449FULL, 0xBFF8F10E7A8921A4ULL}, {0xA321F2D7226895C7ULL, 0xAFF72D52192B6A0DULL},
+    {0xCBEA6F8CEB02BB39ULL, 0x9BF4F8A69F764490ULL}, {0xFEE50B7025C36A08ULL, 0x02F236D04753D5B4ULL},
+    {0x9F4F2726179A2245ULL, 0x01D762422C946590ULL}, {0xC722F0EF9D80AAD6ULL, 0x424D3AD2B7B97EF5ULL},
+    {0xF8EBAD2B84E0D58BULL, 0xD2E0898765A7DEB2ULL}, {0x9B934C3B330C8577ULL, 0x63CC55F49F88EB2FULL},
+    {0xC2781F49FFCFA6D5ULL, 0x3CBF6B71C76B25FBULL}, {0xF316271C7FC3908AULL, 0x8BEF464E3945EF7AULL},
+    {0x97EDD871CFDA3A56ULL, 0x97758BF0E3CBB5ACULL}, {0xBDE94E8E43D0C8ECULL, 0x3D52EEED1CBEA317ULL},
+    {0xED63A231D4C4FB27ULL, 0x4CA7AAA863EE4BDDULL}, {0x945E455F24FB1CF8ULL, 0x8FE8CAA93E74EF6AULL},
+    {0xB975D6B6EE39E436ULL, 0xB3E2FD538E122B44ULL}, {0xE7D34C64A9C85D44ULL, 0x60DBBCA87196B616ULL},
+    {0x90E40FBEEA1D3A4AULL, 0xBC8955E946FE31CDULL}, {0xB51D13AEA4A488DDULL, 0x6BABAB6398BDBE41ULL},
+    {0xE264589A4DCDAB14ULL, 0xC696963C7EED2DD1ULL}, {0x8D7EB76070A08AECULL, 0xFC1E1DE5CF543CA2ULL},
+    {0xB0DE65388CC8ADA8ULL, 0x3B25A55F43294BCBULL}, {0xDD15FE86AFFAD912ULL, 0x49EF0EB713F39EBEULL},
+    {0x8A2DBF142DFCC7ABULL, 0x6E3569326C784337ULL}, {0xACB92ED9397BF996ULL, 0x49C2C37F07965404ULL},
+    {0xD7E77A8F87DAF7FBULL, 0xDC33745EC97BE906ULL}, {0x86F0AC99B4E8DAFDULL, 0x69A028BB3DED71A3ULL},
+    {0xA8ACD7C0222311BCULL, 0xC40832EA0D68CE0CULL}, {0xD2D80DB02AABD62BULL, 0xF50A3FA490C30190ULL},
+    {0x83C7088E1AAB65DBULL, 0x792667C6DA79E0FAULL}, {0xA4B8CAB1A1563F52ULL, 0x577001B891185938ULL},
+    {0xCDE6FD5E09ABCF26ULL, 0xED4C0226B55E6F86ULL}, {0x80B05E5AC60B6178ULL, 0x544F8158315B05B4ULL},
+    {0xA0DC75F1778E39D6ULL, 0x696361AE3DB1C721ULL}, {0xC913936DD571C84CULL, 0x03BC3A19CD1E38E9ULL},
+    {0xFB5878494ACE3A5FULL, 0x04AB48A04065C723ULL}, {0x9D174B2DCEC0E47BULL, 0x62EB0D64283F9C76ULL},
+    {0xC45D1DF942711D9AULL, 0x3BA5D0BD324F8394ULL}, {0xF5746577930D6500ULL, 0xCA8F44EC7EE36479ULL},
+    {0x9968BF6ABBE85F20ULL, 0x7E998B13CF4E1ECBULL}, {0xBFC2EF456AE276E8ULL, 0x9E3FEDD8C321A67EULL},
+    {0xEFB3AB16C59B14A2ULL, 0xC5CFE94EF3EA101EULL}, {0x95D04AEE3B80ECE5ULL, 0xBBA1F1D158724A12ULL},
+    {0xBB445DA9CA61281FULL, 0x2A8A6E45AE8EDC97ULL}, {0xEA1575143CF97226ULL, 0xF52D09D71A3293BDULL},
+    {0x924D692CA61BE758ULL, 0x593C2626705F9C56ULL}, {0xB6E0C377CFA2E12EULL, 0x6F8B2FB00C77836CULL},
+    {0xE498F455C38B997AULL, 0x0B6DFB9C0F956447ULL}, {0x8EDF98B59A373FECULL, 0x4724BD4189BD5EACULL},
+    {0xB2977EE300C50FE7ULL, 0x58EDEC91EC2CB657ULL}, {0xDF3D5E9BC0F653E1ULL, 0x2F2967B66737E3EDULL},
+    {0x8B865B215899F46CULL, 0xBD79E0D20082EE74ULL}, {0xAE67F1E9AEC07187ULL, 0xECD8590680A3AA11ULL},
+    {0xDA01EE641A708DE9ULL, 0xE80E6F4820CC9495ULL}, {0x884134FE908658B2ULL, 0x3109058D147FDCDDULL},
+    {0xAA51823E34A7EEDEULL, 0xBD4B46F0599FD415ULL}, {0xD4E5E2CDC1D1EA96ULL, 0x6C9E18AC7007C91AULL},
+    {0x850FADC09923329EULL, 0x03E2CF6BC604DDB0ULL}, {0xA6539930BF6BFF45ULL, 0x84DB8346B786151CULL},
+    {0xCFE87F7CEF46FF16ULL, 0xE612641865679A63ULL}, {0x81F14FAE158C5F6EULL, 0x4FCB7E8F3F60C07EULL},
+    {0xA26DA3999AEF7749ULL, 0xE3BE5E330F38F09DULL}, {0xCB090C8001AB551CULL, 0x5CADF5BFD3072CC5ULL},
+    {0xFDCB4FA002162A63ULL, 0x73D9732FC7C8F7F6ULL}, {0x9E9F11C4014DDA7EULL, 0x2867E7FDDCDD9AFAULL},
+    {0xC646D63501A1511DULL, 0xB281E1FD541501B8ULL}, {0xF7D88BC24209A565ULL, 0x1F225A7CA91A4226ULL},
+    {0x9AE757596946075FULL, 0x3375788DE9B06958ULL}, {0xC1A12D2FC3978937ULL, 0x0052D6B1641C83AEULL},
+    {0xF209787BB47D6B84ULL, 0xC0678C5DBD23A49AULL}, {0x9745EB4D50CE6332ULL, 0xF840B7BA963646E0ULL},
+    {0xBD176620A501FBFFULL, 0xB650E5A93BC3D898ULL}, {0xEC5D3FA8CE427AFFULL, 0xA3E51F138AB4CEBEULL},
+    {0x93BA47C980E98CDFULL, 0xC66F336C36B10137ULL}, {0xB8A8D9BBE123F017ULL, 0xB80B0047445D4184ULL},
+    {0xE6D3102AD96CEC1DULL, 0xA60DC059157491E5ULL}, {0x9043EA1AC7E41392ULL, 0x87C89837AD68DB2FULL},
+    {0xB454E4A179DD1877ULL, 0x29BABE4598C311FBULL}, {0xE16A1DC9D8545E94ULL, 0xF4296DD6FEF3D67AULL},
+    {0x8CE2529E2734BB1DULL, 0x1899E4A65F58660CULL}, {0xB01AE745B101E9E4ULL, 0x5EC05DCFF72E7F8FULL},
+    {0xDC21A1171D42645DULL, 0x76707543F4FA1F73ULL}, {0x899504AE72497EBAULL, 0x6A06494A791C53A8ULL},
+    {0xABFA45DA0EDBDE69ULL, 0x0487DB9D17636892ULL}, {0xD6F8D7509292D603ULL, 0x45A9D2845D3C42B6ULL},
+    {0x865B86925B9BC5C2ULL, 0x0B8A2392BA45A9B2ULL}, {0xA7F26836F282B732ULL, 0x8E6CAC7768D7141EULL},
+    {0xD1EF0244AF2364FFULL, 0x3207D795430CD926ULL}, {0x8335616AED761F1FULL, 0x7F44E6BD49E807B8ULL},
+    {0xA402B9C5A8D3A6E7ULL, 0x5F16206C9C6209A6ULL}, {0xCD036837130890A1ULL, 0x36DBA887C37A8C0FULL},
+    {0x802221226BE55A64ULL, 0xC2494954DA2C9789ULL}, {0xA02AA96B06DEB0FDULL, 0xF2DB9BAA10B7BD6CULL},
+    {0xC83553C5C8965D3DULL, 0x6F92829494E5ACC7ULL}, {0xFA42A8B73ABBF48CULL, 0xCB772339BA1F17F9ULL},
+    {0x9C69A97284B578D7ULL, 0xFF2A760414536EFBULL}, {0xC38413CF25E2D70DULL, 0xFEF5138519684ABAULL},
+    {0xF46518C2EF5B8CD1ULL, 0x7EB258665FC25D69ULL}, {0x98BF2F79D5993802ULL, 0xEF2F773FFBD97A61ULL},
+    {0xBEEEFB584AFF8603ULL, 0xAAFB550FFACFD8FAULL}, {0xEEAABA2E5DBF6784ULL, 0x95BA2A53F983CF38ULL},
+    {0x952AB45CFA97A0B2ULL, 0xDD945A747BF26183ULL}, {0xBA756174393D88DFULL, 0x94F971119AEEF9E4ULL},
+    {0xE912B9D1478CEB17ULL, 0x7A37CD5601AAB85DULL}, {0x91ABB422CCB812EEULL, 0xAC62E055C10AB33AULL},
+    {0xB616A12B7FE617AAULL, 0x577B986B314D6009ULL}, {0xE39C49765FDF9D94ULL, 0xED5A7E85FDA0B80BULL},
+    {0x8E41ADE9FBEBC27DULL, 0x14588F13BE847307ULL}, {0xB1D219647AE6B31CULL, 0x596EB2D8AE258FC8ULL},
+    {0xDE469FBD99A05FE3ULL, 0x6FCA5F8ED9AEF3BBULL}, {0x8AEC23D680043BEEULL, 0x25DE7BB9480D5854ULL},
+    {0xADA72CCC20054AE9ULL, 0xAF561AA79A10AE6AULL}, {0xD910F7FF28069DA4ULL, 0x1B2BA1518094DA04ULL},
+    {0x87AA9AFF79042286ULL, 0x90FB44D2F05D0842ULL}, {0xA99541BF57452B28ULL, 0x353A1607AC744A53ULL},
+    {0xD3FA922F2D1675F2ULL, 0x42889B8997915CE8ULL}, {0x847C9B5D7C2E09B7ULL, 0x69956135FEBADA11ULL},
+    {0xA59BC234DB398C25ULL, 0x43FAB9837E699095ULL}, {0xCF02B2C21207EF2EULL, 0x94F967E45E03F4BBULL},
+    {0x8161AFB94B44F57DULL, 0x1D1BE0EEBAC278F5ULL}, {0xA1BA1BA79E1632DCULL, 0x6462D92A69731732ULL},
+    {0xCA28A291859BBF93ULL, 0x7D7B8F7503CFDCFEULL}, {0xFCB2CB35E702AF78ULL, 0x5CDA735244C3D43EULL},
+    {0x9DEFBF01B061ADABULL, 0x3A0888136AFA64A7ULL}, {0xC56BAEC21C7A1916ULL, 0x088AAA1845B8FDD0ULL},
+    {0xF6C69A72A3989F5BULL, 0x8AAD549E57273D45ULL}, {0x9A3C2087A63F6399ULL, 0x36AC54E2F678864BULL},
+    {0xC0CB28A98FCF3C7FULL, 0x84576A1BB416A7DDULL}, {0xF0FDF2D3F3C30B9FULL, 0x656D44A2A11C51D5ULL},
+    {0x969EB7C47859E743ULL, 0x9F644AE5A4B1B325ULL}, {0xBC4665B596706114ULL, 0x873D5D9F0DDE1FEEULL},
+    {0xEB57FF22FC0C7959ULL, 0xA90CB506D155A7EAULL}, {0x9316FF75DD87CBD8ULL, 0x09A7F12442D588F2ULL},
+    {0xB7DCBF5354E9BECEULL, 0x0C11ED6D538AEB2FULL}, {0xE5D3EF282A242E81ULL, 0x8F1668C8A86DA5FAULL},
+    {0x8FA475791A569D10ULL, 0xF96E017D694487BCULL}, {0xB38D92D760EC4455ULL, 0x37C981DCC395A9ACULL},
+    {0xE070F78D3927556AULL, 0x85BBE253F47B1417ULL}, {0x8C469AB843B89562ULL, 0x93956D7478CCEC8EULL},
+    {0xAF58416654A6BABBULL, 0x387AC8D1970027B2ULL}, {0xDB2E51BFE9D0696AULL, 0x06997B05FCC0319EULL},
+    {0x88FCF317F22241E2ULL, 0x441FECE3BDF81F03ULL}, {0xAB3C2FDDEEAAD25AULL, 0xD527E81CAD7626C3ULL},
+    {0xD60B3BD56A5586F1ULL, 0x8A71E223D8D3B074ULL}, {0x85C7056562757456ULL, 0xF6872D5667844E49ULL},
+    {0xA738C6BEBB12D16CULL, 0xB428F8AC016561DBULL}, {0xD106F86E69D785C7ULL, 0xE13336D701BEBA52ULL},
+    {0x82A45B450226B39CULL, 0xECC0024661173473ULL}, {0xA34D721642B06084ULL, 0x27F002D7F95D0190ULL},
+    {0xCC20CE9BD35C78A5ULL, 0x31EC038DF7B441F4ULL}, {0xFF290242C83396CEULL, 0x7E67047175A15271ULL},
+    {0x9F79A169BD203E41ULL, 0x0F0062C6E984D386ULL}, {0xC75809C42C684DD1ULL, 0x52C07B78A3E60868ULL},
+    {0xF92E0C3537826145ULL, 0xA7709A56CCDF8A82ULL}, {0x9BBCC7A142B17CCBULL, 0x88A66076400BB691ULL},
+    {0xC2ABF989935DDBFEULL, 0x6ACFF893D00EA435ULL}, {0xF356F7EBF83552FEULL, 0x0583F6B8C4124D43ULL},
+    {0x98165AF37B2153DEULL, 0xC3727A337A8B704AULL}, {0xBE1BF1B059E9A8D6ULL, 0x744F18C0592E4C5CULL},
+    {0xEDA2EE1C7064130CULL, 0x1162DEF06F79DF73ULL}, {0x9485D4D1C63E8BE7ULL, 0x8ADDCB5645AC2BA8ULL},
+    {0xB9A74A0637CE2EE1ULL, 0x6D953E2BD7173692ULL}, {0xE8111C87C5C1BA99ULL, 0xC8FA8DB6CCDD0437ULL},
+    {0x910AB1D4DB9914A0ULL, 0x1D9C9892400A22A2ULL}, {0xB54D5E4A127F59C8ULL, 0x2503BEB6D00CAB4BULL},
+    {0xE2A0B5DC971F303AULL, 0x2E44AE64840FD61DULL}, {0x8DA471A9DE737E24ULL, 0x5CEAECFED289E5D2ULL},
+    {0xB10D8E1456105DADULL, 0x7425A83E872C5F47ULL}, {0xDD50F1996B947518ULL, 0xD12F124E28F77719ULL},
+    {0x8A5296FFE33CC92FULL, 0x82BD6B70D99AAA6FULL}, {0xACE73CBFDC0BFB7BULL, 0x636CC64D1001550BULL},
+    {0xD8210BEFD30EFA5AULL, 0x3C47F7E05401AA4EULL}, {0x8714A775E3E95C78ULL, 0x65ACFAEC34810A71ULL},
+    {0xA8D9D1535CE3B396ULL, 0x7F1839A741A14D0DULL}, {0xD31045A8341CA07CULL, 0x1EDE48111209A050ULL},
+    {0x83EA2B892091E44DULL, 0x934AED0AAB460432ULL}, {0xA4E4B66B68B65D60ULL, 0xF81DA84D5617853FULL},
+    {0xCE1DE40642E3F4B9ULL, 0x36251260AB9D668EULL}, {0x80D2AE83E9CE78F3ULL, 0xC1D72B7C6B426019ULL},
+    {0xA1075A24E4421730ULL, 0xB24CF65B8612F81FULL}, {0xC94930AE1D529CFCULL, 0xDEE033F26797B627ULL},
+    {0xFB9B7CD9A4A7443CULL, 0x169840EF017DA3B1ULL}, {0x9D412E0806E88AA5ULL, 0x8E1F289560EE864EULL},
+    {0xC491798A08A2AD4EULL, 0xF1A6F2BAB92A27E2ULL}, {0xF5B5D7EC8ACB58A2ULL, 0xAE10AF696774B1DBULL},
+    {0x9991A6F3D6BF1765ULL, 0xACCA6DA1E0A8EF29ULL}, {0xBFF610B0CC6EDD3FULL, 0x17FD090A58D32AF3ULL},
+    {0xEFF394DCFF8A948EULL, 0xDDFC4B4CEF07F5B0ULL}, {0x95F83D0A1FB69CD9ULL, 0x4ABDAF101564F98EULL},
+    {0xBB764C4CA7A4440FULL, 0x9D6D1AD41ABE37F1ULL}, {0xEA53DF5FD18D5513ULL, 0x84C86189216DC5EDULL},
+    {0x92746B9BE2F8552CULL, 0x32FD3CF5B4E49BB4ULL}, {0xB7118682DBB66A77ULL, 0x3FBC8C33221DC2A1ULL},
+    {0xE4D5E82392A40515ULL, 0x0FABAF3FEAA5334AULL}, {0x8F05B1163BA6832DULL, 0x29CB4D87F2A7400EULL},
+    {0xB2C71D5BCA9023F8ULL, 0x743E20E9EF511012ULL}, {0xDF78E4B2BD342CF6ULL, 0x914DA9246B255416ULL},
+    {0x8BAB8EEFB6409C1AULL, 0x1AD089B6C2F7548EULL}, {0xAE9672ABA3D0C320ULL, 0xA184AC2473B529B1ULL},
+    {0xDA3C0F568CC4F3E8ULL, 0xC9E5D72D90A2741EULL}, {0x8865899617FB1871ULL, 0x7E2FA67C7A658892ULL},
+    {0xAA7EEBFB9DF9DE8DULL, 0xDDBB901B98FEEAB7ULL}, {0xD51EA6FA85785631ULL, 0x552A74227F3EA565ULL},
+    {0x8533285C936B35DEULL, 0xD53A88958F87275FULL}, {0xA67FF273B8460356ULL, 0x8A892ABAF368F137ULL},
+    {0xD01FEF10A657842CULL, 0x2D2B7569B0432D85ULL}, {0x8213F56A67F6B29BULL, 0x9C3B29620E29FC73ULL},
+    {0xA298F2C501F45F42ULL, 0x8349F3BA91B47B8FULL}, {0xCB3F2F7642717713ULL, 0x241C70A936219A73ULL},
+    {0xFE0EFB53D30DD4D7ULL, 0xED238CD383AA0110ULL}, {0x9EC95D1463E8A506ULL, 0xF4363804324A40AAULL},
+    {0xC67BB4597CE2CE48ULL, 0xB143C6053EDCD0D5ULL}, {0xF81AA16FDC1B81DAULL, 0xDD94B7868E94050AULL},
+    {0x9B10A4E5E9913128ULL, 0xCA7CF2B4191C8326ULL}, {0xC1D4CE1F63F57D72ULL, 0xFD1C2F611F63A3F0ULL},
+    {0xF24A01A73CF2DCCFULL, 0xBC633B39673C8CECULL}, {0x976E41088617CA01ULL, 0xD5BE0503E085D813ULL},
+    {0xBD49D14AA79DBC82ULL, 0x4B2D8644D8A74E18ULL}, {0xEC9C459D51852BA2ULL, 0xDDF8E7D60ED1219EULL},
+    {0x93E1AB8252F33B45ULL, 0xCABB90E5C942B503ULL}, {0xB8DA1662E7B00A17ULL, 0x3D6A751F3B936243ULL},
+    {0xE7109BFBA19C0C9DULL, 0x0CC512670A783AD4ULL}, {0x906A617D450187E2ULL, 0x27FB2B80668B24C5ULL},
+    {0xB484F9DC9641E9DAULL, 0xB1F9F660802DEDF6ULL}, {0xE1A63853BBD26451ULL, 0x5E7873F8A0396973ULL},
+    {0x8D07E33455637EB2ULL, 0xDB0B487B6423E1E8ULL}, {0xB049DC016ABC5E5FULL, 0x91CE1A9A3D2CDA62ULL},
+    {0xDC5C5301C56B75F7ULL, 0x7641A140CC7810FBULL}, {0x89B9B3E11B6329BAULL, 0xA9E904C87FCB0A9DULL},
+    {0xAC2820D9623BF429ULL, 0x546345FA9FBDCD44ULL}, {0xD732290FBACAF133ULL, 0xA97C177947AD4095ULL},
+    {0x867F59A9D4BED6C0ULL, 0x49ED8EABCCCC485DULL}, {0xA81F301449EE8C70ULL, 0x5C68F256BFFF5A74ULL},
+    {0xD226FC195C6A2F8CULL, 0x73832EEC6FFF3111ULL}, {0x83585D8FD9C25DB7ULL, 0xC831FD53C5FF7EABULL},
+    {0xA42E74F3D032F525ULL, 0xBA3E7CA8B77F5E55ULL}, {0xCD3A1230C43FB26FULL, 0x28CE1BD2E55F35EBULL},
+    {0x80444B5E7AA7CF85ULL, 0x7980D163CF5B81B3ULL}, {0xA0555E361951C366ULL, 0xD7E105BCC332621FULL},
+    {0xC86AB5C39FA63440ULL, 0x8DD9472BF3FEFAA7ULL}, {0xFA856334878FC150ULL, 0xB14F98F6F0FEB951ULL},
+    {0x9C935E00D4B9D8D2ULL, 0x6ED1BF9A569F33D3ULL}, {0xC3B8358109E84F07ULL, 0x0A862F80EC4700C8ULL},
+    {0xF4A642E14C6262C8ULL, 0xCD27BB612758C0FAULL}, {0x98E7E9CCCFBD7DBDULL, 0x8038D51CB897789CULL},
+    {0xBF21E44003ACDD2CULL, 0xE0470A63E6BD56C3ULL}, {0xEEEA5D5004981478ULL, 0x1858CCFCE06CAC74ULL},
+    {0x95527A5202DF0CCBULL, 0x0F37801E0C43EBC8ULL}, {0xBAA718E68396CFFDULL, 0xD30560258F54E6BAULL},
+    {0xE950DF20247C83FDULL, 0x47C6B82EF32A2069ULL}, {0x91D28B7416CDD27EULL, 0x4CDC331D57FA5441ULL},
+    {0xB6472E511C81471DULL, 0xE0133FE4ADF8E952ULL}, {0xE3D8F9E563A198E5ULL, 0x58180FDDD97723A6ULL},
+    {0x8E679C2F5E44FF8FULL, 0x570F09EAA7EA7648ULL}, {0xB201833B35D63F73ULL, 0x2CD2CC6551E513DAULL},
+    {0xDE81E40A034BCF4FULL, 0xF8077F7EA65E58D1ULL}, {0x8B112E86420F6191ULL, 0xFB04AFAF27FAF782ULL},
+    {0xADD57A27D29339F6ULL, 0x79C5DB9AF1F9B563ULL}, {0xD94AD8B1C7380874ULL, 0x18375281AE7822BCULL},
+    {0x87CEC76F1C830548ULL, 0x8F2293910D0B15B5ULL}, {0xA9C2794AE3A3C69AULL, 0xB2EB3875504DDB22ULL},
+    {0xD433179D9C8CB841ULL, 0x5FA60692A46151EBULL}, {0x849FEEC281D7F328ULL, 0xDBC7C41BA6BCD333ULL},
+    {0xA5C7EA73224DEFF3ULL, 0x12B9B522906C0800ULL}, {0xCF39E50FEAE16BEFULL, 0xD768226B34870A00ULL},
+    {0x81842F29F2CCE375ULL, 0xE6A1158300D46640ULL}, {0xA1E53AF46F801C53ULL, 0x60495AE3C1097FD0ULL},
+    {0xCA5E89B18B602368ULL, 0x385BB19CB14BDFC4ULL}, {0xFCF62C1DEE382C42ULL, 0x46729E03DD9ED7B5ULL},
+    {0x9E19DB92B4E31BA9ULL, 0x6C07A2C26A8346D1ULL},
+};
+
+DQN_FORCE_INLINE Dqn_u64 Dqn_F64__Mul128(Dqn_u64 a, Dqn_u64 b, Dqn_u64 *hi)
+{
+#if defined(__SIZEOF_INT128__)
+    __uint128_t product = DQN_CAST(__uint128_t)a * b;
+    Dqn_u64     result  = DQN_CAST(Dqn_u64)product;
+    *hi                 = DQN_CAST(Dqn_u64)(product >> 64);
+#elif defined(DQN_COMPILER_W32_MSVC) && defined(_M_X64)
+    Dqn_u64 result = _umul128(a, b, hi);
+#else
+    Dqn_u64 a_lo   = a & 0xFFFFFFFF, a_hi = a >> 32;
+    Dqn_u64 b_lo   = b & 0xFFFFFFFF, b_hi = b >> 32;
+    Dqn_u64 lo_lo  = a_lo * b_lo;
+    Dqn_u64 hi_lo  = a_hi * b_lo;
+    Dqn_u64 cross  = (lo_lo >> 32) + (hi_lo & 0xFFFFFFFF) + (a_lo * b_hi);
+    *hi            = (a_hi * b_hi) + (hi_lo >> 32) + (cross >> 32);
+    Dqn_u64 result = (cross << 32) | (lo_lo & 0xFFFFFFFF);
+#endif
+    return result;
+}
+
+DQN_FORCE_INLINE Dqn_f64 Dqn_F64__FromBits(Dqn_u64 bits)
+{
+    Dqn_f64 result;
+    DQN_MEMCOPY(&result, &bits, sizeof(result));
+    return result;
+}
+
+DQN_FORCE_INLINE Dqn_u64 Dqn_F64__ToBits(Dqn_f64 value)
+{
+    Dqn_u64 result;
+    DQN_MEMCOPY(&result, &value, sizeof(result));
+    return result;
+}
+
+// NOTE: Parse the run of digits at the start of 'buf' 8 at a time. The first 19 significant digits
+// are accumulated into 'mantissa', the rest are only counted and flag 'truncated' if non-zero.
+// return: The number of digits in the run
+DQN_FILE_SCOPE Dqn_isize Dqn_F64__ParseMantissa(char const *buf, Dqn_isize size, Dqn_u64 *mantissa, Dqn_isize *significant, Dqn_b32 *truncated)
+{
+    Dqn_isize result = 0;
+    for (;;)
+    {
+        Dqn_u64   chunk  = 0;
+        Dqn_isize digits = Dqn_Str__LoadDigits8(buf + result, size - result, &chunk);
+        Dqn_isize take   = DQN_M_MIN(digits, 19 - *significant);
+        if (take == digits)
+        {
+            *mantissa = (*mantissa * Dqn_Str__Pow10U64(digits)) + chunk;
+        }
+        else
+        {
+            Dqn_u64 dropped = Dqn_Str__Pow10U64(digits - take);
+            *mantissa       = (*mantissa * Dqn_Str__Pow10U64(take)) + (chunk / dropped);
+            *truncated     |= (chunk % dropped) != 0;
+        }
+
+        *significant += take;
+        result       += digits;
+        if (digits < 8)
+            break;
+    }
+    return result;
+}
+
+// NOTE: Eisel-Lemire, round 'mantissa' * 10^'exponent' to the nearest double using the product of
+// the mantissa and the 128 bit approximation of the power of 10. Fails when the product is too close
+// to half way between 2 doubles to decide the rounding or the result is subnormal.
+// exponent: Must be in [DQN_F64__POW10_MIN, 308]
+DQN_FILE_SCOPE Dqn_b32 Dqn_F64__EiselLemire(Dqn_u64 mantissa, Dqn_i64 exponent, Dqn_b32 negative, Dqn_f64 *value)
+{
+    DQN_ASSERT(mantissa != 0 && exponent >= DQN_F64__POW10_MIN && exponent <= 308);
+    Dqn_u32 leading_zeros = Dqn_CountLeadingZerosU64(mantissa);
+    mantissa            <<= leading_zeros;
+
+    // NOTE: (217706 * exponent) >> 16 is floor(exponent * log2(10))
+    Dqn_u64        exponent2 = DQN_CAST(Dqn_u64)(((217706 * exponent) >> 16) + 64 + 1023) - leading_zeros;
+    Dqn_u64 const *pow10     = DQN_F64__POW10[exponent - DQN_F64__POW10_MIN];
+
+    Dqn_u64 product_hi = 0;
+    Dqn_u64 product_lo = Dqn_F64__Mul128(mantissa, pow10[0], &product_hi);
+    if ((product_hi & 0x1FF) == 0x1FF && product_lo + mantissa < mantissa)
+    {
+        // NOTE: The bits below the mantissa may carry into it, refine with the low 64 bits
+        Dqn_u64 low_hi = 0;
+        Dqn_u64 low_lo = Dqn_F64__Mul128(mantissa, pow10[1], &low_hi);
+        Dqn_u64 merged = product_lo + low_hi;
+        if (merged < product_lo)
+            product_hi++;
+
+        if ((product_hi & 0x1FF) == 0x1FF && merged + 1 == 0 && low_lo + mantissa < mantissa)
+            return false;
+        product_lo = merged;
+    }
+
+    Dqn_u64 top_bit  = product_hi >> 63;
+    Dqn_u64 result   = product_hi >> (top_bit + 9);
+    exponent2       -= 1 ^ top_bit;
+
+    // NOTE: Exactly half way, the rounding depends on bits the product doesn't have
+    if (product_lo == 0 && (product_hi & 0x1FF) == 0 && (result & 3) == 1)
+        return false;
+
+    result += result & 1;
+    result >>= 1;
+    if (result >> 53)
+    {
+        result >>= 1;
+        exponent2++;
+    }
+
+    // NOTE: Zero (underflowed) is subnormal, 0x7FF and up is infinity
+    if (exponent2 - 1 >= 0x7FF - 1)
+        return false;
+
+    Dqn_u64 bits = (exponent2 << 52) | (result & 0x000FFFFFFFFFFFFFULL);
+    if (negative)
+        bits |= 0x8000000000000000ULL;
+    *value = Dqn_F64__FromBits(bits);
+    return true;
+}
+
+// NOTE: Exact fallback, the digits as an arbitrary precision decimal that's scaled by powers of 2
+// until the double's bits can be read off the integer part. 768 digits are enough to round any
+// double correctly, digits past that are dropped but remembered to break ties.
+#define DQN_F64__DECIMAL_MAX_DIGITS 768
+struct Dqn_F64__Decimal
+{
+    Dqn_u8    digits[DQN_F64__DECIMAL_MAX_DIGITS + 19]; // Values 0-9, with space for a left shift's new digits
+    Dqn_isize count;
+    Dqn_i64   decimal_point; // value = 0.digits * 10^decimal_point
+    Dqn_b32   truncated;     // Non-zero digits past DQN_F64__DECIMAL_MAX_DIGITS were dropped
+};
+
+DQN_FILE_SCOPE void Dqn_F64__DecimalTrim(Dqn_F64__Decimal *decimal)
+{
+    while (decimal->count > 0 && decimal->digits[decimal->count - 1] == 0)
+        decimal->count--;
+    if (decimal->count == 0)
+        decimal->decimal_point = 0;
+}
+
+// NOTE: Multiply by 2^shift, shift <= 60 so the running value fits in 64 bits. The digits are
+// written right to left 19 places along, 2^60 adds at most 19 digits, then moved to the front.
+DQN_FILE_SCOPE void Dqn_F64__DecimalLeftShift(Dqn_F64__Decimal *decimal, int shift)
+{
+    Dqn_isize read  = decimal->count;
+    Dqn_isize write = decimal->count + 19;
+    Dqn_u64   value = 0;
+    while (read > 0 || value > 0)
+    {
+        if (read > 0)
+            value += DQN_CAST(Dqn_u64)decimal->digits[--read] << shift;
+
+        Dqn_u64 quotient         = value / 10;
+        decimal->digits[--write] = DQN_CAST(Dqn_u8)(value - (quotient * 10));
+        value                    = quotient;
+    }
+
+    Dqn_isize count = decimal->count + 19 - write;
+    DQN_MEMMOVE(decimal->digits, decimal->digits + write, DQN_CAST(size_t)count);
+    decimal->decimal_point += count - decimal->count;
+    if (count > DQN_F64__DECIMAL_MAX_DIGITS)
+    {
+        for (Dqn_isize index = DQN_F64__DECIMAL_MAX_DIGITS; index < count; index++)
+            decimal->truncated |= decimal->digits[index] != 0;
+        count = DQN_F64__DECIMAL_MAX_DIGITS;
+    }
+
+    decimal->count = count;
+    Dqn_F64__DecimalTrim(decimal);
+}
+
+// NOTE: Divide by 2^shift, shift <= 60
+DQN_FILE_SCOPE void Dqn_F64__DecimalRightShift(Dqn_F64__Decimal *decimal, int shift)
+{
+    Dqn_isize read  = 0;
+    Dqn_isize write = 0;
+    Dqn_u64   value = 0;
+    for (; (value >> shift) == 0; read++)
+    {
+        if (read >= decimal->count)
+        {
+            if (value == 0)
+            {
+                decimal->count         = 0;
+                decimal->decimal_point = 0;
+                return;
+            }
+
+            while ((value >> shift) == 0)
+            {
+                value *= 10;
+                read++;
+            }
+            break;
+        }
+        value = (value * 10) + decimal->digits[read];
+    }
+
+    decimal->decimal_point -= read - 1;
+    Dqn_u64 mask = (1ULL << shift) - 1;
+    for (; read < decimal->count; read++)
+    {
+        decimal->digits[write++] = DQN_CAST(Dqn_u8)(value >> shift);
+        value                    = ((value & mask) * 10) + decimal->digits[read];
+    }
+
+    while (value > 0)
+    {
+        Dqn_u8 digit = DQN_CAST(Dqn_u8)(value >> shift);
+        if (write < DQN_F64__DECIMAL_MAX_DIGITS)
+            decimal->digits[write++] = digit;
+        else if (digit > 0)
+            decimal->truncated = true;
+        value = (value & mask) * 10;
+    }
+
+    decimal->count = write;
+    Dqn_F64__DecimalTrim(decimal);
+}
+
+DQN_FILE_SCOPE void Dqn_F64__DecimalShift(Dqn_F64__Decimal *decimal, int shift)
 {
-    *src = Dqn_Str_SkipWhitespace(*src);
-    return *src;
+    if (decimal->count == 0)
+        return;
+
+    for (; shift > 60; shift -= 60)
+        Dqn_F64__DecimalLeftShift(decimal, 60);
+    for (; shift < -60; shift += 60)
+        Dqn_F64__DecimalRightShift(decimal, 60);
+
+    if (shift > 0)      Dqn_F64__DecimalLeftShift(decimal, shift);
+    else if (shift < 0) Dqn_F64__DecimalRightShift(decimal, -shift);
 }
 
-DQN_API char const *Dqn_Str_TrimWhitespaceAround(char const *src, Dqn_isize size, Dqn_isize *new_size)
+// NOTE: The integer part rounded half to even, the decimal must be less than 2^64
+DQN_FILE_SCOPE Dqn_u64 Dqn_F64__DecimalRoundedInteger(Dqn_F64__Decimal const *decimal)
 {
-    char const *result = src;
-    if (new_size) *new_size = 0;
-    if (size <= 0) return result;
-
-    char const *start = result;
-    char const *end   = start + (size - 1);
-    while (Dqn_Char_IsWhitespace(start[0])) start++;
-    while (end != start && Dqn_Char_IsWhitespace(end[0])) end--;
+    Dqn_u64   result = 0;
+    Dqn_isize index  = 0;
+    for (; index < decimal->decimal_point && index < decimal->count; index++)
+        result = (result * 10) + decimal->digits[index];
+    for (; index < decimal->decimal_point; index++)
+        result *= 10;
 
-    result = start;
-    if (new_size) *new_size = ((end - start) + 1);
+    Dqn_isize point = DQN_CAST(Dqn_isize)decimal->decimal_point;
+    if (point >= 0 && point < decimal->count)
+    {
+        Dqn_b32 round_up = decimal->digits[point] >= 5;
+        if (decimal->digits[point] == 5 && point + 1 == decimal->count) // NOTE: Exactly half way
+            round_up = decimal->truncated || (point > 0 && (decimal->digits[point - 1] & 1));
+        result += round_up ? 1 : 0;
+    }
     return result;
 }
 
-DQN_API char const *Dqn_Str_TrimPrefix(char const *src, Dqn_isize size, char const *prefix, Dqn_isize prefix_size, Dqn_isize *trimmed_size)
+DQN_FILE_SCOPE Dqn_f64 Dqn_F64__DecimalToF64(Dqn_F64__Decimal *decimal, Dqn_b32 negative)
 {
-    char const *result = src;
-    if (size >= prefix_size)
+    // NOTE: Shifts that keep a decimal with 'decimal_point' digits above 1 without underflowing
+    DQN_LOCAL_PERSIST int const POW2_STEPS[] = {1, 3, 6, 9, 13, 16, 19, 23, 26};
+
+    Dqn_u64 bits = 0;
+    if (decimal->count == 0 || decimal->decimal_point < -330)
     {
-        Dqn_b32 prefix_matched = true;
-        for (Dqn_isize prefix_index = 0;
-             prefix_index < prefix_size && prefix_matched;
-             prefix_index++)
+        bits = 0;
+    }
+    else if (decimal->decimal_point > 310)
+    {
+        bits = 0x7FF0000000000000ULL;
+    }
+    else
+    {
+        // NOTE: Scale by powers of 2 into [0.5, 1), the double's exponent is the sum of the shifts
+        int exponent = 0;
+        while (decimal->decimal_point > 0)
         {
-            char prefix_ch = prefix[prefix_index];
-            char src_ch    = src[prefix_index];
-            prefix_matched = src_ch == prefix_ch;
+            int shift = decimal->decimal_point >= Dqn_ArrayCountI(POW2_STEPS) ? 27 : POW2_STEPS[decimal->decimal_point];
+            Dqn_F64__DecimalShift(decimal, -shift);
+            exponent += shift;
         }
 
-        if (prefix_matched)
+        while (decimal->decimal_point < 0 || (decimal->decimal_point == 0 && decimal->digits[0] < 5))
         {
-            result += prefix_size;
-            *trimmed_size = size - prefix_size;
+            int shift = -decimal->decimal_point >= Dqn_ArrayCountI(POW2_STEPS) ? 27 : POW2_STEPS[-decimal->decimal_point];
+            Dqn_F64__DecimalShift(decimal, shift);
+            exponent -= shift;
+        }
+
+        // NOTE: [0.5, 1) to the double's [1, 2), subnormals stay at the minimum exponent
+        exponent--;
+        if (exponent < -1022)
+        {
+            Dqn_F64__DecimalShift(decimal, exponent + 1022);
+            exponent = -1022;
+        }
+
+        Dqn_F64__DecimalShift(decimal, 53);
+        Dqn_u64 mantissa = Dqn_F64__DecimalRoundedInteger(decimal);
+        if (mantissa == (2ULL << 52)) // NOTE: Rounding carried into a new bit
+        {
+            mantissa >>= 1;
+            exponent++;
+        }
+
+        if (exponent + 1023 >= 0x7FF)
+        {
+            bits = 0x7FF0000000000000ULL;
+        }
+        else
+        {
+            if ((mantissa & (1ULL << 52)) == 0)
+                exponent = -1023;
+            bits = (mantissa & ((1ULL << 52) - 1)) | (DQN_CAST(Dqn_u64)(exponent + 1023) << 52);
         }
     }
 
+    if (negative)
+        bits |= 0x8000000000000000ULL;
+    Dqn_f64 result = Dqn_F64__FromBits(bits);
     return result;
 }
 
+DQN_FILE_SCOPE Dqn_b32 Dqn_Str__StartsWithCaseInsensitive(char const *buf, Dqn_isize size, char const *prefix, Dqn_isize prefix_size)
+{
+    if (size < prefix_size)
+        return false;
+
+    for (Dqn_isize index = 0; index < prefix_size; index++)
+        if (Dqn_Char_ToLower(buf[index]) != prefix[index])
+            return false;
+    return true;
+}
 
-DQN_API Dqn_u64 Dqn_Str_ToU64(char const *buf, int len, char separator)
+DQN_API Dqn_f64 Dqn_Str_ToF64(char const *buf, int len)
 {
-    Dqn_u64 result = 0;
+    Dqn_f64 result = 0;
     if (!buf) return result;
     if (len == -1) len = Dqn_Safe_TruncateUSizeToInt(Dqn_Str_Len(buf));
     if (len == 0) return result;
 
     char const *buf_ptr = Dqn_Str_SkipWhitespace(buf);
     len -= static_cast<int>(buf_ptr - buf);
-    for (int buf_index = 0; buf_index < len; ++buf_index)
-    {
-        char ch = buf_ptr[buf_index];
-        if (buf_index && ch == separator)
-            continue;
+    Dqn_Str_ParseF64(buf_ptr, len, &result);
+    return result;
+}
 
-        if (ch < '0' || ch > '9')
-            break;
+DQN_API Dqn_isize Dqn_Str_ParseF64(char const *buf, Dqn_isize size, Dqn_f64 *value)
+{
+    *value        = 0;
+    Dqn_isize pos = 0;
+
+    Dqn_b32 negative = false;
+    if (pos < size && (buf[pos] == '-' || buf[pos] == '+'))
+        negative = buf[pos++] == '-';
 
-        Dqn_u64 val = DQN_CAST(Dqn_u64)(ch - '0');
-        result      = Dqn_Safe_AddU64(result, val);
-        result      = Dqn_Safe_MulU64(result, 10);
+    if (Dqn_Str__StartsWithCaseInsensitive(buf + pos, size - pos, "inf", 3))
+    {
+        pos    += Dqn_Str__StartsWithCaseInsensitive(buf + pos, size - pos, "infinity", 8) ? 8 : 3;
+        *value  = Dqn_F64__FromBits(negative ? 0xFFF0000000000000ULL : 0x7FF0000000000000ULL);
+        return pos;
     }
 
-    result /= 10;
-    return result;
-}
+    if (Dqn_Str__StartsWithCaseInsensitive(buf + pos, size - pos, "nan", 3))
+    {
+        *value = Dqn_F64__FromBits(negative ? 0xFFF8000000000000ULL : 0x7FF8000000000000ULL);
+        return pos + 3;
+    }
 
-DQN_API Dqn_i64 Dqn_Str_ToI64(char const *buf, int len, char separator)
-{
-    Dqn_i64 result = 0;
-    if (!buf) return result;
-    if (len == -1) len = Dqn_Safe_TruncateUSizeToInt(Dqn_Str_Len(buf));
-    if (len == 0) return result;
+    // NOTE: Leading zeros are skipped so every digit parsed into the mantissa is significant. The
+    // mantissa holds the first 19, 'exponent' is adjusted for the integer digits past those and the
+    // fraction digits in it.
+    Dqn_u64   mantissa    = 0;
+    Dqn_isize significant = 0;
+    Dqn_b32   truncated   = false;
+    Dqn_i64   exponent    = 0;
+
+    Dqn_isize int_start = pos;
+    while (pos < size && buf[pos] == '0')
+        pos++;
+
+    Dqn_isize int_digits_start = pos;
+    Dqn_isize int_digits       = Dqn_F64__ParseMantissa(buf + pos, size - pos, &mantissa, &significant, &truncated);
+    pos                       += int_digits;
+    exponent                  += int_digits - significant;
+    Dqn_b32 has_digits         = pos > int_start;
+
+    Dqn_isize frac_zeros        = 0;
+    Dqn_isize frac_digits_start = pos;
+    Dqn_isize frac_digits       = 0;
+    if (pos < size && buf[pos] == '.')
+    {
+        Dqn_isize frac_start = ++pos;
+        if (significant == 0)
+        {
+            while (pos < size && buf[pos] == '0')
+                pos++;
+            frac_zeros = pos - frac_start;
+        }
 
-    char const *buf_ptr = Dqn_Str_SkipWhitespace(buf);
-    len -= static_cast<int>(buf_ptr - buf);
+        Dqn_isize int_significant = significant;
+        frac_digits_start         = pos;
+        frac_digits               = Dqn_F64__ParseMantissa(buf + pos, size - pos, &mantissa, &significant, &truncated);
+        pos                      += frac_digits;
+        exponent                 -= frac_zeros + (significant - int_significant);
+        has_digits               |= pos > frac_start;
+    }
 
-    Dqn_b32 negative = (buf[0] == '-');
-    if (negative)
+    if (!has_digits)
+        return 0;
+
+    // NOTE: The exponent is only consumed if it has digits, "1e" parses as "1"
+    Dqn_i64 exponent_part = 0;
+    if (pos < size && (buf[pos] == 'e' || buf[pos] == 'E'))
     {
-        ++buf_ptr;
-        --len;
+        Dqn_isize exponent_pos      = pos + 1;
+        Dqn_b32   exponent_negative = false;
+        if (exponent_pos < size && (buf[exponent_pos] == '-' || buf[exponent_pos] == '+'))
+            exponent_negative = buf[exponent_pos++] == '-';
+
+        if (exponent_pos < size && Dqn_Char_IsDigit(buf[exponent_pos]))
+        {
+            for (; exponent_pos < size && Dqn_Char_IsDigit(buf[exponent_pos]); exponent_pos++)
+            {
+                if (exponent_part < 100000) // NOTE: Far past the range of a double, stop before overflowing
+                    exponent_part = (exponent_part * 10) + (buf[exponent_pos] - '0');
+            }
+
+            if (exponent_negative)
+                exponent_part = -exponent_part;
+            exponent += exponent_part;
+            pos       = exponent_pos;
+        }
     }
 
-    for (int buf_index = 0; buf_index < len; ++buf_index)
+#if (defined(__FLT_EVAL_METHOD__) && __FLT_EVAL_METHOD__ != 0) || (defined(_M_IX86_FP) && _M_IX86_FP < 2)
+    Dqn_b32 const exact_fpu = false; // NOTE: x87 evaluates in extended precision, doubles round twice
+#else
+    Dqn_b32 const exact_fpu = true;
+#endif
+
+    DQN_LOCAL_PERSIST Dqn_f64 const EXACT_POW10[] =
     {
-        char ch = buf_ptr[buf_index];
-        if (buf_index && ch == separator) continue;
-        if (ch < '0' || ch > '9') break;
+        1e0,  1e1,  1e2,  1e3,  1e4,  1e5,  1e6,  1e7,  1e8,  1e9,  1e10, 1e11,
+        1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22,
+    };
 
-        Dqn_i64 val = ch - '0';
-        result  = Dqn_Safe_AddI64(result, val);
-        result  = Dqn_Safe_MulI64(result, 10);
+    Dqn_f64 result = 0;
+    if (mantissa == 0)
+    {
+        result = 0;
+    }
+    else if (exact_fpu && !truncated && mantissa <= (1ULL << 53) && exponent >= -22 && exponent <= 22)
+    {
+        // NOTE: Both operands are exact doubles so the single multiply or divide rounds correctly
+        result = DQN_CAST(Dqn_f64)mantissa;
+        if (exponent < 0) result /= EXACT_POW10[-exponent];
+        else              result *= EXACT_POW10[exponent];
+    }
+    else if (exponent < DQN_F64__POW10_MIN)
+    {
+        result = 0; // NOTE: Below half the smallest subnormal even with 19 digits
+    }
+    else if (exponent > 308)
+    {
+        result = Dqn_F64__FromBits(0x7FF0000000000000ULL);
     }
+    else
+    {
+        // NOTE: With truncated digits the value is in (mantissa, mantissa + 1) * 10^exponent, if
+        // both ends round to the same double so does the value.
+        Dqn_f64 upper = 0;
+        Dqn_b32 fast  = Dqn_F64__EiselLemire(mantissa, exponent, false, &result);
+        if (fast && truncated)
+            fast = Dqn_F64__EiselLemire(mantissa + 1, exponent, false, &upper) && upper == result;
+
+        if (!fast)
+        {
+            Dqn_F64__Decimal decimal = {};
+            decimal.decimal_point    = (int_digits ? int_digits : -frac_zeros) + exponent_part;
 
-    result /= 10;
-    if (negative) result *= -1;
-    return result;
+            Dqn_isize const spans[2][2] = {{int_digits_start, int_digits}, {frac_digits_start, frac_digits}};
+            for (Dqn_isize span = 0; span < Dqn_ArrayCountI(spans); span++)
+            {
+                for (Dqn_isize index = 0; index < spans[span][1]; index++)
+                {
+                    Dqn_u8 digit = DQN_CAST(Dqn_u8)(buf[spans[span][0] + index] - '0');
+                    if (decimal.count < DQN_F64__DECIMAL_MAX_DIGITS)
+                        decimal.digits[decimal.count++] = digit;
+                    else if (digit)
+                        decimal.truncated = true;
+                }
+            }
+
+            Dqn_F64__DecimalTrim(&decimal);
+            result = Dqn_F64__DecimalToF64(&decimal, false);
+        }
+    }
+
+    *value = negative ? -result : result;
+    return pos;
 }
 
 // -------------------------------------------------------------------------------------------------
@@ -5261,9 +10020,11 @@ DQN_FILE_SCOPE void Dqn_PerfCounter__Init()
 DQN_API Dqn_f64 Dqn_PerfCounter_S(Dqn_u64 begin, Dqn_u64 end)
 {
     Dqn_PerfCounter__Init();
-#if defined(DQN_OS_WIN32)
     Dqn_u64 ticks  = end - begin;
+#if defined(DQN_OS_WIN32)
     Dqn_f64 result = ticks / DQN_CAST(Dqn_f64)dqn__lib.win32_qpc_frequency.QuadPart;
+#else
+    Dqn_f64 result = ticks / 1'000'000'000.0; // NOTE: Ticks are nanoseconds from clock_gettime
 #endif
     return result;
 }
@@ -5271,9 +10032,11 @@ DQN_API Dqn_f64 Dqn_PerfCounter_S(Dqn_u64 begin, Dqn_u64 end)
 DQN_API Dqn_f64 Dqn_PerfCounter_Ms(Dqn_u64 begin, Dqn_u64 end)
 {
     Dqn_PerfCounter__Init();
-#if defined(DQN_OS_WIN32)
     Dqn_u64 ticks  = end - begin;
+#if defined(DQN_OS_WIN32)
     Dqn_f64 result = (ticks * 1'000) / DQN_CAST(Dqn_f64)dqn__lib.win32_qpc_frequency.QuadPart;
+#else
+    Dqn_f64 result = ticks / 1'000'000.0; // NOTE: Ticks are nanoseconds from clock_gettime
 #endif
     return result;
 }
@@ -5281,9 +10044,11 @@ DQN_API Dqn_f64 Dqn_PerfCounter_Ms(Dqn_u64 begin, Dqn_u64 end)
 DQN_API Dqn_f64 Dqn_PerfCounter_MicroS(Dqn_u64 begin, Dqn_u64 end)
 {
     Dqn_PerfCounter__Init();
-#if defined(DQN_OS_WIN32)
     Dqn_u64 ticks  = end - begin;
+#if defined(DQN_OS_WIN32)
     Dqn_f64 result = (ticks * 1'000'000) / DQN_CAST(Dqn_f64)dqn__lib.win32_qpc_frequency.QuadPart;
+#else
+    Dqn_f64 result = ticks / 1'000.0; // NOTE: Ticks are nanoseconds from clock_gettime
 #endif
     return result;
 }
@@ -5291,9 +10056,11 @@ DQN_API Dqn_f64 Dqn_PerfCounter_MicroS(Dqn_u64 begin, Dqn_u64 end)
 DQN_API Dqn_f64 Dqn_PerfCounter_Ns(Dqn_u64 begin, Dqn_u64 end)
 {
     Dqn_PerfCounter__Init();
-#if defined(DQN_OS_WIN32)
     Dqn_u64 ticks  = end - begin;
+#if defined(DQN_OS_WIN32)
     Dqn_f64 result = (ticks * 1'000'000'000) / DQN_CAST(Dqn_f64)dqn__lib.win32_qpc_frequency.QuadPart;
+#else
+    Dqn_f64 result = DQN_CAST(Dqn_f64)ticks; // NOTE: Ticks are nanoseconds from clock_gettime
 #endif
     return result;
 }
@@ -5307,6 +10074,10 @@ DQN_API Dqn_u64 Dqn_PerfCounter_Now()
     (void)qpc_result;
     DQN_ASSERT_MSG(qpc_result, "MSDN says this can only fail when running on a version older than Windows XP");
     result = integer.QuadPart;
+#else
+    struct timespec ts = {};
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    result = DQN_CAST(Dqn_u64)ts.tv_sec * 1'000'000'000 + DQN_CAST(Dqn_u64)ts.tv_nsec;
 #endif
 
     DQN_ASSERT_MSG(result != 0, "Function not implemented");
@@ -5349,41 +10120,294 @@ DQN_API Dqn_f64 Dqn_Timer_Ns(Dqn_Timer timer)
     return result;
 }
 
+// NOTE: "00" to "99" back to back, the 2 characters for n are at n * 2
+DQN_FILE_SCOPE char const DQN_U64__DIGIT_PAIRS[] =
+    "0001020304050607080910111213141516171819202122232425262728293031323334353637383940414243444546474849"
+    "5051525354555657585960616263646566676869707172737475767778798081828384858687888990919293949596979899";
+
+// NOTE: Write 'val' so it ends at 'end' 2 digits at a time, or a comma and 3 digits at a time.
+// return: Where the string starts
+DQN_FORCE_INLINE char *Dqn_U64__WriteBackwards(Dqn_u64 val, char *end, Dqn_b32 comma_sep)
+{
+    char *ptr = end;
+    if (comma_sep)
+    {
+        for (; val >= 1000; val /= 1000)
+        {
+            Dqn_u64 group = val % 1000;
+            ptr          -= 4;
+            ptr[0]        = ',';
+            ptr[1]        = DQN_CAST(char)('0' + (group / 100));
+            DQN_MEMCOPY(ptr + 2, DQN_U64__DIGIT_PAIRS + ((group % 100) * 2), 2);
+        }
+    }
+
+    for (; val >= 100; val /= 100)
+    {
+        ptr -= 2;
+        DQN_MEMCOPY(ptr, DQN_U64__DIGIT_PAIRS + ((val % 100) * 2), 2);
+    }
+
+    if (val >= 10)
+    {
+        ptr -= 2;
+        DQN_MEMCOPY(ptr, DQN_U64__DIGIT_PAIRS + (val * 2), 2);
+    }
+    else
+    {
+        *(--ptr) = DQN_CAST(char)('0' + val);
+    }
+    return ptr;
+}
+
+DQN_API Dqn_isize Dqn_U64ToStrSize(Dqn_u64 val, Dqn_b32 comma_sep)
+{
+    // NOTE: (bits * 1233) >> 12 is floor(bits * log10(2)), one less than the digit count when
+    // 'val' is at or past the next power of 10. val | 1 keeps 0 at 1 digit.
+    Dqn_u64   val_or_1 = val | 1;
+    Dqn_isize log10    = ((64 - Dqn_CountLeadingZerosU64(val_or_1)) * 1233) >> 12;
+    Dqn_isize result   = log10 + (val_or_1 >= Dqn_Str__Pow10U64(log10) ? 1 : 0);
+    if (comma_sep)
+        result += (result - 1) / 3;
+    return result;
+}
+
+DQN_API Dqn_isize Dqn_U64ToStrBuffer(Dqn_u64 val, char *buf, Dqn_b32 comma_sep)
+{
+    Dqn_isize result = Dqn_U64ToStrSize(val, comma_sep);
+    Dqn_U64__WriteBackwards(val, buf + result, comma_sep);
+    return result;
+}
+
 DQN_API char *Dqn_U64ToStr(Dqn_u64 val, Dqn_U64Str *result, Dqn_b32 comma_sep)
 {
-    int buf_index            = (int)(Dqn_ArrayCount(result->buf) - 1);
-    result->buf[buf_index--] = 0;
+    char *end   = result->buf + (Dqn_ArrayCount(result->buf) - 1);
+    *end        = 0;
+    result->str = Dqn_U64__WriteBackwards(val, end, comma_sep);
+    result->len = DQN_CAST(int)(end - result->str);
+    return result->str;
+}
+
+DQN_API char *Dqn_U64ToTempStr(Dqn_u64 val, Dqn_b32 comma_sep)
+{
+    DQN_THREAD_LOCAL Dqn_U64Str string;
+    char *result = Dqn_U64ToStr(val, &string, comma_sep);
+    return result;
+}
+
+DQN_API Dqn_String Dqn_U64ToArenaStr(Dqn_ArenaAllocator *arena, Dqn_u64 val, Dqn_b32 comma_sep)
+{
+    Dqn_isize  size   = Dqn_U64ToStrSize(val, comma_sep);
+    Dqn_String result = Dqn_String_ArenaAllocate(arena, size + 1, Dqn_ZeroMem::No);
+    if (result.str)
+    {
+        Dqn_U64__WriteBackwards(val, result.str + size, comma_sep);
+        result.str[size] = 0;
+        result.size      = size;
+    }
+    return result;
+}
+
+// NOTE: Schubfach, the shortest decimal in the interval of reals that round to the double. The
+// double c * 2^q and the interval's bounds are scaled by 10^-k, picked so the scaled value has 16 or
+// 17 digits, then the shortest candidates are the multiples of 10 and the integers either side of
+// it. All 3 products are rounded to odd from 126 bit constants which keeps the comparisons exact.
+// g1, g0: The upper and lower 63 bits of the 126 bit 10^-k
+DQN_FORCE_INLINE Dqn_u64 Dqn_F64__RoundToOdd(Dqn_u64 g1, Dqn_u64 g0, Dqn_u64 cp)
+{
+    Dqn_u64 x1     = 0;
+    Dqn_u64 y1     = 0;
+    Dqn_F64__Mul128(g0, cp, &x1);
+    Dqn_u64 y0     = Dqn_F64__Mul128(g1, cp, &y1);
+    Dqn_u64 z      = (y0 >> 1) + x1;
+    Dqn_u64 result = (y1 + (z >> 63)) | (((z & 0x7FFFFFFFFFFFFFFFULL) + 0x7FFFFFFFFFFFFFFFULL) >> 63);
+    return result;
+}
 
-    if (val == 0)
+DQN_FILE_SCOPE void Dqn_F64__ShortestDecimal(Dqn_i64 q, Dqn_u64 c, Dqn_u64 *digits, Dqn_i64 *exponent)
+{
+    // NOTE: (q * 661971961083) >> 41 is floor(q * log10(2)), (k * 913124641741) >> 38 is floor(k * log2(10))
+    Dqn_u64 out = c & 1;
+    Dqn_u64 cb  = c << 2;
+    Dqn_u64 cbr = cb + 2;
+    Dqn_u64 cbl = 0;
+    Dqn_i64 k   = 0;
+    if (c != (1ULL << 52) || q == -1074)
     {
-        result->buf[buf_index--] = '0';
-        result->len              = 1;
+        cbl = cb - 2;
+        k   = (q * 661971961083LL) >> 41;
     }
     else
     {
-        for (int digit_count = 0; val > 0; result->len++, digit_count++)
+        // NOTE: At a power of 2 the gap to the double below is half the gap above
+        cbl = cb - 1;
+        k   = ((q * 661971961083LL) - 274743187321LL) >> 41;
+    }
+
+    Dqn_u64 const *pow10 = DQN_F64__POW10[-k - DQN_F64__POW10_MIN];
+    Dqn_u64        g_lo  = ((pow10[1] >> 2) | (pow10[0] << 62)) + 1;
+    Dqn_u64        g_hi  = (pow10[0] >> 2) + (g_lo == 0 ? 1 : 0);
+    Dqn_u64        g1    = (g_hi << 1) | (g_lo >> 63);
+    Dqn_u64        g0    = g_lo & 0x7FFFFFFFFFFFFFFFULL;
+
+    Dqn_i64 h   = q + ((-k * 913124641741LL) >> 38) + 2;
+    Dqn_u64 vb  = Dqn_F64__RoundToOdd(g1, g0, cb << h);
+    Dqn_u64 vbl = Dqn_F64__RoundToOdd(g1, g0, cbl << h);
+    Dqn_u64 vbr = Dqn_F64__RoundToOdd(g1, g0, cbr << h);
+
+    // NOTE: Try one digit less first, the multiples of 10 around s. The interval is less than 10 wide
+    // so at most one is in it. Only the smallest subnormals have fewer than 16 digits in s.
+    Dqn_u64 s = vb >> 2;
+    if (s >= 10)
+    {
+        Dqn_u64 sp10 = (s / 10) * 10;
+        Dqn_u64 tp10 = sp10 + 10;
+        Dqn_b32 upin = vbl + out <= sp10 << 2;
+        Dqn_b32 wpin = (tp10 << 2) + out <= vbr;
+        if (upin != wpin)
         {
-            if (comma_sep && (digit_count != 0) && (digit_count % 3 == 0))
-            {
-                result->buf[buf_index--] = ',';
-                result->len++;
-            }
+            *digits   = upin ? sp10 : tp10;
+            *exponent = k;
+            return;
+        }
+    }
+
+    Dqn_u64 t   = s + 1;
+    Dqn_b32 uin = vbl + out <= s << 2;
+    Dqn_b32 win = (t << 2) + out <= vbr;
+    if (uin != win)
+    {
+        *digits   = uin ? s : t;
+        *exponent = k;
+        return;
+    }
+
+    // NOTE: Both in the interval, pick the closer one and the even one on a tie
+    Dqn_i64 cmp = DQN_CAST(Dqn_i64)(vb - ((s + t) << 1));
+    *digits     = (cmp < 0 || (cmp == 0 && (s & 1) == 0)) ? s : t;
+    *exponent   = k;
+}
+
+DQN_API Dqn_isize Dqn_F64ToStrBuffer(Dqn_f64 value, char *buf)
+{
+    Dqn_u64 bits            = Dqn_F64__ToBits(value);
+    Dqn_b32 negative        = DQN_CAST(Dqn_b32)(bits >> 63);
+    Dqn_u64 fraction        = bits & ((1ULL << 52) - 1);
+    Dqn_i64 biased_exponent = DQN_CAST(Dqn_i64)((bits >> 52) & 0x7FF);
 
-            auto digit               = DQN_CAST(char)(val % 10);
-            result->buf[buf_index--] = '0' + digit;
-            val /= 10;
+    char *ptr = buf;
+    if (biased_exponent == 0x7FF && fraction)
+    {
+        DQN_MEMCOPY(ptr, "nan", 3);
+        return 3;
+    }
+
+    if (negative)
+        *ptr++ = '-';
+
+    if (biased_exponent == 0x7FF)
+    {
+        DQN_MEMCOPY(ptr, "inf", 3);
+        return (ptr - buf) + 3;
+    }
+
+    if (biased_exponent == 0 && fraction == 0)
+    {
+        *ptr++ = '0';
+        return ptr - buf;
+    }
+
+    // NOTE: value = digits * 10^exponent
+    Dqn_u64 digits   = 0;
+    Dqn_i64 exponent = 0;
+    if (biased_exponent)
+    {
+        Dqn_i64 q = biased_exponent - 1075;
+        Dqn_u64 c = (1ULL << 52) | fraction;
+        if (q < 0 && q > -53 && ((c >> -q) << -q) == c)
+            digits = c >> -q; // NOTE: An integer below 2^53, its digits are the shortest form
+        else
+            Dqn_F64__ShortestDecimal(q, c, &digits, &exponent);
+    }
+    else
+    {
+        Dqn_F64__ShortestDecimal(-1074, fraction, &digits, &exponent);
+    }
+
+    for (; digits % 10 == 0; exponent++)
+        digits /= 10;
+
+    char        digit_str[20];
+    Dqn_isize   digit_count = Dqn_U64ToStrBuffer(digits, digit_str, false /*comma_sep*/);
+
+    // NOTE: value = 0.<digits> * 10^point
+    Dqn_i64 point = digit_count + exponent;
+    if (point >= digit_count && point <= 21)
+    {
+        DQN_MEMCOPY(ptr, digit_str, DQN_CAST(size_t)digit_count);
+        DQN_MEMSET(ptr + digit_count, '0', DQN_CAST(size_t)(point - digit_count));
+        ptr += point;
+    }
+    else if (point > 0 && point <= 21)
+    {
+        DQN_MEMCOPY(ptr, digit_str, DQN_CAST(size_t)point);
+        ptr        += point;
+        *ptr++      = '.';
+        DQN_MEMCOPY(ptr, digit_str + point, DQN_CAST(size_t)(digit_count - point));
+        ptr        += digit_count - point;
+    }
+    else if (point > -6 && point <= 0)
+    {
+        *ptr++ = '0';
+        *ptr++ = '.';
+        DQN_MEMSET(ptr, '0', DQN_CAST(size_t)-point);
+        ptr   += -point;
+        DQN_MEMCOPY(ptr, digit_str, DQN_CAST(size_t)digit_count);
+        ptr   += digit_count;
+    }
+    else
+    {
+        *ptr++ = digit_str[0];
+        if (digit_count > 1)
+        {
+            *ptr++ = '.';
+            DQN_MEMCOPY(ptr, digit_str + 1, DQN_CAST(size_t)(digit_count - 1));
+            ptr   += digit_count - 1;
         }
+
+        Dqn_i64 exponent10 = point - 1;
+        *ptr++             = 'e';
+        *ptr++             = exponent10 < 0 ? '-' : '+';
+        if (exponent10 < 0)
+            exponent10 = -exponent10;
+        if (exponent10 >= 100) *ptr++ = DQN_CAST(char)('0' + (exponent10 / 100));
+        if (exponent10 >= 10)  *ptr++ = DQN_CAST(char)('0' + (exponent10 / 10 % 10));
+        *ptr++ = DQN_CAST(char)('0' + (exponent10 % 10));
     }
 
-    result->str = result->buf + (buf_index + 1);
-    return result->str;
+    Dqn_isize result = ptr - buf;
+    return result;
 }
 
-DQN_API char *Dqn_U64ToTempStr(Dqn_u64 val, Dqn_b32 comma_sep)
+DQN_API Dqn_FixedString<32> Dqn_F64ToStr(Dqn_f64 value)
 {
-    DQN_LOCAL_PERSIST Dqn_U64Str string;
-    string = {};
-    char *result = Dqn_U64ToStr(val, &string, comma_sep);
+    Dqn_FixedString<32> result = {};
+    result.size                = Dqn_F64ToStrBuffer(value, result.data);
+    result.data[result.size]   = 0;
+    return result;
+}
+
+DQN_API Dqn_String Dqn_F64ToArenaStr(Dqn_ArenaAllocator *arena, Dqn_f64 value)
+{
+    char       buf[DQN_F64_STR_MAX_SIZE];
+    Dqn_isize  size   = Dqn_F64ToStrBuffer(value, buf);
+    Dqn_String result = Dqn_String_ArenaAllocate(arena, size + 1, Dqn_ZeroMem::No);
+    if (result.str)
+    {
+        DQN_MEMCOPY(result.str, buf, DQN_CAST(size_t)size);
+        result.str[size] = 0;
+        result.size      = size;
+    }
     return result;
 }
 
@@ -5578,53 +10602,38 @@ DQN_API Dqn_u32 Dqn_MurmurHash3_x86_32(void const *key, int len, Dqn_u32 seed)
 
     h1 = Dqn_MurmurHash3__FMix32(h1);
 
-    return h1;
-}
-
-DQN_API Dqn_MurmurHash3_128 Dqn_MurmurHash3_x64_128(void const *key, int len, Dqn_u32 seed)
-{
-    const Dqn_u8 *data = (const Dqn_u8 *)key;
-    const int nblocks   = len / 16;
-
-    Dqn_u64 h1 = seed;
-    Dqn_u64 h2 = seed;
-
-    const Dqn_u64 c1 = 0x87c37b91114253d5;
-    const Dqn_u64 c2 = 0x4cf5ad432745937f;
-
-    //----------
-    // body
-
-    const Dqn_u64 *blocks = (const Dqn_u64 *)(data);
-
-    for (int i = 0; i < nblocks; i++)
-    {
-        Dqn_u64 k1 = Dqn_MurmurHash3__GetBlock64(blocks, i * 2 + 0);
-        Dqn_u64 k2 = Dqn_MurmurHash3__GetBlock64(blocks, i * 2 + 1);
+    return h1;
+}
 
-        k1 *= c1;
-        k1 = DQN_MMH3_ROTL64(k1, 31);
-        k1 *= c2;
-        h1 ^= k1;
+DQN_MMH3_FORCE_INLINE void Dqn_MurmurHash3__x64_128Block(Dqn_u64 *h1, Dqn_u64 *h2, Dqn_u64 k1, Dqn_u64 k2)
+{
+    const Dqn_u64 c1 = 0x87c37b91114253d5;
+    const Dqn_u64 c2 = 0x4cf5ad432745937f;
 
-        h1 = DQN_MMH3_ROTL64(h1, 27);
-        h1 += h2;
-        h1 = h1 * 5 + 0x52dce729;
+    k1 *= c1;
+    k1 = DQN_MMH3_ROTL64(k1, 31);
+    k1 *= c2;
+    *h1 ^= k1;
 
-        k2 *= c2;
-        k2 = DQN_MMH3_ROTL64(k2, 33);
-        k2 *= c1;
-        h2 ^= k2;
+    *h1 = DQN_MMH3_ROTL64(*h1, 27);
+    *h1 += *h2;
+    *h1 = *h1 * 5 + 0x52dce729;
 
-        h2 = DQN_MMH3_ROTL64(h2, 31);
-        h2 += h1;
-        h2 = h2 * 5 + 0x38495ab5;
-    }
+    k2 *= c2;
+    k2 = DQN_MMH3_ROTL64(k2, 33);
+    k2 *= c1;
+    *h2 ^= k2;
 
-    //----------
-    // tail
+    *h2 = DQN_MMH3_ROTL64(*h2, 31);
+    *h2 += *h1;
+    *h2 = *h2 * 5 + 0x38495ab5;
+}
 
-    const Dqn_u8 *tail = (const Dqn_u8 *)(data + nblocks * 16);
+// NOTE: Mix in the (len & 15) bytes of 'tail' that didn't make a full block and finalize
+DQN_MMH3_FORCE_INLINE Dqn_MurmurHash3_128 Dqn_MurmurHash3__x64_128Final(Dqn_u64 h1, Dqn_u64 h2, const Dqn_u8 *tail, Dqn_u64 len)
+{
+    const Dqn_u64 c1 = 0x87c37b91114253d5;
+    const Dqn_u64 c2 = 0x4cf5ad432745937f;
 
     Dqn_u64 k1 = 0;
     Dqn_u64 k2 = 0;
@@ -5693,7 +10702,577 @@ DQN_API Dqn_MurmurHash3_128 Dqn_MurmurHash3_x64_128(void const *key, int len, Dq
     return result;
 }
 
+DQN_API Dqn_MurmurHash3_128 Dqn_MurmurHash3_x64_128(void const *key, int len, Dqn_u32 seed)
+{
+    const Dqn_u8 *data = (const Dqn_u8 *)key;
+    const int nblocks   = len / 16;
+
+    Dqn_u64 h1 = seed;
+    Dqn_u64 h2 = seed;
+
+    //----------
+    // body
+
+    const Dqn_u64 *blocks = (const Dqn_u64 *)(data);
+
+    for (int i = 0; i < nblocks; i++)
+    {
+        Dqn_u64 k1 = Dqn_MurmurHash3__GetBlock64(blocks, i * 2 + 0);
+        Dqn_u64 k2 = Dqn_MurmurHash3__GetBlock64(blocks, i * 2 + 1);
+        Dqn_MurmurHash3__x64_128Block(&h1, &h2, k1, k2);
+    }
+
+    //----------
+    // tail and finalization
+
+    const Dqn_u8 *tail = (const Dqn_u8 *)(data + nblocks * 16);
+    Dqn_MurmurHash3_128 result = Dqn_MurmurHash3__x64_128Final(h1, h2, tail, DQN_CAST(Dqn_u64)len);
+    return result;
+}
+
+DQN_API Dqn_MurmurHash3_x64_128State Dqn_MurmurHash3_x64_128_Init(Dqn_u32 seed)
+{
+    Dqn_MurmurHash3_x64_128State result = {};
+    result.h1                           = seed;
+    result.h2                           = seed;
+    return result;
+}
+
+DQN_API void Dqn_MurmurHash3_x64_128_Update(Dqn_MurmurHash3_x64_128State *state, void const *bytes, Dqn_isize size)
+{
+    auto const *data      = DQN_CAST(Dqn_u8 const *)bytes;
+    Dqn_isize   tail_size = DQN_CAST(Dqn_isize)(state->size & 15);
+    state->size          += size;
+
+    // NOTE: Complete the block left over from the previous update first
+    if (tail_size)
+    {
+        Dqn_isize copy_size = DQN_M_MIN(16 - tail_size, size);
+        DQN_MEMCOPY(state->tail + tail_size, data, copy_size);
+        data += copy_size;
+        size -= copy_size;
+        if (tail_size + copy_size < 16)
+            return;
+
+        Dqn_u64 block[2];
+        DQN_MEMCOPY(block, state->tail, sizeof(block));
+        Dqn_MurmurHash3__x64_128Block(&state->h1, &state->h2, block[0], block[1]);
+    }
+
+    for (; size >= 16; size -= 16, data += 16)
+    {
+        Dqn_u64 block[2];
+        DQN_MEMCOPY(block, data, sizeof(block));
+        Dqn_MurmurHash3__x64_128Block(&state->h1, &state->h2, block[0], block[1]);
+    }
+
+    if (size)
+        DQN_MEMCOPY(state->tail, data, size);
+}
+
+DQN_API Dqn_MurmurHash3_128 Dqn_MurmurHash3_x64_128_Final(Dqn_MurmurHash3_x64_128State const *state)
+{
+    Dqn_MurmurHash3_128 result = Dqn_MurmurHash3__x64_128Final(state->h1, state->h2, state->tail, state->size);
+    return result;
+}
+
 //-----------------------------------------------------------------------------
+
+// -------------------------------------------------------------------------------------------------
+//
+// NOTE: Hashing - Dqn_FastHash64
+//
+// -------------------------------------------------------------------------------------------------
+Dqn_u64   constexpr DQN_FAST_HASH__PRIME64_0        = 0xa0761d6478bd642fULL;
+Dqn_u64   constexpr DQN_FAST_HASH__PRIME64_1        = 0xe7037ed1a0b428dbULL;
+Dqn_u64   constexpr DQN_FAST_HASH__PRIME64_2        = 0x9E3779B185EBCA87ULL;
+Dqn_u32   constexpr DQN_FAST_HASH__PRIME32          = 0x9E3779B1U;
+Dqn_isize constexpr DQN_FAST_HASH__SHORT_SIZE       = 16;
+Dqn_isize constexpr DQN_FAST_HASH__MEDIUM_SIZE      = 256;
+Dqn_isize constexpr DQN_FAST_HASH__STRIPE_SIZE      = 64;
+Dqn_isize constexpr DQN_FAST_HASH__STRIPES_PER_BLOCK = 16;
+Dqn_isize constexpr DQN_FAST_HASH__BLOCK_SIZE       = DQN_FAST_HASH__STRIPE_SIZE * DQN_FAST_HASH__STRIPES_PER_BLOCK;
+Dqn_isize constexpr DQN_FAST_HASH__SECRET_SIZE      = 192;
+
+// NOTE: Random bytes (splitmix64) keying the long input path. Stripe N of a block reads the 64 bytes
+// at offset N * 8, the scramble at the end of each block reads the last 64 bytes.
+Dqn_u64 const DQN_FAST_HASH__SECRET[DQN_FAST_HASH__SECRET_SIZE / sizeof(Dqn_u64)] =
+{
+    0xd74564da8f0de7fdULL, 0xdfa823e696654317ULL, 0x366d365aa8aab935ULL, 0xb547a6154144dda3ULL,
+    0xa86139d968abe7aeULL, 0x43c44f3c3f6b08ffULL, 0xd1ca6edd59fd7068ULL, 0x6ab56a408b35a32bULL,
+    0x4d20f8915de0e554ULL, 0x0f379ac072ceec0aULL, 0xade906b1e6ec7876ULL, 0xc18d5fc99251d1ffULL,
+    0x4066319b0d48292fULL, 0x50806f1e4a9df017ULL, 0xe4928dbd6bf51e76ULL, 0xdf977cbd16b166e2ULL,
+    0x7616d561c5a77d75ULL, 0x22fa4721eded9d24ULL, 0xa4e68d4b11b4752eULL, 0xaeec64c21bb38efbULL,
+    0x74fe5efab19bdf44ULL, 0x640ecbb678c9a62dULL, 0xaba2f727811db7baULL, 0xd867c468f24e3cc7ULL,
+};
+
+DQN_FORCE_INLINE Dqn_u64 Dqn_FastHash__Read64(Dqn_u8 const *ptr)
+{
+    Dqn_u64 result;
+    DQN_MEMCOPY(&result, ptr, sizeof(result));
+    return result;
+}
+
+DQN_FORCE_INLINE Dqn_u64 Dqn_FastHash__Read32(Dqn_u8 const *ptr)
+{
+    Dqn_u32 result;
+    DQN_MEMCOPY(&result, ptr, sizeof(result));
+    return result;
+}
+
+// NOTE: Multiply to 128 bits and fold the high half into the low half
+DQN_FORCE_INLINE Dqn_u64 Dqn_FastHash__Mix(Dqn_u64 a, Dqn_u64 b)
+{
+#if defined(__SIZEOF_INT128__)
+    __uint128_t product = DQN_CAST(__uint128_t)a * b;
+    Dqn_u64     result  = DQN_CAST(Dqn_u64)product ^ DQN_CAST(Dqn_u64)(product >> 64);
+#elif defined(DQN_COMPILER_W32_MSVC) && defined(_M_X64)
+    Dqn_u64 hi     = 0;
+    Dqn_u64 lo     = _umul128(a, b, &hi);
+    Dqn_u64 result = lo ^ hi;
+#else
+    Dqn_u64 a_lo   = a & 0xFFFFFFFF, a_hi = a >> 32;
+    Dqn_u64 b_lo   = b & 0xFFFFFFFF, b_hi = b >> 32;
+    Dqn_u64 lo_lo  = a_lo * b_lo;
+    Dqn_u64 hi_lo  = a_hi * b_lo;
+    Dqn_u64 cross  = (lo_lo >> 32) + (hi_lo & 0xFFFFFFFF) + (a_lo * b_hi);
+    Dqn_u64 hi     = (a_hi * b_hi) + (hi_lo >> 32) + (cross >> 32);
+    Dqn_u64 lo     = (cross << 32) | (lo_lo & 0xFFFFFFFF);
+    Dqn_u64 result = lo ^ hi;
+#endif
+    return result;
+}
+
+// NOTE: Long input path, 'acc' is 8 lanes. Every stripe adds each lane's data to its neighbour and
+// the product of the low and high 32 bits of the data xor'ed with the secret to itself. Once a block
+// the lanes are scrambled by a multiply so no lane degenerates over multi-megabyte inputs.
+DQN_FORCE_INLINE void Dqn_FastHash__AccumulateScalar(Dqn_u64 *acc, Dqn_u8 const *stripe, Dqn_u8 const *secret)
+{
+    for (int lane = 0; lane < 8; lane++)
+    {
+        Dqn_u64 data    = Dqn_FastHash__Read64(stripe + (lane * 8));
+        Dqn_u64 key     = data ^ Dqn_FastHash__Read64(secret + (lane * 8));
+        acc[lane ^ 1]  += data;
+        acc[lane]      += (key & 0xFFFFFFFF) * (key >> 32);
+    }
+}
+
+DQN_FORCE_INLINE void Dqn_FastHash__ScrambleScalar(Dqn_u64 *acc, Dqn_u8 const *secret)
+{
+    for (int lane = 0; lane < 8; lane++)
+    {
+        Dqn_u64 value = acc[lane];
+        value        ^= value >> 47;
+        value        ^= Dqn_FastHash__Read64(secret + (lane * 8));
+        value        *= DQN_FAST_HASH__PRIME32;
+        acc[lane]     = value;
+    }
+}
+
+DQN_API void Dqn_FastHash__LongScalar(Dqn_u64 *acc, Dqn_u8 const *bytes, Dqn_isize size, Dqn_u8 const *secret)
+{
+    Dqn_isize block_count = (size - 1) / DQN_FAST_HASH__BLOCK_SIZE;
+    for (Dqn_isize block = 0; block < block_count; block++)
+    {
+        Dqn_u8 const *block_ptr = bytes + (block * DQN_FAST_HASH__BLOCK_SIZE);
+        for (Dqn_isize stripe = 0; stripe < DQN_FAST_HASH__STRIPES_PER_BLOCK; stripe++)
+            Dqn_FastHash__AccumulateScalar(acc, block_ptr + (stripe * DQN_FAST_HASH__STRIPE_SIZE), secret + (stripe * 8));
+        Dqn_FastHash__ScrambleScalar(acc, secret + DQN_FAST_HASH__SECRET_SIZE - DQN_FAST_HASH__STRIPE_SIZE);
+    }
+
+    Dqn_u8 const *tail         = bytes + (block_count * DQN_FAST_HASH__BLOCK_SIZE);
+    Dqn_isize     stripe_count = ((size - 1) - (block_count * DQN_FAST_HASH__BLOCK_SIZE)) / DQN_FAST_HASH__STRIPE_SIZE;
+    for (Dqn_isize stripe = 0; stripe < stripe_count; stripe++)
+        Dqn_FastHash__AccumulateScalar(acc, tail + (stripe * DQN_FAST_HASH__STRIPE_SIZE), secret + (stripe * 8));
+
+    // NOTE: The last stripe always ends on the last byte, overlapping the previous stripe if needed
+    Dqn_FastHash__AccumulateScalar(acc, bytes + size - DQN_FAST_HASH__STRIPE_SIZE, secret + DQN_FAST_HASH__SECRET_SIZE - DQN_FAST_HASH__STRIPE_SIZE - 7);
+}
+
+#if defined(DQN_SSE2)
+DQN_FORCE_INLINE void Dqn_FastHash__AccumulateSSE2(__m128i *acc, Dqn_u8 const *stripe, Dqn_u8 const *secret)
+{
+    for (int index = 0; index < 4; index++)
+    {
+        __m128i data    = _mm_loadu_si128(DQN_CAST(__m128i const *)stripe + index);
+        __m128i key     = _mm_xor_si128(data, _mm_loadu_si128(DQN_CAST(__m128i const *)secret + index));
+        __m128i key_hi  = _mm_shuffle_epi32(key, _MM_SHUFFLE(0, 3, 0, 1));
+        __m128i product = _mm_mul_epu32(key, key_hi);
+        __m128i swapped = _mm_shuffle_epi32(data, _MM_SHUFFLE(1, 0, 3, 2));
+        acc[index]      = _mm_add_epi64(acc[index], _mm_add_epi64(product, swapped));
+    }
+}
+
+DQN_FORCE_INLINE void Dqn_FastHash__ScrambleSSE2(__m128i *acc, Dqn_u8 const *secret)
+{
+    __m128i prime = _mm_set1_epi32(DQN_CAST(int)DQN_FAST_HASH__PRIME32);
+    for (int index = 0; index < 4; index++)
+    {
+        __m128i value    = acc[index];
+        value            = _mm_xor_si128(value, _mm_srli_epi64(value, 47));
+        value            = _mm_xor_si128(value, _mm_loadu_si128(DQN_CAST(__m128i const *)secret + index));
+        __m128i value_hi = _mm_shuffle_epi32(value, _MM_SHUFFLE(0, 3, 0, 1));
+        acc[index]       = _mm_add_epi64(_mm_mul_epu32(value, prime), _mm_slli_epi64(_mm_mul_epu32(value_hi, prime), 32));
+    }
+}
+
+DQN_API void Dqn_FastHash__LongSSE2(Dqn_u64 *acc, Dqn_u8 const *bytes, Dqn_isize size, Dqn_u8 const *secret)
+{
+    __m128i acc_sse2[4];
+    for (int index = 0; index < 4; index++)
+        acc_sse2[index] = _mm_loadu_si128(DQN_CAST(__m128i const *)acc + index);
+
+    Dqn_isize block_count = (size - 1) / DQN_FAST_HASH__BLOCK_SIZE;
+    for (Dqn_isize block = 0; block < block_count; block++)
+    {
+        Dqn_u8 const *block_ptr = bytes + (block * DQN_FAST_HASH__BLOCK_SIZE);
+        for (Dqn_isize stripe = 0; stripe < DQN_FAST_HASH__STRIPES_PER_BLOCK; stripe++)
+            Dqn_FastHash__AccumulateSSE2(acc_sse2, block_ptr + (stripe * DQN_FAST_HASH__STRIPE_SIZE), secret + (stripe * 8));
+        Dqn_FastHash__ScrambleSSE2(acc_sse2, secret + DQN_FAST_HASH__SECRET_SIZE - DQN_FAST_HASH__STRIPE_SIZE);
+    }
+
+    Dqn_u8 const *tail         = bytes + (block_count * DQN_FAST_HASH__BLOCK_SIZE);
+    Dqn_isize     stripe_count = ((size - 1) - (block_count * DQN_FAST_HASH__BLOCK_SIZE)) / DQN_FAST_HASH__STRIPE_SIZE;
+    for (Dqn_isize stripe = 0; stripe < stripe_count; stripe++)
+        Dqn_FastHash__AccumulateSSE2(acc_sse2, tail + (stripe * DQN_FAST_HASH__STRIPE_SIZE), secret + (stripe * 8));
+    Dqn_FastHash__AccumulateSSE2(acc_sse2, bytes + size - DQN_FAST_HASH__STRIPE_SIZE, secret + DQN_FAST_HASH__SECRET_SIZE - DQN_FAST_HASH__STRIPE_SIZE - 7);
+
+    for (int index = 0; index < 4; index++)
+        _mm_storeu_si128(DQN_CAST(__m128i *)acc + index, acc_sse2[index]);
+}
+#endif // DQN_SSE2
+
+#if defined(DQN_AVX2)
+DQN_AVX2_FUNCTION DQN_FORCE_INLINE void Dqn_FastHash__AccumulateAVX2(__m256i *acc, Dqn_u8 const *stripe, Dqn_u8 const *secret)
+{
+    for (int index = 0; index < 2; index++)
+    {
+        __m256i data    = _mm256_loadu_si256(DQN_CAST(__m256i const *)stripe + index);
+        __m256i key     = _mm256_xor_si256(data, _mm256_loadu_si256(DQN_CAST(__m256i const *)secret + index));
+        __m256i key_hi  = _mm256_shuffle_epi32(key, _MM_SHUFFLE(0, 3, 0, 1));
+        __m256i product = _mm256_mul_epu32(key, key_hi);
+        __m256i swapped = _mm256_shuffle_epi32(data, _MM_SHUFFLE(1, 0, 3, 2));
+        acc[index]      = _mm256_add_epi64(acc[index], _mm256_add_epi64(product, swapped));
+    }
+}
+
+DQN_AVX2_FUNCTION DQN_FORCE_INLINE void Dqn_FastHash__ScrambleAVX2(__m256i *acc, Dqn_u8 const *secret)
+{
+    __m256i prime = _mm256_set1_epi32(DQN_CAST(int)DQN_FAST_HASH__PRIME32);
+    for (int index = 0; index < 2; index++)
+    {
+        __m256i value    = acc[index];
+        value            = _mm256_xor_si256(value, _mm256_srli_epi64(value, 47));
+        value            = _mm256_xor_si256(value, _mm256_loadu_si256(DQN_CAST(__m256i const *)secret + index));
+        __m256i value_hi = _mm256_shuffle_epi32(value, _MM_SHUFFLE(0, 3, 0, 1));
+        acc[index]       = _mm256_add_epi64(_mm256_mul_epu32(value, prime), _mm256_slli_epi64(_mm256_mul_epu32(value_hi, prime), 32));
+    }
+}
+
+DQN_AVX2_FUNCTION DQN_API void Dqn_FastHash__LongAVX2(Dqn_u64 *acc, Dqn_u8 const *bytes, Dqn_isize size, Dqn_u8 const *secret)
+{
+    __m256i acc_avx2[2];
+    for (int index = 0; index < 2; index++)
+        acc_avx2[index] = _mm256_loadu_si256(DQN_CAST(__m256i const *)acc + index);
+
+    Dqn_isize block_count = (size - 1) / DQN_FAST_HASH__BLOCK_SIZE;
+    for (Dqn_isize block = 0; block < block_count; block++)
+    {
+        Dqn_u8 const *block_ptr = bytes + (block * DQN_FAST_HASH__BLOCK_SIZE);
+        for (Dqn_isize stripe = 0; stripe < DQN_FAST_HASH__STRIPES_PER_BLOCK; stripe++)
+            Dqn_FastHash__AccumulateAVX2(acc_avx2, block_ptr + (stripe * DQN_FAST_HASH__STRIPE_SIZE), secret + (stripe * 8));
+        Dqn_FastHash__ScrambleAVX2(acc_avx2, secret + DQN_FAST_HASH__SECRET_SIZE - DQN_FAST_HASH__STRIPE_SIZE);
+    }
+
+    Dqn_u8 const *tail         = bytes + (block_count * DQN_FAST_HASH__BLOCK_SIZE);
+    Dqn_isize     stripe_count = ((size - 1) - (block_count * DQN_FAST_HASH__BLOCK_SIZE)) / DQN_FAST_HASH__STRIPE_SIZE;
+    for (Dqn_isize stripe = 0; stripe < stripe_count; stripe++)
+        Dqn_FastHash__AccumulateAVX2(acc_avx2, tail + (stripe * DQN_FAST_HASH__STRIPE_SIZE), secret + (stripe * 8));
+    Dqn_FastHash__AccumulateAVX2(acc_avx2, bytes + size - DQN_FAST_HASH__STRIPE_SIZE, secret + DQN_FAST_HASH__SECRET_SIZE - DQN_FAST_HASH__STRIPE_SIZE - 7);
+
+    for (int index = 0; index < 2; index++)
+        _mm256_storeu_si256(DQN_CAST(__m256i *)acc + index, acc_avx2[index]);
+}
+#endif // DQN_AVX2
+
+DQN_API Dqn_FastHashPath Dqn_FastHash64_Path()
+{
+    Dqn_CPUFeatures  features = Dqn_CPU_Features();
+    Dqn_FastHashPath result   = Dqn_FastHashPath::Scalar;
+#if defined(DQN_SSE2)
+    if (features.sse2)
+        result = Dqn_FastHashPath::SSE2;
+#endif
+#if defined(DQN_AVX2)
+    if (features.avx2)
+        result = Dqn_FastHashPath::AVX2;
+#endif
+    (void)features;
+    return result;
+}
+
+DQN_FORCE_INLINE Dqn_u64 Dqn_FastHash__Hash(void const *bytes, Dqn_isize size, Dqn_u64 seed, Dqn_FastHashPath path)
+{
+    auto const *ptr = DQN_CAST(Dqn_u8 const *)bytes;
+    seed           ^= DQN_FAST_HASH__PRIME64_0;
+
+    Dqn_u64 a = 0, b = 0;
+    if (size <= DQN_FAST_HASH__SHORT_SIZE)
+    {
+        if (size >= 4)
+        {
+            // NOTE: 2 overlapping reads from each end cover 4-16 bytes without a loop
+            Dqn_isize offset = (size >> 3) << 2;
+            a                = (Dqn_FastHash__Read32(ptr) << 32) | Dqn_FastHash__Read32(ptr + offset);
+            b                = (Dqn_FastHash__Read32(ptr + size - 4) << 32) | Dqn_FastHash__Read32(ptr + size - 4 - offset);
+        }
+        else if (size > 0)
+        {
+            a = (DQN_CAST(Dqn_u64)ptr[0] << 16) | (DQN_CAST(Dqn_u64)ptr[size >> 1] << 8) | ptr[size - 1];
+        }
+    }
+    else if (size <= DQN_FAST_HASH__MEDIUM_SIZE)
+    {
+        Dqn_isize remaining = size;
+        for (; remaining > 16; remaining -= 16, ptr += 16)
+            seed = Dqn_FastHash__Mix(Dqn_FastHash__Read64(ptr) ^ DQN_FAST_HASH__PRIME64_1, Dqn_FastHash__Read64(ptr + 8) ^ seed);
+
+        // NOTE: The last 16 bytes of the input, overlapping the previous chunk if needed
+        a = Dqn_FastHash__Read64(ptr + remaining - 16);
+        b = Dqn_FastHash__Read64(ptr + remaining - 8);
+    }
+    else
+    {
+        Dqn_u64 acc[8] =
+        {
+            DQN_FAST_HASH__PRIME32,           DQN_FAST_HASH__PRIME64_0,           DQN_FAST_HASH__PRIME64_1, DQN_FAST_HASH__PRIME64_2,
+            DQN_FAST_HASH__PRIME64_0 ^ seed,  DQN_FAST_HASH__PRIME64_1 ^ seed,    DQN_FAST_HASH__PRIME64_2 ^ seed, DQN_FAST_HASH__PRIME32 ^ seed,
+        };
+
+        auto const *secret = DQN_CAST(Dqn_u8 const *)DQN_FAST_HASH__SECRET;
+        path               = DQN_M_MIN(path, Dqn_FastHash64_Path());
+        switch (path)
+        {
+#if defined(DQN_AVX2)
+            case Dqn_FastHashPath::AVX2: Dqn_FastHash__LongAVX2(acc, ptr, size, secret); break;
+#endif
+#if defined(DQN_SSE2)
+            case Dqn_FastHashPath::SSE2: Dqn_FastHash__LongSSE2(acc, ptr, size, secret); break;
+#endif
+            default: Dqn_FastHash__LongScalar(acc, ptr, size, secret); break;
+        }
+
+        // NOTE: Merge the lanes pairwise into the 2 words, keyed by unaligned parts of the secret
+        for (int lane = 0; lane < 8; lane += 2)
+        {
+            Dqn_u64 merged = Dqn_FastHash__Mix(acc[lane]     ^ Dqn_FastHash__Read64(secret + 11 + (lane * 8)),
+                                               acc[lane + 1] ^ Dqn_FastHash__Read64(secret + 19 + (lane * 8)));
+            if (lane < 4) a += merged;
+            else          b += merged;
+        }
+    }
+
+    Dqn_u64 result = Dqn_FastHash__Mix(DQN_FAST_HASH__PRIME64_1 ^ DQN_CAST(Dqn_u64)size, Dqn_FastHash__Mix(a ^ DQN_FAST_HASH__PRIME64_1, b ^ seed));
+    return result;
+}
+
+DQN_API Dqn_u64 Dqn_FastHash64_WithPath(void const *bytes, Dqn_isize size, Dqn_u64 seed, Dqn_FastHashPath path)
+{
+    Dqn_u64 result = Dqn_FastHash__Hash(bytes, size, seed, path);
+    return result;
+}
+
+DQN_API Dqn_u64 Dqn_FastHash64(void const *bytes, Dqn_isize size, Dqn_u64 seed)
+{
+    // NOTE: AVX2 is capped to the fastest path the CPU supports
+    Dqn_u64 result = Dqn_FastHash__Hash(bytes, size, seed, Dqn_FastHashPath::AVX2);
+    return result;
+}
+
+// -------------------------------------------------------------------------------------------------
+//
+// NOTE: Hashing - Dqn_CRC32C
+//
+// -------------------------------------------------------------------------------------------------
+// NOTE: The CRC is computed on the register without the initial and final inversion, the public
+// functions invert on the way in and out. Polynomials are bit reflected, x^0 is the top bit.
+Dqn_u32   constexpr DQN_CRC32C__POLYNOMIAL        = 0x82F63B78;
+Dqn_isize constexpr DQN_CRC32C__STREAM_SIZE       = 8 * 1024;
+Dqn_isize constexpr DQN_CRC32C__SMALL_STREAM_SIZE = 512;
+
+// NOTE: a * b modulo the polynomial
+constexpr Dqn_u32 Dqn_CRC32C__MultiplyModP(Dqn_u32 a, Dqn_u32 b)
+{
+    Dqn_u32 result = 0;
+    for (Dqn_u32 bit = 1u << 31; bit; bit >>= 1)
+    {
+        if (a & bit)
+            result ^= b;
+        b = (b & 1) ? (b >> 1) ^ DQN_CRC32C__POLYNOMIAL : b >> 1;
+    }
+    return result;
+}
+
+// NOTE: x^(8 * size) modulo the polynomial, multiplying a CRC by this appends 'size' zero bytes
+constexpr Dqn_u32 Dqn_CRC32C__ShiftConstant(Dqn_u64 size)
+{
+    Dqn_u32 result = 1u << 31;                 // x^0
+    Dqn_u32 power  = 1u << 23;                 // x^8, a byte
+    for (Dqn_u64 bits = size; bits; bits >>= 1) // Square and multiply
+    {
+        if (bits & 1)
+            result = Dqn_CRC32C__MultiplyModP(power, result);
+        power = Dqn_CRC32C__MultiplyModP(power, power);
+    }
+    return result;
+}
+
+struct Dqn_CRC32C__Tables
+{
+    Dqn_u32 e[8][256]; // e[N][byte]: The CRC of 'byte' followed by N zero bytes
+};
+
+DQN_FILE_SCOPE Dqn_CRC32C__Tables Dqn_CRC32C__MakeTables()
+{
+    Dqn_CRC32C__Tables result = {};
+    for (Dqn_u32 byte = 0; byte < 256; byte++)
+    {
+        Dqn_u32 crc = byte;
+        for (int bit = 0; bit < 8; bit++)
+            crc = (crc & 1) ? (crc >> 1) ^ DQN_CRC32C__POLYNOMIAL : crc >> 1;
+        result.e[0][byte] = crc;
+    }
+
+    for (int table = 1; table < 8; table++)
+    {
+        for (Dqn_u32 byte = 0; byte < 256; byte++)
+        {
+            Dqn_u32 prev             = result.e[table - 1][byte];
+            result.e[table][byte]    = (prev >> 8) ^ result.e[0][prev & 0xFF];
+        }
+    }
+    return result;
+}
+
+DQN_FILE_SCOPE Dqn_u32 Dqn_CRC32C__Software(Dqn_u8 const *ptr, Dqn_isize size, Dqn_u32 crc)
+{
+    DQN_LOCAL_PERSIST Dqn_CRC32C__Tables const TABLES = Dqn_CRC32C__MakeTables();
+    Dqn_u32 const (*table)[256]                         = TABLES.e;
+    for (; size >= 8; size -= 8, ptr += 8)
+    {
+        Dqn_u64 value;
+        DQN_MEMCOPY(&value, ptr, sizeof(value));
+        value ^= crc;
+        crc    = table[7][(value >>  0) & 0xFF] ^ table[6][(value >>  8) & 0xFF] ^
+                 table[5][(value >> 16) & 0xFF] ^ table[4][(value >> 24) & 0xFF] ^
+                 table[3][(value >> 32) & 0xFF] ^ table[2][(value >> 40) & 0xFF] ^
+                 table[1][(value >> 48) & 0xFF] ^ table[0][(value >> 56)];
+    }
+
+    for (; size > 0; size--, ptr++)
+        crc = table[0][(crc ^ *ptr) & 0xFF] ^ (crc >> 8);
+    return crc;
+}
+
+#if defined(DQN_SSE42)
+DQN_SSE42_FUNCTION DQN_FILE_SCOPE Dqn_u32 Dqn_CRC32C__SSE42(Dqn_u8 const *ptr, Dqn_isize size, Dqn_u32 crc)
+{
+    // NOTE: The CRC32 instruction has a latency of 3 cycles but can start every cycle, run 3
+    // independent streams over adjacent ranges and join them by shifting the first 2 streams over
+    // the bytes that follow them. Large streams amortise the cost of the shift, the smaller size
+    // keeps the remainder of large inputs and medium inputs off the single stream loop.
+    struct Dqn_CRC32C__Streams
+    {
+        Dqn_isize size;
+        Dqn_u32   shift_1_stream;
+        Dqn_u32   shift_2_streams;
+    };
+
+    Dqn_CRC32C__Streams constexpr STREAMS[] =
+    {
+        {DQN_CRC32C__STREAM_SIZE,       Dqn_CRC32C__ShiftConstant(DQN_CRC32C__STREAM_SIZE),       Dqn_CRC32C__ShiftConstant(DQN_CRC32C__STREAM_SIZE * 2)},
+        {DQN_CRC32C__SMALL_STREAM_SIZE, Dqn_CRC32C__ShiftConstant(DQN_CRC32C__SMALL_STREAM_SIZE), Dqn_CRC32C__ShiftConstant(DQN_CRC32C__SMALL_STREAM_SIZE * 2)},
+    };
+
+    for (Dqn_CRC32C__Streams const &streams : STREAMS)
+    {
+        for (; size >= streams.size * 3; size -= streams.size * 3, ptr += streams.size * 3)
+        {
+            Dqn_u64 crc0 = crc, crc1 = 0, crc2 = 0;
+            for (Dqn_isize offset = 0; offset < streams.size; offset += 8)
+            {
+                Dqn_u64 value0, value1, value2;
+                DQN_MEMCOPY(&value0, ptr + offset, sizeof(value0));
+                DQN_MEMCOPY(&value1, ptr + offset + streams.size, sizeof(value1));
+                DQN_MEMCOPY(&value2, ptr + offset + streams.size * 2, sizeof(value2));
+                crc0 = _mm_crc32_u64(crc0, value0);
+                crc1 = _mm_crc32_u64(crc1, value1);
+                crc2 = _mm_crc32_u64(crc2, value2);
+            }
+
+            crc = Dqn_CRC32C__MultiplyModP(streams.shift_2_streams, DQN_CAST(Dqn_u32)crc0) ^
+                  Dqn_CRC32C__MultiplyModP(streams.shift_1_stream,  DQN_CAST(Dqn_u32)crc1) ^
+                  DQN_CAST(Dqn_u32)crc2;
+        }
+    }
+
+    for (; size >= 8; size -= 8, ptr += 8)
+    {
+        Dqn_u64 value;
+        DQN_MEMCOPY(&value, ptr, sizeof(value));
+        crc = DQN_CAST(Dqn_u32)_mm_crc32_u64(crc, value);
+    }
+
+    for (; size > 0; size--, ptr++)
+        crc = _mm_crc32_u8(crc, *ptr);
+    return crc;
+}
+#endif // DQN_SSE42
+
+DQN_API Dqn_CRC32CPath Dqn_CRC32C_Path()
+{
+    Dqn_CRC32CPath result = Dqn_CRC32CPath::Software;
+#if defined(DQN_SSE42)
+    if (Dqn_CPU_Features().sse42)
+        result = Dqn_CRC32CPath::SSE42;
+#endif
+    return result;
+}
+
+DQN_API Dqn_u32 Dqn_CRC32C_IterateWithPath(void const *bytes, Dqn_isize size, Dqn_u32 crc, Dqn_CRC32CPath path)
+{
+    auto const *ptr = DQN_CAST(Dqn_u8 const *)bytes;
+    Dqn_u32 result  = ~crc;
+    path            = DQN_M_MIN(path, Dqn_CRC32C_Path());
+#if defined(DQN_SSE42)
+    if (path == Dqn_CRC32CPath::SSE42)
+        result = Dqn_CRC32C__SSE42(ptr, size, result);
+    else
+#endif
+        result = Dqn_CRC32C__Software(ptr, size, result);
+    result = ~result;
+    return result;
+}
+
+DQN_API Dqn_u32 Dqn_CRC32C_Iterate(void const *bytes, Dqn_isize size, Dqn_u32 crc)
+{
+    Dqn_u32 result = Dqn_CRC32C_IterateWithPath(bytes, size, crc, Dqn_CRC32CPath::SSE42);
+    return result;
+}
+
+DQN_API Dqn_u32 Dqn_CRC32C(void const *bytes, Dqn_isize size)
+{
+    Dqn_u32 result = Dqn_CRC32C_Iterate(bytes, size, 0 /*crc*/);
+    return result;
+}
+
+DQN_API Dqn_u32 Dqn_CRC32C_Combine(Dqn_u32 crc_a, Dqn_u32 crc_b, Dqn_isize size_b)
+{
+    // NOTE: The inversions of A's final and B's initial value cancel out, see zlib's crc32_combine
+    Dqn_u32 result = Dqn_CRC32C__MultiplyModP(Dqn_CRC32C__ShiftConstant(DQN_CAST(Dqn_u64)size_b), crc_a) ^ crc_b;
+    return result;
+}
+
 #endif // DQN_IMPLEMENTATION
 
 #ifdef STB_SPRINTF_IMPLEMENTATION
@@ -7,6 +7,8 @@
 #define DQN_TEST_WITH_MAIN      Define this to enable the main function and allow standalone compiling
                                 and running of the file.
 #define DQN_TEST_NO_ANSI_COLORS Define this to disable any ANSI terminal color codes from output
+#define DQN_TEST_WITH_BENCHMARKS Define this to run the benchmarks after the unit tests in the main
+                                 function. Benchmarks should be compiled with optimisations on.
 */
 
 #if defined(DQN_TEST_WITH_MAIN)
@@ -14,6 +16,10 @@
     #include "Dqn.h"
 #endif
 
+#if !defined(DQN_OS_WIN32)
+    #include <pthread.h>
+#endif
+
 struct Dqn_TestState
 {
     int           indent_level;
@@ -136,6 +142,281 @@ void Dqn_TestState_PrintResult(Dqn_TestState const *result)
     }
 }
 
+void Dqn_Test_PrintBenchmark(char const *name, Dqn_f64 count, char const *unit, Dqn_f64 duration_ms)
+{
+    char const INDENT[]   = "  ";
+    int const DESIRED_LEN = 72;
+    fprintf(stdout, "%s%s ", INDENT, name);
+
+    Dqn_isize remaining_size = DESIRED_LEN - DQN_CAST(Dqn_isize)strlen(name) - Dqn_CharCount(INDENT) - 1;
+    remaining_size           = DQN_M_MAX(remaining_size, 0);
+    DQN_FOR_EACH(i, remaining_size) fprintf(stdout, ".");
+
+    Dqn_f64 per_s = count / (duration_ms / 1000.0);
+    fprintf(stdout, " %10.2f M %s/s (%.2fms)\n", per_s / 1'000'000.0, unit, duration_ms);
+}
+
+// -------------------------------------------------------------------------------------------------
+//
+// NOTE: Dqn_TestThread
+//
+// -------------------------------------------------------------------------------------------------
+struct Dqn_TestThread
+{
+#if defined(DQN_OS_WIN32)
+    void *handle;
+#else
+    pthread_t handle;
+#endif
+    void (*function)(void *user_context);
+    void *user_context;
+};
+
+#if defined(DQN_OS_WIN32)
+DWORD Dqn_TestThread__Entry(void *user_context)
+#else
+void *Dqn_TestThread__Entry(void *user_context)
+#endif
+{
+    auto *thread = DQN_CAST(Dqn_TestThread *)user_context;
+    thread->function(thread->user_context);
+#if defined(DQN_OS_WIN32)
+    return 0;
+#else
+    return nullptr;
+#endif
+}
+
+Dqn_b32 Dqn_TestThread_Start(Dqn_TestThread *thread, void (*function)(void *user_context), void *user_context)
+{
+    thread->function     = function;
+    thread->user_context = user_context;
+#if defined(DQN_OS_WIN32)
+    thread->handle = CreateThread(nullptr /*thread_attributes*/, 0 /*stack_size*/, Dqn_TestThread__Entry, thread, 0 /*creation_flags*/, nullptr /*thread_id*/);
+    Dqn_b32 result = thread->handle != nullptr;
+#else
+    Dqn_b32 result = pthread_create(&thread->handle, nullptr /*attributes*/, Dqn_TestThread__Entry, thread) == 0;
+#endif
+    return result;
+}
+
+void Dqn_TestThread_Join(Dqn_TestThread *thread)
+{
+#if defined(DQN_OS_WIN32)
+    WaitForSingleObject(thread->handle, 0xFFFFFFFF /*INFINITE*/);
+    CloseHandle(thread->handle);
+#else
+    pthread_join(thread->handle, nullptr /*return_value*/);
+#endif
+}
+
+int Dqn_TestThread_ProcessorCount()
+{
+#if defined(DQN_OS_WIN32)
+    SYSTEM_INFO system_info = {};
+    GetSystemInfo(&system_info);
+    int result = DQN_CAST(int)system_info.dwNumberOfProcessors;
+#else
+    int result = DQN_CAST(int)sysconf(_SC_NPROCESSORS_ONLN);
+#endif
+    result = DQN_M_MAX(result, 1);
+    return result;
+}
+
+struct Dqn_Test__ConcurrentArenaWork
+{
+    Dqn_ConcurrentArenaAllocator *arena;
+    Dqn_u8                        pattern;
+    int                           allocation_count;
+    Dqn_isize                     max_allocation_size;
+    Dqn_u8                      **allocations;
+    Dqn_isize                    *sizes;
+    Dqn_b32                       failed_allocation;
+};
+
+void Dqn_Test__ConcurrentArenaStressThread(void *user_context)
+{
+    auto *work = DQN_CAST(Dqn_Test__ConcurrentArenaWork *)user_context;
+    DQN_FOR_EACH(index, work->allocation_count)
+    {
+        Dqn_isize size  = 1 + ((index * 7 + work->pattern) % work->max_allocation_size);
+        Dqn_u8   *bytes = DQN_CAST(Dqn_u8 *)Dqn_ConcurrentArenaAllocator_Allocate(work->arena, size, 8, Dqn_ZeroMem::No);
+        if (!bytes)
+        {
+            work->failed_allocation = true;
+            return;
+        }
+
+        DQN_MEMSET(bytes, work->pattern, DQN_CAST(size_t)size);
+        work->allocations[index] = bytes;
+        work->sizes[index]       = size;
+    }
+}
+
+struct Dqn_Test__ThreadCacheWork
+{
+    Dqn_ThreadCacheAllocator *allocator;
+    Dqn_u8                    pattern;
+    int                       allocation_count;
+    int                       rounds;
+    void                    **kept;       // Allocations left for another thread to free
+    Dqn_isize                 corrupt_allocations;
+    Dqn_b32                   failed_allocation;
+};
+
+void Dqn_Test__ThreadCacheStressThread(void *user_context)
+{
+    auto *work = DQN_CAST(Dqn_Test__ThreadCacheWork *)user_context;
+    Dqn_isize const SIZES[] = {8, 24, 100, 16, 300, 48, 2000, 64, 6000};
+    Dqn_u8 *allocations[256];
+    Dqn_isize sizes[256];
+    DQN_ASSERT(work->allocation_count <= Dqn_ArrayCountI(allocations));
+
+    DQN_FOR_EACH(round, work->rounds)
+    {
+        DQN_FOR_EACH(index, work->allocation_count)
+        {
+            sizes[index]       = SIZES[(index + round) % Dqn_ArrayCountI(SIZES)];
+            allocations[index] = DQN_CAST(Dqn_u8 *)Dqn_ThreadCacheAllocator_Allocate(work->allocator, sizes[index], 8, Dqn_ZeroMem::No);
+            if (!allocations[index])
+            {
+                work->failed_allocation = true;
+                return;
+            }
+            DQN_MEMSET(allocations[index], work->pattern, DQN_CAST(size_t)sizes[index]);
+        }
+
+        DQN_FOR_EACH(index, work->allocation_count)
+        {
+            DQN_FOR_EACH(byte_index, sizes[index])
+            {
+                if (allocations[index][byte_index] != work->pattern)
+                {
+                    work->corrupt_allocations++;
+                    break;
+                }
+            }
+
+            // NOTE: Keep the last round's allocations so the main thread frees them
+            if (round == work->rounds - 1) work->kept[index] = allocations[index];
+            else                           Dqn_ThreadCacheAllocator_Free(work->allocator, allocations[index]);
+        }
+    }
+}
+
+struct Dqn_Test__ThreadCacheFreeWork
+{
+    Dqn_ThreadCacheAllocator      *allocator;
+    void                         **allocations; // Allocated by another thread
+    Dqn_isize                      allocation_count;
+    Dqn_ThreadCacheAllocatorStats  stats_after_free;
+};
+
+void Dqn_Test__ThreadCacheFreeThread(void *user_context)
+{
+    auto *work = DQN_CAST(Dqn_Test__ThreadCacheFreeWork *)user_context;
+    DQN_FOR_EACH(index, work->allocation_count)
+        Dqn_ThreadCacheAllocator_Free(work->allocator, work->allocations[index]);
+    work->stats_after_free = Dqn_ThreadCacheAllocator_GetStats(work->allocator);
+}
+
+struct Dqn_Test__StringInternerWork
+{
+    Dqn_StringInterner *interner;
+    Dqn_String const   *keys;
+    Dqn_isize           key_count;
+    Dqn_isize           offset;    // Each thread starts interning at a different key
+    Dqn_u32            *ids;       // The id each key interned to, indexed like 'keys'
+};
+
+void Dqn_Test__StringInternerThread(void *user_context)
+{
+    auto *work = DQN_CAST(Dqn_Test__StringInternerWork *)user_context;
+    DQN_FOR_EACH(index, work->key_count)
+    {
+        Dqn_isize key_index  = (index + work->offset) % work->key_count;
+        work->ids[key_index]  = Dqn_StringInterner_Intern(work->interner, work->keys[key_index]).id;
+    }
+}
+
+struct Dqn_Test__ConcurrentMapWork
+{
+    Dqn_ConcurrentMap<Dqn_isize> *map;
+    Dqn_isize                     first_key; // Each thread adds the keys [first_key, first_key + key_count)
+    Dqn_isize                     key_count;
+    Dqn_isize                     failures;
+};
+
+void Dqn_Test__ConcurrentMapThread(void *user_context)
+{
+    auto *work = DQN_CAST(Dqn_Test__ConcurrentMapWork *)user_context;
+    for (Dqn_isize key = work->first_key; key < work->first_key + work->key_count; key++)
+    {
+        Dqn_isize value = 0;
+        work->failures += !Dqn_ConcurrentMap_Add(work->map, DQN_CAST(Dqn_u64)key, key * 2);
+        work->failures += !Dqn_ConcurrentMap_Get(work->map, DQN_CAST(Dqn_u64)key, &value) || value != key * 2;
+        if (key & 1)
+            work->failures += !Dqn_ConcurrentMap_Erase(work->map, DQN_CAST(Dqn_u64)key);
+    }
+}
+
+// NOTE: xorshift64, a fixed seed keeps the randomised tests reproducible
+Dqn_u64 Dqn_Test__RandomU64(Dqn_u64 *state)
+{
+    *state ^= *state << 13;
+    *state ^= *state >> 7;
+    *state ^= *state << 17;
+    return *state;
+}
+
+// NOTE: The byte loop Dqn_Str_Find used before it was vectorised, the reference its tests compare
+// against and the baseline for its benchmark
+char const *Dqn_Test__StrFindByteLoop(char const *buf, Dqn_isize buf_len, char const *find, Dqn_isize find_len, Dqn_b32 case_insensitive)
+{
+    for (Dqn_isize pos = 0; pos + find_len <= buf_len; pos++)
+    {
+        Dqn_isize index = 0;
+        if (case_insensitive) while (index < find_len && Dqn_Char_ToLower(buf[pos + index]) == Dqn_Char_ToLower(find[index])) index++;
+        else                  while (index < find_len && buf[pos + index] == find[index]) index++;
+        if (index == find_len)
+            return buf + pos;
+    }
+    return nullptr;
+}
+
+// NOTE: The number of digits from the first to the last non-zero digit of the significand in a
+// formatted float, i.e. "1.2500e+3" and "0.00125" both have 3
+Dqn_isize Dqn_Test__CountSignificantDigits(char const *str)
+{
+    Dqn_isize digits = 0;
+    Dqn_isize result = 0;
+    for (; *str && *str != 'e' && *str != 'E'; str++)
+    {
+        if (!Dqn_Char_IsDigit(*str) || (digits == 0 && *str == '0'))
+            continue;
+        digits++;
+        if (*str != '0')
+            result = digits;
+    }
+    return result;
+}
+
+static constexpr char const *DQN_TEST__HTTP_HEADERS[] =
+{
+    "accept", "accept-charset", "accept-encoding", "accept-language", "accept-ranges", "age", "allow",
+    "authorization", "cache-control", "connection", "content-disposition", "content-encoding",
+    "content-language", "content-length", "content-location", "content-range", "content-type", "cookie",
+    "date", "etag", "expect", "expires", "from", "host", "if-match", "if-modified-since", "if-none-match",
+    "if-range", "if-unmodified-since", "last-modified", "link", "location", "max-forwards", "origin",
+    "pragma", "proxy-authenticate", "proxy-authorization", "range", "referer", "refresh", "retry-after",
+    "server", "set-cookie", "strict-transport-security", "transfer-encoding", "upgrade", "user-agent",
+    "vary", "via", "www-authenticate",
+};
+
+static constexpr auto DQN_TEST__HTTP_HEADER_TABLE = Dqn_PerfectHash_Init(DQN_TEST__HTTP_HEADERS);
+static_assert(DQN_TEST__HTTP_HEADER_TABLE.valid, "Header names must be unique");
+static_assert(Dqn_PerfectHash_Find(&DQN_TEST__HTTP_HEADER_TABLE, "content-type", 12) == 16, "Lookup must work at compile time");
+
 static void Dqn_Test_UnitTests()
 {
     Dqn_TestingState testing_state = {};
@@ -243,393 +524,1646 @@ static void Dqn_Test_UnitTests()
     }
 
     // ---------------------------------------------------------------------------------------------
-    // NOTE: Dqn_Array
+    // NOTE: Dqn_ArenaAllocator
     // ---------------------------------------------------------------------------------------------
     {
-        DQN_TEST_DECLARE_GROUP_SCOPED(testing_state, "Dqn_Array");
-        // NOTE: Dqn_Array_InitWithMemory
+        DQN_TEST_DECLARE_GROUP_SCOPED(testing_state, "Dqn_ArenaAllocator");
+
+        // NOTE: Dqn_ArenaAllocator_InitWithVirtualMemory
         {
             {
-                DQN_TEST_START_SCOPE(testing_state, "Fixed Memory: Test add single item and can't allocate more");
-                int memory[4]        = {};
-                Dqn_Array<int> array = Dqn_Array_InitWithMemory(memory, Dqn_ArrayCount(memory), 0 /*size*/);
-                Dqn_Array_Add(&array, 1);
-                Dqn_Array_Add(&array, 2);
-                Dqn_Array_Add(&array, 3);
-                Dqn_Array_Add(&array, 4);
-                DQN_TEST_EXPECT_MSG(testing_state, array.data[0] == 1, "array.data %d", array.data[0]);
-                DQN_TEST_EXPECT_MSG(testing_state, array.data[1] == 2, "array.data %d", array.data[1]);
-                DQN_TEST_EXPECT_MSG(testing_state, array.data[2] == 3, "array.data %d", array.data[2]);
-                DQN_TEST_EXPECT_MSG(testing_state, array.data[3] == 4, "array.data %d", array.data[3]);
-                DQN_TEST_EXPECT_MSG(testing_state, array.size == 4, "array.size: %d", array.size);
+                DQN_TEST_START_SCOPE(testing_state, "Virtual memory arena grows contiguously");
+                Dqn_ArenaAllocator arena = Dqn_ArenaAllocator_InitWithVirtualMemory(DQN_MEGABYTES(16), DQN_KILOBYTES(64));
+                DQN_DEFER { Dqn_ArenaAllocator_Free(&arena); };
 
-                int *added_item = Dqn_Array_Add(&array, 5);
-                DQN_TEST_EXPECT(testing_state, added_item == nullptr);
-                DQN_TEST_EXPECT_MSG(testing_state, array.size == 4, "array.size: %d", array.size);
-                DQN_TEST_EXPECT_MSG(testing_state, array.max == 4, "array.max: %d", array.max);
-            }
+                Dqn_isize const ALLOCATION_SIZE = DQN_KILOBYTES(48);
+                char *first  = DQN_CAST(char *)Dqn_ArenaAllocator_Allocate(&arena, ALLOCATION_SIZE, 1, Dqn_ZeroMem::Yes);
+                char *second = DQN_CAST(char *)Dqn_ArenaAllocator_Allocate(&arena, ALLOCATION_SIZE, 1, Dqn_ZeroMem::Yes);
+                char *third  = DQN_CAST(char *)Dqn_ArenaAllocator_Allocate(&arena, ALLOCATION_SIZE, 1, Dqn_ZeroMem::Yes);
+                DQN_TEST_EXPECT(testing_state, first && second && third);
+                DQN_TEST_EXPECT_MSG(testing_state, second == first + ALLOCATION_SIZE, "first: %p, second: %p", first, second);
+                DQN_TEST_EXPECT_MSG(testing_state, third == second + ALLOCATION_SIZE, "second: %p, third: %p", second, third);
+                DQN_MEMSET(first, 'a', DQN_CAST(size_t)(ALLOCATION_SIZE * 3));
 
-            {
-                DQN_TEST_START_SCOPE(testing_state, "Fixed Memory: Test add array of items");
-                int memory[4]        = {};
-                int DATA[]           = {1, 2, 3};
-                Dqn_Array<int> array = Dqn_Array_InitWithMemory(memory, Dqn_ArrayCount(memory), 0 /*size*/);
-                Dqn_Array_AddArray(&array, DATA, Dqn_ArrayCount(DATA));
-                DQN_TEST_EXPECT_MSG(testing_state, array.data[0] == 1, "array.data %d", array.data[0]);
-                DQN_TEST_EXPECT_MSG(testing_state, array.data[1] == 2, "array.data %d", array.data[1]);
-                DQN_TEST_EXPECT_MSG(testing_state, array.data[2] == 3, "array.data %d", array.data[2]);
-                DQN_TEST_EXPECT_MSG(testing_state, array.size == 3, "array.size: %d", array.size);
-                DQN_TEST_EXPECT_MSG(testing_state, array.max == 4, "array.max: %d", array.max);
+                Dqn_ArenaAllocatorStats stats = Dqn_ArenaAllocator_GetStats(&arena);
+                DQN_TEST_EXPECT_MSG(testing_state, stats.total_blocks == 1, "total_blocks: %zd", stats.total_blocks);
+                DQN_TEST_EXPECT_MSG(testing_state, stats.total_allocated >= ALLOCATION_SIZE * 3, "total_allocated: %zd", stats.total_allocated);
             }
 
             {
-                DQN_TEST_START_SCOPE(testing_state, "Fixed Memory: Test clear and clear with memory zeroed");
-                int memory[4]        = {};
-                int DATA[]           = {1, 2, 3};
-                Dqn_Array<int> array = Dqn_Array_InitWithMemory(memory, Dqn_ArrayCount(memory), 0 /*size*/);
-                Dqn_Array_AddArray(&array, DATA, Dqn_ArrayCount(DATA));
-                Dqn_Array_Clear(&array, Dqn_ZeroMem::No);
-                DQN_TEST_EXPECT_MSG(testing_state, array.size == 0, "array.size: %d", array.size);
-                DQN_TEST_EXPECT_MSG(testing_state, array.max == 4, "array.max: %d", array.max);
-                DQN_TEST_EXPECT_MSG(testing_state, array.data[0] == 1, "array.data %d. Clear but don't zero memory so old values should still remain", array.data[0]);
+                DQN_TEST_START_SCOPE(testing_state, "Virtual memory arena decommits on reset");
+                Dqn_ArenaAllocator arena = Dqn_ArenaAllocator_InitWithVirtualMemory(DQN_MEGABYTES(16), DQN_KILOBYTES(64));
+                DQN_DEFER { Dqn_ArenaAllocator_Free(&arena); };
 
-                Dqn_Array_Clear(&array, Dqn_ZeroMem::Yes);
-                DQN_TEST_EXPECT_MSG(testing_state, array.data[0] == 0, "array.data %d. Clear but zero memory old values should not remain", array.data[0]);
+                Dqn_isize const ALLOCATION_SIZE = DQN_MEGABYTES(1);
+                char *buf = DQN_CAST(char *)Dqn_ArenaAllocator_Allocate(&arena, ALLOCATION_SIZE, 1, Dqn_ZeroMem::No);
+                DQN_MEMSET(buf, 'a', DQN_CAST(size_t)ALLOCATION_SIZE);
+
+                Dqn_ArenaAllocator_ResetUsage(&arena, Dqn_ZeroMem::No);
+                Dqn_ArenaAllocatorStats stats = Dqn_ArenaAllocator_GetStats(&arena);
+                DQN_TEST_EXPECT_MSG(testing_state, stats.total_allocated < arena.commit_granularity, "total_allocated: %zd", stats.total_allocated);
+
+                char *reused = DQN_CAST(char *)Dqn_ArenaAllocator_Allocate(&arena, ALLOCATION_SIZE, 1, Dqn_ZeroMem::No);
+                DQN_TEST_EXPECT_MSG(testing_state, reused == buf, "buf: %p, reused: %p", buf, reused);
+                DQN_TEST_EXPECT_MSG(testing_state, reused[ALLOCATION_SIZE - 1] == 0, "reused[last]: %d", reused[ALLOCATION_SIZE - 1]);
             }
 
             {
-                DQN_TEST_START_SCOPE(testing_state, "Fixed Memory: Test erase stable and erase unstable");
-                int memory[4]        = {};
-                int DATA[]           = {1, 2, 3, 4};
-                Dqn_Array<int> array = Dqn_Array_InitWithMemory(memory, Dqn_ArrayCount(memory), 0 /*size*/);
-                Dqn_Array_AddArray(&array, DATA, Dqn_ArrayCount(DATA));
-                Dqn_Array_EraseUnstable(&array, 1);
-                DQN_TEST_EXPECT_MSG(testing_state, array.data[0] == 1, "array.data %d", array.data[0]);
-                DQN_TEST_EXPECT_MSG(testing_state, array.data[1] == 4, "array.data %d", array.data[1]);
-                DQN_TEST_EXPECT_MSG(testing_state, array.data[2] == 3, "array.data %d", array.data[2]);
-                DQN_TEST_EXPECT_MSG(testing_state, array.size == 3, "array.size: %d", array.size);
+                DQN_TEST_START_SCOPE(testing_state, "Virtual memory arena fails past its reservation");
+                Dqn_ArenaAllocator arena = Dqn_ArenaAllocator_InitWithVirtualMemory(DQN_MEGABYTES(1), DQN_KILOBYTES(64));
+                DQN_DEFER { Dqn_ArenaAllocator_Free(&arena); };
+                void *buf = Dqn_ArenaAllocator_Allocate(&arena, DQN_MEGABYTES(2), 1, Dqn_ZeroMem::No);
+                DQN_TEST_EXPECT(testing_state, buf == nullptr);
+            }
+        }
 
-                Dqn_Array_EraseStable(&array, 0);
-                DQN_TEST_EXPECT_MSG(testing_state, array.data[0] == 4, "array.data: %d", array.data[0]);
-                DQN_TEST_EXPECT_MSG(testing_state, array.data[1] == 3, "array.data: %d", array.data[1]);
-                DQN_TEST_EXPECT_MSG(testing_state, array.size == 2, "array.size: %d", array.size);
+        // NOTE: Dqn_Scratch_Get
+        {
+            {
+                DQN_TEST_START_SCOPE(testing_state, "Scratch arena usage is reset at the end of the scope");
+                Dqn_ArenaAllocator *arena = nullptr;
+                Dqn_isize used_before     = 0;
+                {
+                    Dqn_ScratchArena scratch = Dqn_Scratch_Get();
+                    arena                    = scratch.arena;
+                    used_before              = Dqn_ArenaAllocator_GetStats(arena).total_used;
+                    Dqn_String string        = Dqn_String_InitFmt(&scratch.allocator, "%s", "hello world");
+                    DQN_TEST_EXPECT(testing_state, string.size == 11);
+                    DQN_TEST_EXPECT(testing_state, Dqn_ArenaAllocator_GetStats(arena).total_used > used_before);
+                }
+                Dqn_isize used_after = Dqn_ArenaAllocator_GetStats(arena).total_used;
+                DQN_TEST_EXPECT_MSG(testing_state, used_after == used_before, "used_before: %zd, used_after: %zd", used_before, used_after);
             }
 
             {
-                DQN_TEST_START_SCOPE(testing_state, "Fixed Memory: Test array pop and peek");
-                int memory[4]        = {};
-                int DATA[]           = {1, 2, 3};
-                Dqn_Array<int> array = Dqn_Array_InitWithMemory(memory, Dqn_ArrayCount(memory), 0 /*size*/);
-                Dqn_Array_AddArray(&array, DATA, Dqn_ArrayCount(DATA));
-                Dqn_Array_Pop(&array, 2);
-                DQN_TEST_EXPECT_MSG(testing_state, array.data[0] == 1, "array.data: %d", array.data[0]);
-                DQN_TEST_EXPECT_MSG(testing_state, array.size == 1, "array.size: %d", array.size);
-                DQN_TEST_EXPECT_MSG(testing_state, array.max == 4, "array.max: %d", array.max);
+                DQN_TEST_START_SCOPE(testing_state, "Scratch arena does not alias the conflicting arena");
+                Dqn_ScratchArena outer = Dqn_Scratch_Get();
+                Dqn_ScratchArena inner = Dqn_Scratch_Get(outer.arena);
+                DQN_TEST_EXPECT(testing_state, inner.arena != outer.arena);
 
-                int *peek_item = Dqn_Array_Peek(&array);
-                DQN_TEST_EXPECT_MSG(testing_state, *peek_item == 1, "peek: %d", *peek_item);
-                DQN_TEST_EXPECT_MSG(testing_state, array.size == 1, "array.size: %d", array.size);
-                DQN_TEST_EXPECT_MSG(testing_state, array.max == 4, "array.max: %d", array.max);
+
+                Dqn_ArenaAllocator const *conflicts[] = {inner.arena};
+                Dqn_ScratchArena          excluding   = Dqn_Scratch_GetExcluding(conflicts, Dqn_ArrayCountI(conflicts));
+                DQN_TEST_EXPECT(testing_state, excluding.arena != inner.arena);
             }
 
             {
-                DQN_TEST_START_SCOPE(testing_state, "Fixed Memory: Test free on fixed memory array does nothing");
-                int memory[4]        = {};
-                Dqn_Array<int> array = Dqn_Array_InitWithMemory(memory, Dqn_ArrayCount(memory), 0 /*size*/);
-                DQN_DEFER { Dqn_Array_Free(&array); };
+                DQN_TEST_START_SCOPE(testing_state, "Moving a scratch arena hands its region to the destination");
+                Dqn_ArenaAllocator *arena = nullptr;
+                Dqn_isize used_before     = 0;
+                {
+                    Dqn_ScratchArena source = Dqn_Scratch_Get();
+                    arena                   = source.arena;
+                    used_before             = Dqn_ArenaAllocator_GetStats(arena).total_used;
+                    {
+                        Dqn_ScratchArena moved = DQN_CAST(Dqn_ScratchArena &&)source;
+                        DQN_TEST_EXPECT(testing_state, moved.arena == arena && !source.region.region.arena);
+                        Dqn_ArenaAllocator_Allocate(arena, 64, 1, Dqn_ZeroMem::No);
+                    }
+                    Dqn_isize used_after_move = Dqn_ArenaAllocator_GetStats(arena).total_used;
+                    DQN_TEST_EXPECT_MSG(testing_state, used_after_move == used_before, "used_before: %zd, used_after_move: %zd", used_before, used_after_move);
+                }
             }
         }
 
-        // NOTE: Dynamic Memory: Dqn_Array
+        // NOTE: Dqn_ConcurrentArenaAllocator
         {
             {
-                DQN_TEST_START_SCOPE(testing_state, "Dynamic Memory: Reserve and check over commit reallocates");
-                Dqn_Array<int> array = {};
-                if (array.allocator.type == Dqn_AllocatorType::Null)
-                    array.allocator = Dqn_Allocator_InitWithHeap();
+                DQN_TEST_START_SCOPE(testing_state, "Concurrent arena allocates aligned memory and chains blocks");
+                Dqn_ConcurrentArenaAllocator arena = Dqn_ConcurrentArenaAllocator_InitWithNewAllocator(Dqn_Allocator_InitWithHeap(), DQN_KILOBYTES(1), nullptr);
+                arena.arena.min_block_size         = DQN_KILOBYTES(1);
+                DQN_DEFER { Dqn_ConcurrentArenaAllocator_Free(&arena); };
 
-                DQN_DEFER { Dqn_Array_Free(&array); };
+                DQN_FOR_EACH(index, 64)
+                {
+                    void *ptr = Dqn_ConcurrentArenaAllocator_Allocate(&arena, 100, 16, Dqn_ZeroMem::Yes);
+                    DQN_TEST_EXPECT(testing_state, ptr && (DQN_CAST(Dqn_uintptr)ptr & 15) == 0);
+                }
 
-                Dqn_Array_Reserve(&array, 4);
-                DQN_TEST_EXPECT_MSG(testing_state, array.size == 0, "array.size: %d", array.size);
-                DQN_TEST_EXPECT_MSG(testing_state, array.max == 4, "array.max: %d", array.max);
+                Dqn_ArenaAllocatorStats stats = Dqn_ConcurrentArenaAllocator_GetStats(&arena);
+                DQN_TEST_EXPECT_MSG(testing_state, stats.total_blocks > 1, "total_blocks: %zd", stats.total_blocks);
+                DQN_TEST_EXPECT_MSG(testing_state, stats.total_used <= stats.total_allocated, "total_used: %zd, total_allocated: %zd", stats.total_used, stats.total_allocated);
 
-                int DATA[] = {1, 2, 3, 4};
-                Dqn_Array_AddArray(&array, DATA, Dqn_ArrayCount(DATA));
-                DQN_TEST_EXPECT_MSG(testing_state, array.data[0] == 1, "array.data: %d", array.data[0]);
-                DQN_TEST_EXPECT_MSG(testing_state, array.data[1] == 2, "array.data: %d", array.data[1]);
-                DQN_TEST_EXPECT_MSG(testing_state, array.data[2] == 3, "array.data: %d", array.data[2]);
-                DQN_TEST_EXPECT_MSG(testing_state, array.data[3] == 4, "array.data: %d", array.data[3]);
-                DQN_TEST_EXPECT_MSG(testing_state, array.size == 4, "array.size: %d", array.size);
+                Dqn_ConcurrentArenaAllocator_ResetUsage(&arena, Dqn_ZeroMem::No);
+                DQN_TEST_EXPECT(testing_state, Dqn_ConcurrentArenaAllocator_GetStats(&arena).total_used == 0);
+                DQN_TEST_EXPECT(testing_state, arena.curr_mem_block == arena.arena.curr_mem_block && arena.curr_mem_block->prev == nullptr);
+            }
 
-                int *added_item = Dqn_Array_Add(&array, 5);
-                DQN_TEST_EXPECT_MSG(testing_state, *added_item == 5, "added_item: %d", *added_item);
-                DQN_TEST_EXPECT_MSG(testing_state, array.data[4] == 5, "array.data: %d", array.data[4]);
-                DQN_TEST_EXPECT_MSG(testing_state, array.size == 5, "array.size: %d", array.size);
-                DQN_TEST_EXPECT_MSG(testing_state, array.max >= 5, "array.max: %d", array.max);
+            {
+                DQN_TEST_START_SCOPE(testing_state, "Concurrent arena allocations from many threads do not overlap");
+                int const THREAD_COUNT           = 8;
+                int const ALLOCATIONS_PER_THREAD = 4096;
+
+                // NOTE: Small blocks so that threads frequently race to chain a new block
+                Dqn_ConcurrentArenaAllocator arena = Dqn_ConcurrentArenaAllocator_InitWithNewAllocator(Dqn_Allocator_InitWithHeap(), DQN_KILOBYTES(4), nullptr);
+                arena.arena.min_block_size         = DQN_KILOBYTES(4);
+                DQN_DEFER { Dqn_ConcurrentArenaAllocator_Free(&arena); };
+
+                Dqn_TestThread                threads[THREAD_COUNT] = {};
+                Dqn_Test__ConcurrentArenaWork work[THREAD_COUNT]    = {};
+                DQN_FOR_EACH(thread_index, THREAD_COUNT)
+                {
+                    Dqn_Test__ConcurrentArenaWork *item = work + thread_index;
+                    item->arena                         = &arena;
+                    item->pattern                       = DQN_CAST(Dqn_u8)(thread_index + 1);
+                    item->allocation_count              = ALLOCATIONS_PER_THREAD;
+                    item->max_allocation_size           = 96;
+                    item->allocations                   = Dqn_ArenaAllocator_NewArray(&testing_state.arena, Dqn_u8 *, ALLOCATIONS_PER_THREAD, Dqn_ZeroMem::Yes);
+                    item->sizes                         = Dqn_ArenaAllocator_NewArray(&testing_state.arena, Dqn_isize, ALLOCATIONS_PER_THREAD, Dqn_ZeroMem::Yes);
+                }
+
+                DQN_FOR_EACH(thread_index, THREAD_COUNT)
+                {
+                    Dqn_b32 started = Dqn_TestThread_Start(threads + thread_index, Dqn_Test__ConcurrentArenaStressThread, work + thread_index);
+                    DQN_TEST_EXPECT(testing_state, started);
+                }
+
+                DQN_FOR_EACH(thread_index, THREAD_COUNT)
+                    Dqn_TestThread_Join(threads + thread_index);
+
+                // NOTE: If any two allocations overlapped, one thread's pattern would have been overwritten by another
+                Dqn_isize corrupt_allocations = 0;
+                DQN_FOR_EACH(thread_index, THREAD_COUNT)
+                {
+                    Dqn_Test__ConcurrentArenaWork const *item = work + thread_index;
+                    DQN_TEST_EXPECT(testing_state, !item->failed_allocation);
+                    DQN_FOR_EACH(index, item->allocation_count)
+                    {
+                        Dqn_u8 const *bytes = item->allocations[index];
+                        DQN_FOR_EACH(byte_index, item->sizes[index])
+                        {
+                            if (bytes[byte_index] != item->pattern)
+                            {
+                                corrupt_allocations++;
+                                break;
+                            }
+                        }
+                    }
+                }
+                DQN_TEST_EXPECT_MSG(testing_state, corrupt_allocations == 0, "corrupt_allocations: %zd", corrupt_allocations);
             }
         }
     }
 
     // ---------------------------------------------------------------------------------------------
-    // NOTE: Dqn_Rect
+    // NOTE: Dqn_PoolAllocator
     // ---------------------------------------------------------------------------------------------
     {
-        DQN_TEST_DECLARE_GROUP_SCOPED(testing_state, "Dqn_Rect");
-        // NOTE: Dqn_Rect_Intersection
+        DQN_TEST_DECLARE_GROUP_SCOPED(testing_state, "Dqn_PoolAllocator");
         {
-            {
-                DQN_TEST_START_SCOPE(testing_state, "No intersection");
-                Dqn_Rect a  = Dqn_Rect_InitFromPosAndSize(Dqn_V2(0, 0), Dqn_V2(100, 100));
-                Dqn_Rect b  = Dqn_Rect_InitFromPosAndSize(Dqn_V2(200, 0), Dqn_V2(200, 200));
-                Dqn_Rect ab = Dqn_Rect_Intersection(a, b);
+            DQN_TEST_START_SCOPE(testing_state, "Freed slots are reused before growing the pool");
+            Dqn_PoolAllocator pool = Dqn_PoolAllocator_InitWithArena(&testing_state.arena, 24, 8, 4 /*slots_per_chunk*/);
+            void *slots[4]         = {};
+            DQN_FOR_EACH(index, Dqn_ArrayCountI(slots))
+                slots[index] = Dqn_PoolAllocator_Allocate(&pool, Dqn_ZeroMem::Yes);
+            DQN_TEST_EXPECT_MSG(testing_state, pool.total_slots == 4, "total_slots: %zd", pool.total_slots);
 
-                DQN_TEST_EXPECT_MSG(testing_state,
-                                ab.min.x == 0 && ab.min.y == 0 && ab.max.x == 0 && ab.max.y == 0,
-                                "ab = { min.x = %.2f, min.y = %.2f, max.x = %.2f. max.y = %.2f }",
-                                ab.min.x,
-                                ab.min.y,
-                                ab.max.x,
-                                ab.max.y);
+            Dqn_PoolAllocator_Free(&pool, slots[2]);
+            void *reused = Dqn_PoolAllocator_Allocate(&pool, Dqn_ZeroMem::Yes);
+            DQN_TEST_EXPECT_MSG(testing_state, reused == slots[2], "reused: %p, freed: %p", reused, slots[2]);
+            DQN_TEST_EXPECT_MSG(testing_state, pool.total_slots == 4, "total_slots: %zd", pool.total_slots);
+
+            void *grown = Dqn_PoolAllocator_Allocate(&pool, Dqn_ZeroMem::Yes);
+            DQN_TEST_EXPECT(testing_state, grown);
+            DQN_TEST_EXPECT_MSG(testing_state, pool.total_slots == 8, "total_slots: %zd", pool.total_slots);
+            DQN_TEST_EXPECT_MSG(testing_state, pool.slots_in_use == 5, "slots_in_use: %zd", pool.slots_in_use);
+        }
+
+        {
+            DQN_TEST_START_SCOPE(testing_state, "Allocations larger than the slot fail");
+            Dqn_PoolAllocator pool      = Dqn_PoolAllocator_InitWithArena(&testing_state.arena, 16, 8);
+            Dqn_Allocator     allocator = Dqn_Allocator_InitWithPool(&pool);
+            void *buf                   = Dqn_Allocator_Allocate(&allocator, 17, 1, Dqn_ZeroMem::No);
+            DQN_TEST_EXPECT(testing_state, buf == nullptr);
+            DQN_TEST_EXPECT(testing_state, pool.slots_in_use == 0);
+        }
+
+        {
+            DQN_TEST_START_SCOPE(testing_state, "Allocations through a pool balance the allocator on free");
+            Dqn_PoolAllocator pool      = Dqn_PoolAllocator_InitWithArena(&testing_state.arena, 40, 8);
+            Dqn_Allocator     allocator = Dqn_Allocator_InitWithPool(&pool);
+
+            void *buffers[64] = {};
+            DQN_FOR_EACH(index, Dqn_ArrayCountI(buffers))
+                buffers[index] = Dqn_Allocator_Allocate(&allocator, 40, 8, Dqn_ZeroMem::No);
+
+            DQN_TEST_EXPECT_MSG(testing_state, pool.slots_in_use == 64, "slots_in_use: %zd", pool.slots_in_use);
+            DQN_TEST_EXPECT_MSG(testing_state, allocator.bytes_allocated == 64 * pool.slot_size, "bytes_allocated: %zd", allocator.bytes_allocated);
+
+            DQN_FOR_EACH(index, Dqn_ArrayCountI(buffers))
+                Dqn_Allocator_Free(&allocator, buffers[index]);
+            DQN_TEST_EXPECT_MSG(testing_state, allocator.bytes_allocated == 0, "bytes_allocated: %zd", allocator.bytes_allocated);
+            DQN_TEST_EXPECT_MSG(testing_state, pool.slots_in_use == 0, "slots_in_use: %zd", pool.slots_in_use);
+        }
+
+        {
+            DQN_TEST_START_SCOPE(testing_state, "List chunks fit in a pool sized by Dqn_List_ChunkAllocationSize");
+            Dqn_PoolAllocator pool      = Dqn_PoolAllocator_InitWithArena(&testing_state.arena, Dqn_List_ChunkAllocationSize<Dqn_u64>(8), alignof(Dqn_ListChunk<Dqn_u64>));
+            Dqn_Allocator     allocator = Dqn_Allocator_InitWithPool(&pool);
+            Dqn_List<Dqn_u64> list      = Dqn_List_InitWithAllocator<Dqn_u64>(&allocator, 8);
+            DQN_FOR_EACH(index, 20)
+            {
+                Dqn_u64 *item = Dqn_List_Make(&list, 1);
+                DQN_TEST_EXPECT(testing_state, item);
+                if (item) *item = index;
             }
 
+            DQN_TEST_EXPECT_MSG(testing_state, pool.slots_in_use == 3, "slots_in_use: %zd", pool.slots_in_use);
+            Dqn_u64 expected = 0;
+            for (Dqn_ListIterator<Dqn_u64> it = {}; Dqn_List_Iterate(&list, &it); expected++)
             {
-                DQN_TEST_START_SCOPE(testing_state, "A's min intersects B");
-                Dqn_Rect a  = Dqn_Rect_InitFromPosAndSize(Dqn_V2(50, 50), Dqn_V2(100, 100));
-                Dqn_Rect b  = Dqn_Rect_InitFromPosAndSize(Dqn_V2( 0,  0), Dqn_V2(100, 100));
-                Dqn_Rect ab = Dqn_Rect_Intersection(a, b);
+                DQN_TEST_EXPECT_MSG(testing_state, *it.data == expected, "data: %I64u, expected: %I64u", *it.data, expected);
+            }
+            DQN_TEST_EXPECT_MSG(testing_state, expected == 20, "expected: %I64u", expected);
+        }
+    }
 
-                DQN_TEST_EXPECT_MSG(testing_state,
-                                ab.min.x == 50 && ab.min.y == 50 && ab.max.x == 100 && ab.max.y == 100,
-                                "ab = { min.x = %.2f, min.y = %.2f, max.x = %.2f. max.y = %.2f }",
-                                ab.min.x,
-                                ab.min.y,
-                                ab.max.x,
-                                ab.max.y);
-            }
+    // ---------------------------------------------------------------------------------------------
+    // NOTE: Dqn_SlabAllocator
+    // ---------------------------------------------------------------------------------------------
+    {
+        DQN_TEST_DECLARE_GROUP_SCOPED(testing_state, "Dqn_SlabAllocator");
+        {
+            DQN_TEST_START_SCOPE(testing_state, "Small allocations use a size class and reuse freed slots");
+            Dqn_SlabAllocator slab = {};
+            DQN_DEFER { Dqn_SlabAllocator_Release(&slab); };
 
-            {
-                DQN_TEST_START_SCOPE(testing_state, "B's min intersects A");
-                Dqn_Rect a  = Dqn_Rect_InitFromPosAndSize(Dqn_V2( 0,  0), Dqn_V2(100, 100));
-                Dqn_Rect b  = Dqn_Rect_InitFromPosAndSize(Dqn_V2(50, 50), Dqn_V2(100, 100));
-                Dqn_Rect ab = Dqn_Rect_Intersection(a, b);
+            void *a = Dqn_SlabAllocator_Allocate(&slab, 24, 8, Dqn_ZeroMem::Yes);
+            void *b = Dqn_SlabAllocator_Allocate(&slab, 32, 8, Dqn_ZeroMem::Yes);
+            DQN_TEST_EXPECT(testing_state, a && b && a != b);
+            DQN_TEST_EXPECT_MSG(testing_state, Dqn_SlabAllocator_AllocationSize(a) == 32, "size: %zd", Dqn_SlabAllocator_AllocationSize(a));
+            DQN_TEST_EXPECT_MSG(testing_state, slab.size_classes[1].slots_in_use == 2, "slots_in_use: %zd", slab.size_classes[1].slots_in_use);
 
-                DQN_TEST_EXPECT_MSG(testing_state,
-                                ab.min.x == 50 && ab.min.y == 50 && ab.max.x == 100 && ab.max.y == 100,
-                                "ab = { min.x = %.2f, min.y = %.2f, max.x = %.2f. max.y = %.2f }",
-                                ab.min.x,
-                                ab.min.y,
-                                ab.max.x,
-                                ab.max.y);
-            }
+            Dqn_SlabAllocator_Free(&slab, a);
+            void *c = Dqn_SlabAllocator_Allocate(&slab, 20, 4, Dqn_ZeroMem::Yes);
+            DQN_TEST_EXPECT_MSG(testing_state, c == a, "c: %p, a: %p", c, a);
+            DQN_TEST_EXPECT_MSG(testing_state, slab.size_classes[1].total_slabs == 1, "total_slabs: %zd", slab.size_classes[1].total_slabs);
+            DQN_TEST_EXPECT_MSG(testing_state, slab.size_classes[1].total_allocations == 3, "total_allocations: %zd", slab.size_classes[1].total_allocations);
+        }
 
-            {
-                DQN_TEST_START_SCOPE(testing_state, "A's max intersects B");
-                Dqn_Rect a  = Dqn_Rect_InitFromPosAndSize(Dqn_V2(-50, -50), Dqn_V2(100, 100));
-                Dqn_Rect b  = Dqn_Rect_InitFromPosAndSize(Dqn_V2(  0,   0), Dqn_V2(100, 100));
-                Dqn_Rect ab = Dqn_Rect_Intersection(a, b);
+        {
+            DQN_TEST_START_SCOPE(testing_state, "Allocations are aligned to the requested alignment");
+            Dqn_SlabAllocator slab = {};
+            DQN_DEFER { Dqn_SlabAllocator_Release(&slab); };
 
-                DQN_TEST_EXPECT_MSG(testing_state,
-                                ab.min.x == 0 && ab.min.y == 0 && ab.max.x == 50 && ab.max.y == 50,
-                                "ab = { min.x = %.2f, min.y = %.2f, max.x = %.2f. max.y = %.2f }",
-                                ab.min.x,
-                                ab.min.y,
-                                ab.max.x,
-                                ab.max.y);
+            Dqn_u8 const ALIGNMENTS[] = {1, 2, 4, 8, 16, 32, 64, 128};
+            for (Dqn_u8 alignment : ALIGNMENTS)
+            {
+                void *ptr = Dqn_SlabAllocator_Allocate(&slab, 3, alignment, Dqn_ZeroMem::No);
+                DQN_TEST_EXPECT_MSG(testing_state, ptr && (DQN_CAST(Dqn_uintptr)ptr & (alignment - 1)) == 0, "ptr: %p, alignment: %u", ptr, alignment);
             }
 
-            {
-                DQN_TEST_START_SCOPE(testing_state, "B's max intersects A");
-                Dqn_Rect a  = Dqn_Rect_InitFromPosAndSize(Dqn_V2(  0,   0), Dqn_V2(100, 100));
-                Dqn_Rect b  = Dqn_Rect_InitFromPosAndSize(Dqn_V2(-50, -50), Dqn_V2(100, 100));
-                Dqn_Rect ab = Dqn_Rect_Intersection(a, b);
+            void *large = Dqn_SlabAllocator_Allocate(&slab, DQN_KILOBYTES(8), 128, Dqn_ZeroMem::No);
+            DQN_TEST_EXPECT_MSG(testing_state, large && (DQN_CAST(Dqn_uintptr)large & 127) == 0, "large: %p", large);
+        }
 
-                DQN_TEST_EXPECT_MSG(testing_state,
-                                ab.min.x == 0 && ab.min.y == 0 && ab.max.x == 50 && ab.max.y == 50,
-                                "ab = { min.x = %.2f, min.y = %.2f, max.x = %.2f. max.y = %.2f }",
-                                ab.min.x,
-                                ab.min.y,
-                                ab.max.x,
-                                ab.max.y);
-            }
+        {
+            DQN_TEST_START_SCOPE(testing_state, "Large allocations bypass the size classes");
+            Dqn_SlabAllocator slab = {};
+            DQN_DEFER { Dqn_SlabAllocator_Release(&slab); };
 
+            Dqn_isize const SIZE = DQN_MEGABYTES(1);
+            char *buf            = DQN_CAST(char *)Dqn_SlabAllocator_Allocate(&slab, SIZE, 16, Dqn_ZeroMem::Yes);
+            DQN_TEST_EXPECT(testing_state, buf);
+            DQN_MEMSET(buf, 'a', DQN_CAST(size_t)SIZE);
+            DQN_TEST_EXPECT_MSG(testing_state, Dqn_SlabAllocator_AllocationSize(buf) == SIZE, "size: %zd", Dqn_SlabAllocator_AllocationSize(buf));
+            DQN_TEST_EXPECT_MSG(testing_state, slab.large_allocations == 1 && slab.large_bytes == SIZE, "large_allocations: %zd, large_bytes: %zd", slab.large_allocations, slab.large_bytes);
 
-            {
-                DQN_TEST_START_SCOPE(testing_state, "B contains A");
-                Dqn_Rect a  = Dqn_Rect_InitFromPosAndSize(Dqn_V2(25, 25), Dqn_V2( 25,  25));
-                Dqn_Rect b  = Dqn_Rect_InitFromPosAndSize(Dqn_V2( 0,  0), Dqn_V2(100, 100));
-                Dqn_Rect ab = Dqn_Rect_Intersection(a, b);
+            Dqn_SlabAllocator_Free(&slab, buf);
+            DQN_TEST_EXPECT_MSG(testing_state, slab.large_allocations == 0 && slab.large_bytes == 0, "large_allocations: %zd, large_bytes: %zd", slab.large_allocations, slab.large_bytes);
+            DQN_TEST_EXPECT(testing_state, slab.reservations == nullptr);
+        }
 
-                DQN_TEST_EXPECT_MSG(testing_state,
-                                ab.min.x == 25 && ab.min.y == 25 && ab.max.x == 50 && ab.max.y == 50,
-                                "ab = { min.x = %.2f, min.y = %.2f, max.x = %.2f. max.y = %.2f }",
-                                ab.min.x,
-                                ab.min.y,
-                                ab.max.x,
-                                ab.max.y);
-            }
+        {
+            DQN_TEST_START_SCOPE(testing_state, "Dqn_Array grows through a slab backed Dqn_Allocator");
+            Dqn_SlabAllocator slab = {};
+            DQN_DEFER { Dqn_SlabAllocator_Release(&slab); };
 
-            {
-                DQN_TEST_START_SCOPE(testing_state, "A contains B");
-                Dqn_Rect a  = Dqn_Rect_InitFromPosAndSize(Dqn_V2( 0,  0), Dqn_V2(100, 100));
-                Dqn_Rect b  = Dqn_Rect_InitFromPosAndSize(Dqn_V2(25, 25), Dqn_V2( 25,  25));
-                Dqn_Rect ab = Dqn_Rect_Intersection(a, b);
+            Dqn_Array<int> array = {};
+            array.allocator      = Dqn_Allocator_InitWithSlab(&slab);
+            DQN_FOR_EACH(index, 2000)
+                Dqn_Array_Add(&array, DQN_CAST(int)index);
 
-                DQN_TEST_EXPECT_MSG(testing_state,
-                                ab.min.x == 25 && ab.min.y == 25 && ab.max.x == 50 && ab.max.y == 50,
-                                "ab = { min.x = %.2f, min.y = %.2f, max.x = %.2f. max.y = %.2f }",
-                                ab.min.x,
-                                ab.min.y,
-                                ab.max.x,
-                                ab.max.y);
+            Dqn_b32 matches = array.size == 2000;
+            DQN_FOR_EACH(index, array.size)
+                matches &= array.data[index] == index;
+            DQN_TEST_EXPECT(testing_state, matches);
+
+            Dqn_Array_Free(&array);
+            DQN_TEST_EXPECT_MSG(testing_state, array.allocator.allocations == 0, "allocations: %zd", array.allocator.allocations);
+            DQN_TEST_EXPECT_MSG(testing_state, array.allocator.bytes_allocated == 0, "bytes_allocated: %zd", array.allocator.bytes_allocated);
+        }
+    }
+
+    // ---------------------------------------------------------------------------------------------
+    // NOTE: Dqn_ThreadCacheAllocator
+    // ---------------------------------------------------------------------------------------------
+    {
+        DQN_TEST_DECLARE_GROUP_SCOPED(testing_state, "Dqn_ThreadCacheAllocator");
+        {
+            DQN_TEST_START_SCOPE(testing_state, "Freed slots are cached and reused by the thread");
+            Dqn_Allocator            backing   = Dqn_Allocator_InitWithHeap();
+            Dqn_ThreadCacheAllocator allocator = Dqn_ThreadCacheAllocator_Init(&backing, 8 /*batch_size*/);
+            DQN_DEFER { Dqn_ThreadCacheAllocator_Release(&allocator); };
+
+            void *a = Dqn_ThreadCacheAllocator_Allocate(&allocator, 24, 8, Dqn_ZeroMem::Yes);
+            DQN_TEST_EXPECT(testing_state, a && (DQN_CAST(Dqn_uintptr)a & 15) == 0);
+            DQN_TEST_EXPECT_MSG(testing_state, backing.allocations == 1, "backing.allocations: %zd", backing.allocations);
+
+            Dqn_ThreadCacheAllocator_Free(&allocator, a);
+            void *b = Dqn_ThreadCacheAllocator_Allocate(&allocator, 32, 8, Dqn_ZeroMem::Yes);
+            DQN_TEST_EXPECT_MSG(testing_state, a == b, "a: %p, b: %p", a, b);
+
+            Dqn_ThreadCacheAllocatorStats stats = Dqn_ThreadCacheAllocator_GetStats(&allocator);
+            DQN_TEST_EXPECT_MSG(testing_state, stats.allocations == 1 && stats.bytes_allocated == 32, "allocations: %zd, bytes_allocated: %zd", stats.allocations, stats.bytes_allocated);
+            DQN_TEST_EXPECT_MSG(testing_state, stats.total_allocations == 2, "total_allocations: %zd", stats.total_allocations);
+            DQN_TEST_EXPECT_MSG(testing_state, stats.cached_slots == 7, "cached_slots: %zd", stats.cached_slots);
+            Dqn_ThreadCacheAllocator_Free(&allocator, b);
+
+            Dqn_ThreadCacheAllocator_FlushThread(&allocator);
+            stats = Dqn_ThreadCacheAllocator_GetStats(&allocator);
+            DQN_TEST_EXPECT_MSG(testing_state, stats.threads == 0 && stats.cached_slots == 0, "threads: %zd, cached_slots: %zd", stats.threads, stats.cached_slots);
+            DQN_TEST_EXPECT_MSG(testing_state, stats.shared_slots == 8, "shared_slots: %zd", stats.shared_slots);
+            DQN_TEST_EXPECT_MSG(testing_state, stats.allocations == 0, "allocations: %zd", stats.allocations);
+        }
+
+        {
+            DQN_TEST_START_SCOPE(testing_state, "Large and over aligned allocations use the backing allocator");
+            Dqn_Allocator            backing   = Dqn_Allocator_InitWithHeap();
+            Dqn_ThreadCacheAllocator allocator = Dqn_ThreadCacheAllocator_Init(&backing);
+            Dqn_Allocator            wrapper   = Dqn_Allocator_InitWithThreadCache(&allocator);
+            DQN_DEFER { Dqn_ThreadCacheAllocator_Release(&allocator); };
+
+            void *large   = Dqn_Allocator_Allocate(&wrapper, DQN_KILOBYTES(8), 8, Dqn_ZeroMem::Yes);
+            void *aligned = Dqn_Allocator_Allocate(&wrapper, 40, 64, Dqn_ZeroMem::Yes);
+            DQN_TEST_EXPECT(testing_state, large && aligned && (DQN_CAST(Dqn_uintptr)aligned & 63) == 0);
+            DQN_TEST_EXPECT_MSG(testing_state, backing.allocations == 2, "backing.allocations: %zd", backing.allocations);
+            DQN_TEST_EXPECT_MSG(testing_state, Dqn_ThreadCacheAllocator_AllocationSize(large) == DQN_KILOBYTES(8), "size: %zd", Dqn_ThreadCacheAllocator_AllocationSize(large));
+
+            Dqn_Allocator_Free(&wrapper, large);
+            Dqn_Allocator_Free(&wrapper, aligned);
+            DQN_TEST_EXPECT_MSG(testing_state, backing.allocations == 0, "backing.allocations: %zd", backing.allocations);
+            DQN_TEST_EXPECT(testing_state, Dqn_ThreadCacheAllocator_GetStats(&allocator).bytes_allocated == 0);
+        }
+
+        {
+            DQN_TEST_START_SCOPE(testing_state, "A thread that only frees returns slots to the shared free lists");
+            Dqn_Allocator            backing   = Dqn_Allocator_InitWithHeap();
+            Dqn_ThreadCacheAllocator allocator = Dqn_ThreadCacheAllocator_Init(&backing, 8 /*batch_size*/);
+            DQN_DEFER { Dqn_ThreadCacheAllocator_Release(&allocator); };
+
+            void *allocations[8] = {};
+            DQN_FOR_EACH(index, Dqn_ArrayCountI(allocations))
+                allocations[index] = Dqn_ThreadCacheAllocator_Allocate(&allocator, 64, 8, Dqn_ZeroMem::No);
+
+            Dqn_Test__ThreadCacheFreeWork work = {};
+            work.allocator                     = &allocator;
+            work.allocations                   = allocations;
+            work.allocation_count              = Dqn_ArrayCountI(allocations);
+
+            Dqn_TestThread thread  = {};
+            Dqn_b32        started = Dqn_TestThread_Start(&thread, Dqn_Test__ThreadCacheFreeThread, &work);
+            DQN_TEST_EXPECT(testing_state, started);
+            if (started)
+                Dqn_TestThread_Join(&thread);
+
+            Dqn_ThreadCacheAllocatorStats stats = work.stats_after_free;
+            DQN_TEST_EXPECT_MSG(testing_state, stats.threads == 1, "threads: %zd", stats.threads);
+            DQN_TEST_EXPECT_MSG(testing_state, stats.shared_slots == Dqn_ArrayCountI(allocations), "shared_slots: %zd", stats.shared_slots);
+            DQN_TEST_EXPECT_MSG(testing_state, stats.allocations == 0, "allocations: %zd", stats.allocations);
+        }
+
+        {
+            DQN_TEST_START_SCOPE(testing_state, "Threads allocate concurrently and free across threads");
+            int const THREAD_COUNT = 8;
+            Dqn_Allocator            backing   = Dqn_Allocator_InitWithHeap();
+            Dqn_ThreadCacheAllocator allocator = Dqn_ThreadCacheAllocator_Init(&backing, 16 /*batch_size*/);
+            DQN_DEFER { Dqn_ThreadCacheAllocator_Release(&allocator); };
+
+            Dqn_TestThread             threads[THREAD_COUNT] = {};
+            Dqn_Test__ThreadCacheWork  work[THREAD_COUNT]    = {};
+            DQN_FOR_EACH(thread_index, THREAD_COUNT)
+            {
+                Dqn_Test__ThreadCacheWork *item = work + thread_index;
+                item->allocator                 = &allocator;
+                item->pattern                   = DQN_CAST(Dqn_u8)(thread_index + 1);
+                item->allocation_count          = 200;
+                item->rounds                    = 50;
+                item->kept                      = Dqn_ArenaAllocator_NewArray(&testing_state.arena, void *, item->allocation_count, Dqn_ZeroMem::Yes);
             }
 
+            DQN_FOR_EACH(thread_index, THREAD_COUNT)
             {
-                DQN_TEST_START_SCOPE(testing_state, "A equals B");
-                Dqn_Rect a  = Dqn_Rect_InitFromPosAndSize(Dqn_V2(0, 0), Dqn_V2(100, 100));
-                Dqn_Rect b  = a;
-                Dqn_Rect ab = Dqn_Rect_Intersection(a, b);
+                Dqn_b32 started = Dqn_TestThread_Start(threads + thread_index, Dqn_Test__ThreadCacheStressThread, work + thread_index);
+                DQN_TEST_EXPECT(testing_state, started);
+            }
 
-                DQN_TEST_EXPECT_MSG(testing_state,
-                                ab.min.x == 0 && ab.min.y == 0 && ab.max.x == 100 && ab.max.y == 100,
-                                "ab = { min.x = %.2f, min.y = %.2f, max.x = %.2f. max.y = %.2f }",
-                                ab.min.x,
-                                ab.min.y,
-                                ab.max.x,
-                                ab.max.y);
+            DQN_FOR_EACH(thread_index, THREAD_COUNT)
+                Dqn_TestThread_Join(threads + thread_index);
+
+            Dqn_ThreadCacheAllocatorStats stats = Dqn_ThreadCacheAllocator_GetStats(&allocator);
+            DQN_TEST_EXPECT_MSG(testing_state, stats.threads == 0, "threads: %zd", stats.threads);
+            DQN_TEST_EXPECT_MSG(testing_state, stats.allocations == THREAD_COUNT * 200, "allocations: %zd", stats.allocations);
+
+            DQN_FOR_EACH(thread_index, THREAD_COUNT)
+            {
+                DQN_TEST_EXPECT(testing_state, !work[thread_index].failed_allocation);
+                DQN_TEST_EXPECT_MSG(testing_state, work[thread_index].corrupt_allocations == 0, "corrupt_allocations: %zd", work[thread_index].corrupt_allocations);
+                DQN_FOR_EACH(index, work[thread_index].allocation_count)
+                    Dqn_ThreadCacheAllocator_Free(&allocator, work[thread_index].kept[index]);
             }
+
+            stats = Dqn_ThreadCacheAllocator_GetStats(&allocator);
+            DQN_TEST_EXPECT_MSG(testing_state, stats.allocations == 0 && stats.bytes_allocated == 0, "allocations: %zd, bytes_allocated: %zd", stats.allocations, stats.bytes_allocated);
         }
     }
 
     // ---------------------------------------------------------------------------------------------
-    // NOTE: Dqn_StringBuilder
+    // NOTE: Dqn_Map
     // ---------------------------------------------------------------------------------------------
     {
-        DQN_TEST_DECLARE_GROUP_SCOPED(testing_state, "Dqn_StringBuilder");
-        Dqn_Allocator allocator = Dqn_Allocator_InitWithHeap();
-        // NOTE: Dqn_StringBuilder_Append
+        DQN_TEST_DECLARE_GROUP_SCOPED(testing_state, "Dqn_Map");
+        Dqn_isize const MEM_SIZE = Dqn_Map_MemoryRequired<Dqn_u64>(64);
+        void           *mem      = Dqn_ArenaAllocator_Allocate(&testing_state.arena, MEM_SIZE, alignof(Dqn_u64), Dqn_ZeroMem::No);
         {
-            {
-                DQN_TEST_START_SCOPE(testing_state, "Append variable size strings and build using heap allocator");
-                Dqn_StringBuilder<> builder = {};
-                if (builder.backup_allocator.type == Dqn_AllocatorType::Null)
-                    builder.backup_allocator = Dqn_Allocator_InitWithHeap();
+            DQN_TEST_START_SCOPE(testing_state, "Keys that share a slot keep their own values");
+            Dqn_Map<Dqn_u64> map = Dqn_Map_InitWithMemory<Dqn_u64>(mem, MEM_SIZE);
+            DQN_TEST_EXPECT_MSG(testing_state, map.size == 64, "size: %zd", map.size);
 
-                Dqn_StringBuilder_Append(&builder, "Abc", 1);
-                Dqn_StringBuilder_Append(&builder, "cd");
-                Dqn_isize size    = 0;
-                char *result = Dqn_StringBuilder_Build(&builder, &allocator, &size);
-                DQN_DEFER { Dqn_Allocator_Free(&allocator, result); };
-
-                char const EXPECT_STR[] = "Acd";
-                DQN_TEST_EXPECT_MSG(testing_state, size == Dqn_CharCountI(EXPECT_STR), "size: %zd", size);
-                DQN_TEST_EXPECT_MSG(testing_state, strncmp(result, EXPECT_STR, size) == 0, "result: %s", result);
+            // NOTE: Multiples of the size all mapped to slot 0 with the old modulo indexing
+            DQN_FOR_EACH(index, 32)
+            {
+                DQN_TEST_EXPECT(testing_state, Dqn_Map_Add(&map, DQN_CAST(Dqn_u64)(index * map.size), DQN_CAST(Dqn_u64)index));
             }
+            DQN_TEST_EXPECT_MSG(testing_state, map.count == 32, "count: %zd", map.count);
 
+            DQN_FOR_EACH(index, 32)
             {
-                DQN_TEST_START_SCOPE(testing_state, "Append empty string and build using heap allocator");
-                Dqn_StringBuilder<> builder = {};
-                if (builder.backup_allocator.type == Dqn_AllocatorType::Null)
-                    builder.backup_allocator = Dqn_Allocator_InitWithHeap();
+                Dqn_u64 *value = Dqn_Map_Get(&map, DQN_CAST(Dqn_u64)(index * map.size));
+                DQN_TEST_EXPECT_MSG(testing_state, value && *value == DQN_CAST(Dqn_u64)index, "index: %zd", index);
+            }
+            DQN_TEST_EXPECT(testing_state, Dqn_Map_Get(&map, DQN_CAST(Dqn_u64)(33 * map.size)) == nullptr);
+            DQN_TEST_EXPECT(testing_state, Dqn_Map_Add(&map, 0, DQN_CAST(Dqn_u64)123) == false);
+        }
 
-                Dqn_StringBuilder_Append(&builder, "");
-                Dqn_StringBuilder_Append(&builder, "");
-                Dqn_isize size    = 0;
-                char *result = Dqn_StringBuilder_Build(&builder, &allocator, &size);
-                DQN_DEFER { Dqn_Allocator_Free(&allocator, result); };
+        {
+            DQN_TEST_START_SCOPE(testing_state, "Erase keeps the rest of the probe sequence reachable");
+            Dqn_Map<Dqn_u64> map = Dqn_Map_InitWithMemory<Dqn_u64>(mem, MEM_SIZE);
+            DQN_FOR_EACH(index, 48)
+            {
+                Dqn_Map_Add(&map, DQN_CAST(Dqn_u64)index * 0x9E3779B9ULL, DQN_CAST(Dqn_u64)index);
+            }
 
-                char const EXPECT_STR[] = "";
-                DQN_TEST_EXPECT_MSG(testing_state, size == Dqn_CharCountI(EXPECT_STR), "size: %zd", size);
-                DQN_TEST_EXPECT_MSG(testing_state, strncmp(result, EXPECT_STR, size) == 0, "result: %s", result);
+            for (Dqn_isize index = 0; index < 48; index += 2)
+            {
+                DQN_TEST_EXPECT(testing_state, Dqn_Map_Erase(&map, DQN_CAST(Dqn_u64)index * 0x9E3779B9ULL));
             }
+            DQN_TEST_EXPECT(testing_state, Dqn_Map_Erase(&map, 0) == false);
+            DQN_TEST_EXPECT_MSG(testing_state, map.count == 24, "count: %zd", map.count);
 
+            DQN_FOR_EACH(index, 48)
             {
-                DQN_TEST_START_SCOPE(testing_state, "Append empty string onto string and build using heap allocator");
-                Dqn_StringBuilder<> builder = {};
-                if (builder.backup_allocator.type == Dqn_AllocatorType::Null)
-                    builder.backup_allocator = Dqn_Allocator_InitWithHeap();
+                Dqn_u64 *value = Dqn_Map_Get(&map, DQN_CAST(Dqn_u64)index * 0x9E3779B9ULL);
+                if (index % 2 == 0)
+                {
+                    DQN_TEST_EXPECT_MSG(testing_state, value == nullptr, "index: %zd", index);
+                }
+                else
+                {
+                    DQN_TEST_EXPECT_MSG(testing_state, value && *value == DQN_CAST(Dqn_u64)index, "index: %zd", index);
+                }
+            }
 
-                Dqn_StringBuilder_Append(&builder, "Acd");
-                Dqn_StringBuilder_Append(&builder, "");
-                Dqn_isize size    = 0;
-                char *result = Dqn_StringBuilder_Build(&builder, &allocator, &size);
-                DQN_DEFER { Dqn_Allocator_Free(&allocator, result); };
+            Dqn_MapStats stats = Dqn_Map_GetStats(&map);
+            DQN_TEST_EXPECT_MSG(testing_state, stats.load_factor == 24.0 / 64.0, "load_factor: %f", stats.load_factor);
+            DQN_TEST_EXPECT_MSG(testing_state, stats.max_probe_length >= 1, "max_probe_length: %zd", stats.max_probe_length);
+        }
 
-                char const EXPECT_STR[] = "Acd";
-                DQN_TEST_EXPECT_MSG(testing_state, size == Dqn_CharCountI(EXPECT_STR), "size: %zd", size);
-                DQN_TEST_EXPECT_MSG(testing_state, strncmp(result, EXPECT_STR, size) == 0, "result: %s", result);
+        {
+            DQN_TEST_START_SCOPE(testing_state, "Full map rejects new keys until one is erased");
+            Dqn_Map<Dqn_u64> map = Dqn_Map_InitWithMemory<Dqn_u64>(mem, MEM_SIZE);
+            DQN_FOR_EACH(index, map.size)
+            {
+                Dqn_Map_Add(&map, DQN_CAST(Dqn_u64)index, DQN_CAST(Dqn_u64)index);
             }
+            DQN_TEST_EXPECT_MSG(testing_state, map.count == map.size, "count: %zd, size: %zd", map.count, map.size);
 
-            {
-                DQN_TEST_START_SCOPE(testing_state, "Append nullptr and build using heap allocator");
-                Dqn_StringBuilder<> builder = {};
-                if (builder.backup_allocator.type == Dqn_AllocatorType::Null)
-                    builder.backup_allocator = Dqn_Allocator_InitWithHeap();
+            Dqn_b32 found = true;
+            DQN_TEST_EXPECT(testing_state, Dqn_Map_FindOrMake(&map, DQN_CAST(Dqn_u64)map.size, &found) == nullptr && !found);
 
-                Dqn_StringBuilder_Append(&builder, nullptr, 5);
-                Dqn_isize size    = 0;
-                char *result = Dqn_StringBuilder_Build(&builder, &allocator, &size);
-                DQN_DEFER { Dqn_Allocator_Free(&allocator, result); };
+            Dqn_u64 *value = Dqn_Map_Get(&map, DQN_CAST(Dqn_u64)(map.size - 1));
+            DQN_TEST_EXPECT(testing_state, value && *value == DQN_CAST(Dqn_u64)(map.size - 1));
 
-                char const EXPECT_STR[] = "";
-                DQN_TEST_EXPECT_MSG(testing_state, size == Dqn_CharCountI(EXPECT_STR), "size: %zd", size);
-                DQN_TEST_EXPECT_MSG(testing_state, strncmp(result, EXPECT_STR, size) == 0, "result: %s", result);
-            }
+            DQN_TEST_EXPECT(testing_state, Dqn_Map_Erase(&map, 0));
+            DQN_TEST_EXPECT(testing_state, Dqn_Map_Add(&map, DQN_CAST(Dqn_u64)map.size, DQN_CAST(Dqn_u64)map.size));
+        }
 
+        {
+            DQN_TEST_START_SCOPE(testing_state, "GetBatch finds the same values as Get");
+            Dqn_Map<Dqn_u64> map = Dqn_Map_InitWithMemory<Dqn_u64>(mem, MEM_SIZE);
+            DQN_FOR_EACH(index, 40)
             {
-                DQN_TEST_START_SCOPE(testing_state, "Append and require new linked buffer and build using heap allocator");
-                Dqn_StringBuilder<2> builder = {};
-                if (builder.backup_allocator.type == Dqn_AllocatorType::Null)
-                    builder.backup_allocator = Dqn_Allocator_InitWithHeap();
+                Dqn_Map_Add(&map, DQN_CAST(Dqn_u64)index * 3, DQN_CAST(Dqn_u64)index);
+            }
 
-                Dqn_StringBuilder_Append(&builder, "A");
-                Dqn_StringBuilder_Append(&builder, "z"); // Should force a new memory block
-                Dqn_StringBuilder_Append(&builder, "tec");
-                Dqn_isize size    = 0;
-                char *result = Dqn_StringBuilder_Build(&builder, &allocator, &size);
-                DQN_DEFER { Dqn_Allocator_Free(&allocator, result); };
+            // NOTE: Not a multiple of the batch size so the last batch is partial
+            Dqn_u64  keys[101]    = {};
+            Dqn_u64 *results[101] = {};
+            DQN_FOR_EACH(index, Dqn_ArrayCountI(keys))
+                keys[index] = DQN_CAST(Dqn_u64)index;
 
-                char const EXPECT_STR[] = "Aztec";
-                DQN_TEST_EXPECT_MSG(testing_state, size == Dqn_CharCountI(EXPECT_STR), "size: %zd", size);
-                DQN_TEST_EXPECT_MSG(testing_state, strncmp(result, EXPECT_STR, size) == 0, "result: %s", result);
-            }
+            Dqn_isize found      = Dqn_Map_GetBatch(&map, keys, Dqn_ArrayCountI(keys), results);
+            Dqn_isize mismatches = 0;
+            DQN_FOR_EACH(index, Dqn_ArrayCountI(keys))
+                mismatches += results[index] != Dqn_Map_Get(&map, keys[index]);
+            DQN_TEST_EXPECT_MSG(testing_state, found == 34, "found: %zd", found);
+            DQN_TEST_EXPECT_MSG(testing_state, mismatches == 0, "mismatches: %zd", mismatches);
+
+            Dqn_Map<Dqn_u64> empty = {};
+            results[0]             = &keys[0];
+            DQN_TEST_EXPECT(testing_state, Dqn_Map_GetBatch(&empty, keys, 1, results) == 0 && results[0] == nullptr);
         }
+    }
 
-        // NOTE: Dqn_StringBuilder_AppendChar
+    // ---------------------------------------------------------------------------------------------
+    // NOTE: Dqn_FlatMap
+    // ---------------------------------------------------------------------------------------------
+    {
+        DQN_TEST_DECLARE_GROUP_SCOPED(testing_state, "Dqn_FlatMap");
+        using FlatMap            = Dqn_FlatMap<Dqn_u64, Dqn_u32>;
+        Dqn_isize const MEM_SIZE = Dqn_FlatMap_MemoryRequired<Dqn_u64, Dqn_u32>(256);
+        void           *mem      = Dqn_ArenaAllocator_Allocate(&testing_state.arena, MEM_SIZE, alignof(Dqn_FlatMapSlot<Dqn_u64, Dqn_u32>), Dqn_ZeroMem::No);
         {
-            DQN_TEST_START_SCOPE(testing_state, "Append char and build using heap allocator");
-            Dqn_StringBuilder<> builder = {};
-            if (builder.backup_allocator.type == Dqn_AllocatorType::Null)
-                builder.backup_allocator = Dqn_Allocator_InitWithHeap();
+            DQN_TEST_START_SCOPE(testing_state, "Add, get and erase through the Dqn_Map API");
+            FlatMap map = Dqn_FlatMap_InitWithMemory<Dqn_u64, Dqn_u32>(mem, MEM_SIZE);
+            DQN_TEST_EXPECT_MSG(testing_state, map.size == 256, "size: %zd", map.size);
 
-            Dqn_StringBuilder_AppendChar(&builder, 'a');
-            Dqn_StringBuilder_AppendChar(&builder, 'b');
-            Dqn_isize size    = 0;
-            char *result = Dqn_StringBuilder_Build(&builder, &allocator, &size);
-            DQN_DEFER { Dqn_Allocator_Free(&allocator, result); };
+            DQN_FOR_EACH(index, 200)
+            {
+                DQN_TEST_EXPECT(testing_state, Dqn_Map_Add(&map, index * 256, DQN_CAST(Dqn_u32)index));
+            }
+            DQN_TEST_EXPECT(testing_state, Dqn_Map_Add(&map, 0, 7) == false);
 
-            char const EXPECT_STR[] = "ab";
-            DQN_TEST_EXPECT_MSG(testing_state, size == Dqn_CharCountI(EXPECT_STR), "size: %zd", size);
-            DQN_TEST_EXPECT_MSG(testing_state, strncmp(result, EXPECT_STR, size) == 0, "result: %s", result);
+            Dqn_b32 found = false;
+            Dqn_u32 *value = Dqn_Map_FindOrMake(&map, 199 * 256, &found);
+            DQN_TEST_EXPECT(testing_state, found && value && *value == 199);
+
+            for (Dqn_isize index = 0; index < 200; index += 3)
+            {
+                DQN_TEST_EXPECT(testing_state, Dqn_Map_Erase(&map, index * 256));
+            }
+            DQN_TEST_EXPECT(testing_state, Dqn_Map_Erase(&map, 0) == false);
+
+            DQN_FOR_EACH(index, 200)
+            {
+                value = Dqn_Map_Get(&map, index * 256);
+                if (index % 3 == 0)
+                {
+                    DQN_TEST_EXPECT_MSG(testing_state, value == nullptr, "index: %zd", index);
+                }
+                else
+                {
+                    DQN_TEST_EXPECT_MSG(testing_state, value && *value == DQN_CAST(Dqn_u32)index, "index: %zd", index);
+                }
+            }
+            DQN_TEST_EXPECT_MSG(testing_state, map.count == 133, "count: %zd", map.count);
         }
 
-        // NOTE: Dqn_StringBuilder_AppendFmt
         {
+            DQN_TEST_START_SCOPE(testing_state, "Full map rejects new keys and reuses erased slots");
+            FlatMap map = Dqn_FlatMap_InitWithMemory<Dqn_u64, Dqn_u32>(mem, MEM_SIZE);
+            DQN_FOR_EACH(index, map.size)
             {
-                DQN_TEST_START_SCOPE(testing_state, "Append format string and build using heap allocator");
-                Dqn_StringBuilder<> builder = {};
-                if (builder.backup_allocator.type == Dqn_AllocatorType::Null)
-                    builder.backup_allocator = Dqn_Allocator_InitWithHeap();
+                Dqn_Map_Add(&map, index, DQN_CAST(Dqn_u32)index);
+            }
+            DQN_TEST_EXPECT_MSG(testing_state, map.count == map.size, "count: %zd, size: %zd", map.count, map.size);
+            DQN_TEST_EXPECT(testing_state, Dqn_Map_FindOrMake(&map, map.size) == nullptr);
+            DQN_TEST_EXPECT(testing_state, Dqn_Map_Get(&map, map.size) == nullptr);
 
-                Dqn_StringBuilder_AppendFmt(&builder, "Number: %d, String: %s, ", 4, "Hello Sailor");
-                Dqn_StringBuilder_AppendFmt(&builder, "Extra Stuff");
-                Dqn_isize size    = 0;
-                char *result = Dqn_StringBuilder_Build(&builder, &allocator, &size);
-                DQN_DEFER { Dqn_Allocator_Free(&allocator, result); };
+            // NOTE: Every group is full so erasing leaves a tombstone that the next insert reuses
+            DQN_TEST_EXPECT(testing_state, Dqn_Map_Erase(&map, 5));
+            DQN_TEST_EXPECT_MSG(testing_state, map.tombstones == 1, "tombstones: %zd", map.tombstones);
+            DQN_TEST_EXPECT(testing_state, Dqn_Map_Add(&map, map.size, 1234));
+            DQN_TEST_EXPECT_MSG(testing_state, map.tombstones == 0, "tombstones: %zd", map.tombstones);
 
-                char const EXPECT_STR[] = "Number: 4, String: Hello Sailor, Extra Stuff";
-                DQN_TEST_EXPECT_MSG(testing_state, size == Dqn_CharCountI(EXPECT_STR), "size: %zd", size);
-                DQN_TEST_EXPECT_MSG(testing_state, strncmp(result, EXPECT_STR, size) == 0, "result: %s", result);
+            Dqn_u32 *value = Dqn_Map_Get(&map, map.size);
+            DQN_TEST_EXPECT(testing_state, value && *value == 1234);
+
+            Dqn_MapStats stats = Dqn_Map_GetStats(&map);
+            DQN_TEST_EXPECT_MSG(testing_state, stats.load_factor == 1.0, "load_factor: %f", stats.load_factor);
+        }
+
+        {
+            DQN_TEST_START_SCOPE(testing_state, "Erasing and adding at 90% load rehashes away tombstones");
+            Dqn_isize const CHURN_MEM_SIZE = Dqn_FlatMap_MemoryRequired<Dqn_u64, Dqn_u32>(1024);
+            void           *churn_mem      = Dqn_ArenaAllocator_Allocate(&testing_state.arena, CHURN_MEM_SIZE, alignof(Dqn_FlatMapSlot<Dqn_u64, Dqn_u32>), Dqn_ZeroMem::No);
+            FlatMap         map            = Dqn_FlatMap_InitWithMemory<Dqn_u64, Dqn_u32>(churn_mem, CHURN_MEM_SIZE);
+
+            Dqn_u64 keys[921]; // NOTE: 90% of 1024 slots
+            Dqn_u64 next_key = 0;
+            DQN_FOR_EACH(index, Dqn_ArrayCountI(keys))
+            {
+                keys[index] = next_key++;
+                Dqn_Map_Add(&map, keys[index], DQN_CAST(Dqn_u32)keys[index]);
+            }
+
+            // NOTE: Replace a random key many times over the map's size, every erase that lands in a
+            // full group leaves a tombstone. Without rehashing they eventually fill every free slot.
+            Dqn_u64   rng             = 0xD1B54A32D192ED03ULL;
+            Dqn_isize failures        = 0;
+            Dqn_isize max_tombstones  = 0;
+            Dqn_isize too_few_empties = 0;
+            for (Dqn_isize iteration = 0; iteration < 20 * map.size; iteration++)
+            {
+                Dqn_u64 *key = keys + (Dqn_Test__RandomU64(&rng) % Dqn_ArrayCount(keys));
+                failures    += !Dqn_Map_Erase(&map, *key);
+                failures    += Dqn_Map_Get(&map, *key) != nullptr;
+
+                *key         = next_key++;
+                failures    += !Dqn_Map_Add(&map, *key, DQN_CAST(Dqn_u32)*key);
+
+                Dqn_isize empty  = map.size - map.count - map.tombstones;
+                max_tombstones   = DQN_M_MAX(max_tombstones, map.tombstones);
+                too_few_empties += map.tombstones >= map.size / 32 && map.tombstones > empty + 1;
+            }
+
+            DQN_TEST_EXPECT_MSG(testing_state, failures == 0, "failures: %zd", failures);
+            DQN_TEST_EXPECT_MSG(testing_state, map.count == Dqn_ArrayCountI(keys), "count: %zd", map.count);
+            DQN_TEST_EXPECT_MSG(testing_state, max_tombstones <= map.size / 8, "max tombstones: %zd", max_tombstones);
+            DQN_TEST_EXPECT_MSG(testing_state, too_few_empties == 0, "iterations with more tombstones than empty slots: %zd", too_few_empties);
+
+            // NOTE: Every live key must be found and every erased or never added key must miss
+            Dqn_b8 *live = Dqn_ArenaAllocator_NewArray(&testing_state.arena, Dqn_b8, next_key + 1000, Dqn_ZeroMem::Yes);
+            for (Dqn_u64 key : keys)
+                live[key] = true;
+
+            Dqn_isize missing    = 0;
+            Dqn_isize false_hits = 0;
+            for (Dqn_u64 key = 0; key < next_key + 1000; key++)
+            {
+                Dqn_u32 *value = Dqn_Map_Get(&map, key);
+                if (live[key]) missing    += !value || *value != DQN_CAST(Dqn_u32)key;
+                else           false_hits += value != nullptr;
+            }
+            DQN_TEST_EXPECT_MSG(testing_state, missing == 0, "missing: %zd", missing);
+            DQN_TEST_EXPECT_MSG(testing_state, false_hits == 0, "false hits: %zd", false_hits);
+        }
+    }
+
+    // ---------------------------------------------------------------------------------------------
+    // NOTE: Dqn_GrowableMap
+    // ---------------------------------------------------------------------------------------------
+    {
+        DQN_TEST_DECLARE_GROUP_SCOPED(testing_state, "Dqn_GrowableMap");
+        {
+            DQN_TEST_START_SCOPE(testing_state, "Zero initialised map grows and keeps every key");
+            Dqn_GrowableMap<Dqn_isize> map = {};
+            map.allocator                  = Dqn_Allocator_InitWithHeap();
+            DQN_DEFER { Dqn_GrowableMap_Free(&map); };
+
+            DQN_FOR_EACH(index, 10000)
+            {
+                DQN_TEST_EXPECT(testing_state, Dqn_Map_Add(&map, DQN_CAST(Dqn_u64)index * 4096, index));
+            }
+            DQN_TEST_EXPECT(testing_state, Dqn_Map_Add(&map, 0, DQN_CAST(Dqn_isize)1) == false);
+
+            DQN_FOR_EACH(index, 10000)
+            {
+                Dqn_isize *value = Dqn_Map_Get(&map, DQN_CAST(Dqn_u64)index * 4096);
+                DQN_TEST_EXPECT_MSG(testing_state, value && *value == index, "index: %zd", index);
+            }
+
+            Dqn_MapStats stats = Dqn_Map_GetStats(&map);
+            DQN_TEST_EXPECT_MSG(testing_state, stats.resize_count == 10, "resize_count: %zd", stats.resize_count);
+            DQN_TEST_EXPECT_MSG(testing_state, stats.load_factor <= 0.75, "load_factor: %f", stats.load_factor);
+            DQN_TEST_EXPECT_MSG(testing_state, stats.max_probe_length >= 1, "max_probe_length: %zd", stats.max_probe_length);
+        }
+
+        {
+            DQN_TEST_START_SCOPE(testing_state, "Keys stay reachable and erasable while rehashing");
+            Dqn_GrowableMap<Dqn_isize> map = Dqn_GrowableMap_InitWithAllocator<Dqn_isize>(Dqn_Allocator_InitWithHeap(), 64);
+            DQN_DEFER { Dqn_GrowableMap_Free(&map); };
+
+            // NOTE: 64 slots grow at the 49th key, the next insert only migrates part of the old table
+            DQN_FOR_EACH(index, 50)
+                Dqn_Map_Add(&map, DQN_CAST(Dqn_u64)index, index);
+            DQN_TEST_EXPECT_MSG(testing_state, map.old_map.count > 0, "old_map.count: %zd", map.old_map.count);
+            DQN_TEST_EXPECT_MSG(testing_state, map.map.count + map.old_map.count == 50, "count: %zd", map.map.count + map.old_map.count);
+
+            DQN_FOR_EACH(index, 50)
+            {
+                Dqn_isize *value = Dqn_Map_Get(&map, DQN_CAST(Dqn_u64)index);
+                DQN_TEST_EXPECT_MSG(testing_state, value && *value == index, "index: %zd", index);
+            }
+
+            for (Dqn_isize index = 0; index < 50; index += 2)
+            {
+                DQN_TEST_EXPECT(testing_state, Dqn_Map_Erase(&map, DQN_CAST(Dqn_u64)index));
+            }
+
+            // NOTE: Keep inserting until the migration finishes and the old table is released
+            for (Dqn_isize index = 50; map.old_map.size; index++)
+                Dqn_Map_Add(&map, DQN_CAST(Dqn_u64)index, index);
+
+            DQN_FOR_EACH(index, 50)
+            {
+                Dqn_isize *value = Dqn_Map_Get(&map, DQN_CAST(Dqn_u64)index);
+                if (index % 2 == 0)
+                {
+                    DQN_TEST_EXPECT_MSG(testing_state, value == nullptr, "index: %zd", index);
+                }
+                else
+                {
+                    DQN_TEST_EXPECT_MSG(testing_state, value && *value == index, "index: %zd", index);
+                }
+            }
+        }
+    }
+
+    // ---------------------------------------------------------------------------------------------
+    // NOTE: Dqn_ConcurrentMap
+    // ---------------------------------------------------------------------------------------------
+    {
+        DQN_TEST_DECLARE_GROUP_SCOPED(testing_state, "Dqn_ConcurrentMap");
+        {
+            DQN_TEST_START_SCOPE(testing_state, "Add, set, get and erase across shards");
+            Dqn_ConcurrentMap<Dqn_isize> map = {};
+            DQN_TEST_EXPECT(testing_state, Dqn_ConcurrentMap_InitWithAllocator(&map, Dqn_Allocator_InitWithHeap(), 6));
+            DQN_DEFER { Dqn_ConcurrentMap_Free(&map); };
+            DQN_TEST_EXPECT_MSG(testing_state, map.shard_count == 8, "shard_count: %zd", map.shard_count);
+
+            DQN_FOR_EACH(index, 1000)
+            {
+                DQN_TEST_EXPECT(testing_state, Dqn_ConcurrentMap_Add(&map, DQN_CAST(Dqn_u64)index, index));
+            }
+            DQN_TEST_EXPECT(testing_state, Dqn_ConcurrentMap_Add(&map, DQN_CAST(Dqn_u64)5, DQN_CAST(Dqn_isize)0) == false);
+            DQN_TEST_EXPECT(testing_state, Dqn_ConcurrentMap_Set(&map, DQN_CAST(Dqn_u64)5, DQN_CAST(Dqn_isize)-5));
+            DQN_TEST_EXPECT(testing_state, Dqn_ConcurrentMap_Erase(&map, DQN_CAST(Dqn_u64)6));
+            DQN_TEST_EXPECT(testing_state, Dqn_ConcurrentMap_Erase(&map, DQN_CAST(Dqn_u64)6) == false);
+            DQN_TEST_EXPECT_MSG(testing_state, Dqn_ConcurrentMap_Count(&map) == 999, "count: %zd", Dqn_ConcurrentMap_Count(&map));
+
+            Dqn_isize value = 0;
+            DQN_TEST_EXPECT(testing_state, Dqn_ConcurrentMap_Get(&map, DQN_CAST(Dqn_u64)5, &value) && value == -5);
+            DQN_TEST_EXPECT(testing_state, Dqn_ConcurrentMap_Get(&map, DQN_CAST(Dqn_u64)6, &value) == false);
+            DQN_TEST_EXPECT(testing_state, Dqn_ConcurrentMap_Get(&map, DQN_CAST(Dqn_u64)999, DQN_CAST(Dqn_isize *)nullptr));
+
+            Dqn_isize empty_shards = 0;
+            DQN_FOR_EACH(index, map.shard_count)
+                empty_shards += map.shards[index].map.map.count == 0;
+            DQN_TEST_EXPECT_MSG(testing_state, empty_shards == 0, "empty_shards: %zd", empty_shards);
+        }
+
+        {
+            DQN_TEST_START_SCOPE(testing_state, "A map whose shards failed to allocate fails every operation");
+            Dqn_ConcurrentMap<Dqn_isize> map = {};
+            DQN_TEST_EXPECT(testing_state, Dqn_ConcurrentMap_InitWithAllocator(&map, Dqn_Allocator_InitWithNull()) == false);
+            DQN_DEFER { Dqn_ConcurrentMap_Free(&map); };
+            DQN_TEST_EXPECT_MSG(testing_state, !map.shards && map.shard_count == 0, "shards: %p, shard_count: %zd", map.shards, map.shard_count);
+
+            Dqn_isize value = 0;
+            DQN_TEST_EXPECT(testing_state, Dqn_ConcurrentMap_Add(&map, DQN_CAST(Dqn_u64)1, DQN_CAST(Dqn_isize)1) == false);
+            DQN_TEST_EXPECT(testing_state, Dqn_ConcurrentMap_Set(&map, DQN_CAST(Dqn_u64)1, DQN_CAST(Dqn_isize)1) == false);
+            DQN_TEST_EXPECT(testing_state, Dqn_ConcurrentMap_Get(&map, DQN_CAST(Dqn_u64)1, &value) == false);
+            DQN_TEST_EXPECT(testing_state, Dqn_ConcurrentMap_Erase(&map, DQN_CAST(Dqn_u64)1) == false);
+            DQN_TEST_EXPECT(testing_state, Dqn_ConcurrentMap_Count(&map) == 0);
+        }
+
+        {
+            DQN_TEST_START_SCOPE(testing_state, "Threads adding and erasing at once keep every key");
+            int const       THREAD_COUNT = 4;
+            Dqn_isize const KEY_COUNT    = 2000;
+            Dqn_ConcurrentMap<Dqn_isize> map = {};
+            DQN_TEST_EXPECT(testing_state, Dqn_ConcurrentMap_InitWithAllocator(&map, Dqn_Allocator_InitWithHeap()));
+            DQN_DEFER { Dqn_ConcurrentMap_Free(&map); };
+
+            Dqn_TestThread              threads[THREAD_COUNT] = {};
+            Dqn_Test__ConcurrentMapWork work[THREAD_COUNT]    = {};
+            DQN_FOR_EACH(thread_index, THREAD_COUNT)
+            {
+                work[thread_index].map       = &map;
+                work[thread_index].first_key = thread_index * KEY_COUNT;
+                work[thread_index].key_count = KEY_COUNT;
+                Dqn_b32 started              = Dqn_TestThread_Start(threads + thread_index, Dqn_Test__ConcurrentMapThread, work + thread_index);
+                DQN_TEST_EXPECT(testing_state, started);
+            }
+
+            DQN_FOR_EACH(thread_index, THREAD_COUNT)
+                Dqn_TestThread_Join(threads + thread_index);
+
+            Dqn_isize failures = 0;
+            DQN_FOR_EACH(thread_index, THREAD_COUNT)
+                failures += work[thread_index].failures;
+            DQN_FOR_EACH(key, THREAD_COUNT * KEY_COUNT)
+            {
+                Dqn_isize value = 0;
+                Dqn_b32   found = Dqn_ConcurrentMap_Get(&map, DQN_CAST(Dqn_u64)key, &value);
+                failures += (key & 1) ? found : (!found || value != key * 2);
+            }
+
+            Dqn_isize count = Dqn_ConcurrentMap_Count(&map);
+            DQN_TEST_EXPECT_MSG(testing_state, failures == 0, "failures: %zd", failures);
+            DQN_TEST_EXPECT_MSG(testing_state, count == THREAD_COUNT * KEY_COUNT / 2, "count: %zd", count);
+        }
+    }
+
+    // ---------------------------------------------------------------------------------------------
+    // NOTE: Dqn_StringMap
+    // ---------------------------------------------------------------------------------------------
+    {
+        DQN_TEST_DECLARE_GROUP_SCOPED(testing_state, "Dqn_StringMap");
+        {
+            DQN_TEST_START_SCOPE(testing_state, "Map grows past its initial size and keeps every key");
+            Dqn_StringMap<int> map = Dqn_StringMap_InitWithArena<int>(&testing_state.arena, 16);
+            int values[200]        = {};
+            DQN_FOR_EACH(index, Dqn_ArrayCountI(values))
+            {
+                Dqn_String key = Dqn_String_InitArenaFmt(&testing_state.arena, "key%zd", index);
+                DQN_TEST_EXPECT(testing_state, Dqn_StringMap_Add(&map, key, values + index, Dqn_StringMapCollisionRule::Stop));
+            }
+            DQN_TEST_EXPECT_MSG(testing_state, map.count == 200, "count: %zd", map.count);
+            DQN_TEST_EXPECT_MSG(testing_state, map.size == 512, "size: %zd", map.size);
+
+            DQN_FOR_EACH(index, Dqn_ArrayCountI(values))
+            {
+                Dqn_String key = Dqn_String_InitArenaFmt(&testing_state.arena, "key%zd", index);
+                Dqn_StringMapEntry<int> *entry = Dqn_StringMap_Get(&map, key);
+                DQN_TEST_EXPECT_MSG(testing_state, entry && entry->value == values + index, "index: %zd", index);
+            }
+            DQN_TEST_EXPECT(testing_state, Dqn_StringMap_Get(&map, DQN_STRING("key200")) == nullptr);
+            DQN_TEST_EXPECT(testing_state, Dqn_StringMap_Get(&map, DQN_STRING("")) == nullptr);
+
+            // NOTE: Half of the keys are missing and the last batch is partial
+            Dqn_String               keys[301]    = {};
+            Dqn_StringMapEntry<int> *results[301] = {};
+            DQN_FOR_EACH(index, Dqn_ArrayCountI(keys))
+                keys[index] = Dqn_String_InitArenaFmt(&testing_state.arena, "key%zd", index * 2);
+
+            Dqn_isize found      = Dqn_StringMap_GetBatch(&map, keys, Dqn_ArrayCountI(keys), results);
+            Dqn_isize mismatches = 0;
+            DQN_FOR_EACH(index, Dqn_ArrayCountI(keys))
+                mismatches += results[index] != Dqn_StringMap_Get(&map, keys[index]);
+            DQN_TEST_EXPECT_MSG(testing_state, found == 100, "found: %zd", found);
+            DQN_TEST_EXPECT_MSG(testing_state, mismatches == 0, "mismatches: %zd", mismatches);
+        }
+
+        {
+            DQN_TEST_START_SCOPE(testing_state, "Collision rule decides if an existing value is replaced");
+            Dqn_StringMap<int> map = {};
+            map.backup_allocator   = Dqn_Allocator_InitWithHeap();
+            DQN_DEFER { Dqn_StringMap_Free(&map); };
+            DQN_TEST_EXPECT(testing_state, Dqn_StringMap_Get(&map, DQN_STRING("a")) == nullptr);
+
+            int a = 0, b = 1;
+            Dqn_StringMap_Add(&map, DQN_STRING("a"), &a, Dqn_StringMapCollisionRule::Stop);
+            Dqn_StringMapEntry<int> *entry = Dqn_StringMap_Add(&map, DQN_STRING("a"), &b, Dqn_StringMapCollisionRule::Stop);
+            DQN_TEST_EXPECT(testing_state, entry && entry->value == &a);
+
+            entry = Dqn_StringMap_Add(&map, DQN_STRING("a"), &b, Dqn_StringMapCollisionRule::Overwrite);
+            DQN_TEST_EXPECT(testing_state, entry && entry->value == &b);
+            DQN_TEST_EXPECT_MSG(testing_state, map.count == 1, "count: %zd", map.count);
+
+            entry = Dqn_StringMap_Add(&map, DQN_STRING(""), &a, Dqn_StringMapCollisionRule::Stop);
+            DQN_TEST_EXPECT(testing_state, entry && Dqn_StringMap_Get(&map, DQN_STRING("")) == entry);
+        }
+    }
+
+    // ---------------------------------------------------------------------------------------------
+    // NOTE: Dqn_StringInterner
+    // ---------------------------------------------------------------------------------------------
+    {
+        DQN_TEST_DECLARE_GROUP_SCOPED(testing_state, "Dqn_StringInterner");
+        {
+            DQN_TEST_START_SCOPE(testing_state, "Equal strings intern to the same id and canonical pointer");
+            Dqn_StringInterner interner = Dqn_StringInterner_InitWithArena(&testing_state.arena);
+
+            char buffer[] = "position";
+            Dqn_InternedString a = Dqn_StringInterner_Intern(&interner, DQN_STRING("position"));
+            Dqn_InternedString b = Dqn_StringInterner_Intern(&interner, DQN_STRING("velocity"));
+            Dqn_InternedString c = Dqn_StringInterner_Intern(&interner, Dqn_String_Init(buffer, Dqn_CharCountI(buffer)));
+            DQN_TEST_EXPECT_MSG(testing_state, a.id == 1 && b.id == 2, "a: %u, b: %u", a.id, b.id);
+            DQN_TEST_EXPECT(testing_state, a == c && a != b);
+            DQN_TEST_EXPECT(testing_state, a.string.str == c.string.str && c.string.str != buffer);
+            DQN_TEST_EXPECT(testing_state, a.string.str[a.string.size] == 0);
+
+            DQN_TEST_EXPECT(testing_state, Dqn_StringInterner_Find(&interner, DQN_STRING("velocity")) == b);
+            DQN_TEST_EXPECT(testing_state, Dqn_StringInterner_Find(&interner, DQN_STRING("colour")).id == 0);
+            DQN_TEST_EXPECT(testing_state, Dqn_StringInterner_StringFromID(&interner, b.id) == DQN_STRING("velocity"));
+            DQN_TEST_EXPECT(testing_state, Dqn_StringInterner_StringFromID(&interner, 3).size == 0);
+            DQN_TEST_EXPECT(testing_state, Dqn_StringInterner_StringFromID(&interner, 0).size == 0);
+        }
+
+        {
+            DQN_TEST_START_SCOPE(testing_state, "Threads interning the same strings agree on their ids");
+            int const       THREAD_COUNT = 4;
+            Dqn_isize const KEY_COUNT    = 2000;
+            Dqn_ArenaAllocator arena     = Dqn_ArenaAllocator_InitWithNewAllocator(Dqn_Allocator_InitWithHeap(), 0, nullptr);
+            DQN_DEFER { Dqn_ArenaAllocator_Free(&arena); };
+            Dqn_StringInterner interner  = Dqn_StringInterner_InitWithArena(&arena, true /*thread_safe*/);
+
+            Dqn_String *keys = Dqn_ArenaAllocator_NewArray(&testing_state.arena, Dqn_String, KEY_COUNT, Dqn_ZeroMem::No);
+            DQN_FOR_EACH(index, KEY_COUNT)
+                keys[index] = Dqn_String_InitArenaFmt(&testing_state.arena, "field%zd", index);
+
+            Dqn_TestThread               threads[THREAD_COUNT] = {};
+            Dqn_Test__StringInternerWork work[THREAD_COUNT]    = {};
+            DQN_FOR_EACH(thread_index, THREAD_COUNT)
+            {
+                Dqn_Test__StringInternerWork *item = work + thread_index;
+                item->interner                     = &interner;
+                item->keys                         = keys;
+                item->key_count                    = KEY_COUNT;
+                item->offset                       = thread_index * (KEY_COUNT / THREAD_COUNT);
+                item->ids                          = Dqn_ArenaAllocator_NewArray(&testing_state.arena, Dqn_u32, KEY_COUNT, Dqn_ZeroMem::Yes);
+                Dqn_b32 started                    = Dqn_TestThread_Start(threads + thread_index, Dqn_Test__StringInternerThread, item);
+                DQN_TEST_EXPECT(testing_state, started);
+            }
+
+            DQN_FOR_EACH(thread_index, THREAD_COUNT)
+                Dqn_TestThread_Join(threads + thread_index);
+
+            DQN_TEST_EXPECT_MSG(testing_state, interner.entries.size == KEY_COUNT, "entries: %zd", interner.entries.size);
+            Dqn_isize mismatches = 0;
+            DQN_FOR_EACH(index, KEY_COUNT)
+            {
+                Dqn_u32 id = work[0].ids[index];
+                DQN_FOR_EACH(thread_index, THREAD_COUNT)
+                    mismatches += work[thread_index].ids[index] != id;
+                mismatches += !(Dqn_StringInterner_StringFromID(&interner, id) == keys[index]);
+            }
+            DQN_TEST_EXPECT_MSG(testing_state, mismatches == 0, "mismatches: %zd", mismatches);
+        }
+
+        {
+            DQN_TEST_START_SCOPE(testing_state, "A string whose entry could not be stored is not left in the map");
+            Dqn_StringInterner interner = Dqn_StringInterner_InitWithArena(&testing_state.arena);
+            Dqn_InternedString a        = Dqn_StringInterner_Intern(&interner, DQN_STRING("position"));
+            while (interner.entries.size < interner.entries.max)
+                Dqn_StringInterner_Intern(&interner, Dqn_String_InitArenaFmt(&testing_state.arena, "field%zd", interner.entries.size));
+
+            // NOTE: The entries are full, make their next growth fail
+            interner.entries.allocator = Dqn_Allocator_InitWithNull();
+            Dqn_InternedString b       = Dqn_StringInterner_Intern(&interner, DQN_STRING("velocity"));
+            DQN_TEST_EXPECT_MSG(testing_state, b.id == 0, "b: %u", b.id);
+            DQN_TEST_EXPECT(testing_state, Dqn_StringInterner_Find(&interner, DQN_STRING("velocity")).id == 0);
+            DQN_TEST_EXPECT(testing_state, Dqn_StringInterner_Intern(&interner, DQN_STRING("velocity")).id == 0);
+            DQN_TEST_EXPECT(testing_state, Dqn_StringInterner_Intern(&interner, DQN_STRING("position")) == a);
+        }
+    }
+
+    // ---------------------------------------------------------------------------------------------
+    // NOTE: Dqn_PerfectHash
+    // ---------------------------------------------------------------------------------------------
+    {
+        DQN_TEST_DECLARE_GROUP_SCOPED(testing_state, "Dqn_PerfectHash");
+        {
+            DQN_TEST_START_SCOPE(testing_state, "Every string finds its index, other strings find nothing");
+            Dqn_PerfectHash<Dqn_ArrayCountI(DQN_TEST__HTTP_HEADERS)> const *table = &DQN_TEST__HTTP_HEADER_TABLE;
+            DQN_FOR_EACH(index, Dqn_ArrayCountI(DQN_TEST__HTTP_HEADERS))
+            {
+                Dqn_String key   = Dqn_String_Init(DQN_TEST__HTTP_HEADERS[index], DQN_CAST(Dqn_isize)strlen(DQN_TEST__HTTP_HEADERS[index]));
+                Dqn_isize  found = Dqn_PerfectHash_Find(table, key);
+                DQN_TEST_EXPECT_MSG(testing_state, found == index, "key: %.*s, found: %zd", DQN_STRING_FMT(key), found);
+            }
+
+            DQN_TEST_EXPECT(testing_state, Dqn_PerfectHash_Find(table, DQN_STRING("content-typ")) == -1);
+            DQN_TEST_EXPECT(testing_state, Dqn_PerfectHash_Find(table, DQN_STRING("Content-Type")) == -1);
+            DQN_TEST_EXPECT(testing_state, Dqn_PerfectHash_Find(table, DQN_STRING("x-forwarded-for")) == -1);
+            DQN_TEST_EXPECT(testing_state, Dqn_PerfectHash_Find(table, DQN_STRING("")) == -1);
+        }
+
+        {
+            DQN_TEST_START_SCOPE(testing_state, "Duplicate strings fail, a lone empty string works");
+            static constexpr char const *KEYS[]       = {"if", "else", "if"};
+            static constexpr auto        TABLE        = Dqn_PerfectHash_Init(KEYS);
+            static constexpr char const *SINGLE[]     = {""};
+            static constexpr auto        SINGLE_TABLE = Dqn_PerfectHash_Init(SINGLE);
+            DQN_TEST_EXPECT(testing_state, !TABLE.valid);
+            DQN_TEST_EXPECT(testing_state, SINGLE_TABLE.valid && Dqn_PerfectHash_Find(&SINGLE_TABLE, DQN_STRING("")) == 0);
+        }
+    }
+
+    // ---------------------------------------------------------------------------------------------
+    // NOTE: Dqn_MurmurHash3
+    // ---------------------------------------------------------------------------------------------
+    {
+        DQN_TEST_DECLARE_GROUP_SCOPED(testing_state, "Dqn_MurmurHash3");
+        Dqn_u8 bytes[1024 + 7];
+        DQN_FOR_EACH(index, Dqn_ArrayCountI(bytes))
+            bytes[index] = DQN_CAST(Dqn_u8)((index * 2654435761u) >> 13);
+
+        {
+            DQN_TEST_START_SCOPE(testing_state, "Streaming in any chunk size matches the one-shot hash");
+            Dqn_isize const CHUNK_SIZES[] = {1, 3, 15, 16, 17, 64, 100, 1031};
+            Dqn_isize       mismatches    = 0;
+            for (Dqn_isize size = 0; size <= Dqn_ArrayCountI(bytes); size++)
+            {
+                Dqn_MurmurHash3_128 expect = Dqn_MurmurHash3_x64_128(bytes, DQN_CAST(int)size, 0xc0ffee);
+                for (Dqn_isize chunk_size : CHUNK_SIZES)
+                {
+                    Dqn_MurmurHash3_x64_128State state = Dqn_MurmurHash3_x64_128_Init(0xc0ffee);
+                    for (Dqn_isize offset = 0; offset < size; offset += chunk_size)
+                        Dqn_MurmurHash3_x64_128_Update(&state, bytes + offset, DQN_M_MIN(chunk_size, size - offset));
+
+                    Dqn_MurmurHash3_128 hash = Dqn_MurmurHash3_x64_128_Final(&state);
+                    mismatches += hash.e[0] != expect.e[0] || hash.e[1] != expect.e[1];
+                }
+            }
+            DQN_TEST_EXPECT_MSG(testing_state, mismatches == 0, "mismatches: %zd", mismatches);
+        }
+
+        {
+            DQN_TEST_START_SCOPE(testing_state, "Streaming a string builder's blocks matches hashing the string");
+            Dqn_StringBuilder<32> builder = {};
+            builder.backup_allocator      = Dqn_Allocator_InitWithHeap();
+            DQN_FOR_EACH(index, 300)
+                Dqn_StringBuilder_AppendFmt(&builder, "%zd,", index);
+
+            Dqn_MurmurHash3_x64_128State state = Dqn_MurmurHash3_x64_128_Init(0);
+            for (Dqn_StringBuilderBlock const *block = &builder.fixed_mem_block; block; block = block->next)
+                Dqn_MurmurHash3_x64_128_Update(&state, block->mem, block->used);
+            Dqn_MurmurHash3_128 hash = Dqn_MurmurHash3_x64_128_Final(&state);
+
+            Dqn_Allocator       allocator = Dqn_Allocator_InitWithHeap();
+            Dqn_String          string    = Dqn_StringBuilder_BuildStringWithAllocator(&builder, &allocator);
+            Dqn_MurmurHash3_128 expect    = Dqn_MurmurHash3_x64_128(string.str, DQN_CAST(int)string.size, 0);
+            DQN_TEST_EXPECT(testing_state, builder.fixed_mem_block.next);
+            DQN_TEST_EXPECT(testing_state, hash.e[0] == expect.e[0] && hash.e[1] == expect.e[1]);
+            Dqn_Allocator_Free(&allocator, string.str);
+            Dqn_StringBuilder_Free(&builder);
+        }
+    }
+
+    // ---------------------------------------------------------------------------------------------
+    // NOTE: Dqn_FastHash64
+    // ---------------------------------------------------------------------------------------------
+    {
+        DQN_TEST_DECLARE_GROUP_SCOPED(testing_state, "Dqn_FastHash64");
+        Dqn_u8 bytes[3 * 1024 + 64];
+        DQN_FOR_EACH(index, Dqn_ArrayCountI(bytes))
+            bytes[index] = DQN_CAST(Dqn_u8)((index * 2654435761u) >> 13);
+
+        {
+            DQN_TEST_START_SCOPE(testing_state, "Scalar, SSE2 and AVX2 paths agree on every size and seed");
+            Dqn_u64 const SEEDS[]    = {0, 1, 0xdeadbeefcafef00dULL};
+            Dqn_isize     mismatches = 0;
+            for (Dqn_u64 seed : SEEDS)
+            {
+                for (Dqn_isize size = 0; size <= Dqn_ArrayCountI(bytes) - 1; size++)
+                {
+                    // NOTE: Hash from an odd offset so the SIMD paths are tested on unaligned input
+                    Dqn_u64 scalar = Dqn_FastHash64_WithPath(bytes + 1, size, seed, Dqn_FastHashPath::Scalar);
+                    Dqn_u64 sse2   = Dqn_FastHash64_WithPath(bytes + 1, size, seed, Dqn_FastHashPath::SSE2);
+                    Dqn_u64 avx2   = Dqn_FastHash64_WithPath(bytes + 1, size, seed, Dqn_FastHashPath::AVX2);
+                    mismatches    += (scalar != sse2 || scalar != avx2 || scalar != Dqn_FastHash64(bytes + 1, size, seed));
+                }
+            }
+            DQN_TEST_EXPECT_MSG(testing_state, mismatches == 0, "mismatches: %zd, path: %d", mismatches, DQN_CAST(int)Dqn_FastHash64_Path());
+        }
+
+        {
+            DQN_TEST_START_SCOPE(testing_state, "Flipping any input bit or changing the seed changes the hash");
+            Dqn_isize const SIZES[]    = {1, 3, 4, 7, 8, 9, 16, 17, 32, 255, 256, 257, 1024, 1025, 3000};
+            Dqn_isize       collisions = 0;
+            for (Dqn_isize size : SIZES)
+            {
+                Dqn_u64 hash = Dqn_FastHash64(bytes, size);
+                collisions  += hash == Dqn_FastHash64(bytes, size, 1);
+                collisions  += hash == Dqn_FastHash64(bytes, size - 1);
+                for (Dqn_isize bit = 0; bit < size * 8; bit += (size > 32) ? 7 : 1)
+                {
+                    bytes[bit / 8] ^= DQN_CAST(Dqn_u8)(1 << (bit % 8));
+                    collisions     += hash == Dqn_FastHash64(bytes, size);
+                    bytes[bit / 8] ^= DQN_CAST(Dqn_u8)(1 << (bit % 8));
+                }
+            }
+            DQN_TEST_EXPECT_MSG(testing_state, collisions == 0, "collisions: %zd", collisions);
+        }
+
+        {
+            // NOTE: The hash is documented as stable across machines and
+            // builds, pin its output so a change to the mixing is caught.
+            DQN_TEST_START_SCOPE(testing_state, "Output matches known values");
+            struct GoldenString { char const *string; Dqn_u64 hash; Dqn_u64 seeded_hash; };
+            GoldenString const STRINGS[] =
+            {
+                {"",                                     0x42bc986dc5eec4d3ULL, 0x60fc0db92a7e14d5ULL},
+                {"a",                                    0x6cf84e5a2465e867ULL, 0xa43a55d8635796bcULL},
+                {"abc",                                  0xb4808df22d44ffcfULL, 0x4e05ded863ec48c2ULL},
+                {"message digest",                       0x42290cf3f6384b2cULL, 0x62d67cbd99381a66ULL},
+                {"abcdefghijklmnopqrstuvwxyz0123456789", 0xbc2fea000e05b0e9ULL, 0x6b9022be7614121fULL},
+            };
+
+            for (GoldenString const &golden : STRINGS)
+            {
+                Dqn_isize size        = Dqn_Str_Len(golden.string);
+                Dqn_u64   hash        = Dqn_FastHash64(golden.string, size);
+                Dqn_u64   seeded_hash = Dqn_FastHash64(golden.string, size, 0xdeadbeefcafef00dULL);
+                DQN_TEST_EXPECT_MSG(testing_state, hash == golden.hash,               "string: \"%s\", hash: 0x%016I64x", golden.string, hash);
+                DQN_TEST_EXPECT_MSG(testing_state, seeded_hash == golden.seeded_hash, "string: \"%s\", seeded hash: 0x%016I64x", golden.string, seeded_hash);
+            }
+
+            // NOTE: Cover the sizes either side of each path's block width
+            struct GoldenBytes { Dqn_isize size; Dqn_u64 hash; };
+            GoldenBytes const BYTES[] =
+            {
+                {7,    0xc97d12afbcabc6f6ULL},
+                {16,   0xa21dd9cc481c5efdULL},
+                {31,   0xb96ed726c79ed8d5ULL},
+                {64,   0x40746284861c700dULL},
+                {100,  0x9d5a947012712eacULL},
+                {255,  0xf270791f4dfc9851ULL},
+                {256,  0x51b50f7da17a5329ULL},
+                {1000, 0x79936fb24bb29e71ULL},
+                {3000, 0x9a711d02623293edULL},
+            };
+
+            for (GoldenBytes const &golden : BYTES)
+            {
+                Dqn_u64 hash = Dqn_FastHash64(bytes, golden.size);
+                DQN_TEST_EXPECT_MSG(testing_state, hash == golden.hash, "size: %zd, hash: 0x%016I64x", golden.size, hash);
+            }
+        }
+    }
+
+    // ---------------------------------------------------------------------------------------------
+    // NOTE: Dqn_CRC32C
+    // ---------------------------------------------------------------------------------------------
+    {
+        DQN_TEST_DECLARE_GROUP_SCOPED(testing_state, "Dqn_CRC32C");
+        Dqn_isize const    SIZE  = 80 * 1024;
+        Dqn_ArenaAllocator arena = Dqn_ArenaAllocator_InitWithNewAllocator(Dqn_Allocator_InitWithHeap(), 0, nullptr);
+        DQN_DEFER { Dqn_ArenaAllocator_Free(&arena); };
+        Dqn_u8 *bytes = Dqn_ArenaAllocator_NewArray(&arena, Dqn_u8, SIZE, Dqn_ZeroMem::No);
+        DQN_FOR_EACH(index, SIZE)
+            bytes[index] = DQN_CAST(Dqn_u8)((index * 2654435761u) >> 13);
+
+        {
+            DQN_TEST_START_SCOPE(testing_state, "Known checksums");
+            Dqn_u8 const zeros[32] = {};
+            Dqn_u32      check     = Dqn_CRC32C("123456789", 9);
+            DQN_TEST_EXPECT_MSG(testing_state, check == 0xE3069283, "check: %08x", check);
+            DQN_TEST_EXPECT(testing_state, Dqn_CRC32C(zeros, sizeof(zeros)) == 0x8A9136AA);
+            DQN_TEST_EXPECT(testing_state, Dqn_CRC32C(nullptr, 0) == 0);
+        }
+
+        {
+            DQN_TEST_START_SCOPE(testing_state, "Software and SSE4.2 paths agree on every size");
+            Dqn_isize mismatches = 0;
+            for (Dqn_isize size = 0; size < SIZE - 1; size += (size < 256) ? 1 : 997)
+            {
+                Dqn_u32 software = Dqn_CRC32C_IterateWithPath(bytes + 1, size, 0, Dqn_CRC32CPath::Software);
+                Dqn_u32 sse42    = Dqn_CRC32C_IterateWithPath(bytes + 1, size, 0, Dqn_CRC32CPath::SSE42);
+                mismatches      += software != sse42;
+            }
+            DQN_TEST_EXPECT_MSG(testing_state, mismatches == 0, "mismatches: %zd, path: %d", mismatches, DQN_CAST(int)Dqn_CRC32C_Path());
+        }
+
+        {
+            DQN_TEST_START_SCOPE(testing_state, "Iterating and combining chunks matches the whole checksum");
+            Dqn_u32         expect        = Dqn_CRC32C(bytes, SIZE);
+            Dqn_isize const SPLIT_SIZES[] = {0, 1, 7, 4096, 3 * 8 * 1024 + 5, SIZE};
+            for (Dqn_isize split : SPLIT_SIZES)
+            {
+                Dqn_u32 crc_a    = Dqn_CRC32C(bytes, split);
+                Dqn_u32 crc_b    = Dqn_CRC32C(bytes + split, SIZE - split);
+                Dqn_u32 iterated = Dqn_CRC32C_Iterate(bytes + split, SIZE - split, crc_a);
+                Dqn_u32 combined = Dqn_CRC32C_Combine(crc_a, crc_b, SIZE - split);
+                DQN_TEST_EXPECT_MSG(testing_state, iterated == expect, "split: %zd", split);
+                DQN_TEST_EXPECT_MSG(testing_state, combined == expect, "split: %zd", split);
+            }
+        }
+    }
+
+    // ---------------------------------------------------------------------------------------------
+    // NOTE: Dqn_Array
+    // ---------------------------------------------------------------------------------------------
+    {
+        DQN_TEST_DECLARE_GROUP_SCOPED(testing_state, "Dqn_Array");
+        // NOTE: Dqn_Array_InitWithMemory
+        {
+            {
+                DQN_TEST_START_SCOPE(testing_state, "Fixed Memory: Test add single item and can't allocate more");
+                int memory[4]        = {};
+                Dqn_Array<int> array = Dqn_Array_InitWithMemory(memory, Dqn_ArrayCount(memory), 0 /*size*/);
+                Dqn_Array_Add(&array, 1);
+                Dqn_Array_Add(&array, 2);
+                Dqn_Array_Add(&array, 3);
+                Dqn_Array_Add(&array, 4);
+                DQN_TEST_EXPECT_MSG(testing_state, array.data[0] == 1, "array.data %d", array.data[0]);
+                DQN_TEST_EXPECT_MSG(testing_state, array.data[1] == 2, "array.data %d", array.data[1]);
+                DQN_TEST_EXPECT_MSG(testing_state, array.data[2] == 3, "array.data %d", array.data[2]);
+                DQN_TEST_EXPECT_MSG(testing_state, array.data[3] == 4, "array.data %d", array.data[3]);
+                DQN_TEST_EXPECT_MSG(testing_state, array.size == 4, "array.size: %d", array.size);
+
+                int *added_item = Dqn_Array_Add(&array, 5);
+                DQN_TEST_EXPECT(testing_state, added_item == nullptr);
+                DQN_TEST_EXPECT_MSG(testing_state, array.size == 4, "array.size: %d", array.size);
+                DQN_TEST_EXPECT_MSG(testing_state, array.max == 4, "array.max: %d", array.max);
+            }
+
+            {
+                DQN_TEST_START_SCOPE(testing_state, "Fixed Memory: Test add array of items");
+                int memory[4]        = {};
+                int DATA[]           = {1, 2, 3};
+                Dqn_Array<int> array = Dqn_Array_InitWithMemory(memory, Dqn_ArrayCount(memory), 0 /*size*/);
+                Dqn_Array_AddArray(&array, DATA, Dqn_ArrayCount(DATA));
+                DQN_TEST_EXPECT_MSG(testing_state, array.data[0] == 1, "array.data %d", array.data[0]);
+                DQN_TEST_EXPECT_MSG(testing_state, array.data[1] == 2, "array.data %d", array.data[1]);
+                DQN_TEST_EXPECT_MSG(testing_state, array.data[2] == 3, "array.data %d", array.data[2]);
+                DQN_TEST_EXPECT_MSG(testing_state, array.size == 3, "array.size: %d", array.size);
+                DQN_TEST_EXPECT_MSG(testing_state, array.max == 4, "array.max: %d", array.max);
+            }
+
+            {
+                DQN_TEST_START_SCOPE(testing_state, "Fixed Memory: Test clear and clear with memory zeroed");
+                int memory[4]        = {};
+                int DATA[]           = {1, 2, 3};
+                Dqn_Array<int> array = Dqn_Array_InitWithMemory(memory, Dqn_ArrayCount(memory), 0 /*size*/);
+                Dqn_Array_AddArray(&array, DATA, Dqn_ArrayCount(DATA));
+                Dqn_Array_Clear(&array, Dqn_ZeroMem::No);
+                DQN_TEST_EXPECT_MSG(testing_state, array.size == 0, "array.size: %d", array.size);
+                DQN_TEST_EXPECT_MSG(testing_state, array.max == 4, "array.max: %d", array.max);
+                DQN_TEST_EXPECT_MSG(testing_state, array.data[0] == 1, "array.data %d. Clear but don't zero memory so old values should still remain", array.data[0]);
+
+                Dqn_Array_Clear(&array, Dqn_ZeroMem::Yes);
+                DQN_TEST_EXPECT_MSG(testing_state, array.data[0] == 0, "array.data %d. Clear but zero memory old values should not remain", array.data[0]);
+            }
+
+            {
+                DQN_TEST_START_SCOPE(testing_state, "Fixed Memory: Test erase stable and erase unstable");
+                int memory[4]        = {};
+                int DATA[]           = {1, 2, 3, 4};
+                Dqn_Array<int> array = Dqn_Array_InitWithMemory(memory, Dqn_ArrayCount(memory), 0 /*size*/);
+                Dqn_Array_AddArray(&array, DATA, Dqn_ArrayCount(DATA));
+                Dqn_Array_EraseUnstable(&array, 1);
+                DQN_TEST_EXPECT_MSG(testing_state, array.data[0] == 1, "array.data %d", array.data[0]);
+                DQN_TEST_EXPECT_MSG(testing_state, array.data[1] == 4, "array.data %d", array.data[1]);
+                DQN_TEST_EXPECT_MSG(testing_state, array.data[2] == 3, "array.data %d", array.data[2]);
+                DQN_TEST_EXPECT_MSG(testing_state, array.size == 3, "array.size: %d", array.size);
+
+                Dqn_Array_EraseStable(&array, 0);
+                DQN_TEST_EXPECT_MSG(testing_state, array.data[0] == 4, "array.data: %d", array.data[0]);
+                DQN_TEST_EXPECT_MSG(testing_state, array.data[1] == 3, "array.data: %d", array.data[1]);
+                DQN_TEST_EXPECT_MSG(testing_state, array.size == 2, "array.size: %d", array.size);
+            }
+
+            {
+                DQN_TEST_START_SCOPE(testing_state, "Fixed Memory: Test array pop and peek");
+                int memory[4]        = {};
+                int DATA[]           = {1, 2, 3};
+                Dqn_Array<int> array = Dqn_Array_InitWithMemory(memory, Dqn_ArrayCount(memory), 0 /*size*/);
+                Dqn_Array_AddArray(&array, DATA, Dqn_ArrayCount(DATA));
+                Dqn_Array_Pop(&array, 2);
+                DQN_TEST_EXPECT_MSG(testing_state, array.data[0] == 1, "array.data: %d", array.data[0]);
+                DQN_TEST_EXPECT_MSG(testing_state, array.size == 1, "array.size: %d", array.size);
+                DQN_TEST_EXPECT_MSG(testing_state, array.max == 4, "array.max: %d", array.max);
+
+                int *peek_item = Dqn_Array_Peek(&array);
+                DQN_TEST_EXPECT_MSG(testing_state, *peek_item == 1, "peek: %d", *peek_item);
+                DQN_TEST_EXPECT_MSG(testing_state, array.size == 1, "array.size: %d", array.size);
+                DQN_TEST_EXPECT_MSG(testing_state, array.max == 4, "array.max: %d", array.max);
+            }
+
+            {
+                DQN_TEST_START_SCOPE(testing_state, "Fixed Memory: Test free on fixed memory array does nothing");
+                int memory[4]        = {};
+                Dqn_Array<int> array = Dqn_Array_InitWithMemory(memory, Dqn_ArrayCount(memory), 0 /*size*/);
+                DQN_DEFER { Dqn_Array_Free(&array); };
+            }
+        }
+
+        // NOTE: Dynamic Memory: Dqn_Array
+        {
+            {
+                DQN_TEST_START_SCOPE(testing_state, "Dynamic Memory: Reserve and check over commit reallocates");
+                Dqn_Array<int> array = {};
+                if (array.allocator.type == Dqn_AllocatorType::Null)
+                    array.allocator = Dqn_Allocator_InitWithHeap();
+
+                DQN_DEFER { Dqn_Array_Free(&array); };
+
+                Dqn_Array_Reserve(&array, 4);
+                DQN_TEST_EXPECT_MSG(testing_state, array.size == 0, "array.size: %d", array.size);
+                DQN_TEST_EXPECT_MSG(testing_state, array.max == 4, "array.max: %d", array.max);
+
+                int DATA[] = {1, 2, 3, 4};
+                Dqn_Array_AddArray(&array, DATA, Dqn_ArrayCount(DATA));
+                DQN_TEST_EXPECT_MSG(testing_state, array.data[0] == 1, "array.data: %d", array.data[0]);
+                DQN_TEST_EXPECT_MSG(testing_state, array.data[1] == 2, "array.data: %d", array.data[1]);
+                DQN_TEST_EXPECT_MSG(testing_state, array.data[2] == 3, "array.data: %d", array.data[2]);
+                DQN_TEST_EXPECT_MSG(testing_state, array.data[3] == 4, "array.data: %d", array.data[3]);
+                DQN_TEST_EXPECT_MSG(testing_state, array.size == 4, "array.size: %d", array.size);
+
+                int *added_item = Dqn_Array_Add(&array, 5);
+                DQN_TEST_EXPECT_MSG(testing_state, *added_item == 5, "added_item: %d", *added_item);
+                DQN_TEST_EXPECT_MSG(testing_state, array.data[4] == 5, "array.data: %d", array.data[4]);
+                DQN_TEST_EXPECT_MSG(testing_state, array.size == 5, "array.size: %d", array.size);
+                DQN_TEST_EXPECT_MSG(testing_state, array.max >= 5, "array.max: %d", array.max);
+            }
+        }
+    }
+
+    // ---------------------------------------------------------------------------------------------
+    // NOTE: Dqn_Rect
+    // ---------------------------------------------------------------------------------------------
+    {
+        DQN_TEST_DECLARE_GROUP_SCOPED(testing_state, "Dqn_Rect");
+        // NOTE: Dqn_Rect_Intersection
+        {
+            {
+                DQN_TEST_START_SCOPE(testing_state, "No intersection");
+                Dqn_Rect a  = Dqn_Rect_InitFromPosAndSize(Dqn_V2(0, 0), Dqn_V2(100, 100));
+                Dqn_Rect b  = Dqn_Rect_InitFromPosAndSize(Dqn_V2(200, 0), Dqn_V2(200, 200));
+                Dqn_Rect ab = Dqn_Rect_Intersection(a, b);
+
+                DQN_TEST_EXPECT_MSG(testing_state,
+                                ab.min.x == 0 && ab.min.y == 0 && ab.max.x == 0 && ab.max.y == 0,
+                                "ab = { min.x = %.2f, min.y = %.2f, max.x = %.2f. max.y = %.2f }",
+                                ab.min.x,
+                                ab.min.y,
+                                ab.max.x,
+                                ab.max.y);
+            }
+
+            {
+                DQN_TEST_START_SCOPE(testing_state, "A's min intersects B");
+                Dqn_Rect a  = Dqn_Rect_InitFromPosAndSize(Dqn_V2(50, 50), Dqn_V2(100, 100));
+                Dqn_Rect b  = Dqn_Rect_InitFromPosAndSize(Dqn_V2( 0,  0), Dqn_V2(100, 100));
+                Dqn_Rect ab = Dqn_Rect_Intersection(a, b);
+
+                DQN_TEST_EXPECT_MSG(testing_state,
+                                ab.min.x == 50 && ab.min.y == 50 && ab.max.x == 100 && ab.max.y == 100,
+                                "ab = { min.x = %.2f, min.y = %.2f, max.x = %.2f. max.y = %.2f }",
+                                ab.min.x,
+                                ab.min.y,
+                                ab.max.x,
+                                ab.max.y);
+            }
+
+            {
+                DQN_TEST_START_SCOPE(testing_state, "B's min intersects A");
+                Dqn_Rect a  = Dqn_Rect_InitFromPosAndSize(Dqn_V2( 0,  0), Dqn_V2(100, 100));
+                Dqn_Rect b  = Dqn_Rect_InitFromPosAndSize(Dqn_V2(50, 50), Dqn_V2(100, 100));
+                Dqn_Rect ab = Dqn_Rect_Intersection(a, b);
+
+                DQN_TEST_EXPECT_MSG(testing_state,
+                                ab.min.x == 50 && ab.min.y == 50 && ab.max.x == 100 && ab.max.y == 100,
+                                "ab = { min.x = %.2f, min.y = %.2f, max.x = %.2f. max.y = %.2f }",
+                                ab.min.x,
+                                ab.min.y,
+                                ab.max.x,
+                                ab.max.y);
+            }
+
+            {
+                DQN_TEST_START_SCOPE(testing_state, "A's max intersects B");
+                Dqn_Rect a  = Dqn_Rect_InitFromPosAndSize(Dqn_V2(-50, -50), Dqn_V2(100, 100));
+                Dqn_Rect b  = Dqn_Rect_InitFromPosAndSize(Dqn_V2(  0,   0), Dqn_V2(100, 100));
+                Dqn_Rect ab = Dqn_Rect_Intersection(a, b);
+
+                DQN_TEST_EXPECT_MSG(testing_state,
+                                ab.min.x == 0 && ab.min.y == 0 && ab.max.x == 50 && ab.max.y == 50,
+                                "ab = { min.x = %.2f, min.y = %.2f, max.x = %.2f. max.y = %.2f }",
+                                ab.min.x,
+                                ab.min.y,
+                                ab.max.x,
+                                ab.max.y);
+            }
+
+            {
+                DQN_TEST_START_SCOPE(testing_state, "B's max intersects A");
+                Dqn_Rect a  = Dqn_Rect_InitFromPosAndSize(Dqn_V2(  0,   0), Dqn_V2(100, 100));
+                Dqn_Rect b  = Dqn_Rect_InitFromPosAndSize(Dqn_V2(-50, -50), Dqn_V2(100, 100));
+                Dqn_Rect ab = Dqn_Rect_Intersection(a, b);
+
+                DQN_TEST_EXPECT_MSG(testing_state,
+                                ab.min.x == 0 && ab.min.y == 0 && ab.max.x == 50 && ab.max.y == 50,
+                                "ab = { min.x = %.2f, min.y = %.2f, max.x = %.2f. max.y = %.2f }",
+                                ab.min.x,
+                                ab.min.y,
+                                ab.max.x,
+                                ab.max.y);
+            }
+
+
+            {
+                DQN_TEST_START_SCOPE(testing_state, "B contains A");
+                Dqn_Rect a  = Dqn_Rect_InitFromPosAndSize(Dqn_V2(25, 25), Dqn_V2( 25,  25));
+                Dqn_Rect b  = Dqn_Rect_InitFromPosAndSize(Dqn_V2( 0,  0), Dqn_V2(100, 100));
+                Dqn_Rect ab = Dqn_Rect_Intersection(a, b);
+
+                DQN_TEST_EXPECT_MSG(testing_state,
+                                ab.min.x == 25 && ab.min.y == 25 && ab.max.x == 50 && ab.max.y == 50,
+                                "ab = { min.x = %.2f, min.y = %.2f, max.x = %.2f. max.y = %.2f }",
+                                ab.min.x,
+                                ab.min.y,
+                                ab.max.x,
+                                ab.max.y);
+            }
+
+            {
+                DQN_TEST_START_SCOPE(testing_state, "A contains B");
+                Dqn_Rect a  = Dqn_Rect_InitFromPosAndSize(Dqn_V2( 0,  0), Dqn_V2(100, 100));
+                Dqn_Rect b  = Dqn_Rect_InitFromPosAndSize(Dqn_V2(25, 25), Dqn_V2( 25,  25));
+                Dqn_Rect ab = Dqn_Rect_Intersection(a, b);
+
+                DQN_TEST_EXPECT_MSG(testing_state,
+                                ab.min.x == 25 && ab.min.y == 25 && ab.max.x == 50 && ab.max.y == 50,
+                                "ab = { min.x = %.2f, min.y = %.2f, max.x = %.2f. max.y = %.2f }",
+                                ab.min.x,
+                                ab.min.y,
+                                ab.max.x,
+                                ab.max.y);
+            }
+
+            {
+                DQN_TEST_START_SCOPE(testing_state, "A equals B");
+                Dqn_Rect a  = Dqn_Rect_InitFromPosAndSize(Dqn_V2(0, 0), Dqn_V2(100, 100));
+                Dqn_Rect b  = a;
+                Dqn_Rect ab = Dqn_Rect_Intersection(a, b);
+
+                DQN_TEST_EXPECT_MSG(testing_state,
+                                ab.min.x == 0 && ab.min.y == 0 && ab.max.x == 100 && ab.max.y == 100,
+                                "ab = { min.x = %.2f, min.y = %.2f, max.x = %.2f. max.y = %.2f }",
+                                ab.min.x,
+                                ab.min.y,
+                                ab.max.x,
+                                ab.max.y);
+            }
+        }
+    }
+
+    // ---------------------------------------------------------------------------------------------
+    // NOTE: Dqn_StringBuilder
+    // ---------------------------------------------------------------------------------------------
+    {
+        DQN_TEST_DECLARE_GROUP_SCOPED(testing_state, "Dqn_StringBuilder");
+        Dqn_Allocator allocator = Dqn_Allocator_InitWithHeap();
+        // NOTE: Dqn_StringBuilder_Append
+        {
+            {
+                DQN_TEST_START_SCOPE(testing_state, "Append variable size strings and build using heap allocator");
+                Dqn_StringBuilder<> builder = {};
+                if (builder.backup_allocator.type == Dqn_AllocatorType::Null)
+                    builder.backup_allocator = Dqn_Allocator_InitWithHeap();
+
+                Dqn_StringBuilder_Append(&builder, "Abc", 1);
+                Dqn_StringBuilder_Append(&builder, "cd");
+                Dqn_isize size    = 0;
+                char *result = Dqn_StringBuilder_Build(&builder, &allocator, &size);
+                DQN_DEFER { Dqn_Allocator_Free(&allocator, result); };
+
+                char const EXPECT_STR[] = "Acd";
+                DQN_TEST_EXPECT_MSG(testing_state, size == Dqn_CharCountI(EXPECT_STR), "size: %zd", size);
+                DQN_TEST_EXPECT_MSG(testing_state, strncmp(result, EXPECT_STR, size) == 0, "result: %s", result);
+            }
+
+            {
+                DQN_TEST_START_SCOPE(testing_state, "Append empty string and build using heap allocator");
+                Dqn_StringBuilder<> builder = {};
+                if (builder.backup_allocator.type == Dqn_AllocatorType::Null)
+                    builder.backup_allocator = Dqn_Allocator_InitWithHeap();
+
+                Dqn_StringBuilder_Append(&builder, "");
+                Dqn_StringBuilder_Append(&builder, "");
+                Dqn_isize size    = 0;
+                char *result = Dqn_StringBuilder_Build(&builder, &allocator, &size);
+                DQN_DEFER { Dqn_Allocator_Free(&allocator, result); };
+
+                char const EXPECT_STR[] = "";
+                DQN_TEST_EXPECT_MSG(testing_state, size == Dqn_CharCountI(EXPECT_STR), "size: %zd", size);
+                DQN_TEST_EXPECT_MSG(testing_state, strncmp(result, EXPECT_STR, size) == 0, "result: %s", result);
+            }
+
+            {
+                DQN_TEST_START_SCOPE(testing_state, "Append empty string onto string and build using heap allocator");
+                Dqn_StringBuilder<> builder = {};
+                if (builder.backup_allocator.type == Dqn_AllocatorType::Null)
+                    builder.backup_allocator = Dqn_Allocator_InitWithHeap();
+
+                Dqn_StringBuilder_Append(&builder, "Acd");
+                Dqn_StringBuilder_Append(&builder, "");
+                Dqn_isize size    = 0;
+                char *result = Dqn_StringBuilder_Build(&builder, &allocator, &size);
+                DQN_DEFER { Dqn_Allocator_Free(&allocator, result); };
+
+                char const EXPECT_STR[] = "Acd";
+                DQN_TEST_EXPECT_MSG(testing_state, size == Dqn_CharCountI(EXPECT_STR), "size: %zd", size);
+                DQN_TEST_EXPECT_MSG(testing_state, strncmp(result, EXPECT_STR, size) == 0, "result: %s", result);
+            }
+
+            {
+                DQN_TEST_START_SCOPE(testing_state, "Append nullptr and build using heap allocator");
+                Dqn_StringBuilder<> builder = {};
+                if (builder.backup_allocator.type == Dqn_AllocatorType::Null)
+                    builder.backup_allocator = Dqn_Allocator_InitWithHeap();
+
+                Dqn_StringBuilder_Append(&builder, nullptr, 5);
+                Dqn_isize size    = 0;
+                char *result = Dqn_StringBuilder_Build(&builder, &allocator, &size);
+                DQN_DEFER { Dqn_Allocator_Free(&allocator, result); };
+
+                char const EXPECT_STR[] = "";
+                DQN_TEST_EXPECT_MSG(testing_state, size == Dqn_CharCountI(EXPECT_STR), "size: %zd", size);
+                DQN_TEST_EXPECT_MSG(testing_state, strncmp(result, EXPECT_STR, size) == 0, "result: %s", result);
+            }
+
+            {
+                DQN_TEST_START_SCOPE(testing_state, "Append and require new linked buffer and build using heap allocator");
+                Dqn_StringBuilder<2> builder = {};
+                if (builder.backup_allocator.type == Dqn_AllocatorType::Null)
+                    builder.backup_allocator = Dqn_Allocator_InitWithHeap();
+
+                Dqn_StringBuilder_Append(&builder, "A");
+                Dqn_StringBuilder_Append(&builder, "z"); // Should force a new memory block
+                Dqn_StringBuilder_Append(&builder, "tec");
+                Dqn_isize size    = 0;
+                char *result = Dqn_StringBuilder_Build(&builder, &allocator, &size);
+                DQN_DEFER { Dqn_Allocator_Free(&allocator, result); };
+
+                char const EXPECT_STR[] = "Aztec";
+                DQN_TEST_EXPECT_MSG(testing_state, size == Dqn_CharCountI(EXPECT_STR), "size: %zd", size);
+                DQN_TEST_EXPECT_MSG(testing_state, strncmp(result, EXPECT_STR, size) == 0, "result: %s", result);
+            }
+
+            {
+                DQN_TEST_START_SCOPE(testing_state, "Free returns every linked buffer to the allocator");
+                Dqn_Allocator        builder_allocator = Dqn_Allocator_InitWithHeap();
+                Dqn_StringBuilder<2> builder           = {};
+                Dqn_StringBuilder_InitWithAllocator(&builder, &builder_allocator);
+
+                Dqn_StringBuilder_Append(&builder, "Abc"); // Should force a new memory block
+                char big[DQN_STRING_BUILDER_MIN_BLOCK_SIZE] = {};
+                Dqn_StringBuilder_Append(&builder, big, Dqn_ArrayCountI(big)); // Should force another memory block
+                DQN_TEST_EXPECT_MSG(testing_state, builder_allocator.allocations == 2, "allocations: %zd", builder_allocator.allocations);
+
+                Dqn_StringBuilder_Free(&builder);
+                DQN_TEST_EXPECT_MSG(testing_state, builder_allocator.allocations == 0, "allocations: %zd", builder_allocator.allocations);
+                DQN_TEST_EXPECT(testing_state, Dqn_StringBuilder_GetSize(&builder) == 0);
+            }
+        }
+
+        // NOTE: Dqn_StringBuilder_AppendChar
+        {
+            DQN_TEST_START_SCOPE(testing_state, "Append char and build using heap allocator");
+            Dqn_StringBuilder<> builder = {};
+            if (builder.backup_allocator.type == Dqn_AllocatorType::Null)
+                builder.backup_allocator = Dqn_Allocator_InitWithHeap();
+
+            Dqn_StringBuilder_AppendChar(&builder, 'a');
+            Dqn_StringBuilder_AppendChar(&builder, 'b');
+            Dqn_isize size    = 0;
+            char *result = Dqn_StringBuilder_Build(&builder, &allocator, &size);
+            DQN_DEFER { Dqn_Allocator_Free(&allocator, result); };
+
+            char const EXPECT_STR[] = "ab";
+            DQN_TEST_EXPECT_MSG(testing_state, size == Dqn_CharCountI(EXPECT_STR), "size: %zd", size);
+            DQN_TEST_EXPECT_MSG(testing_state, strncmp(result, EXPECT_STR, size) == 0, "result: %s", result);
+        }
+
+        // NOTE: Dqn_StringBuilder_AppendU64Array
+        {
+            DQN_TEST_START_SCOPE(testing_state, "Append array of numbers across memory blocks and build using heap allocator");
+            Dqn_StringBuilder<8> builder = {};
+            if (builder.backup_allocator.type == Dqn_AllocatorType::Null)
+                builder.backup_allocator = Dqn_Allocator_InitWithHeap();
+            DQN_DEFER { Dqn_StringBuilder_Free(&builder); };
+
+            Dqn_u64 values[100] = {};
+            for (Dqn_isize index = 0; index < Dqn_ArrayCountI(values); index++)
+                values[index] = DQN_CAST(Dqn_u64)index * 1000;
+
+            Dqn_StringBuilder_AppendU64Array(&builder, values, 3, DQN_STRING(", "), true /*comma_sep*/);
+            Dqn_StringBuilder_AppendChar(&builder, '|');
+            Dqn_StringBuilder_AppendU64Array(&builder, values, Dqn_ArrayCountI(values), DQN_STRING(","));
+            Dqn_isize size   = 0;
+            char     *result = Dqn_StringBuilder_Build(&builder, &allocator, &size);
+            DQN_DEFER { Dqn_Allocator_Free(&allocator, result); };
+
+            char const EXPECT_PREFIX[] = "0, 1,000, 2,000|0,1000,2000,";
+            char const EXPECT_SUFFIX[] = ",98000,99000";
+            DQN_TEST_EXPECT_MSG(testing_state, size == 16 + 586, "size: %zd", size);
+            DQN_TEST_EXPECT_MSG(testing_state, strncmp(result, EXPECT_PREFIX, Dqn_CharCountI(EXPECT_PREFIX)) == 0, "result: %s", result);
+            DQN_TEST_EXPECT_MSG(testing_state, strcmp(result + size - Dqn_CharCountI(EXPECT_SUFFIX), EXPECT_SUFFIX) == 0, "result: %s", result);
+        }
+
+        // NOTE: Dqn_StringBuilder_AppendFmt
+        {
+            {
+                DQN_TEST_START_SCOPE(testing_state, "Append format string and build using heap allocator");
+                Dqn_StringBuilder<> builder = {};
+                if (builder.backup_allocator.type == Dqn_AllocatorType::Null)
+                    builder.backup_allocator = Dqn_Allocator_InitWithHeap();
+
+                Dqn_StringBuilder_AppendFmt(&builder, "Number: %d, String: %s, ", 4, "Hello Sailor");
+                Dqn_StringBuilder_AppendFmt(&builder, "Extra Stuff");
+                Dqn_isize size    = 0;
+                char *result = Dqn_StringBuilder_Build(&builder, &allocator, &size);
+                DQN_DEFER { Dqn_Allocator_Free(&allocator, result); };
+
+                char const EXPECT_STR[] = "Number: 4, String: Hello Sailor, Extra Stuff";
+                DQN_TEST_EXPECT_MSG(testing_state, size == Dqn_CharCountI(EXPECT_STR), "size: %zd", size);
+                DQN_TEST_EXPECT_MSG(testing_state, strncmp(result, EXPECT_STR, size) == 0, "result: %s", result);
             }
 
             {
@@ -638,265 +2172,1957 @@ static void Dqn_Test_UnitTests()
                 if (builder.backup_allocator.type == Dqn_AllocatorType::Null)
                     builder.backup_allocator = Dqn_Allocator_InitWithHeap();
 
-                Dqn_StringBuilder_AppendFmt(&builder, nullptr);
-                Dqn_isize size = 0;
-                char *result = Dqn_StringBuilder_Build(&builder, &allocator, &size);
-                DQN_DEFER { Dqn_Allocator_Free(&allocator, result); };
+                Dqn_StringBuilder_AppendFmt(&builder, nullptr);
+                Dqn_isize size = 0;
+                char *result = Dqn_StringBuilder_Build(&builder, &allocator, &size);
+                DQN_DEFER { Dqn_Allocator_Free(&allocator, result); };
+
+                char const EXPECT_STR[] = "";
+                DQN_TEST_EXPECT_MSG(testing_state, size == Dqn_CharCountI(EXPECT_STR), "size: %zd", size);
+                DQN_TEST_EXPECT_MSG(testing_state, strncmp(result, EXPECT_STR, size) == 0, "result: %s", result);
+            }
+        }
+    }
+
+    // ---------------------------------------------------------------------------------------------
+    // NOTE: Dqn_FixedArray
+    // ---------------------------------------------------------------------------------------------
+    {
+        DQN_TEST_DECLARE_GROUP_SCOPED(testing_state, "Dqn_FixedArray");
+        // NOTE: Dqn_FixedArray_Init
+        {
+            DQN_TEST_START_SCOPE(testing_state, "Initialise from raw array");
+            int raw_array[] = {1, 2};
+            auto array = Dqn_FixedArray_Init<int, 4>(raw_array, (int)Dqn_ArrayCount(raw_array));
+            DQN_TEST_EXPECT(testing_state, array.size == 2);
+            DQN_TEST_EXPECT(testing_state, array[0] == 1);
+            DQN_TEST_EXPECT(testing_state, array[1] == 2);
+        }
+
+        // NOTE: Dqn_FixedArray_EraseStable
+        {
+            DQN_TEST_START_SCOPE(testing_state, "Erase stable 1 element from array");
+            int raw_array[] = {1, 2, 3};
+            auto array = Dqn_FixedArray_Init<int, 4>(raw_array, (int)Dqn_ArrayCount(raw_array));
+            Dqn_FixedArray_EraseStable(&array, 1);
+            DQN_TEST_EXPECT(testing_state, array.size == 2);
+            DQN_TEST_EXPECT(testing_state, array[0] == 1);
+            DQN_TEST_EXPECT(testing_state, array[1] == 3);
+        }
+
+        // NOTE: Dqn_FixedArray_EraseUnstable
+        {
+            DQN_TEST_START_SCOPE(testing_state, "Erase unstable 1 element from array");
+            int raw_array[] = {1, 2, 3};
+            auto array = Dqn_FixedArray_Init<int, 4>(raw_array, (int)Dqn_ArrayCount(raw_array));
+            Dqn_FixedArray_EraseUnstable(&array, 0);
+            DQN_TEST_EXPECT(testing_state, array.size == 2);
+            DQN_TEST_EXPECT(testing_state, array[0] == 3);
+            DQN_TEST_EXPECT(testing_state, array[1] == 2);
+        }
+
+        // NOTE: Dqn_FixedArray_Add
+        {
+            DQN_TEST_START_SCOPE(testing_state, "Add 1 element to array");
+            int const ITEM  = 2;
+            int raw_array[] = {1};
+            auto array      = Dqn_FixedArray_Init<int, 4>(raw_array, (int)Dqn_ArrayCount(raw_array));
+            Dqn_FixedArray_Add(&array, ITEM);
+            DQN_TEST_EXPECT(testing_state, array.size == 2);
+            DQN_TEST_EXPECT(testing_state, array[0] == 1);
+            DQN_TEST_EXPECT(testing_state, array[1] == ITEM);
+        }
+
+        // NOTE: Dqn_FixedArray_Clear
+        {
+            DQN_TEST_START_SCOPE(testing_state, "Clear array");
+            int raw_array[] = {1};
+            auto array      = Dqn_FixedArray_Init<int, 4>(raw_array, (int)Dqn_ArrayCount(raw_array));
+            Dqn_FixedArray_Clear(&array);
+            DQN_TEST_EXPECT(testing_state, array.size == 0);
+        }
+    }
+
+    // ---------------------------------------------------------------------------------------------
+    // NOTE: Dqn_FixedString
+    // ---------------------------------------------------------------------------------------------
+    {
+        DQN_TEST_DECLARE_GROUP_SCOPED(testing_state, "Dqn_FixedString");
+
+        // NOTE: Dqn_FixedString_Append
+        {
+            DQN_TEST_START_SCOPE(testing_state, "Append too much fails");
+            Dqn_FixedString<4> str = {};
+            DQN_TEST_EXPECT_MSG(testing_state, Dqn_FixedString_Append(&str, "abcd") == false, "We need space for the null-terminator");
+        }
+
+        // NOTE: Dqn_FixedString_AppendFmt
+        {
+            DQN_TEST_START_SCOPE(testing_state, "Append format string too much fails");
+            Dqn_FixedString<4> str = {};
+            DQN_TEST_EXPECT_MSG(testing_state, Dqn_FixedString_AppendFmt(&str, "abcd") == false, "We need space for the null-terminator");
+        }
+    }
+
+    // ---------------------------------------------------------------------------------------------
+    // NOTE: Dqn_Str_ToI64
+    // ---------------------------------------------------------------------------------------------
+    {
+        DQN_TEST_DECLARE_GROUP_SCOPED(testing_state, "Dqn_Str_ToI64");
+        {
+            DQN_TEST_START_SCOPE(testing_state, "Convert nullptr");
+            Dqn_i64 result = Dqn_Str_ToI64(nullptr);
+            DQN_TEST_EXPECT(testing_state, result == 0);
+        }
+
+        {
+            DQN_TEST_START_SCOPE(testing_state, "Convert empty string");
+            Dqn_i64 result = Dqn_Str_ToI64("");
+            DQN_TEST_EXPECT(testing_state, result == 0);
+        }
+
+        {
+            DQN_TEST_START_SCOPE(testing_state, "Convert \"1\"");
+            Dqn_i64 result = Dqn_Str_ToI64("1");
+            DQN_TEST_EXPECT(testing_state, result == 1);
+        }
+
+        {
+            DQN_TEST_START_SCOPE(testing_state, "Convert \"-0\"");
+            Dqn_i64 result = Dqn_Str_ToI64("-0");
+            DQN_TEST_EXPECT(testing_state, result == 0);
+        }
+
+        {
+            DQN_TEST_START_SCOPE(testing_state, "Convert \"-1\"");
+            Dqn_i64 result = Dqn_Str_ToI64("-1");
+            DQN_TEST_EXPECT(testing_state, result == -1);
+        }
+
+        {
+            DQN_TEST_START_SCOPE(testing_state, "Convert \"1.2\"");
+            Dqn_i64 result = Dqn_Str_ToI64("1.2");
+            DQN_TEST_EXPECT(testing_state, result == 1);
+        }
+
+        {
+            DQN_TEST_START_SCOPE(testing_state, "Convert \"1,234\"");
+            Dqn_i64 result = Dqn_Str_ToI64("1,234");
+            DQN_TEST_EXPECT(testing_state, result == 1234);
+        }
+
+        {
+            DQN_TEST_START_SCOPE(testing_state, "Convert \"1,2\"");
+            Dqn_i64 result = Dqn_Str_ToI64("1,2");
+            DQN_TEST_EXPECT(testing_state, result == 12);
+        }
+
+        {
+            DQN_TEST_START_SCOPE(testing_state, "Convert \"12a3\"");
+            Dqn_i64 result = Dqn_Str_ToI64("12a3");
+            DQN_TEST_EXPECT(testing_state, result == 12);
+        }
+    }
+
+    // ---------------------------------------------------------------------------------------------
+    // NOTE: Dqn_Str_ToU64
+    // ---------------------------------------------------------------------------------------------
+    {
+        DQN_TEST_DECLARE_GROUP_SCOPED(testing_state, "Dqn_Str_ToU64");
+        {
+            DQN_TEST_START_SCOPE(testing_state, "Convert nullptr");
+            Dqn_u64 result = Dqn_Str_ToU64(nullptr);
+            DQN_TEST_EXPECT_MSG(testing_state, result == 0, "result: %zu", result);
+        }
+
+        {
+            DQN_TEST_START_SCOPE(testing_state, "Convert empty string");
+            Dqn_u64 result = Dqn_Str_ToU64("");
+            DQN_TEST_EXPECT_MSG(testing_state, result == 0, "result: %zu", result);
+        }
+
+        {
+            DQN_TEST_START_SCOPE(testing_state, "Convert \"1\"");
+            Dqn_u64 result = Dqn_Str_ToU64("1");
+            DQN_TEST_EXPECT_MSG(testing_state, result == 1, "result: %zu", result);
+        }
+
+        {
+            DQN_TEST_START_SCOPE(testing_state, "Convert \"-0\"");
+            Dqn_u64 result = Dqn_Str_ToU64("-0");
+            DQN_TEST_EXPECT_MSG(testing_state, result == 0, "result: %zu", result);
+        }
+
+        {
+            DQN_TEST_START_SCOPE(testing_state, "Convert \"-1\"");
+            Dqn_u64 result = Dqn_Str_ToU64("-1");
+            DQN_TEST_EXPECT_MSG(testing_state, result == 0, "result: %zu", result);
+        }
+
+        {
+            DQN_TEST_START_SCOPE(testing_state, "Convert \"1.2\"");
+            Dqn_u64 result = Dqn_Str_ToU64("1.2");
+            DQN_TEST_EXPECT_MSG(testing_state, result == 1, "result: %zu", result);
+        }
+
+        {
+            DQN_TEST_START_SCOPE(testing_state, "Convert \"1,234\"");
+            Dqn_u64 result = Dqn_Str_ToU64("1,234");
+            DQN_TEST_EXPECT_MSG(testing_state, result == 1234, "result: %zu", result);
+        }
+
+        {
+            DQN_TEST_START_SCOPE(testing_state, "Convert \"1,2\"");
+            Dqn_u64 result = Dqn_Str_ToU64("1,2");
+            DQN_TEST_EXPECT_MSG(testing_state, result == 12, "result: %zu", result);
+        }
+
+        {
+            DQN_TEST_START_SCOPE(testing_state, "Convert \"12a3\"");
+            Dqn_u64 result = Dqn_Str_ToU64("12a3");
+            DQN_TEST_EXPECT_MSG(testing_state, result == 12, "result: %zu", result);
+        }
+
+        {
+            DQN_TEST_START_SCOPE(testing_state, "Convert \"18,446,744,073,709,551,616\" saturates");
+            Dqn_u64 result = Dqn_Str_ToU64("18,446,744,073,709,551,616");
+            DQN_TEST_EXPECT_MSG(testing_state, result == DQN_U64_MAX, "result: %zu", result);
+        }
+    }
+
+    // ---------------------------------------------------------------------------------------------
+    // NOTE: Dqn_Str_ParseU64/ParseI64
+    // ---------------------------------------------------------------------------------------------
+    {
+        DQN_TEST_DECLARE_GROUP_SCOPED(testing_state, "Dqn_Str_ParseU64/ParseI64");
+        {
+            DQN_TEST_START_SCOPE(testing_state, "Parse numbers spanning 8 byte chunks");
+            char const *inputs[] = {"0", "7", "12345678", "123456789", "1234567890123456", "00000000000000000000001"};
+            Dqn_u64 const expect[] = {0, 7, 12345678, 123456789, 1234567890123456ULL, 1};
+            for (Dqn_isize index = 0; index < Dqn_ArrayCountI(inputs); index++)
+            {
+                Dqn_u64   value  = 0;
+                Dqn_isize size   = DQN_CAST(Dqn_isize)Dqn_Str_Len(inputs[index]);
+                Dqn_isize parsed = Dqn_Str_ParseU64(inputs[index], size, &value);
+                DQN_TEST_EXPECT_MSG(testing_state, parsed == size && value == expect[index], "input: %s, parsed: %zd, value: %zu", inputs[index], parsed, value);
+            }
+        }
+
+        {
+            DQN_TEST_START_SCOPE(testing_state, "Parse stops at the first non-digit");
+            Dqn_u64   value  = 0;
+            Dqn_isize parsed = Dqn_Str_ParseU64("123456789:1", 11, &value);
+            DQN_TEST_EXPECT_MSG(testing_state, parsed == 9 && value == 123456789, "parsed: %zd, value: %zu", parsed, value);
+
+            parsed = Dqn_Str_ParseU64("x1", 2, &value);
+            DQN_TEST_EXPECT_MSG(testing_state, parsed == 0, "parsed: %zd", parsed);
+        }
+
+        {
+            DQN_TEST_START_SCOPE(testing_state, "Parse U64 limits");
+            Dqn_u64   value  = 0;
+            Dqn_isize parsed = Dqn_Str_ParseU64("18446744073709551615", 20, &value);
+            DQN_TEST_EXPECT_MSG(testing_state, parsed == 20 && value == DQN_U64_MAX, "parsed: %zd, value: %zu", parsed, value);
+
+            parsed = Dqn_Str_ParseU64("18446744073709551616", 20, &value);
+            DQN_TEST_EXPECT_MSG(testing_state, parsed == 0 && value == DQN_U64_MAX, "parsed: %zd, value: %zu", parsed, value);
+        }
+
+        {
+            DQN_TEST_START_SCOPE(testing_state, "Parse I64 limits");
+            Dqn_i64   value  = 0;
+            Dqn_isize parsed = Dqn_Str_ParseI64("-9223372036854775808", 20, &value);
+            DQN_TEST_EXPECT_MSG(testing_state, parsed == 20 && value == DQN_I64_MIN, "parsed: %zd, value: %zd", parsed, value);
+
+            parsed = Dqn_Str_ParseI64("+9223372036854775808", 20, &value);
+            DQN_TEST_EXPECT_MSG(testing_state, parsed == 0 && value == DQN_I64_MAX, "parsed: %zd, value: %zd", parsed, value);
+
+            parsed = Dqn_Str_ParseI64("-", 1, &value);
+            DQN_TEST_EXPECT_MSG(testing_state, parsed == 0, "parsed: %zd", parsed);
+        }
+
+        {
+            DQN_TEST_START_SCOPE(testing_state, "Parse column");
+            char const buf[] = "1\r\n -22 \n333\n4x\n5";
+            Dqn_i64    values[8] = {};
+            Dqn_isize  consumed  = 0;
+            Dqn_isize  count     = Dqn_Str_ParseI64Column(buf, Dqn_ArrayCountI(buf) - 1, '\n', values, Dqn_ArrayCountI(values), &consumed);
+            DQN_TEST_EXPECT_MSG(testing_state, count == 3, "count: %zd", count);
+            DQN_TEST_EXPECT(testing_state, values[0] == 1 && values[1] == -22 && values[2] == 333);
+            DQN_TEST_EXPECT_MSG(testing_state, consumed == 13, "consumed: %zd", consumed);
+        }
+
+        {
+            DQN_TEST_START_SCOPE(testing_state, "Parse column resumes when the output is full");
+            char const buf[] = "10,20,30";
+            Dqn_u64    values[2] = {};
+            Dqn_isize  consumed  = 0;
+            Dqn_isize  count     = Dqn_Str_ParseU64Column(buf, Dqn_ArrayCountI(buf) - 1, ',', values, Dqn_ArrayCountI(values), &consumed);
+            DQN_TEST_EXPECT(testing_state, count == 2 && values[0] == 10 && values[1] == 20 && consumed == 6);
+
+            count = Dqn_Str_ParseU64Column(buf + consumed, Dqn_ArrayCountI(buf) - 1 - consumed, ',', values, Dqn_ArrayCountI(values));
+            DQN_TEST_EXPECT(testing_state, count == 1 && values[0] == 30);
+        }
+    }
+
+    // ---------------------------------------------------------------------------------------------
+    // NOTE: Dqn_U64ToStr
+    // ---------------------------------------------------------------------------------------------
+    {
+        DQN_TEST_DECLARE_GROUP_SCOPED(testing_state, "Dqn_U64ToStr");
+        {
+            DQN_TEST_START_SCOPE(testing_state, "Convert with and without comma separators");
+            Dqn_u64 const     values[]       = {0, 7, 10, 999, 1000, 123456, 1000000, 9999999999ULL, DQN_U64_MAX};
+            char const *const expect[]       = {"0", "7", "10", "999", "1000", "123456", "1000000", "9999999999", "18446744073709551615"};
+            char const *const expect_comma[] = {"0", "7", "10", "999", "1,000", "123,456", "1,000,000", "9,999,999,999", "18,446,744,073,709,551,615"};
+            for (Dqn_isize index = 0; index < Dqn_ArrayCountI(values); index++)
+            {
+                Dqn_U64Str string = {};
+                char const *result = Dqn_U64ToStr(values[index], &string, false /*comma_sep*/);
+                DQN_TEST_EXPECT_MSG(testing_state, Dqn_Str_Equals(result, expect[index]) && string.len == Dqn_Str_Len(expect[index]), "result: %s", result);
+
+                result = Dqn_U64ToStr(values[index], &string, true /*comma_sep*/);
+                DQN_TEST_EXPECT_MSG(testing_state, Dqn_Str_Equals(result, expect_comma[index]) && string.len == Dqn_Str_Len(expect_comma[index]), "result: %s", result);
+                DQN_TEST_EXPECT(testing_state, Dqn_U64ToStrSize(values[index], true /*comma_sep*/) == string.len);
+            }
+        }
+
+        {
+            DQN_TEST_START_SCOPE(testing_state, "Convert into an arena");
+            Dqn_ArenaAllocator arena = Dqn_ArenaAllocator_InitWithNewAllocator(Dqn_Allocator_InitWithHeap(), 0, nullptr);
+            DQN_DEFER { Dqn_ArenaAllocator_Free(&arena); };
+
+            Dqn_String result = Dqn_U64ToArenaStr(&arena, 1234567);
+            DQN_TEST_EXPECT_MSG(testing_state, result == DQN_STRING("1,234,567"), "result: %.*s", DQN_STRING_FMT(result));
+        }
+    }
+
+    // ---------------------------------------------------------------------------------------------
+    // NOTE: Dqn_Str_ToF64/Dqn_F64ToStr
+    // ---------------------------------------------------------------------------------------------
+    {
+        DQN_TEST_DECLARE_GROUP_SCOPED(testing_state, "Dqn_Str_ToF64/Dqn_F64ToStr");
+        {
+            DQN_TEST_START_SCOPE(testing_state, "Convert decimal strings");
+            DQN_TEST_EXPECT(testing_state, Dqn_Str_ToF64(nullptr) == 0);
+            DQN_TEST_EXPECT(testing_state, Dqn_Str_ToF64("0.1") == 0.1);
+            DQN_TEST_EXPECT(testing_state, Dqn_Str_ToF64("  -12.25xyz") == -12.25);
+            DQN_TEST_EXPECT(testing_state, Dqn_Str_ToF64("6.02214076E+23") == 6.02214076e23);
+            DQN_TEST_EXPECT(testing_state, Dqn_Str_ToF64("1e400") == Dqn_Str_ToF64("inf"));
+            DQN_TEST_EXPECT(testing_state, Dqn_Str_ToF64("1e-400") == 0);
+        }
+
+        {
+            DQN_TEST_START_SCOPE(testing_state, "Convert values that need the exact fallback");
+            // NOTE: Half way between 2 doubles, decided by the 54th significant digit onwards
+            DQN_TEST_EXPECT(testing_state, Dqn_Str_ToF64("1.00000000000000011102230246251565404236316680908203125") == 1.0);
+            DQN_TEST_EXPECT(testing_state, Dqn_Str_ToF64("1.00000000000000011102230246251565404236316680908203126") == 1.0000000000000002);
+            DQN_TEST_EXPECT(testing_state, Dqn_Str_ToF64("2.2250738585072011e-308") == 2.2250738585072009e-308);
+            DQN_TEST_EXPECT(testing_state, Dqn_Str_ToF64("4.9e-324") == 4.9406564584124654e-324);
+        }
+
+        {
+            DQN_TEST_START_SCOPE(testing_state, "Parse returns the characters consumed");
+            Dqn_f64   value  = 0;
+            Dqn_isize parsed = Dqn_Str_ParseF64("12.5e-1,", 8, &value);
+            DQN_TEST_EXPECT_MSG(testing_state, parsed == 7 && value == 1.25, "parsed: %zd, value: %f", parsed, value);
+
+            parsed = Dqn_Str_ParseF64("1e+x", 4, &value);
+            DQN_TEST_EXPECT_MSG(testing_state, parsed == 1 && value == 1, "parsed: %zd, value: %f", parsed, value);
+
+            parsed = Dqn_Str_ParseF64("-.", 2, &value);
+            DQN_TEST_EXPECT_MSG(testing_state, parsed == 0, "parsed: %zd", parsed);
+        }
+
+        {
+            DQN_TEST_START_SCOPE(testing_state, "Format the shortest round-trip string");
+            Dqn_f64 const     values[] = {0.1, 0.3, 100, 123456.75, -0.0, 1e20, 1e21, 1.5e-7, 0.000001, 5e-324, DQN_F64_MAX};
+            char const *const expect[] = {"0.1", "0.3", "100", "123456.75", "-0", "100000000000000000000", "1e+21", "1.5e-7", "0.000001", "5e-324", "1.7976931348623157e+308"};
+            for (Dqn_isize index = 0; index < Dqn_ArrayCountI(values); index++)
+            {
+                Dqn_FixedString<32> string = Dqn_F64ToStr(values[index]);
+                DQN_TEST_EXPECT_MSG(testing_state, Dqn_Str_Equals(string.data, expect[index]), "string: %s, expect: %s", string.data, expect[index]);
+                DQN_TEST_EXPECT(testing_state, Dqn_Str_ToF64(string.data) == values[index]);
+            }
+        }
+
+        {
+            DQN_TEST_START_SCOPE(testing_state, "Random doubles round-trip with no more digits than needed");
+            // NOTE: Fully random bit patterns, subnormals and values a few ULPs either side of
+            // powers of 10 and 2. The digit count must not exceed the shortest "%.*g" precision that
+            // parses back to the same double, which is at most 17.
+            Dqn_u64   rng             = 0x2545F4914F6CDD1DULL;
+            Dqn_isize round_trip_fail = 0;
+            Dqn_isize too_long        = 0;
+            for (Dqn_isize iteration = 0; iteration < 50000; iteration++)
+            {
+                Dqn_u64 random = Dqn_Test__RandomU64(&rng);
+                Dqn_u64 bits   = 0;
+                switch (iteration % 4)
+                {
+                    case 0: bits = random; break;
+                    case 1: bits = random & ((1ULL << 52) - 1); break;
+
+                    case 2:
+                    {
+                        char pow10[16];
+                        snprintf(pow10, sizeof(pow10), "1e%d", DQN_CAST(int)(random % 632) - 323);
+                        Dqn_f64 value = strtod(pow10, nullptr);
+                        memcpy(&bits, &value, sizeof(bits));
+                        bits += ((random >> 16) % 7) - 3;
+                    }
+                    break;
+
+                    case 3: bits = (((random % 2046) + 1) << 52) + ((random >> 16) % 7) - 3; break;
+                }
+                bits |= (random >> 32) & (1ULL << 63);
+
+                if (((bits >> 52) & 0x7FF) == 0x7FF) // NOTE: Skip inf and NaN
+                    continue;
+
+                Dqn_f64 value = 0;
+                memcpy(&value, &bits, sizeof(value));
+                Dqn_FixedString<32> string = Dqn_F64ToStr(value);
+
+                Dqn_f64 parsed      = Dqn_Str_ToF64(string.data);
+                Dqn_u64 parsed_bits = 0;
+                memcpy(&parsed_bits, &parsed, sizeof(parsed_bits));
+                round_trip_fail    += parsed_bits != bits;
+
+                char expect[32];
+                for (int precision = 1; precision <= 17; precision++)
+                {
+                    snprintf(expect, sizeof(expect), "%.*g", precision, value);
+                    if (strtod(expect, nullptr) == value)
+                        break;
+                }
+                too_long += Dqn_Test__CountSignificantDigits(string.data) > Dqn_Test__CountSignificantDigits(expect);
+            }
+            DQN_TEST_EXPECT_MSG(testing_state, round_trip_fail == 0, "round trip failures: %zd", round_trip_fail);
+            DQN_TEST_EXPECT_MSG(testing_state, too_long == 0, "strings longer than necessary: %zd", too_long);
+        }
+
+        {
+            DQN_TEST_START_SCOPE(testing_state, "Random decimal strings parse to the same double as strtod");
+            // NOTE: Up to 25 digits with the decimal point anywhere and exponents within +-350, past
+            // the digits and range where the fast paths give up
+            Dqn_u64   rng            = 0x9E3779B97F4A7C15ULL;
+            Dqn_isize failures       = 0;
+            char      first_fail[64] = {};
+            for (Dqn_isize iteration = 0; iteration < 100000; iteration++)
+            {
+                Dqn_u64   random     = Dqn_Test__RandomU64(&rng);
+                Dqn_isize digits     = 1 + DQN_CAST(Dqn_isize)(random % 25);
+                Dqn_isize point      = DQN_CAST(Dqn_isize)((random >> 8) % DQN_CAST(Dqn_u64)(digits + 2)) - 1; // -1 for no point
+                int       exponent   = DQN_CAST(int)((random >> 16) % 701) - 350;
+                char      string[64] = {};
+                int       size       = 0;
+
+                if ((random >> 32) & 1) string[size++] = '-';
+                DQN_FOR_EACH(index, digits)
+                {
+                    if (index == point) string[size++] = '.';
+                    // NOTE: Bias towards runs of 0s and 9s that sit on rounding boundaries
+                    Dqn_u64 digit = Dqn_Test__RandomU64(&rng);
+                    switch (random >> 60)
+                    {
+                        case 0:  string[size++] = (digit & 7)  ? '9' : DQN_CAST(char)('0' + (digit >> 8) % 10); break;
+                        case 1:  string[size++] = (digit & 7)  ? '0' : DQN_CAST(char)('0' + (digit >> 8) % 10); break;
+                        default: string[size++] = DQN_CAST(char)('0' + digit % 10); break;
+                    }
+                }
+                if (point == digits) string[size++] = '.';
+                if ((random >> 33) & 1) size += snprintf(string + size, sizeof(string) - DQN_CAST(size_t)size, "e%d", exponent);
+
+                Dqn_f64   value  = 0;
+                Dqn_isize parsed = Dqn_Str_ParseF64(string, size, &value);
+                Dqn_f64   expect = strtod(string, nullptr);
+                if (parsed != size || memcmp(&value, &expect, sizeof(value)) != 0)
+                {
+                    if (failures++ == 0)
+                        memcpy(first_fail, string, sizeof(first_fail));
+                }
+            }
+            DQN_TEST_EXPECT_MSG(testing_state, failures == 0, "failures: %zd, first: %s", failures, first_fail);
+        }
+    }
+
+    // ---------------------------------------------------------------------------------------------
+    // NOTE: Dqn_Str_Find
+    // ---------------------------------------------------------------------------------------------
+    {
+        DQN_TEST_DECLARE_GROUP_SCOPED(testing_state, "Dqn_Str_Find");
+        {
+            DQN_TEST_START_SCOPE(testing_state, "String (char) is not in buffer");
+            char const buf[]  = "836a35becd4e74b66a0d6844d51f1a63018c7ebc44cf7e109e8e4bba57eefb55";
+            char const find[] = "2";
+            char const *result = Dqn_Str_Find(buf, find, Dqn_CharCountI(buf), Dqn_CharCountI(find));
+            DQN_TEST_EXPECT(testing_state, result == nullptr);
+        }
+
+        {
+            DQN_TEST_START_SCOPE(testing_state, "String (char) is in buffer");
+            char const buf[]  = "836a35becd4e74b66a0d6844d51f1a63018c7ebc44cf7e109e8e4bba57eefb55";
+            char const find[] = "6";
+            char const *result = Dqn_Str_Find(buf, find, Dqn_CharCountI(buf), Dqn_CharCountI(find));
+            DQN_TEST_EXPECT(testing_state, result != nullptr);
+            DQN_TEST_EXPECT(testing_state, result[0] == '6' && result[1] == 'a');
+        }
+
+        {
+            DQN_TEST_START_SCOPE(testing_state, "Case insensitive search matches letters of either case only");
+            char const buf[]   = "[2021-01-01] info: Connection reset by peer, retrying [@ERROR] Disk Full";
+            char const *result = Dqn_Str_Find(buf, "`error", Dqn_CharCountI(buf), -1, true /*case_insensitive*/);
+            DQN_TEST_EXPECT(testing_state, result == nullptr);
+            result = Dqn_Str_Find(buf, "@error] disk", Dqn_CharCountI(buf), -1, true /*case_insensitive*/);
+            DQN_TEST_EXPECT(testing_state, result && result - buf == 55);
+            result = Dqn_Str_Find(buf, "@error] disk", Dqn_CharCountI(buf), -1, false /*case_insensitive*/);
+            DQN_TEST_EXPECT(testing_state, result == nullptr);
+        }
+
+        {
+            DQN_TEST_START_SCOPE(testing_state, "Needles of 1-64 bytes are found at every offset of the buffer");
+            char buf[256];
+            DQN_FOR_EACH(index, Dqn_ArrayCountI(buf))
+                buf[index] = "ab"[(index * 2654435761u >> 7) & 1];
+
+            // NOTE: The needle is the only 'x'-'z' run in the buffer, every position and length
+            // crosses the SIMD loops and the scalar search over the remainder at some point
+            Dqn_isize failures = 0;
+            for (Dqn_isize find_len = 1; find_len <= 64; find_len++)
+            {
+                char find[64];
+                DQN_FOR_EACH(index, find_len)
+                    find[index] = "xyz"[index % 3];
+                for (Dqn_isize offset = 0; offset + find_len <= Dqn_ArrayCountI(buf); offset++)
+                {
+                    char copy[sizeof(buf)];
+                    memcpy(copy, buf, sizeof(buf));
+                    memcpy(copy + offset, find, DQN_CAST(size_t)find_len);
+                    failures += Dqn_Str_Find(copy, find, sizeof(copy), find_len) != copy + offset;
+                    failures += Dqn_Str_Find(copy, find, offset + find_len - 1, find_len) != nullptr;
+                }
+            }
+            DQN_TEST_EXPECT_MSG(testing_state, failures == 0, "failures: %zd", failures);
+        }
+
+        {
+            DQN_TEST_START_SCOPE(testing_state, "Random buffers and needles match the byte loop");
+
+            // NOTE: Mixed case letters and the non-letters that alias them when the 0x20 bit is set
+            // ('@' and '`', '[' and '{') so the case insensitive filter lets through false candidates.
+            // Needles go past 255 bytes where Horspool caps its skip and matches are planted near the
+            // end of the buffer where the 16 and 32 byte loops hand over to Horspool.
+            char const ALPHABET[] = "aAbBzZ@`[{";
+            char       buf[640];
+            char       find[320];
+            Dqn_u64    rng      = 0x9E3779B97F4A7C15ULL;
+            Dqn_isize  failures = 0;
+            Dqn_isize  matches  = 0;
+            for (Dqn_isize iteration = 0; iteration < 20000; iteration++)
+            {
+                Dqn_u64   random   = Dqn_Test__RandomU64(&rng);
+                Dqn_isize find_len = (random % 8 == 0) ? 250 + DQN_CAST(Dqn_isize)((random >> 3) % 70) : 1 + DQN_CAST(Dqn_isize)((random >> 3) % 48);
+                Dqn_isize buf_len  = find_len + DQN_CAST(Dqn_isize)((random >> 16) % DQN_CAST(Dqn_u64)(Dqn_ArrayCountI(buf) - find_len + 1));
+                Dqn_isize alphabet = (random >> 32) % 2 ? 2 : Dqn_CharCountI(ALPHABET); // A tiny alphabet makes partial matches common
+
+                DQN_FOR_EACH(index, buf_len)  buf[index]  = ALPHABET[Dqn_Test__RandomU64(&rng) % DQN_CAST(Dqn_u64)alphabet];
+                DQN_FOR_EACH(index, find_len) find[index] = ALPHABET[Dqn_Test__RandomU64(&rng) % DQN_CAST(Dqn_u64)alphabet];
+
+                if ((random >> 40) % 4 != 0)
+                {
+                    // NOTE: Plant the needle with some letters' case flipped, mostly within the
+                    // last 48 positions of the buffer
+                    Dqn_isize last_pos = buf_len - find_len;
+                    Dqn_isize back     = DQN_CAST(Dqn_isize)((random >> 42) % 48);
+                    Dqn_isize pos      = (random >> 48) % 4 ? DQN_M_MAX(last_pos - back, 0) : DQN_CAST(Dqn_isize)((random >> 48) % DQN_CAST(Dqn_u64)(last_pos + 1));
+                    DQN_FOR_EACH(index, find_len)
+                    {
+                        char    ch       = find[index];
+                        Dqn_b32 flip     = Dqn_Char_IsAlpha(ch) && Dqn_Test__RandomU64(&rng) % 8 == 0;
+                        buf[pos + index] = flip ? DQN_CAST(char)(ch ^ 0x20) : ch;
+                    }
+                }
+
+                for (Dqn_b32 case_insensitive = false; case_insensitive <= true; case_insensitive++)
+                {
+                    char const *expect = Dqn_Test__StrFindByteLoop(buf, buf_len, find, find_len, case_insensitive);
+                    char const *result = Dqn_Str_Find(buf, find, buf_len, find_len, case_insensitive);
+                    failures          += result != expect;
+                    matches           += expect != nullptr;
+                }
+            }
+            DQN_TEST_EXPECT_MSG(testing_state, failures == 0, "failures: %zd", failures);
+            DQN_TEST_EXPECT_MSG(testing_state, matches > 10000, "matches: %zd", matches);
+        }
+    }
+
+    // ---------------------------------------------------------------------------------------------
+    // NOTE: Dqn_AhoCorasick
+    // ---------------------------------------------------------------------------------------------
+    {
+        DQN_TEST_DECLARE_GROUP_SCOPED(testing_state, "Dqn_AhoCorasick");
+        Dqn_ArenaAllocator arena = Dqn_ArenaAllocator_InitWithNewAllocator(Dqn_Allocator_InitWithHeap(), 0, nullptr);
+        DQN_DEFER { Dqn_ArenaAllocator_Free(&arena); };
+
+        {
+            DQN_TEST_START_SCOPE(testing_state, "Find all overlapping matches");
+            Dqn_String      patterns[] = {DQN_STRING("he"), DQN_STRING("she"), DQN_STRING("his"), DQN_STRING("hers")};
+            Dqn_AhoCorasick matcher    = Dqn_AhoCorasick_InitWithArena(&arena, patterns, Dqn_ArrayCountI(patterns));
+
+            char const                     buf[]   = "ushers";
+            Dqn_List<Dqn_AhoCorasickMatch> matches = Dqn_List_InitWithArena<Dqn_AhoCorasickMatch>(&arena);
+            Dqn_isize                      count   = Dqn_AhoCorasick_FindAll(&matcher, buf, Dqn_CharCountI(buf), &matches);
+            DQN_TEST_EXPECT_MSG(testing_state, count == 3, "count: %zd", count);
+            DQN_TEST_EXPECT(testing_state, matches.count == 3);
+
+            // NOTE: Ordered by the end of the match, longest first
+            Dqn_AhoCorasickMatch const EXPECT[] = {{1 /*she*/, 1, 3}, {0 /*he*/, 2, 2}, {3 /*hers*/, 2, 4}};
+            Dqn_isize                  index    = 0;
+            for (Dqn_ListIterator<Dqn_AhoCorasickMatch> it = {}; Dqn_List_Iterate(&matches, &it) && index < Dqn_ArrayCountI(EXPECT); index++)
+            {
+                Dqn_AhoCorasickMatch const *expect = EXPECT + index;
+                DQN_TEST_EXPECT_MSG(testing_state,
+                                    it.data->pattern_index == expect->pattern_index && it.data->offset == expect->offset && it.data->size == expect->size,
+                                    "index: %zd, pattern_index: %zd, offset: %zd, size: %zd", index, it.data->pattern_index, it.data->offset, it.data->size);
+            }
+        }
+
+        {
+            DQN_TEST_START_SCOPE(testing_state, "Find first returns the earliest ending, longest match");
+            Dqn_String      patterns[] = {DQN_STRING("disk"), DQN_STRING("full"), DQN_STRING("sk f"), DQN_STRING("k")};
+            Dqn_AhoCorasick matcher    = Dqn_AhoCorasick_InitWithArena(&arena, patterns, Dqn_ArrayCountI(patterns));
+
+            char const           buf[] = "error: disk full";
+            Dqn_AhoCorasickMatch match = {};
+            DQN_TEST_EXPECT(testing_state, Dqn_AhoCorasick_FindFirst(&matcher, buf, Dqn_CharCountI(buf), &match));
+            DQN_TEST_EXPECT_MSG(testing_state, match.pattern_index == 0 && match.offset == 7 && match.size == 4,
+                                "pattern_index: %zd, offset: %zd, size: %zd", match.pattern_index, match.offset, match.size);
+            DQN_TEST_EXPECT(testing_state, !Dqn_AhoCorasick_FindFirst(&matcher, buf, 10, nullptr));
+        }
+
+        {
+            DQN_TEST_START_SCOPE(testing_state, "Empty patterns are ignored and duplicates report the first");
+            Dqn_String      patterns[] = {DQN_STRING(""), DQN_STRING("ab"), DQN_STRING("ab")};
+            Dqn_AhoCorasick matcher    = Dqn_AhoCorasick_InitWithArena(&arena, patterns, Dqn_ArrayCountI(patterns));
+
+            Dqn_AhoCorasickMatch match = {};
+            DQN_TEST_EXPECT(testing_state, !Dqn_AhoCorasick_FindFirst(&matcher, "xyz", 3, &match));
+            DQN_TEST_EXPECT(testing_state, Dqn_AhoCorasick_FindFirst(&matcher, "xaby", 4, &match));
+            DQN_TEST_EXPECT(testing_state, match.pattern_index == 1 && match.offset == 1);
+
+            Dqn_AhoCorasick empty = Dqn_AhoCorasick_InitWithArena(&arena, nullptr, 0);
+            DQN_TEST_EXPECT(testing_state, !Dqn_AhoCorasick_FindFirst(&empty, "xaby", 4, &match));
+        }
+
+        {
+            DQN_TEST_START_SCOPE(testing_state, "Find all matches the same as comparing at every offset");
+            char buf[512];
+            DQN_FOR_EACH(index, Dqn_ArrayCountI(buf))
+                buf[index] = "abc"[(index * 2654435761u >> 9) % 3];
+
+            // NOTE: A small alphabet so patterns overlap and share suffixes often
+            Dqn_String patterns[48];
+            DQN_FOR_EACH(index, Dqn_ArrayCountI(patterns))
+            {
+                Dqn_isize size       = 1 + (index % 6);
+                patterns[index]      = Dqn_String_ArenaAllocate(&arena, size, Dqn_ZeroMem::No);
+                patterns[index].size = size;
+                DQN_FOR_EACH(char_index, size)
+                    patterns[index].str[char_index] = "abc"[((index + 1) * (char_index + 7) * 40503u >> 4) % 3];
+            }
+
+            Dqn_AhoCorasick                matcher = Dqn_AhoCorasick_InitWithArena(&arena, patterns, Dqn_ArrayCountI(patterns));
+            Dqn_List<Dqn_AhoCorasickMatch> matches = Dqn_List_InitWithArena<Dqn_AhoCorasickMatch>(&arena);
+            Dqn_AhoCorasick_FindAll(&matcher, buf, Dqn_ArrayCountI(buf), &matches);
+
+            // NOTE: Every match must be a real occurrence of a first occurrence pattern, then the
+            // counts must agree so nothing was missed
+            Dqn_isize failures = 0;
+            for (Dqn_ListIterator<Dqn_AhoCorasickMatch> it = {}; Dqn_List_Iterate(&matches, &it);)
+            {
+                Dqn_String const *pattern = patterns + it.data->pattern_index;
+                failures += it.data->size != pattern->size || memcmp(buf + it.data->offset, pattern->str, DQN_CAST(size_t)pattern->size) != 0;
+                DQN_FOR_EACH(prev, it.data->pattern_index)
+                    failures += Dqn_String_Compare(patterns[prev], *pattern);
+            }
+
+            Dqn_isize expect_count = 0;
+            DQN_FOR_EACH(offset, Dqn_ArrayCountI(buf))
+            {
+                DQN_FOR_EACH(index, Dqn_ArrayCountI(patterns))
+                {
+                    Dqn_b32 duplicate = false;
+                    DQN_FOR_EACH(prev, index)
+                        duplicate |= Dqn_String_Compare(patterns[prev], patterns[index]);
+
+                    Dqn_String const *pattern = patterns + index;
+                    if (!duplicate && offset + pattern->size <= Dqn_ArrayCountI(buf) && memcmp(buf + offset, pattern->str, DQN_CAST(size_t)pattern->size) == 0)
+                        expect_count++;
+                }
+            }
+            DQN_TEST_EXPECT_MSG(testing_state, failures == 0, "failures: %zd", failures);
+            DQN_TEST_EXPECT_MSG(testing_state, matches.count == expect_count, "matches: %zd, expect: %zd", matches.count, expect_count);
+        }
+    }
+
+    // ---------------------------------------------------------------------------------------------
+    // NOTE: Dqn_String_Split
+    // ---------------------------------------------------------------------------------------------
+    {
+        DQN_TEST_DECLARE_GROUP_SCOPED(testing_state, "Dqn_String_Split");
+        Dqn_ArenaAllocator arena     = Dqn_ArenaAllocator_InitWithNewAllocator(Dqn_Allocator_InitWithHeap(), 0, nullptr);
+        Dqn_Allocator      allocator = Dqn_Allocator_InitWithArena(&arena);
+        DQN_DEFER { Dqn_ArenaAllocator_Free(&arena); };
+
+        {
+            DQN_TEST_START_SCOPE(testing_state, "Split lines, skipping empty lines and keeping the last line");
+            Dqn_Slice<Dqn_String> lines = Dqn_String_Split(DQN_STRING("\r\nfirst\r\nsecond\n\n\rthird"), &allocator);
+            DQN_TEST_EXPECT_MSG(testing_state, lines.size == 3, "size: %zd", lines.size);
+            if (lines.size == 3)
+            {
+                DQN_TEST_EXPECT(testing_state, lines[0] == DQN_STRING("first"));
+                DQN_TEST_EXPECT(testing_state, lines[1] == DQN_STRING("second"));
+                DQN_TEST_EXPECT(testing_state, lines[2] == DQN_STRING("third"));
+            }
+        }
+
+        {
+            DQN_TEST_START_SCOPE(testing_state, "Split stops at the string's size, not the null-terminator");
+            Dqn_Slice<Dqn_String> lines = Dqn_String_Split(Dqn_String_Init("one\ntwo\nthree", 6), &allocator);
+            DQN_TEST_EXPECT_MSG(testing_state, lines.size == 2, "size: %zd", lines.size);
+            if (lines.size == 2)
+            {
+                DQN_TEST_EXPECT(testing_state, lines[0] == DQN_STRING("one"));
+                DQN_TEST_EXPECT(testing_state, lines[1] == DQN_STRING("tw"));
+            }
+        }
+
+        {
+            DQN_TEST_START_SCOPE(testing_state, "Split to list on a delimiter set matches a byte by byte split");
+            char buf[300];
+            DQN_FOR_EACH(index, Dqn_ArrayCountI(buf))
+                buf[index] = DQN_CAST(char)((index * 2654435761u) >> 11);
+
+            // NOTE: Sets of 1-4 bytes take the SSE2 path without AVX2, larger sets and bytes >= 0x80
+            // need every nibble table. Every length crosses the SIMD loops and the scalar remainder.
+            Dqn_String const DELIMITERS[] = {DQN_STRING(","), DQN_STRING("\r\n"), Dqn_String_Init("\x00\x7f\x80\xff", 4), DQN_STRING(" \t;:|/\\\"'"), Dqn_String_Init("\x81\x92\xa3\xb4\xc5\xd6\xe7\xf8\x09", 9)};
+            Dqn_isize        failures     = 0;
+            for (Dqn_String delimiters : DELIMITERS)
+            {
+                Dqn_u8 *delimiter_bytes = DQN_CAST(Dqn_u8 *)delimiters.str;
+                for (Dqn_isize size = 0; size <= Dqn_ArrayCountI(buf); size++)
+                {
+                    // NOTE: Make roughly 1 in 4 bytes a delimiter
+                    char src[sizeof(buf)];
+                    DQN_FOR_EACH(index, size)
+                        src[index] = (buf[index] & 3) ? buf[index] : DQN_CAST(char)delimiter_bytes[(index >> 2) % delimiters.size];
+
+                    Dqn_ArenaAllocatorScopedRegion region = Dqn_ArenaAllocator_MakeScopedRegion(&arena);
+                    Dqn_List<Dqn_String>           splits = Dqn_List_InitWithArena<Dqn_String>(&arena, 16);
+                    Dqn_isize                      count  = Dqn_String_SplitToList(Dqn_String_Init(src, size), delimiters, &splits);
+                    failures += count != splits.count;
+
+                    Dqn_ListIterator<Dqn_String> it    = {};
+                    Dqn_isize                    begin = 0;
+                    for (Dqn_isize pos = 0; pos <= size; pos++)
+                    {
+                        if (pos < size && !memchr(delimiters.str, src[pos], DQN_CAST(size_t)delimiters.size))
+                            continue;
+                        if (pos > begin)
+                            failures += !Dqn_List_Iterate(&splits, &it) || it.data->str != src + begin || it.data->size != pos - begin;
+                        begin = pos + 1;
+                    }
+                    failures += Dqn_List_Iterate(&splits, &it);
+                }
+            }
+            DQN_TEST_EXPECT_MSG(testing_state, failures == 0, "failures: %zd", failures);
+        }
+
+        {
+            DQN_TEST_START_SCOPE(testing_state, "Split to list with no delimiters returns the whole string");
+            Dqn_List<Dqn_String> splits = Dqn_List_InitWithArena<Dqn_String>(&arena);
+            DQN_TEST_EXPECT(testing_state, Dqn_String_SplitToList(DQN_STRING("a,b"), DQN_STRING(""), &splits) == 1);
+            DQN_TEST_EXPECT(testing_state, splits.head && splits.head->data[0] == DQN_STRING("a,b"));
+            DQN_TEST_EXPECT(testing_state, Dqn_String_SplitToList(DQN_STRING(""), DQN_STRING(","), &splits) == 0);
+        }
+    }
+
+    // ---------------------------------------------------------------------------------------------
+    // NOTE: Dqn_StringTokenizer
+    // ---------------------------------------------------------------------------------------------
+    {
+        DQN_TEST_DECLARE_GROUP_SCOPED(testing_state, "Dqn_StringTokenizer");
+        {
+            DQN_TEST_START_SCOPE(testing_state, "Tokenize lines, skipping empty lines");
+            Dqn_String const EXPECT[] = {DQN_STRING("first"), DQN_STRING("second line"), DQN_STRING("third")};
+            Dqn_isize        count    = 0;
+            for (Dqn_StringTokenizer it = Dqn_StringTokenizer_InitLines(DQN_STRING("first\r\nsecond line\n\n\nthird")); Dqn_StringTokenizer_Next(&it); count++)
+            {
+                DQN_TEST_EXPECT_MSG(testing_state, count < Dqn_ArrayCountI(EXPECT) && it.token == EXPECT[count], "token: %.*s", DQN_STRING_FMT(it.token));
+            }
+            DQN_TEST_EXPECT_MSG(testing_state, count == Dqn_ArrayCountI(EXPECT), "count: %zd", count);
+        }
+
+        {
+            DQN_TEST_START_SCOPE(testing_state, "Tokenize words separated by any whitespace");
+            Dqn_String const EXPECT[] = {DQN_STRING("GET"), DQN_STRING("/index.html"), DQN_STRING("HTTP/1.1")};
+            Dqn_isize        count    = 0;
+            for (Dqn_StringTokenizer it = Dqn_StringTokenizer_InitWords(DQN_STRING("  GET\t/index.html \r\n HTTP/1.1\n")); Dqn_StringTokenizer_Next(&it); count++)
+            {
+                DQN_TEST_EXPECT_MSG(testing_state, count < Dqn_ArrayCountI(EXPECT) && it.token == EXPECT[count], "token: %.*s", DQN_STRING_FMT(it.token));
+            }
+            DQN_TEST_EXPECT_MSG(testing_state, count == Dqn_ArrayCountI(EXPECT), "count: %zd", count);
+        }
+
+        {
+            DQN_TEST_START_SCOPE(testing_state, "Stop early and return the rest of the string");
+            Dqn_StringTokenizer it = Dqn_StringTokenizer_InitWithDelimiters(DQN_STRING("key=value=more"), DQN_STRING("="));
+            DQN_TEST_EXPECT(testing_state, Dqn_StringTokenizer_Next(&it) && it.token == DQN_STRING("key"));
+            DQN_TEST_EXPECT(testing_state, Dqn_StringTokenizer_Rest(&it) == DQN_STRING("=value=more"));
+        }
+
+        {
+            DQN_TEST_START_SCOPE(testing_state, "Tokenize stops at the string's size, not the null-terminator");
+            Dqn_StringTokenizer it = Dqn_StringTokenizer_InitWithDelimiters(Dqn_String_Init("a,bc,d", 4), DQN_STRING(","));
+            DQN_TEST_EXPECT(testing_state, Dqn_StringTokenizer_Next(&it) && it.token == DQN_STRING("a"));
+            DQN_TEST_EXPECT(testing_state, Dqn_StringTokenizer_Next(&it) && it.token == DQN_STRING("bc"));
+            DQN_TEST_EXPECT(testing_state, !Dqn_StringTokenizer_Next(&it) && it.token.size == 0);
+            DQN_TEST_EXPECT(testing_state, !Dqn_StringTokenizer_Next(&it));
+        }
+
+        {
+            DQN_TEST_START_SCOPE(testing_state, "Tokens match splitting the string to a list");
+            Dqn_ArenaAllocator arena = Dqn_ArenaAllocator_InitWithNewAllocator(Dqn_Allocator_InitWithHeap(), 0, nullptr);
+            DQN_DEFER { Dqn_ArenaAllocator_Free(&arena); };
+
+            // NOTE: Long runs without a delimiter so the tokenizer's SIMD search is used as well
+            char src[1024];
+            DQN_FOR_EACH(index, Dqn_ArrayCountI(src))
+            {
+                Dqn_u32 hash = DQN_CAST(Dqn_u32)index * 2654435761u;
+                src[index]   = ((hash >> 24) < 24) ? "\n,\x80"[(hash >> 8) % 3] : DQN_CAST(char)('a' + (hash >> 12) % 26);
+            }
+
+            Dqn_String const DELIMITERS[] = {DQN_STRING("\n"), DQN_STRING("\n,"), Dqn_String_Init("\n,\x80\t\r;:!", 8)};
+            Dqn_isize        failures     = 0;
+            for (Dqn_String delimiters : DELIMITERS)
+            {
+                for (Dqn_isize size = 0; size <= Dqn_ArrayCountI(src); size += 7)
+                {
+                    Dqn_ArenaAllocatorScopedRegion region = Dqn_ArenaAllocator_MakeScopedRegion(&arena);
+                    Dqn_List<Dqn_String>           splits = Dqn_List_InitWithArena<Dqn_String>(&arena);
+                    Dqn_String_SplitToList(Dqn_String_Init(src, size), delimiters, &splits);
+
+                    Dqn_ListIterator<Dqn_String> split = {};
+                    for (Dqn_StringTokenizer it = Dqn_StringTokenizer_InitWithDelimiters(Dqn_String_Init(src, size), delimiters); Dqn_StringTokenizer_Next(&it);)
+                        failures += !Dqn_List_Iterate(&splits, &split) || split.data->str != it.token.str || split.data->size != it.token.size;
+                    failures += Dqn_List_Iterate(&splits, &split);
+                }
+            }
+            DQN_TEST_EXPECT_MSG(testing_state, failures == 0, "failures: %zd", failures);
+        }
+    }
+
+    // ---------------------------------------------------------------------------------------------
+    // NOTE: Dqn_M4
+    // ---------------------------------------------------------------------------------------------
+    {
+        DQN_TEST_DECLARE_GROUP_SCOPED(testing_state, "Dqn_M4");
+        {
+            DQN_TEST_START_SCOPE(testing_state, "Simple translate and scale matrix");
+            Dqn_M4 translate = Dqn_M4_TranslateF(1, 2, 3);
+            Dqn_M4 scale     = Dqn_M4_ScaleF(2, 2, 2);
+            Dqn_M4 result    = Dqn_M4_Mul(translate, scale);
+
+            const Dqn_M4 EXPECT = {{
+                {2, 0, 0, 0},
+                {0, 2, 0, 0},
+                {0, 0, 2, 0},
+                {1, 2, 3, 1},
+            }};
+
+            DQN_TEST_EXPECT_MSG(testing_state,
+                                memcmp(result.columns, EXPECT.columns, sizeof(EXPECT)) == 0,
+                                "\nresult =\n%s\nexpected =\n%s",
+                                Dqn_M4_ColumnMajorString(result).str,
+                                Dqn_M4_ColumnMajorString(EXPECT).str);
+        }
+    }
+}
+
+// NOTE: The arena allocation routine prior to the inlined bump pointer fast path, kept to compare against
+// in the benchmarks.
+void *Dqn_Test__ArenaAllocatorWalkingAllocate(Dqn_ArenaAllocator *arena, Dqn_isize size, Dqn_u8 alignment)
+{
+    Dqn_isize allocation_size  = size + (alignment - 1);
+    Dqn_b32 need_new_mem_block = true;
+    for (Dqn_ArenaAllocatorBlock *mem_block = arena->curr_mem_block; mem_block; mem_block = mem_block->next)
+    {
+        Dqn_b32 can_fit_in_block = (mem_block->used + allocation_size) <= mem_block->size;
+        if (can_fit_in_block)
+        {
+            arena->curr_mem_block = mem_block;
+            need_new_mem_block    = false;
+            break;
+        }
+    }
+
+    if (need_new_mem_block)
+    {
+        Dqn_ArenaAllocatorBlock *new_block = Dqn_ArenaAllocator__AllocateBlock(arena, allocation_size DQN_CALL_SITE(""));
+        if (!new_block) return nullptr;
+        Dqn_ArenaAllocator__AttachBlock(arena, new_block);
+        arena->curr_mem_block = arena->top_mem_block;
+    }
+
+    Dqn_uintptr address = DQN_CAST(Dqn_uintptr) arena->curr_mem_block->memory + arena->curr_mem_block->used;
+    void *result        = DQN_CAST(void *) Dqn_AlignAddress(address, alignment);
+    arena->curr_mem_block->used += allocation_size;
+    Dqn__ZeroMemBytes(DQN_CAST(void *)address, allocation_size, Dqn_ZeroMem::No);
+    Dqn_AllocationTracer_Add(arena->tracer, DQN_CAST(void *)address, allocation_size DQN_CALL_SITE(""));
+    return result;
+}
+
+// NOTE: Benchmarks write their results here to stop the compiler from optimising the work away
+Dqn_uintptr volatile dqn_test__benchmark_sink;
+
+void Dqn_Test__ConcurrentArenaBenchmarkThread(void *user_context)
+{
+    auto *work = DQN_CAST(Dqn_Test__ConcurrentArenaWork *)user_context;
+    DQN_FOR_EACH(index, work->allocation_count)
+        dqn_test__benchmark_sink = DQN_CAST(Dqn_uintptr)Dqn_ConcurrentArenaAllocator_Allocate(work->arena, work->max_allocation_size, 8, Dqn_ZeroMem::No);
+}
+
+struct Dqn_Test__LockedAllocatorWork
+{
+    Dqn_TicketMutex *mutex;     // Guards 'allocator' when set
+    Dqn_Allocator   *allocator;
+    int              iterations;
+};
+
+void Dqn_Test__LockedAllocatorBenchmarkThread(void *user_context)
+{
+    auto *work = DQN_CAST(Dqn_Test__LockedAllocatorWork *)user_context;
+    Dqn_isize const SIZES[] = {8, 24, 16, 40, 12, 64, 32, 200, 96, 1000};
+    void *live[64]          = {};
+    DQN_FOR_EACH(index, work->iterations)
+    {
+        Dqn_isize slot = index % Dqn_ArrayCountI(live);
+        if (work->mutex) Dqn_TicketMutex_Begin(work->mutex);
+        Dqn_Allocator_Free(work->allocator, live[slot]);
+        live[slot] = Dqn_Allocator_Allocate(work->allocator, SIZES[index % Dqn_ArrayCountI(SIZES)], 8, Dqn_ZeroMem::No);
+        if (work->mutex) Dqn_TicketMutex_End(work->mutex);
+    }
+
+    if (work->mutex) Dqn_TicketMutex_Begin(work->mutex);
+    for (void *ptr : live)
+        Dqn_Allocator_Free(work->allocator, ptr);
+    if (work->mutex) Dqn_TicketMutex_End(work->mutex);
+}
+
+struct Dqn_Test__ConcurrentMapBenchmarkWork
+{
+    Dqn_ConcurrentMap<Dqn_u64> *map;         // Used when 'mutex' is null
+    Dqn_GrowableMap<Dqn_u64>   *locked_map;  // Guarded by 'mutex'
+    Dqn_TicketMutex            *mutex;
+    Dqn_isize                   operations;
+    Dqn_u64                     key_range;
+    Dqn_u64                     read_percent; // The remaining operations overwrite or add a key
+    Dqn_u64                     rng;
+    Dqn_u64                     hits;
+};
+
+void Dqn_Test__ConcurrentMapBenchmarkThread(void *user_context)
+{
+    auto *work = DQN_CAST(Dqn_Test__ConcurrentMapBenchmarkWork *)user_context;
+    DQN_FOR_EACH(index, work->operations)
+    {
+        work->rng ^= work->rng << 13;
+        work->rng ^= work->rng >> 7;
+        work->rng ^= work->rng << 17;
+        Dqn_u64 key  = (work->rng & 0xFFFFFFFF) % work->key_range;
+        Dqn_b32 read = (work->rng >> 32) % 100 < work->read_percent;
+        if (work->mutex)
+        {
+            Dqn_TicketMutex_Begin(work->mutex);
+            if (read) work->hits += Dqn_Map_Get(work->locked_map, key) != nullptr;
+            else      *Dqn_Map_FindOrMake(work->locked_map, key) = index;
+            Dqn_TicketMutex_End(work->mutex);
+        }
+        else
+        {
+            if (read) work->hits += Dqn_ConcurrentMap_Get(work->map, key, DQN_CAST(Dqn_u64 *)nullptr);
+            else      Dqn_ConcurrentMap_Set(work->map, key, DQN_CAST(Dqn_u64)index);
+        }
+    }
+}
+
+// NOTE: Dqn_String_Split before it was made single pass, the baseline for its benchmark
+Dqn_Slice<Dqn_String> Dqn_Test__StringSplitTwoPass(Dqn_String src, Dqn_Allocator *allocator)
+{
+    Dqn_Slice<Dqn_String> result      = {};
+    Dqn_isize             split_index = 0;
+    Dqn_isize             split_count = 0;
+    for (int stage = 0; stage < 2; stage++)
+    {
+        if (stage == 1)
+            result = Dqn_Slice_Allocate(allocator, Dqn_String, split_count, Dqn_ZeroMem::No);
+
+        char const *begin = src.str;
+        char const *end   = src.str;
+        for (;;)
+        {
+            while (end[0] != '\r' && end[0] != '\n' && end[0] != 0)
+                end++;
+
+            if (end[0] == 0)
+                break;
+
+            Dqn_String split = Dqn_String_Init(begin, end - begin);
+            begin            = end + 1;
+            end              = begin;
+            if (split.size)
+            {
+                if (stage == 0) split_count++;
+                else            result[split_index++] = split;
+            }
+        }
+    }
+    return result;
+}
+
+void Dqn_Test_Benchmarks()
+{
+    // ---------------------------------------------------------------------------------------------
+    // NOTE: Dqn_ArenaAllocator
+    // ---------------------------------------------------------------------------------------------
+    {
+        fprintf(stdout, "Dqn_ArenaAllocator Benchmarks\n");
+        Dqn_isize const ALLOCATIONS_PER_RESET = 64 * 1024;
+        Dqn_isize const RESETS                = 128;
+        Dqn_isize const SIZES[]               = {8, 24, 16, 40, 12, 64, 32, 4};
+        Dqn_u8    const ALIGNMENTS[]          = {8, 8, 4, 16, 4, 8, 16, 1};
+
+        // NOTE: Blocks are sized smaller than the working set so that a reset walks over retained
+        // blocks, like a frame arena that has warmed up.
+        Dqn_ArenaAllocator arena = Dqn_ArenaAllocator_InitWithNewAllocator(Dqn_Allocator_InitWithHeap(), DQN_KILOBYTES(256), nullptr);
+        arena.min_block_size     = DQN_KILOBYTES(256);
+        DQN_DEFER { Dqn_ArenaAllocator_Free(&arena); };
+
+        for (int walking = 1; walking >= 0; walking--)
+        {
+            Dqn_Timer timer = Dqn_Timer_Begin();
+            DQN_FOR_EACH(reset_index, RESETS)
+            {
+                Dqn_ArenaAllocator_ResetUsage(&arena, Dqn_ZeroMem::No);
+                DQN_FOR_EACH(index, ALLOCATIONS_PER_RESET)
+                {
+                    Dqn_isize size      = SIZES[index % Dqn_ArrayCountI(SIZES)];
+                    Dqn_u8    alignment = ALIGNMENTS[index % Dqn_ArrayCountI(ALIGNMENTS)];
+                    void *ptr = walking ? Dqn_Test__ArenaAllocatorWalkingAllocate(&arena, size, alignment)
+                                        : Dqn_ArenaAllocator_Allocate(&arena, size, alignment, Dqn_ZeroMem::No);
+                    dqn_test__benchmark_sink = DQN_CAST(Dqn_uintptr)ptr;
+                }
+            }
+            Dqn_Timer_End(&timer);
+            Dqn_Test_PrintBenchmark(walking ? "Allocate (walk blocks, pad alignment - 1)" : "Allocate (inline bump pointer)",
+                                    DQN_CAST(Dqn_f64)(ALLOCATIONS_PER_RESET * RESETS),
+                                    "allocs",
+                                    Dqn_Timer_Ms(timer));
+        }
+        fprintf(stdout, "\n");
+    }
+
+    // ---------------------------------------------------------------------------------------------
+    // NOTE: Dqn_Map
+    // ---------------------------------------------------------------------------------------------
+    {
+        fprintf(stdout, "Dqn_Map Benchmarks\n");
+        Dqn_isize const MAP_SIZE       = 1 << 16;
+        Dqn_isize const LOOKUPS        = 4 * 1024 * 1024;
+        Dqn_f64   const LOAD_FACTORS[] = {0.25, 0.5, 0.75, 0.9};
+
+        Dqn_ArenaAllocator arena = Dqn_ArenaAllocator_InitWithNewAllocator(Dqn_Allocator_InitWithHeap(), 0, nullptr);
+        DQN_DEFER { Dqn_ArenaAllocator_Free(&arena); };
+        Dqn_isize const MEM_SIZE = Dqn_Map_MemoryRequired<Dqn_u64>(MAP_SIZE);
+        void           *mem      = Dqn_ArenaAllocator_Allocate(&arena, MEM_SIZE, alignof(Dqn_u64), Dqn_ZeroMem::No);
+
+        for (Dqn_f64 load_factor : LOAD_FACTORS)
+        {
+            Dqn_Map<Dqn_u64> map = Dqn_Map_InitWithMemory<Dqn_u64>(mem, MEM_SIZE);
+            Dqn_isize count      = DQN_CAST(Dqn_isize)(DQN_CAST(Dqn_f64)map.size * load_factor);
+
+            // NOTE: Pointer-like keys, 16 byte aligned allocations from a single region
+            DQN_FOR_EACH(index, count) Dqn_Map_Add(&map, 0x10000000ULL + DQN_CAST(Dqn_u64)index * 16, DQN_CAST(Dqn_u64)index);
+
+            Dqn_u64   sum   = 0;
+            Dqn_Timer timer = Dqn_Timer_Begin();
+            DQN_FOR_EACH(index, LOOKUPS)
+            {
+                // NOTE: Alternate between keys that are present and keys that are not
+                Dqn_u64 key   = 0x10000000ULL + DQN_CAST(Dqn_u64)((index * 7919) % (count * 2)) * 16;
+                Dqn_u64 *value = Dqn_Map_Get(&map, key);
+                sum += value ? *value : 1;
+            }
+            Dqn_Timer_End(&timer);
+            dqn_test__benchmark_sink = DQN_CAST(Dqn_uintptr)sum;
+
+            Dqn_MapStats stats = Dqn_Map_GetStats(&map);
+            char name[128];
+            snprintf(name, sizeof(name), "Get at %.2f load (avg probe %.2f, max probe %lld)", stats.load_factor, stats.average_probe_length, (long long)stats.max_probe_length);
+            Dqn_Test_PrintBenchmark(name, DQN_CAST(Dqn_f64)LOOKUPS, "gets", Dqn_Timer_Ms(timer));
+        }
+
+        // NOTE: A table much larger than the last level cache, every lookup is a miss to main memory
+        {
+            Dqn_isize const LARGE_MAP_SIZE = 1 << 25;
+            Dqn_isize const LARGE_MEM_SIZE = Dqn_Map_MemoryRequired<Dqn_u64>(LARGE_MAP_SIZE);
+            void           *large_mem      = Dqn_ArenaAllocator_Allocate(&arena, LARGE_MEM_SIZE, alignof(Dqn_u64), Dqn_ZeroMem::No);
+            Dqn_Map<Dqn_u64> map           = Dqn_Map_InitWithMemory<Dqn_u64>(large_mem, LARGE_MEM_SIZE);
+            Dqn_isize count                = map.size / 2;
+            DQN_FOR_EACH(index, count) Dqn_Map_Add(&map, DQN_CAST(Dqn_u64)index, DQN_CAST(Dqn_u64)index);
+
+            Dqn_u64  *keys    = Dqn_ArenaAllocator_NewArray(&arena, Dqn_u64, LOOKUPS, Dqn_ZeroMem::No);
+            Dqn_u64 **results = Dqn_ArenaAllocator_NewArray(&arena, Dqn_u64 *, LOOKUPS, Dqn_ZeroMem::No);
+            DQN_FOR_EACH(index, LOOKUPS)
+                keys[index] = DQN_CAST(Dqn_u64)((index * 7919) % (count * 2));
+
+            for (int batched = 0; batched <= 1; batched++)
+            {
+                Dqn_u64   sum   = 0;
+                Dqn_Timer timer = Dqn_Timer_Begin();
+                if (batched)
+                {
+                    Dqn_Map_GetBatch(&map, keys, LOOKUPS, results);
+                    DQN_FOR_EACH(index, LOOKUPS)
+                        sum += results[index] ? *results[index] : 1;
+                }
+                else
+                {
+                    DQN_FOR_EACH(index, LOOKUPS)
+                    {
+                        Dqn_u64 *value = Dqn_Map_Get(&map, keys[index]);
+                        sum += value ? *value : 1;
+                    }
+                }
+                Dqn_Timer_End(&timer);
+                dqn_test__benchmark_sink = DQN_CAST(Dqn_uintptr)sum;
+
+                char name[128];
+                snprintf(name, sizeof(name), "%s on a %lluMiB table (50%% hits)", batched ? "GetBatch" : "Get", (unsigned long long)(LARGE_MEM_SIZE / DQN_MEGABYTES(1)));
+                Dqn_Test_PrintBenchmark(name, DQN_CAST(Dqn_f64)LOOKUPS, "gets", Dqn_Timer_Ms(timer));
+            }
+        }
+        fprintf(stdout, "\n");
+    }
+
+    // ---------------------------------------------------------------------------------------------
+    // NOTE: Dqn_FlatMap
+    // ---------------------------------------------------------------------------------------------
+    {
+#if defined(DQN_SSE2)
+        fprintf(stdout, "Dqn_FlatMap Benchmarks (SSE2)\n");
+#else
+        fprintf(stdout, "Dqn_FlatMap Benchmarks (scalar)\n");
+#endif
+        Dqn_isize const MAP_SIZE       = 1 << 21;
+        Dqn_isize const LOOKUPS        = 4 * 1024 * 1024;
+        Dqn_f64   const LOAD_FACTORS[] = {0.5, 0.75, 0.9};
+
+        Dqn_ArenaAllocator arena = Dqn_ArenaAllocator_InitWithNewAllocator(Dqn_Allocator_InitWithHeap(), 0, nullptr);
+        DQN_DEFER { Dqn_ArenaAllocator_Free(&arena); };
+        Dqn_isize const MAP_MEM_SIZE      = Dqn_Map_MemoryRequired<Dqn_u64>(MAP_SIZE);
+        Dqn_isize const FLAT_MAP_MEM_SIZE = Dqn_FlatMap_MemoryRequired<Dqn_u64, Dqn_u64>(MAP_SIZE);
+        void           *map_mem           = Dqn_ArenaAllocator_Allocate(&arena, MAP_MEM_SIZE, alignof(Dqn_u64), Dqn_ZeroMem::No);
+        void           *flat_map_mem      = Dqn_ArenaAllocator_Allocate(&arena, FLAT_MAP_MEM_SIZE, alignof(Dqn_u64), Dqn_ZeroMem::No);
+
+        for (Dqn_f64 load_factor : LOAD_FACTORS)
+        {
+            Dqn_Map<Dqn_u64>              map      = Dqn_Map_InitWithMemory<Dqn_u64>(map_mem, MAP_MEM_SIZE);
+            Dqn_FlatMap<Dqn_u64, Dqn_u64> flat_map = Dqn_FlatMap_InitWithMemory<Dqn_u64, Dqn_u64>(flat_map_mem, FLAT_MAP_MEM_SIZE);
+            Dqn_isize                     count    = DQN_CAST(Dqn_isize)(DQN_CAST(Dqn_f64)MAP_SIZE * load_factor);
+            DQN_FOR_EACH(index, count)
+            {
+                Dqn_Map_Add(&map, DQN_CAST(Dqn_u64)index * 16, DQN_CAST(Dqn_u64)index);
+                Dqn_Map_Add(&flat_map, DQN_CAST(Dqn_u64)index * 16, DQN_CAST(Dqn_u64)index);
+            }
+
+            for (int use_flat_map = 0; use_flat_map <= 1; use_flat_map++)
+            {
+                Dqn_u64   sum   = 0;
+                Dqn_Timer timer = Dqn_Timer_Begin();
+                DQN_FOR_EACH(index, LOOKUPS)
+                {
+                    // NOTE: Alternate between keys that are present and keys that are not
+                    Dqn_u64  key   = DQN_CAST(Dqn_u64)((index * 7919) % (count * 2)) * 16;
+                    Dqn_u64 *value = use_flat_map ? Dqn_Map_Get(&flat_map, key) : Dqn_Map_Get(&map, key);
+                    sum += value ? *value : 1;
+                }
+                Dqn_Timer_End(&timer);
+                dqn_test__benchmark_sink = DQN_CAST(Dqn_uintptr)sum;
+
+                char name[128];
+                snprintf(name, sizeof(name), "%s Get at %.2f load", use_flat_map ? "Dqn_FlatMap" : "Dqn_Map", load_factor);
+                Dqn_Test_PrintBenchmark(name, DQN_CAST(Dqn_f64)LOOKUPS, "gets", Dqn_Timer_Ms(timer));
+            }
+        }
+        fprintf(stdout, "\n");
+    }
+
+    // ---------------------------------------------------------------------------------------------
+    // NOTE: Dqn_GrowableMap
+    // ---------------------------------------------------------------------------------------------
+    {
+        fprintf(stdout, "Dqn_GrowableMap Benchmarks\n");
+        Dqn_isize const INSERTS = 4 * 1024 * 1024;
+        for (int incremental = 0; incremental <= 1; incremental++)
+        {
+            Dqn_GrowableMap<Dqn_u64> map = Dqn_GrowableMap_InitWithAllocator<Dqn_u64>(Dqn_Allocator_InitWithHeap());
+            map.rehash_step              = incremental ? DQN_GROWABLE_MAP_REHASH_STEP : DQN_ISIZE_MAX;
+
+            // NOTE: Only adds from a resize until its migration finishes are timed for the worst case,
+            // other adds are subject to scheduler noise that has nothing to do with the rehash.
+            Dqn_f64   worst_resize_ms = 0;
+            Dqn_Timer timer           = Dqn_Timer_Begin();
+            DQN_FOR_EACH(index, INSERTS)
+            {
+                Dqn_isize resize_count = map.resize_count;
+                Dqn_b32   rehashing    = map.old_map.size != 0;
+                Dqn_u64   begin        = Dqn_PerfCounter_Now();
+                Dqn_Map_Add(&map, DQN_CAST(Dqn_u64)index * 16, DQN_CAST(Dqn_u64)index);
+                if (rehashing || resize_count != map.resize_count)
+                    worst_resize_ms = DQN_M_MAX(worst_resize_ms, Dqn_PerfCounter_Ms(begin, Dqn_PerfCounter_Now()));
+            }
+            Dqn_Timer_End(&timer);
+
+            Dqn_MapStats stats = Dqn_Map_GetStats(&map);
+            char name[128];
+            snprintf(name, sizeof(name), "Add %s (%lld resizes, worst add while resizing %.3fms)", incremental ? "incremental rehash" : "full rehash", (long long)stats.resize_count, worst_resize_ms);
+            Dqn_Test_PrintBenchmark(name, DQN_CAST(Dqn_f64)INSERTS, "adds", Dqn_Timer_Ms(timer));
+            Dqn_GrowableMap_Free(&map);
+        }
+        fprintf(stdout, "\n");
+    }
+
+    // ---------------------------------------------------------------------------------------------
+    // NOTE: Dqn_ConcurrentMap
+    // ---------------------------------------------------------------------------------------------
+    {
+        // NOTE: Thread counts are capped at the processor count as the ticket mutexes spin, past that
+        // the results measure the scheduler preempting lock holders rather than the map.
+        fprintf(stdout, "Dqn_ConcurrentMap Benchmarks\n");
+        int const       MAX_THREADS           = DQN_M_MIN(Dqn_TestThread_ProcessorCount(), 64);
+        Dqn_isize const OPERATIONS_PER_THREAD = 256 * 1024;
+        Dqn_u64 const   KEY_RANGE             = 64 * 1024;
+        Dqn_u64 const   READ_PERCENTS[]       = {50, 90, 99};
+
+        Dqn_TestThread                       threads[64] = {};
+        Dqn_Test__ConcurrentMapBenchmarkWork work[64]    = {};
+        for (Dqn_u64 read_percent : READ_PERCENTS)
+        {
+            for (int thread_count = 1; thread_count <= MAX_THREADS; thread_count *= 2)
+            {
+                for (int use_shards = 0; use_shards <= 1; use_shards++)
+                {
+                    Dqn_TicketMutex            mutex      = {};
+                    Dqn_GrowableMap<Dqn_u64>   locked_map = Dqn_GrowableMap_InitWithAllocator<Dqn_u64>(Dqn_Allocator_InitWithHeap());
+                    Dqn_ConcurrentMap<Dqn_u64> map        = {};
+                    Dqn_ConcurrentMap_InitWithAllocator(&map, Dqn_Allocator_InitWithHeap());
+                    for (Dqn_u64 key = 0; key < KEY_RANGE; key += 2)
+                    {
+                        if (use_shards) Dqn_ConcurrentMap_Add(&map, key, key);
+                        else            Dqn_Map_Add(&locked_map, key, key);
+                    }
+
+                    Dqn_Timer timer = Dqn_Timer_Begin();
+                    DQN_FOR_EACH(thread_index, thread_count)
+                    {
+                        work[thread_index]              = {};
+                        work[thread_index].map          = &map;
+                        work[thread_index].locked_map   = &locked_map;
+                        work[thread_index].mutex        = use_shards ? nullptr : &mutex;
+                        work[thread_index].operations   = OPERATIONS_PER_THREAD;
+                        work[thread_index].key_range    = KEY_RANGE;
+                        work[thread_index].read_percent = read_percent;
+                        work[thread_index].rng          = 0x9E3779B97F4A7C15ULL * DQN_CAST(Dqn_u64)(thread_index + 1);
+                        Dqn_TestThread_Start(threads + thread_index, Dqn_Test__ConcurrentMapBenchmarkThread, work + thread_index);
+                    }
+
+                    DQN_FOR_EACH(thread_index, thread_count)
+                        Dqn_TestThread_Join(threads + thread_index);
+                    Dqn_Timer_End(&timer);
+                    dqn_test__benchmark_sink = DQN_CAST(Dqn_uintptr)work[0].hits;
+
+                    char name[64];
+                    snprintf(name, sizeof(name), "%s (%d%% reads, %d thread%s)", use_shards ? "Sharded" : "Single mutex", DQN_CAST(int)read_percent, thread_count, thread_count == 1 ? "" : "s");
+                    Dqn_Test_PrintBenchmark(name, DQN_CAST(Dqn_f64)(thread_count) * OPERATIONS_PER_THREAD, "ops", Dqn_Timer_Ms(timer));
+                    Dqn_ConcurrentMap_Free(&map);
+                    Dqn_GrowableMap_Free(&locked_map);
+                }
+            }
+        }
+        fprintf(stdout, "\n");
+    }
+
+    // ---------------------------------------------------------------------------------------------
+    // NOTE: Dqn_StringMap
+    // ---------------------------------------------------------------------------------------------
+    {
+        fprintf(stdout, "Dqn_StringMap Benchmarks\n");
+        Dqn_isize const KEY_COUNT = 64 * 1024;
+        Dqn_isize const REPEATS   = 16;
+
+        Dqn_ArenaAllocator arena = Dqn_ArenaAllocator_InitWithNewAllocator(Dqn_Allocator_InitWithHeap(), DQN_MEGABYTES(4), nullptr);
+        DQN_DEFER { Dqn_ArenaAllocator_Free(&arena); };
+
+        // NOTE: Half of the keys are added to the map, lookups alternate between present and missing keys
+        Dqn_String *keys = Dqn_ArenaAllocator_NewArray(&arena, Dqn_String, KEY_COUNT * 2, Dqn_ZeroMem::No);
+        DQN_FOR_EACH(index, KEY_COUNT * 2)
+            keys[index] = Dqn_String_InitArenaFmt(&arena, "config.section%zd.field_name", index);
+
+        Dqn_StringMap<int> map = Dqn_StringMap_InitWithArena<int>(&arena);
+        {
+            Dqn_Timer timer = Dqn_Timer_Begin();
+            DQN_FOR_EACH(index, KEY_COUNT)
+                Dqn_StringMap_Add(&map, keys[index], DQN_CAST(int *)nullptr, Dqn_StringMapCollisionRule::Overwrite);
+            Dqn_Timer_End(&timer);
+            Dqn_Test_PrintBenchmark("Dqn_StringMap_Add (growing from 4096 slots)", DQN_CAST(Dqn_f64)KEY_COUNT, "adds", Dqn_Timer_Ms(timer));
+        }
+
+        {
+            Dqn_isize hits  = 0;
+            Dqn_Timer timer = Dqn_Timer_Begin();
+            DQN_FOR_EACH(repeat, REPEATS)
+            {
+                DQN_FOR_EACH(index, KEY_COUNT * 2)
+                    hits += Dqn_StringMap_Get(&map, keys[(index * 7919) % (KEY_COUNT * 2)]) != nullptr;
+            }
+            Dqn_Timer_End(&timer);
+            dqn_test__benchmark_sink = DQN_CAST(Dqn_uintptr)hits;
+            Dqn_Test_PrintBenchmark("Dqn_StringMap_Get (50% hits)", DQN_CAST(Dqn_f64)(KEY_COUNT * 2 * REPEATS), "gets", Dqn_Timer_Ms(timer));
+        }
+
+        // NOTE: A table much larger than the last level cache, lookups miss on the entry and the key
+        {
+            Dqn_isize const LARGE_KEY_COUNT = 4 * 1024 * 1024;
+            Dqn_isize const LOOKUPS         = 4 * 1024 * 1024;
+            Dqn_ArenaAllocator large_arena  = Dqn_ArenaAllocator_InitWithNewAllocator(Dqn_Allocator_InitWithHeap(), DQN_MEGABYTES(64), nullptr);
+            DQN_DEFER { Dqn_ArenaAllocator_Free(&large_arena); };
+
+            Dqn_String *large_keys = Dqn_ArenaAllocator_NewArray(&large_arena, Dqn_String, LARGE_KEY_COUNT * 2, Dqn_ZeroMem::No);
+            DQN_FOR_EACH(index, LARGE_KEY_COUNT * 2)
+                large_keys[index] = Dqn_String_InitArenaFmt(&large_arena, "config.section%zd.field_name", index);
+
+            Dqn_StringMap<int> large_map = Dqn_StringMap_InitWithArena<int>(&large_arena, LARGE_KEY_COUNT * 2);
+            DQN_FOR_EACH(index, LARGE_KEY_COUNT)
+                Dqn_StringMap_Add(&large_map, large_keys[index * 2], DQN_CAST(int *)nullptr, Dqn_StringMapCollisionRule::Overwrite);
 
-                char const EXPECT_STR[] = "";
-                DQN_TEST_EXPECT_MSG(testing_state, size == Dqn_CharCountI(EXPECT_STR), "size: %zd", size);
-                DQN_TEST_EXPECT_MSG(testing_state, strncmp(result, EXPECT_STR, size) == 0, "result: %s", result);
+            Dqn_String               *lookups = Dqn_ArenaAllocator_NewArray(&large_arena, Dqn_String, LOOKUPS, Dqn_ZeroMem::No);
+            Dqn_StringMapEntry<int> **results = Dqn_ArenaAllocator_NewArray(&large_arena, Dqn_StringMapEntry<int> *, LOOKUPS, Dqn_ZeroMem::No);
+            DQN_FOR_EACH(index, LOOKUPS)
+                lookups[index] = large_keys[(index * 7919) % (LARGE_KEY_COUNT * 2)];
+
+            for (int batched = 0; batched <= 1; batched++)
+            {
+                Dqn_isize hits  = 0;
+                Dqn_Timer timer = Dqn_Timer_Begin();
+                if (batched)
+                {
+                    hits = Dqn_StringMap_GetBatch(&large_map, lookups, LOOKUPS, results);
+                }
+                else
+                {
+                    DQN_FOR_EACH(index, LOOKUPS)
+                        hits += Dqn_StringMap_Get(&large_map, lookups[index]) != nullptr;
+                }
+                Dqn_Timer_End(&timer);
+                dqn_test__benchmark_sink = DQN_CAST(Dqn_uintptr)hits;
+                Dqn_Test_PrintBenchmark(batched ? "Dqn_StringMap_GetBatch (4M keys, 50% hits)" : "Dqn_StringMap_Get (4M keys, 50% hits)",
+                                        DQN_CAST(Dqn_f64)LOOKUPS,
+                                        "gets",
+                                        Dqn_Timer_Ms(timer));
             }
         }
+        fprintf(stdout, "\n");
     }
 
     // ---------------------------------------------------------------------------------------------
-    // NOTE: Dqn_FixedArray
+    // NOTE: Dqn_StringInterner
     // ---------------------------------------------------------------------------------------------
     {
-        DQN_TEST_DECLARE_GROUP_SCOPED(testing_state, "Dqn_FixedArray");
-        // NOTE: Dqn_FixedArray_Init
+        fprintf(stdout, "Dqn_StringInterner Benchmarks\n");
+        Dqn_isize const KEY_COUNT = 64 * 1024;
+        Dqn_isize const REPEATS   = 16;
+
+        Dqn_ArenaAllocator arena = Dqn_ArenaAllocator_InitWithNewAllocator(Dqn_Allocator_InitWithHeap(), DQN_MEGABYTES(4), nullptr);
+        DQN_DEFER { Dqn_ArenaAllocator_Free(&arena); };
+        Dqn_String *keys = Dqn_ArenaAllocator_NewArray(&arena, Dqn_String, KEY_COUNT, Dqn_ZeroMem::No);
+        DQN_FOR_EACH(index, KEY_COUNT)
+            keys[index] = Dqn_String_InitArenaFmt(&arena, "entity.component%zd.field_name", index);
+
+        for (int thread_safe = 0; thread_safe <= 1; thread_safe++)
         {
-            DQN_TEST_START_SCOPE(testing_state, "Initialise from raw array");
-            int raw_array[] = {1, 2};
-            auto array = Dqn_FixedArray_Init<int, 4>(raw_array, (int)Dqn_ArrayCount(raw_array));
-            DQN_TEST_EXPECT(testing_state, array.size == 2);
-            DQN_TEST_EXPECT(testing_state, array[0] == 1);
-            DQN_TEST_EXPECT(testing_state, array[1] == 2);
+            Dqn_ArenaAllocator interner_arena = Dqn_ArenaAllocator_InitWithNewAllocator(Dqn_Allocator_InitWithHeap(), 0, nullptr);
+            Dqn_StringInterner interner       = Dqn_StringInterner_InitWithArena(&interner_arena, thread_safe);
+
+            // NOTE: The first pass interns every key, the remaining passes hit existing entries
+            Dqn_u64   sum   = 0;
+            Dqn_Timer timer = Dqn_Timer_Begin();
+            DQN_FOR_EACH(repeat, REPEATS)
+            {
+                DQN_FOR_EACH(index, KEY_COUNT)
+                    sum += Dqn_StringInterner_Intern(&interner, keys[(index * 7919) % KEY_COUNT]).id;
+            }
+            Dqn_Timer_End(&timer);
+            dqn_test__benchmark_sink = DQN_CAST(Dqn_uintptr)sum;
+
+            Dqn_Test_PrintBenchmark(thread_safe ? "Intern (thread safe)" : "Intern",
+                                    DQN_CAST(Dqn_f64)(KEY_COUNT * REPEATS),
+                                    "interns",
+                                    Dqn_Timer_Ms(timer));
+            Dqn_ArenaAllocator_Free(&interner_arena);
         }
 
-        // NOTE: Dqn_FixedArray_EraseStable
+        // NOTE: What the interner buys, comparing two interned strings versus their characters
         {
-            DQN_TEST_START_SCOPE(testing_state, "Erase stable 1 element from array");
-            int raw_array[] = {1, 2, 3};
-            auto array = Dqn_FixedArray_Init<int, 4>(raw_array, (int)Dqn_ArrayCount(raw_array));
-            Dqn_FixedArray_EraseStable(&array, 1);
-            DQN_TEST_EXPECT(testing_state, array.size == 2);
-            DQN_TEST_EXPECT(testing_state, array[0] == 1);
-            DQN_TEST_EXPECT(testing_state, array[1] == 3);
+            Dqn_ArenaAllocator interner_arena = Dqn_ArenaAllocator_InitWithNewAllocator(Dqn_Allocator_InitWithHeap(), 0, nullptr);
+            DQN_DEFER { Dqn_ArenaAllocator_Free(&interner_arena); };
+            Dqn_StringInterner  interner = Dqn_StringInterner_InitWithArena(&interner_arena);
+            Dqn_InternedString *interned = Dqn_ArenaAllocator_NewArray(&arena, Dqn_InternedString, KEY_COUNT, Dqn_ZeroMem::No);
+            DQN_FOR_EACH(index, KEY_COUNT)
+                interned[index] = Dqn_StringInterner_Intern(&interner, keys[index]);
+
+            Dqn_isize const COMPARES = KEY_COUNT * REPEATS;
+            for (int use_ids = 0; use_ids <= 1; use_ids++)
+            {
+                Dqn_isize equal = 0;
+                Dqn_Timer timer = Dqn_Timer_Begin();
+                DQN_FOR_EACH(index, COMPARES)
+                {
+                    Dqn_isize lhs = index % KEY_COUNT;
+                    Dqn_isize rhs = (index * 7) % KEY_COUNT;
+                    equal += use_ids ? interned[lhs] == interned[rhs] : keys[lhs] == keys[rhs];
+                }
+                Dqn_Timer_End(&timer);
+                dqn_test__benchmark_sink = DQN_CAST(Dqn_uintptr)equal;
+                Dqn_Test_PrintBenchmark(use_ids ? "Compare (interned ids)" : "Compare (Dqn_String operator==)",
+                                        DQN_CAST(Dqn_f64)COMPARES,
+                                        "compares",
+                                        Dqn_Timer_Ms(timer));
+            }
         }
+        fprintf(stdout, "\n");
+    }
 
-        // NOTE: Dqn_FixedArray_EraseUnstable
+    // ---------------------------------------------------------------------------------------------
+    // NOTE: Dqn_PerfectHash
+    // ---------------------------------------------------------------------------------------------
+    {
+        fprintf(stdout, "Dqn_PerfectHash Benchmarks\n");
+        Dqn_isize const HEADER_COUNT = Dqn_ArrayCountI(DQN_TEST__HTTP_HEADERS);
+        Dqn_isize const TOKEN_COUNT  = 4096;
+        Dqn_isize const REPEATS      = 256;
+
+        Dqn_ArenaAllocator arena = Dqn_ArenaAllocator_InitWithNewAllocator(Dqn_Allocator_InitWithHeap(), DQN_MEGABYTES(1), nullptr);
+        DQN_DEFER { Dqn_ArenaAllocator_Free(&arena); };
+
+        // NOTE: Half of the tokens are header names, the rest are names a parser would see that are not
+        Dqn_String *tokens = Dqn_ArenaAllocator_NewArray(&arena, Dqn_String, TOKEN_COUNT, Dqn_ZeroMem::No);
+        DQN_FOR_EACH(index, TOKEN_COUNT)
         {
-            DQN_TEST_START_SCOPE(testing_state, "Erase unstable 1 element from array");
-            int raw_array[] = {1, 2, 3};
-            auto array = Dqn_FixedArray_Init<int, 4>(raw_array, (int)Dqn_ArrayCount(raw_array));
-            Dqn_FixedArray_EraseUnstable(&array, 0);
-            DQN_TEST_EXPECT(testing_state, array.size == 2);
-            DQN_TEST_EXPECT(testing_state, array[0] == 3);
-            DQN_TEST_EXPECT(testing_state, array[1] == 2);
+            char const *header = DQN_TEST__HTTP_HEADERS[(index * 7) % HEADER_COUNT];
+            tokens[index]      = (index & 1) ? Dqn_String_InitArenaFmt(&arena, "x-%s", header)
+                                             : Dqn_String_Init(header, DQN_CAST(Dqn_isize)strlen(header));
         }
 
-        // NOTE: Dqn_FixedArray_Add
+        // NOTE: What Dqn_PerfectHash replaces, a string map filled in at startup
+        Dqn_StringMap<Dqn_isize> map = Dqn_StringMap_InitWithArena<Dqn_isize>(&arena);
         {
-            DQN_TEST_START_SCOPE(testing_state, "Add 1 element to array");
-            int const ITEM  = 2;
-            int raw_array[] = {1};
-            auto array      = Dqn_FixedArray_Init<int, 4>(raw_array, (int)Dqn_ArrayCount(raw_array));
-            Dqn_FixedArray_Add(&array, ITEM);
-            DQN_TEST_EXPECT(testing_state, array.size == 2);
-            DQN_TEST_EXPECT(testing_state, array[0] == 1);
-            DQN_TEST_EXPECT(testing_state, array[1] == ITEM);
+            Dqn_Timer timer = Dqn_Timer_Begin();
+            DQN_FOR_EACH(index, HEADER_COUNT)
+            {
+                Dqn_String key = Dqn_String_Init(DQN_TEST__HTTP_HEADERS[index], DQN_CAST(Dqn_isize)strlen(DQN_TEST__HTTP_HEADERS[index]));
+                Dqn_StringMap_Add(&map, key, Dqn_ArenaAllocator_New(&arena, Dqn_isize, Dqn_ZeroMem::No), Dqn_StringMapCollisionRule::Stop);
+            }
+            Dqn_Timer_End(&timer);
+            Dqn_Test_PrintBenchmark("Dqn_StringMap_Add (startup)", DQN_CAST(Dqn_f64)HEADER_COUNT, "adds", Dqn_Timer_Ms(timer));
         }
 
-        // NOTE: Dqn_FixedArray_Clear
+        for (int use_perfect_hash = 0; use_perfect_hash <= 1; use_perfect_hash++)
         {
-            DQN_TEST_START_SCOPE(testing_state, "Clear array");
-            int raw_array[] = {1};
-            auto array      = Dqn_FixedArray_Init<int, 4>(raw_array, (int)Dqn_ArrayCount(raw_array));
-            Dqn_FixedArray_Clear(&array);
-            DQN_TEST_EXPECT(testing_state, array.size == 0);
+            Dqn_isize hits  = 0;
+            Dqn_Timer timer = Dqn_Timer_Begin();
+            DQN_FOR_EACH(repeat, REPEATS)
+            {
+                DQN_FOR_EACH(index, TOKEN_COUNT)
+                {
+                    if (use_perfect_hash) hits += Dqn_PerfectHash_Find(&DQN_TEST__HTTP_HEADER_TABLE, tokens[index]) != -1;
+                    else                  hits += Dqn_StringMap_Get(&map, tokens[index]) != nullptr;
+                }
+            }
+            Dqn_Timer_End(&timer);
+            dqn_test__benchmark_sink = DQN_CAST(Dqn_uintptr)hits;
+            Dqn_Test_PrintBenchmark(use_perfect_hash ? "Dqn_PerfectHash_Find (50% hits)" : "Dqn_StringMap_Get (50% hits)",
+                                    DQN_CAST(Dqn_f64)(TOKEN_COUNT * REPEATS),
+                                    "gets",
+                                    Dqn_Timer_Ms(timer));
         }
+        fprintf(stdout, "\n");
     }
 
     // ---------------------------------------------------------------------------------------------
-    // NOTE: Dqn_FixedString
+    // NOTE: Dqn_FastHash64
     // ---------------------------------------------------------------------------------------------
     {
-        DQN_TEST_DECLARE_GROUP_SCOPED(testing_state, "Dqn_FixedString");
+        fprintf(stdout, "Dqn_FastHash64 Benchmarks\n");
+        Dqn_isize const SIZES[]        = {1, 4, 8, 16, 32, 64, 256, 1024, 4 * 1024, 64 * 1024, 1024 * 1024};
+        Dqn_isize const BYTES_PER_SIZE = 64 * 1024 * 1024;
+        Dqn_isize const BUFFER_SIZE    = 1024 * 1024 + 64;
 
-        // NOTE: Dqn_FixedString_Append
-        {
-            DQN_TEST_START_SCOPE(testing_state, "Append too much fails");
-            Dqn_FixedString<4> str = {};
-            DQN_TEST_EXPECT_MSG(testing_state, Dqn_FixedString_Append(&str, "abcd") == false, "We need space for the null-terminator");
-        }
+        Dqn_ArenaAllocator arena = Dqn_ArenaAllocator_InitWithNewAllocator(Dqn_Allocator_InitWithHeap(), 0, nullptr);
+        DQN_DEFER { Dqn_ArenaAllocator_Free(&arena); };
+        Dqn_u8 *buffer = Dqn_ArenaAllocator_NewArray(&arena, Dqn_u8, BUFFER_SIZE, Dqn_ZeroMem::No);
+        DQN_FOR_EACH(index, BUFFER_SIZE)
+            buffer[index] = DQN_CAST(Dqn_u8)((index * 2654435761u) >> 13);
 
-        // NOTE: Dqn_FixedString_AppendFmt
+        enum Hasher { Hasher_FNV1A64, Hasher_MurmurHash3, Hasher_FastHash64Scalar, Hasher_FastHash64SSE2, Hasher_FastHash64AVX2, Hasher_Count };
+        char const *HASHER_NAMES[] = {"Dqn_FNV1A64_Hash", "Dqn_MurmurHash3_x64_128", "Dqn_FastHash64 (Scalar)", "Dqn_FastHash64 (SSE2)", "Dqn_FastHash64 (AVX2)"};
+        for (Dqn_isize size : SIZES)
         {
-            DQN_TEST_START_SCOPE(testing_state, "Append format string too much fails");
-            Dqn_FixedString<4> str = {};
-            DQN_TEST_EXPECT_MSG(testing_state, Dqn_FixedString_AppendFmt(&str, "abcd") == false, "We need space for the null-terminator");
+            // NOTE: Keys are read from a sliding offset so every hash is of different bytes
+            Dqn_isize iterations = BYTES_PER_SIZE / size;
+            for (int hasher = 0; hasher < Hasher_Count; hasher++)
+            {
+                if (hasher >= Hasher_FastHash64Scalar && (hasher - Hasher_FastHash64Scalar) > DQN_CAST(int)Dqn_FastHash64_Path())
+                    continue;
+
+                Dqn_u64   sum   = 0;
+                Dqn_Timer timer = Dqn_Timer_Begin();
+                DQN_FOR_EACH(index, iterations)
+                {
+                    Dqn_u8 const *key = buffer + (index & 63);
+                    switch (hasher)
+                    {
+                        case Hasher_FNV1A64:          sum += Dqn_FNV1A64_Hash(key, size); break;
+                        case Hasher_MurmurHash3:      sum += DQN_MURMUR_HASH3_U128_AS_U64(key, DQN_CAST(int)size, 0); break;
+                        case Hasher_FastHash64Scalar: sum += Dqn_FastHash64_WithPath(key, size, 0, Dqn_FastHashPath::Scalar); break;
+                        case Hasher_FastHash64SSE2:   sum += Dqn_FastHash64_WithPath(key, size, 0, Dqn_FastHashPath::SSE2); break;
+                        case Hasher_FastHash64AVX2:   sum += Dqn_FastHash64_WithPath(key, size, 0, Dqn_FastHashPath::AVX2); break;
+                    }
+                }
+                Dqn_Timer_End(&timer);
+                dqn_test__benchmark_sink = DQN_CAST(Dqn_uintptr)sum;
+
+                char name[128];
+                if (size >= 1024) snprintf(name, sizeof(name), "%s (%lld KiB)", HASHER_NAMES[hasher], (long long)(size / 1024));
+                else              snprintf(name, sizeof(name), "%s (%lld B)", HASHER_NAMES[hasher], (long long)size);
+
+                // NOTE: Short keys are bound by the cost per hash, long keys by the cost per byte
+                if (size <= 256) Dqn_Test_PrintBenchmark(name, DQN_CAST(Dqn_f64)iterations, "hashes", Dqn_Timer_Ms(timer));
+                else             Dqn_Test_PrintBenchmark(name, DQN_CAST(Dqn_f64)BYTES_PER_SIZE, "bytes", Dqn_Timer_Ms(timer));
+            }
         }
+        fprintf(stdout, "\n");
     }
 
     // ---------------------------------------------------------------------------------------------
-    // NOTE: Dqn_Str_ToI64
+    // NOTE: Dqn_Str_Find
     // ---------------------------------------------------------------------------------------------
     {
-        DQN_TEST_DECLARE_GROUP_SCOPED(testing_state, "Dqn_Str_ToI64");
-        {
-            DQN_TEST_START_SCOPE(testing_state, "Convert nullptr");
-            Dqn_i64 result = Dqn_Str_ToI64(nullptr);
-            DQN_TEST_EXPECT(testing_state, result == 0);
-        }
+        fprintf(stdout, "Dqn_Str_Find Benchmarks\n");
+        Dqn_isize const BUFFER_SIZE = DQN_MEGABYTES(8);
+        Dqn_isize const REPEATS     = 8;
+        char const      MARKER[]    = "#FATAL: disk quota exceeded on /var/log/app.log, rotating the logs";
 
+        // NOTE: A log buffer with the marker at the very end so every search scans all of it
+        Dqn_ArenaAllocator arena = Dqn_ArenaAllocator_InitWithNewAllocator(Dqn_Allocator_InitWithHeap(), 0, nullptr);
+        DQN_DEFER { Dqn_ArenaAllocator_Free(&arena); };
+        char     *buffer  = Dqn_ArenaAllocator_NewArray(&arena, char, BUFFER_SIZE, Dqn_ZeroMem::No);
+        Dqn_isize buf_len = 0;
+        for (Dqn_isize line = 0; buf_len < BUFFER_SIZE - 256; line++)
         {
-            DQN_TEST_START_SCOPE(testing_state, "Convert empty string");
-            Dqn_i64 result = Dqn_Str_ToI64("");
-            DQN_TEST_EXPECT(testing_state, result == 0);
+            buf_len += snprintf(buffer + buf_len, DQN_CAST(size_t)(BUFFER_SIZE - buf_len),
+                                "[%08lld] info: request %lld served in %lldms for 10.0.%lld.%lld\n",
+                                (long long)line, (long long)(line * 7), (long long)(line % 97), (long long)(line % 256), (long long)((line * 13) % 256));
         }
+        memcpy(buffer + buf_len, MARKER, sizeof(MARKER) - 1);
+        buf_len += sizeof(MARKER) - 1;
 
+        Dqn_isize const FIND_LENS[] = {1, 2, 4, 8, 16, 32, 64};
+        for (Dqn_isize find_len : FIND_LENS)
         {
-            DQN_TEST_START_SCOPE(testing_state, "Convert \"1\"");
-            Dqn_i64 result = Dqn_Str_ToI64("1");
-            DQN_TEST_EXPECT(testing_state, result == 1);
-        }
+            for (int method = 0; method < 4; method++)
+            {
+                Dqn_b32     case_insensitive = method & 1;
+                char const *found            = nullptr;
+                Dqn_Timer   timer            = Dqn_Timer_Begin();
+                DQN_FOR_EACH(repeat, REPEATS)
+                {
+                    if (method < 2) found = Dqn_Test__StrFindByteLoop(buffer, buf_len, MARKER, find_len, case_insensitive);
+                    else            found = Dqn_Str_Find(buffer, MARKER, buf_len, find_len, case_insensitive);
+                }
+                Dqn_Timer_End(&timer);
+                DQN_ASSERT(found == buffer + buf_len - (sizeof(MARKER) - 1));
+                dqn_test__benchmark_sink = DQN_CAST(Dqn_uintptr)found;
 
-        {
-            DQN_TEST_START_SCOPE(testing_state, "Convert \"-0\"");
-            Dqn_i64 result = Dqn_Str_ToI64("-0");
-            DQN_TEST_EXPECT(testing_state, result == 0);
+                char const *NAMES[] = {"Byte loop", "Byte loop (case insensitive)", "Dqn_Str_Find", "Dqn_Str_Find (case insensitive)"};
+                char        name[128];
+                snprintf(name, sizeof(name), "%s (%lld byte needle)", NAMES[method], (long long)find_len);
+                Dqn_Test_PrintBenchmark(name, DQN_CAST(Dqn_f64)(buf_len * REPEATS), "bytes", Dqn_Timer_Ms(timer));
+            }
         }
+        fprintf(stdout, "\n");
+    }
 
-        {
-            DQN_TEST_START_SCOPE(testing_state, "Convert \"-1\"");
-            Dqn_i64 result = Dqn_Str_ToI64("-1");
-            DQN_TEST_EXPECT(testing_state, result == -1);
-        }
+    // ---------------------------------------------------------------------------------------------
+    // NOTE: Dqn_String_Split
+    // ---------------------------------------------------------------------------------------------
+    {
+        fprintf(stdout, "Dqn_String_Split/Dqn_StringTokenizer Benchmarks\n");
+        Dqn_isize const BUFFER_SIZE = DQN_MEGABYTES(64);
+
+        Dqn_ArenaAllocator arena     = Dqn_ArenaAllocator_InitWithNewAllocator(Dqn_Allocator_InitWithHeap(), 0, nullptr);
+        Dqn_Allocator      allocator = Dqn_Allocator_InitWithArena(&arena);
+        DQN_DEFER { Dqn_ArenaAllocator_Free(&arena); };
 
+        // NOTE: Newline delimited log lines, null-terminated for the two pass baseline
+        char     *buffer  = Dqn_ArenaAllocator_NewArray(&arena, char, BUFFER_SIZE + 1, Dqn_ZeroMem::No);
+        Dqn_isize buf_len = 0;
+        for (Dqn_isize line = 0; buf_len < BUFFER_SIZE - 256; line++)
         {
-            DQN_TEST_START_SCOPE(testing_state, "Convert \"1.2\"");
-            Dqn_i64 result = Dqn_Str_ToI64("1.2");
-            DQN_TEST_EXPECT(testing_state, result == 1);
+            buf_len += snprintf(buffer + buf_len, DQN_CAST(size_t)(BUFFER_SIZE - buf_len),
+                                "[%08lld] info: request %lld served in %lldms for 10.0.%lld.%lld\n",
+                                (long long)line, (long long)(line * 7), (long long)(line % 97), (long long)(line % 256), (long long)((line * 13) % 256));
         }
+        buffer[buf_len] = 0;
 
+        Dqn_String src = Dqn_String_Init(buffer, buf_len);
+        for (int method = 0; method < 3; method++)
         {
-            DQN_TEST_START_SCOPE(testing_state, "Convert \"1,234\"");
-            Dqn_i64 result = Dqn_Str_ToI64("1,234");
-            DQN_TEST_EXPECT(testing_state, result == 1234);
+            Dqn_ArenaAllocatorScopedRegion region = Dqn_ArenaAllocator_MakeScopedRegion(&arena);
+            Dqn_isize                      count  = 0;
+            Dqn_Timer                      timer  = Dqn_Timer_Begin();
+            if (method == 0)
+            {
+                count = Dqn_Test__StringSplitTwoPass(src, &allocator).size;
+            }
+            else if (method == 1)
+            {
+                count = Dqn_String_Split(src, &allocator).size;
+            }
+            else
+            {
+                Dqn_List<Dqn_String> lines = Dqn_List_InitWithArena<Dqn_String>(&arena, 4096);
+                count                      = Dqn_String_SplitToList(src, DQN_STRING("\r\n"), &lines);
+            }
+            Dqn_Timer_End(&timer);
+            dqn_test__benchmark_sink = DQN_CAST(Dqn_uintptr)count;
+
+            char const *NAMES[] = {"Two pass byte loop", "Dqn_String_Split", "Dqn_String_SplitToList"};
+            Dqn_Test_PrintBenchmark(NAMES[method], DQN_CAST(Dqn_f64)buf_len, "bytes", Dqn_Timer_Ms(timer));
         }
 
         {
-            DQN_TEST_START_SCOPE(testing_state, "Convert \"1,2\"");
-            Dqn_i64 result = Dqn_Str_ToI64("1,2");
-            DQN_TEST_EXPECT(testing_state, result == 12);
+            Dqn_isize count = 0;
+            Dqn_Timer timer = Dqn_Timer_Begin();
+            for (Dqn_StringTokenizer it = Dqn_StringTokenizer_InitLines(src); Dqn_StringTokenizer_Next(&it);)
+                count++;
+            Dqn_Timer_End(&timer);
+            dqn_test__benchmark_sink = DQN_CAST(Dqn_uintptr)count;
+            Dqn_Test_PrintBenchmark("Dqn_StringTokenizer lines", DQN_CAST(Dqn_f64)buf_len, "bytes", Dqn_Timer_Ms(timer));
         }
 
         {
-            DQN_TEST_START_SCOPE(testing_state, "Convert \"12a3\"");
-            Dqn_i64 result = Dqn_Str_ToI64("12a3");
-            DQN_TEST_EXPECT(testing_state, result == 12);
+            Dqn_isize count = 0;
+            Dqn_Timer timer = Dqn_Timer_Begin();
+            for (Dqn_StringTokenizer it = Dqn_StringTokenizer_InitWords(src); Dqn_StringTokenizer_Next(&it);)
+                count++;
+            Dqn_Timer_End(&timer);
+            dqn_test__benchmark_sink = DQN_CAST(Dqn_uintptr)count;
+            Dqn_Test_PrintBenchmark("Dqn_StringTokenizer words", DQN_CAST(Dqn_f64)buf_len, "bytes", Dqn_Timer_Ms(timer));
         }
+        fprintf(stdout, "\n");
     }
 
     // ---------------------------------------------------------------------------------------------
-    // NOTE: Dqn_Str_ToU64
+    // NOTE: Dqn_AhoCorasick
     // ---------------------------------------------------------------------------------------------
     {
-        DQN_TEST_DECLARE_GROUP_SCOPED(testing_state, "Dqn_Str_ToU64");
-        {
-            DQN_TEST_START_SCOPE(testing_state, "Convert nullptr");
-            Dqn_u64 result = Dqn_Str_ToU64(nullptr);
-            DQN_TEST_EXPECT_MSG(testing_state, result == 0, "result: %zu", result);
-        }
+        fprintf(stdout, "Dqn_AhoCorasick Benchmarks\n");
+        Dqn_isize const RECORD_COUNT = 4096;
 
-        {
-            DQN_TEST_START_SCOPE(testing_state, "Convert empty string");
-            Dqn_u64 result = Dqn_Str_ToU64("");
-            DQN_TEST_EXPECT_MSG(testing_state, result == 0, "result: %zu", result);
-        }
+        Dqn_ArenaAllocator arena = Dqn_ArenaAllocator_InitWithNewAllocator(Dqn_Allocator_InitWithHeap(), 0, nullptr);
+        DQN_DEFER { Dqn_ArenaAllocator_Free(&arena); };
 
+        // NOTE: Short log records checked against hundreds of keywords, few of them match
+        Dqn_String *records = Dqn_ArenaAllocator_NewArray(&arena, Dqn_String, RECORD_COUNT, Dqn_ZeroMem::No);
+        Dqn_isize   bytes   = 0;
+        DQN_FOR_EACH(index, RECORD_COUNT)
         {
-            DQN_TEST_START_SCOPE(testing_state, "Convert \"1\"");
-            Dqn_u64 result = Dqn_Str_ToU64("1");
-            DQN_TEST_EXPECT_MSG(testing_state, result == 1, "result: %zu", result);
+            records[index] = Dqn_String_InitArenaFmt(&arena, "[%08zd] info: request %zd served in %zdms for 10.0.%zd.%zd%s",
+                                                     index, index * 7, index % 97, index % 256, (index * 13) % 256, (index % 64) ? "" : " keyword_17");
+            bytes += records[index].size;
         }
 
+        Dqn_isize const KEYWORD_COUNTS[] = {8, 64, 512};
+        for (Dqn_isize keyword_count : KEYWORD_COUNTS)
         {
-            DQN_TEST_START_SCOPE(testing_state, "Convert \"-0\"");
-            Dqn_u64 result = Dqn_Str_ToU64("-0");
-            DQN_TEST_EXPECT_MSG(testing_state, result == 0, "result: %zu", result);
-        }
+            Dqn_String  *keywords  = Dqn_ArenaAllocator_NewArray(&arena, Dqn_String, keyword_count, Dqn_ZeroMem::No);
+            char const **find_list = Dqn_ArenaAllocator_NewArray(&arena, char const *, keyword_count, Dqn_ZeroMem::No);
+            Dqn_isize   *find_lens = Dqn_ArenaAllocator_NewArray(&arena, Dqn_isize, keyword_count, Dqn_ZeroMem::No);
+            DQN_FOR_EACH(index, keyword_count)
+            {
+                keywords[index]  = Dqn_String_InitArenaFmt(&arena, "keyword_%zd", index);
+                find_list[index] = keywords[index].str;
+                find_lens[index] = keywords[index].size;
+            }
 
-        {
-            DQN_TEST_START_SCOPE(testing_state, "Convert \"-1\"");
-            Dqn_u64 result = Dqn_Str_ToU64("-1");
-            DQN_TEST_EXPECT_MSG(testing_state, result == 0, "result: %zu", result);
-        }
+            Dqn_Timer       build_timer = Dqn_Timer_Begin();
+            Dqn_AhoCorasick matcher     = Dqn_AhoCorasick_InitWithArena(&arena, keywords, keyword_count);
+            Dqn_Timer_End(&build_timer);
 
-        {
-            DQN_TEST_START_SCOPE(testing_state, "Convert \"1.2\"");
-            Dqn_u64 result = Dqn_Str_ToU64("1.2");
-            DQN_TEST_EXPECT_MSG(testing_state, result == 1, "result: %zu", result);
-        }
+            for (int method = 0; method < 2; method++)
+            {
+                Dqn_isize found = 0;
+                Dqn_Timer timer = Dqn_Timer_Begin();
+                DQN_FOR_EACH(index, RECORD_COUNT)
+                {
+                    Dqn_String const *record = records + index;
+                    if (method == 0)
+                    {
+                        Dqn_isize match_index = 0;
+                        found += Dqn_Str_FindMulti(record->str, find_list, find_lens, keyword_count, &match_index, record->size) != nullptr;
+                    }
+                    else
+                    {
+                        found += Dqn_AhoCorasick_FindFirst(&matcher, record->str, record->size, nullptr);
+                    }
+                }
+                Dqn_Timer_End(&timer);
+                DQN_ASSERT(found == RECORD_COUNT / 64);
+                dqn_test__benchmark_sink = DQN_CAST(Dqn_uintptr)found;
 
-        {
-            DQN_TEST_START_SCOPE(testing_state, "Convert \"1,234\"");
-            Dqn_u64 result = Dqn_Str_ToU64("1,234");
-            DQN_TEST_EXPECT_MSG(testing_state, result == 1234, "result: %zu", result);
+                char name[128];
+                snprintf(name, sizeof(name), "%s (%lld keywords)", method == 0 ? "Dqn_Str_FindMulti" : "Dqn_AhoCorasick_FindFirst", (long long)keyword_count);
+                Dqn_Test_PrintBenchmark(name, DQN_CAST(Dqn_f64)bytes, "bytes", Dqn_Timer_Ms(timer));
+            }
+
+            char name[128];
+            snprintf(name, sizeof(name), "Dqn_AhoCorasick_InitWithArena (%lld keywords)", (long long)keyword_count);
+            Dqn_Test_PrintBenchmark(name, 1, "builds", Dqn_Timer_Ms(build_timer));
         }
+        fprintf(stdout, "\n");
+    }
+
+    // ---------------------------------------------------------------------------------------------
+    // NOTE: Dqn_CRC32C
+    // ---------------------------------------------------------------------------------------------
+    {
+        fprintf(stdout, "Dqn_CRC32C Benchmarks\n");
+        Dqn_isize const BUFFER_SIZE = DQN_MEGABYTES(64);
+        Dqn_isize const TOTAL_BYTES = DQN_MEGABYTES(256);
 
+        Dqn_ArenaAllocator arena = Dqn_ArenaAllocator_InitWithNewAllocator(Dqn_Allocator_InitWithHeap(), 0, nullptr);
+        DQN_DEFER { Dqn_ArenaAllocator_Free(&arena); };
+        Dqn_u8 *buffer = Dqn_ArenaAllocator_NewArray(&arena, Dqn_u8, BUFFER_SIZE, Dqn_ZeroMem::No);
+        DQN_FOR_EACH(index, BUFFER_SIZE)
+            buffer[index] = DQN_CAST(Dqn_u8)((index * 2654435761u) >> 13);
+
+        // NOTE: 64 KiB stays in the cache, 64 MiB is bound by memory bandwidth
+        Dqn_isize const SIZES[] = {DQN_KILOBYTES(64), BUFFER_SIZE};
+        for (Dqn_isize size : SIZES)
         {
-            DQN_TEST_START_SCOPE(testing_state, "Convert \"1,2\"");
-            Dqn_u64 result = Dqn_Str_ToU64("1,2");
-            DQN_TEST_EXPECT_MSG(testing_state, result == 12, "result: %zu", result);
+            for (int checksum = 0; checksum < 3; checksum++)
+            {
+                if (checksum == 2 && Dqn_CRC32C_Path() != Dqn_CRC32CPath::SSE42)
+                    continue;
+
+                Dqn_u32   crc   = 0;
+                Dqn_Timer timer = Dqn_Timer_Begin();
+                DQN_FOR_EACH(repeat, TOTAL_BYTES / size)
+                {
+                    if (checksum == 0)      crc ^= Dqn_FNV1A32_Hash(buffer, size);
+                    else if (checksum == 1) crc ^= Dqn_CRC32C_IterateWithPath(buffer, size, 0, Dqn_CRC32CPath::Software);
+                    else                    crc ^= Dqn_CRC32C_IterateWithPath(buffer, size, 0, Dqn_CRC32CPath::SSE42);
+                }
+                Dqn_Timer_End(&timer);
+                dqn_test__benchmark_sink = crc;
+
+                char const *NAMES[] = {"Dqn_FNV1A32_Hash", "Dqn_CRC32C (slice-by-8)", "Dqn_CRC32C (SSE4.2)"};
+                char        name[128];
+                snprintf(name, sizeof(name), "%s (%lld KiB)", NAMES[checksum], (long long)(size / 1024));
+                Dqn_Test_PrintBenchmark(name, DQN_CAST(Dqn_f64)TOTAL_BYTES, "bytes", Dqn_Timer_Ms(timer));
+            }
         }
+        fprintf(stdout, "\n");
+    }
+
+    // ---------------------------------------------------------------------------------------------
+    // NOTE: Dqn_PoolAllocator
+    // ---------------------------------------------------------------------------------------------
+    {
+        fprintf(stdout, "Dqn_PoolAllocator Benchmarks\n");
+        Dqn_isize const LIVE_ALLOCATIONS = 4096;
+        Dqn_isize const ITERATIONS       = 4 * 1024 * 1024;
+        Dqn_isize const SLOT_SIZE        = 48;
+
+        Dqn_ArenaAllocator arena = Dqn_ArenaAllocator_InitWithNewAllocator(Dqn_Allocator_InitWithHeap(), 0, nullptr);
+        DQN_DEFER { Dqn_ArenaAllocator_Free(&arena); };
+        Dqn_PoolAllocator pool = Dqn_PoolAllocator_InitWithArena(&arena, SLOT_SIZE, 8, 1024);
 
+        void *live[LIVE_ALLOCATIONS] = {};
+        for (int use_pool = 0; use_pool <= 1; use_pool++)
         {
-            DQN_TEST_START_SCOPE(testing_state, "Convert \"12a3\"");
-            Dqn_u64 result = Dqn_Str_ToU64("12a3");
-            DQN_TEST_EXPECT_MSG(testing_state, result == 12, "result: %zu", result);
+            Dqn_Allocator allocator = use_pool ? Dqn_Allocator_InitWithPool(&pool) : Dqn_Allocator_InitWithHeap();
+            Dqn_Timer     timer     = Dqn_Timer_Begin();
+
+            // NOTE: Keep a working set of live allocations and replace one per iteration
+            DQN_FOR_EACH(index, ITERATIONS)
+            {
+                Dqn_isize slot = (index * 7919) % LIVE_ALLOCATIONS;
+                Dqn_Allocator_Free(&allocator, live[slot]);
+                live[slot] = Dqn_Allocator_Allocate(&allocator, SLOT_SIZE, 8, Dqn_ZeroMem::No);
+            }
+
+            DQN_FOR_EACH(index, LIVE_ALLOCATIONS)
+            {
+                Dqn_Allocator_Free(&allocator, live[index]);
+                live[index] = nullptr;
+            }
+
+            Dqn_Timer_End(&timer);
+            Dqn_Test_PrintBenchmark(use_pool ? "Allocate and free (pool)" : "Allocate and free (heap)",
+                                    DQN_CAST(Dqn_f64)ITERATIONS,
+                                    "allocs",
+                                    Dqn_Timer_Ms(timer));
         }
+        fprintf(stdout, "\n");
     }
 
     // ---------------------------------------------------------------------------------------------
-    // NOTE: Dqn_Str_Find
+    // NOTE: Dqn_SlabAllocator
     // ---------------------------------------------------------------------------------------------
     {
-        DQN_TEST_DECLARE_GROUP_SCOPED(testing_state, "Dqn_Str_Find");
+        fprintf(stdout, "Dqn_SlabAllocator Benchmarks\n");
+        Dqn_isize const LIVE_ALLOCATIONS = 4096;
+        Dqn_isize const ITERATIONS       = 4 * 1024 * 1024;
+        Dqn_isize const SIZES[]          = {8, 24, 16, 40, 12, 64, 32, 200, 96, 1000};
+
+        Dqn_SlabAllocator slab = {};
+        DQN_DEFER { Dqn_SlabAllocator_Release(&slab); };
+
+        void *live[LIVE_ALLOCATIONS] = {};
+        for (int use_slab = 0; use_slab <= 1; use_slab++)
         {
-            DQN_TEST_START_SCOPE(testing_state, "String (char) is not in buffer");
-            char const buf[]  = "836a35becd4e74b66a0d6844d51f1a63018c7ebc44cf7e109e8e4bba57eefb55";
-            char const find[] = "2";
-            char const *result = Dqn_Str_Find(buf, find, Dqn_CharCountI(buf), Dqn_CharCountI(find));
-            DQN_TEST_EXPECT(testing_state, result == nullptr);
+            Dqn_Allocator allocator = use_slab ? Dqn_Allocator_InitWithSlab(&slab) : Dqn_Allocator_InitWithHeap();
+            Dqn_Timer     timer     = Dqn_Timer_Begin();
+
+            // NOTE: Keep a working set of live allocations and replace one per iteration
+            DQN_FOR_EACH(index, ITERATIONS)
+            {
+                Dqn_isize slot = (index * 7919) % LIVE_ALLOCATIONS;
+                Dqn_Allocator_Free(&allocator, live[slot]);
+                live[slot] = Dqn_Allocator_Allocate(&allocator, SIZES[index % Dqn_ArrayCountI(SIZES)], 8, Dqn_ZeroMem::No);
+            }
+
+            DQN_FOR_EACH(index, LIVE_ALLOCATIONS)
+            {
+                Dqn_Allocator_Free(&allocator, live[index]);
+                live[index] = nullptr;
+            }
+
+            Dqn_Timer_End(&timer);
+            Dqn_Test_PrintBenchmark(use_slab ? "Allocate and free (slab)" : "Allocate and free (heap)",
+                                    DQN_CAST(Dqn_f64)ITERATIONS,
+                                    "allocs",
+                                    Dqn_Timer_Ms(timer));
         }
+        fprintf(stdout, "\n");
+    }
+
+    // ---------------------------------------------------------------------------------------------
+    // NOTE: Dqn_ThreadCacheAllocator
+    // ---------------------------------------------------------------------------------------------
+    {
+        fprintf(stdout, "Dqn_ThreadCacheAllocator Benchmarks\n");
+        int const MAX_THREADS           = DQN_M_MIN(Dqn_TestThread_ProcessorCount(), 16);
+        int const ITERATIONS_PER_THREAD = 1024 * 1024;
+
+        Dqn_SlabAllocator slab = {};
+        DQN_DEFER { Dqn_SlabAllocator_Release(&slab); };
+        Dqn_Allocator            slab_allocator = Dqn_Allocator_InitWithSlab(&slab);
+        Dqn_TicketMutex          slab_mutex     = {};
+        Dqn_ThreadCacheAllocator thread_cache   = Dqn_ThreadCacheAllocator_Init(&slab_allocator);
+        Dqn_Allocator            cached         = Dqn_Allocator_InitWithThreadCache(&thread_cache);
+        DQN_DEFER { Dqn_ThreadCacheAllocator_Release(&thread_cache); };
 
+        Dqn_TestThread                threads[16] = {};
+        Dqn_Test__LockedAllocatorWork work[16]    = {};
+        for (int thread_count = 1; thread_count <= MAX_THREADS; thread_count *= 2)
         {
-            DQN_TEST_START_SCOPE(testing_state, "String (char) is in buffer");
-            char const buf[]  = "836a35becd4e74b66a0d6844d51f1a63018c7ebc44cf7e109e8e4bba57eefb55";
-            char const find[] = "6";
-            char const *result = Dqn_Str_Find(buf, find, Dqn_CharCountI(buf), Dqn_CharCountI(find));
-            DQN_TEST_EXPECT(testing_state, result != nullptr);
-            DQN_TEST_EXPECT(testing_state, result[0] == '6' && result[1] == 'a');
+            for (int use_cache = 0; use_cache <= 1; use_cache++)
+            {
+                Dqn_Timer timer = Dqn_Timer_Begin();
+                DQN_FOR_EACH(thread_index, thread_count)
+                {
+                    work[thread_index]            = {};
+                    work[thread_index].mutex      = use_cache ? nullptr : &slab_mutex;
+                    work[thread_index].allocator  = use_cache ? &cached : &slab_allocator;
+                    work[thread_index].iterations = ITERATIONS_PER_THREAD;
+                    Dqn_TestThread_Start(threads + thread_index, Dqn_Test__LockedAllocatorBenchmarkThread, work + thread_index);
+                }
+
+                DQN_FOR_EACH(thread_index, thread_count)
+                    Dqn_TestThread_Join(threads + thread_index);
+                Dqn_Timer_End(&timer);
+
+                char name[64];
+                snprintf(name, sizeof(name), "Allocate and free (%s, %d thread%s)", use_cache ? "thread cache" : "locked slab", thread_count, thread_count == 1 ? "" : "s");
+                Dqn_Test_PrintBenchmark(name, DQN_CAST(Dqn_f64)(thread_count) * ITERATIONS_PER_THREAD, "allocs", Dqn_Timer_Ms(timer));
+            }
         }
+        fprintf(stdout, "\n");
     }
 
     // ---------------------------------------------------------------------------------------------
-    // NOTE: Dqn_M4
+    // NOTE: Dqn_ConcurrentArenaAllocator
     // ---------------------------------------------------------------------------------------------
     {
-        DQN_TEST_DECLARE_GROUP_SCOPED(testing_state, "Dqn_M4");
+        fprintf(stdout, "Dqn_ConcurrentArenaAllocator Benchmarks\n");
+        int const       MAX_THREADS            = DQN_M_MIN(Dqn_TestThread_ProcessorCount(), 16);
+        int const       ALLOCATIONS_PER_THREAD = 1024 * 1024;
+        Dqn_isize const ALLOCATION_SIZE        = 32;
+
+        Dqn_ConcurrentArenaAllocator arena = Dqn_ConcurrentArenaAllocator_InitWithNewAllocator(Dqn_Allocator_InitWithHeap(), DQN_MEGABYTES(1), nullptr);
+        arena.arena.min_block_size         = DQN_MEGABYTES(1);
+        DQN_DEFER { Dqn_ConcurrentArenaAllocator_Free(&arena); };
+
+        Dqn_TestThread                threads[16] = {};
+        Dqn_Test__ConcurrentArenaWork work[16]    = {};
+        for (int thread_count = 1; thread_count <= MAX_THREADS; thread_count *= 2)
         {
-            DQN_TEST_START_SCOPE(testing_state, "Simple translate and scale matrix");
-            Dqn_M4 translate = Dqn_M4_TranslateF(1, 2, 3);
-            Dqn_M4 scale     = Dqn_M4_ScaleF(2, 2, 2);
-            Dqn_M4 result    = Dqn_M4_Mul(translate, scale);
+            // NOTE: Warm the arena so that each pass allocates out of retained blocks
+            Dqn_ConcurrentArenaAllocator_ResetUsage(&arena, Dqn_ZeroMem::No);
+            Dqn_Timer timer = Dqn_Timer_Begin();
+            DQN_FOR_EACH(thread_index, thread_count)
+            {
+                work[thread_index]                     = {};
+                work[thread_index].arena               = &arena;
+                work[thread_index].allocation_count    = ALLOCATIONS_PER_THREAD;
+                work[thread_index].max_allocation_size = ALLOCATION_SIZE;
+                Dqn_TestThread_Start(threads + thread_index, Dqn_Test__ConcurrentArenaBenchmarkThread, work + thread_index);
+            }
 
-            const Dqn_M4 EXPECT = {{
-                {2, 0, 0, 0},
-                {0, 2, 0, 0},
-                {0, 0, 2, 0},
-                {1, 2, 3, 1},
-            }};
+            DQN_FOR_EACH(thread_index, thread_count)
+                Dqn_TestThread_Join(threads + thread_index);
+            Dqn_Timer_End(&timer);
 
-            DQN_TEST_EXPECT_MSG(testing_state,
-                                memcmp(result.columns, EXPECT.columns, sizeof(EXPECT)) == 0,
-                                "\nresult =\n%s\nexpected =\n%s",
-                                Dqn_M4_ColumnMajorString(result).str,
-                                Dqn_M4_ColumnMajorString(EXPECT).str);
+            char name[64];
+            snprintf(name, sizeof(name), "Allocate (%d thread%s)", thread_count, thread_count == 1 ? "" : "s");
+            Dqn_Test_PrintBenchmark(name, DQN_CAST(Dqn_f64)(thread_count) * ALLOCATIONS_PER_THREAD, "allocs", Dqn_Timer_Ms(timer));
         }
+        fprintf(stdout, "\n");
     }
 }
 
@@ -905,6 +4131,9 @@ int main(int argc, char *argv[])
 {
     (void)argv; (void)argc;
     Dqn_Test_UnitTests();
+#if defined(DQN_TEST_WITH_BENCHMARKS)
+    Dqn_Test_Benchmarks();
+#endif
     return 0;
 }
 #endif